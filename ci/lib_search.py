@@ -109,6 +109,7 @@ def check_dir(start_dir):
         'resnet_images.txt',
         "resnet_labels.txt",
         'rest_sdk_v2.10.16.patch',
+        'reuseport.patch',
         'summator.xml',
         'tf.patch',
         'tf_graph_info_multilinecomment.patch',
@@ -201,6 +202,7 @@ def check_func(start_dir):
         'ovms-c/dist',
         'requirements.txt',
         'rest_sdk_v2.10.16.patch',
+        'reuseport.patch',
         'summator.xml',
         'tf.patch',
         'tf_graph_info_multilinecomment.patch',
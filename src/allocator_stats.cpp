@@ -0,0 +1,203 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "allocator_stats.hpp"
+
+#include <stdexcept>
+#include <string>
+
+#if defined(OVMS_JEMALLOC)
+#include <jemalloc/jemalloc.h>
+#elif defined(OVMS_TCMALLOC)
+#include <gperftools/malloc_extension.h>
+#else
+#include <malloc.h>
+#endif
+
+#include "logging.hpp"
+#include "metric.hpp"
+#include "metric_config.hpp"
+#include "metric_family.hpp"
+#include "metric_registry.hpp"
+
+#if defined(OVMS_JEMALLOC)
+// Default jemalloc options, can be overridden with MALLOC_CONF environment variable.
+// Worker threads get thread caches and are spread over 4 arenas per CPU, background
+// thread returns unused dirty pages to the system instead of request threads.
+extern "C" {
+const char* malloc_conf = "background_thread:true,metadata_thp:auto,dirty_decay_ms:5000,muzzy_decay_ms:5000";
+}
+#endif
+
+namespace ovms {
+
+double AllocatorStats::getFragmentationRatio() const {
+    if (resident == 0 || allocated >= resident) {
+        return 0.0;
+    }
+    return 1.0 - static_cast<double>(allocated) / static_cast<double>(resident);
+}
+
+#if defined(OVMS_JEMALLOC)
+static bool readJemallocStat(const char* name, size_t& value) {
+    size_t size = sizeof(value);
+    return mallctl(name, &value, &size, nullptr, 0) == 0;
+}
+
+const char* getAllocatorName() {
+    return "jemalloc";
+}
+
+bool getAllocatorStats(AllocatorStats& stats) {
+    // statistics are cached by jemalloc until epoch is advanced
+    uint64_t epoch = 1;
+    size_t epochSize = sizeof(epoch);
+    if (mallctl("epoch", &epoch, &epochSize, &epoch, epochSize) != 0) {
+        return false;
+    }
+    return readJemallocStat("stats.allocated", stats.allocated) &&
+           readJemallocStat("stats.active", stats.active) &&
+           readJemallocStat("stats.resident", stats.resident);
+}
+
+void releaseFreeMemory() {
+    SPDLOG_TRACE("Purging jemalloc arenas");
+    const std::string purgeAllArenas = "arena." + std::to_string(MALLCTL_ARENAS_ALL) + ".purge";
+    mallctl(purgeAllArenas.c_str(), nullptr, nullptr, nullptr, 0);
+}
+#elif defined(OVMS_TCMALLOC)
+static bool readTcmallocStat(const char* name, size_t& value) {
+    return MallocExtension::instance()->GetNumericProperty(name, &value);
+}
+
+const char* getAllocatorName() {
+    return "tcmalloc";
+}
+
+bool getAllocatorStats(AllocatorStats& stats) {
+    size_t heapSize = 0;
+    size_t freeBytes = 0;
+    size_t unmappedBytes = 0;
+    if (!readTcmallocStat("generic.current_allocated_bytes", stats.allocated) ||
+        !readTcmallocStat("generic.heap_size", heapSize) ||
+        !readTcmallocStat("tcmalloc.pageheap_free_bytes", freeBytes) ||
+        !readTcmallocStat("tcmalloc.pageheap_unmapped_bytes", unmappedBytes)) {
+        return false;
+    }
+    stats.resident = heapSize - unmappedBytes;
+    stats.active = stats.resident - freeBytes;
+    return true;
+}
+
+void releaseFreeMemory() {
+    SPDLOG_TRACE("MallocExtension::ReleaseFreeMemory()");
+    MallocExtension::instance()->ReleaseFreeMemory();
+}
+#else
+const char* getAllocatorName() {
+    return "glibc";
+}
+
+bool getAllocatorStats(AllocatorStats& stats) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    struct mallinfo2 info = mallinfo2();
+#else
+    // values wrap above 4GB in older glibc versions
+    struct mallinfo info = mallinfo();
+#endif
+    stats.allocated = static_cast<size_t>(info.uordblks) + static_cast<size_t>(info.hblkhd);
+    stats.active = stats.allocated;
+    stats.resident = static_cast<size_t>(info.arena) + static_cast<size_t>(info.hblkhd);
+    return true;
+}
+
+void releaseFreeMemory() {
+    SPDLOG_TRACE("malloc_trim(0)");
+    malloc_trim(0);
+}
+#endif
+
+#define THROW_IF_NULL(VAR, MESSAGE)                        \
+    if (VAR == nullptr) {                                  \
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, MESSAGE); \
+        throw std::logic_error(MESSAGE);                   \
+    }
+
+AllocatorMetricReporter::~AllocatorMetricReporter() = default;
+
+AllocatorMetricReporter::AllocatorMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry) {
+    if (!registry) {
+        return;
+    }
+
+    if (!metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+
+    const std::string allocatorName = getAllocatorName();
+
+    std::string familyName = METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of bytes allocated by the application.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->allocatedBytes = family->addMetric({{"allocator", allocatorName}});
+        THROW_IF_NULL(this->allocatedBytes, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_ALLOCATOR_ACTIVE_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of bytes in active pages of the allocator.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->activeBytes = family->addMetric({{"allocator", allocatorName}});
+        THROW_IF_NULL(this->activeBytes, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_ALLOCATOR_RESIDENT_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of bytes of physical memory mapped by the allocator.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->residentBytes = family->addMetric({{"allocator", allocatorName}});
+        THROW_IF_NULL(this->residentBytes, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_ALLOCATOR_FRAGMENTATION;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Part of resident memory of the allocator not allocated by the application.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->fragmentationRatio = family->addMetric({{"allocator", allocatorName}});
+        THROW_IF_NULL(this->fragmentationRatio, "cannot create metric");
+    }
+}
+
+void AllocatorMetricReporter::update() {
+    if (!allocatedBytes && !activeBytes && !residentBytes && !fragmentationRatio) {
+        return;
+    }
+    std::unique_lock lock(mtx);
+    AllocatorStats stats;
+    if (!getAllocatorStats(stats)) {
+        SPDLOG_DEBUG("Reading {} statistics failed", getAllocatorName());
+        return;
+    }
+    SET_IF_ENABLED(this->allocatedBytes, stats.allocated);
+    SET_IF_ENABLED(this->activeBytes, stats.active);
+    SET_IF_ENABLED(this->residentBytes, stats.resident);
+    SET_IF_ENABLED(this->fragmentationRatio, stats.getFragmentationRatio());
+}
+}  // namespace ovms
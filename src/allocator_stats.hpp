@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace ovms {
+
+class MetricConfig;
+class MetricGauge;
+class MetricRegistry;
+
+/**
+ * @brief Memory usage reported by the allocator linked into the server.
+ * Selected at build time with --define MALLOC=jemalloc|tcmalloc, glibc malloc is used by default.
+ */
+struct AllocatorStats {
+    // bytes allocated by the application
+    size_t allocated = 0;
+    // bytes in pages used by the allocator for application allocations
+    size_t active = 0;
+    // bytes of physical memory mapped by the allocator
+    size_t resident = 0;
+
+    // part of resident memory which is not allocated by the application
+    double getFragmentationRatio() const;
+};
+
+const char* getAllocatorName();
+
+bool getAllocatorStats(AllocatorStats& stats);
+
+/**
+ * @brief Returns unused memory cached by the allocator to the system.
+ */
+void releaseFreeMemory();
+
+class AllocatorMetricReporter {
+    std::mutex mtx;
+
+public:
+    AllocatorMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry);
+    ~AllocatorMetricReporter();
+
+    /**
+     * @brief Refreshes gauges with current allocator statistics. Called before metrics collection.
+     */
+    void update();
+
+    std::unique_ptr<MetricGauge> allocatedBytes;
+    std::unique_ptr<MetricGauge> activeBytes;
+    std::unique_ptr<MetricGauge> residentBytes;
+    std::unique_ptr<MetricGauge> fragmentationRatio;
+};
+}  // namespace ovms
@@ -36,6 +36,14 @@ Buffer::Buffer(size_t byteSize, OVMS_BufferType bufferType, std::optional<uint32
     ownedCopy = std::make_unique<char[]>(byteSize);
 }
 
+Buffer::Buffer(const void* pptr, size_t byteSize, OVMS_BufferType bufferType, std::optional<uint32_t> bufferDeviceId, OVMS_InputBufferReleaseFn releaseFn, void* releaseUserData) :
+    ptr(pptr),
+    byteSize(byteSize),
+    bufferType(bufferType),
+    bufferDeviceId(bufferDeviceId),
+    releaseFn(releaseFn),
+    releaseUserData(releaseUserData) {}
+
 const void* Buffer::data() const {
     return (ptr != nullptr) ? ptr : ownedCopy.get();
 }
@@ -56,5 +64,13 @@ const std::optional<uint32_t>& Buffer::getDeviceId() const {
     return bufferDeviceId;
 }
 
-Buffer::~Buffer() = default;
+bool Buffer::hasReleaseCallback() const {
+    return releaseFn != nullptr;
+}
+
+Buffer::~Buffer() {
+    if (releaseFn != nullptr) {
+        releaseFn(ptr, releaseUserData);
+    }
+}
 }  // namespace ovms
@@ -26,16 +26,21 @@ class Buffer {
     OVMS_BufferType bufferType;
     std::optional<uint32_t> bufferDeviceId;
     std::unique_ptr<char[]> ownedCopy = nullptr;
+    OVMS_InputBufferReleaseFn releaseFn = nullptr;
+    void* releaseUserData = nullptr;
 
 public:
     Buffer(const void* ptr, size_t byteSize, OVMS_BufferType bufferType = OVMS_BUFFERTYPE_CPU, std::optional<uint32_t> bufferDeviceId = std::nullopt, bool createCopy = false);
     Buffer(size_t byteSize, OVMS_BufferType bufferType = OVMS_BUFFERTYPE_CPU, std::optional<uint32_t> bufferDeviceId = std::nullopt);
+    // does not copy the data, releaseFn is called with ptr and releaseUserData on destruction
+    Buffer(const void* ptr, size_t byteSize, OVMS_BufferType bufferType, std::optional<uint32_t> bufferDeviceId, OVMS_InputBufferReleaseFn releaseFn, void* releaseUserData);
     ~Buffer();
     const void* data() const;
     void* data();
     OVMS_BufferType getBufferType() const;
     const std::optional<uint32_t>& getDeviceId() const;
     size_t getByteSize() const;
+    bool hasReleaseCallback() const;
 };
 
 }  // namespace ovms
@@ -30,6 +30,7 @@
 #include "../dags/pipelinedefinitionstatus.hpp"
 #include "../dags/pipelinedefinitionunloadguard.hpp"
 #include "../execution_context.hpp"
+#include "../logging.hpp"
 #include "../version.hpp"
 #if (MEDIAPIPE_DISABLE == 0)
 #include "../mediapipe_internal/mediapipegraphdefinition.hpp"
@@ -44,6 +45,7 @@
 #include "../servablemanagermodule.hpp"
 #include "../server.hpp"
 #include "../status.hpp"
+#include "../systeminfo.hpp"
 #include "../timer.hpp"
 #include "buffer.hpp"
 #include "capi_utils.hpp"
@@ -202,6 +204,15 @@ DLL_PUBLIC OVMS_Status* OVMS_MetadataFieldByPointer(OVMS_Metadata* metadata, con
     if (!val) {
         return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::JSON_SERIALIZATION_ERROR, "value not found"));
     }
+    if (!val->IsString()) {
+        // numbers and objects are returned in their json representation
+        rapidjson::StringBuffer strbuf;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(strbuf);
+        val->Accept(writer);
+        *value = strdup(strbuf.GetString());
+        *size = strbuf.GetSize();
+        return nullptr;
+    }
     *value = strdup(val->GetString());
     *size = val->GetStringLength();
     return nullptr;
@@ -242,6 +253,16 @@ DLL_PUBLIC OVMS_Status* OVMS_ServerMetadata(OVMS_Server* server, OVMS_Metadata**
     doc->AddMember("name", PROJECT_NAME, doc->GetAllocator());
     doc->AddMember("version", PROJECT_VERSION, doc->GetAllocator());
     doc->AddMember("ov_version", OPENVINO_NAME, doc->GetAllocator());
+    const auto& topology = getCpuTopology();
+    rapidjson::Value cpuTopology(rapidjson::kObjectType);
+    cpuTopology.AddMember("available_cores", static_cast<unsigned>(topology.availableCores), doc->GetAllocator());
+    cpuTopology.AddMember("host_cores", static_cast<unsigned>(topology.hostCores), doc->GetAllocator());
+    cpuTopology.AddMember("affinity_cores", static_cast<unsigned>(topology.affinityCores), doc->GetAllocator());
+    if (topology.cgroupQuota) {
+        cpuTopology.AddMember("cgroup_quota", topology.cgroupQuota.value(), doc->GetAllocator());
+    }
+    cpuTopology.AddMember("numa_nodes", static_cast<unsigned>(topology.numaNodes), doc->GetAllocator());
+    doc->AddMember("cpu_topology", cpuTopology, doc->GetAllocator());
     *metadata = reinterpret_cast<OVMS_Metadata*>(doc);
     return nullptr;
 }
@@ -572,6 +593,38 @@ DLL_PUBLIC OVMS_Status* OVMS_InferenceRequestInputSetData(OVMS_InferenceRequest*
     return nullptr;
 }
 
+DLL_PUBLIC OVMS_Status* OVMS_InferenceRequestInputSetDataWithRelease(OVMS_InferenceRequest* req, const char* inputName, const void* data, size_t bufferSize, OVMS_BufferType bufferType, uint32_t deviceId, OVMS_InputBufferReleaseFn releaseFn, void* userData) {
+    if (req == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "inference request"));
+    }
+    if (inputName == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "input name"));
+    }
+    if (data == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "data"));
+    }
+    if (releaseFn == nullptr) {
+        return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "release function"));
+    }
+    InferenceRequest* request = reinterpret_cast<InferenceRequest*>(req);
+    auto status = request->setInputBuffer(inputName, data, bufferSize, bufferType, deviceId, releaseFn, userData);
+    if (!status.ok()) {
+        return reinterpret_cast<OVMS_Status*>(new Status(status));
+    }
+    if (spdlog::default_logger_raw()->level() == spdlog::level::trace) {
+        std::stringstream ss;
+        ss << "C-API setting request input data with release callback for servable: " << request->getServableName()
+           << " version: " << request->getServableVersion()
+           << " name: " << inputName
+           << " data: " << data
+           << " bufferSize: " << bufferSize
+           << " bufferType: " << bufferType
+           << " deviceId: " << deviceId;
+        SPDLOG_TRACE(ss.str());
+    }
+    return nullptr;
+}
+
 DLL_PUBLIC OVMS_Status* OVMS_InferenceRequestAddParameter(OVMS_InferenceRequest* req, const char* parameterName, OVMS_DataType datatype, const void* data, size_t byteSize) {
     if (req == nullptr) {
         return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "inference request"));
@@ -768,6 +821,18 @@ enum : unsigned int {
     TIMER_END
 };
 
+// returns input buffers set with release callback once inference using them is finished, on every exit path
+class InputBuffersReleaseGuard {
+    InferenceRequest& request;
+
+public:
+    InputBuffersReleaseGuard(InferenceRequest& request) :
+        request(request) {}
+    ~InputBuffersReleaseGuard() {
+        request.releaseInputBuffersWithCallback();
+    }
+};
+
 static Status getModelManager(Server& server, ModelManager** modelManager) {
     if (!server.isLive()) {
         return ovms::Status(ovms::StatusCode::SERVER_NOT_READY, "not live");
@@ -791,6 +856,20 @@ static Status getModelInstance(ovms::Server& server, const std::string& modelNam
     return modelManager->getModelInstance(modelName, modelVersion, modelInstance, modelInstanceUnloadGuardPtr);
 }
 
+static Status getModelInstance(ovms::Server& server, const InferenceRequest* request, std::shared_ptr<ovms::ModelInstance>& modelInstance,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
+    OVMS_PROFILE_FUNCTION();
+    ModelManager* modelManager{nullptr};
+    auto status = getModelManager(server, &modelManager);
+    if (!status.ok()) {
+        return status;
+    }
+    if (auto router = modelManager->findModelRouterByName(request->getServableName())) {
+        return router->route(*modelManager, request->getRequestShapes(), modelInstance, modelInstanceUnloadGuardPtr);
+    }
+    return modelManager->getModelInstance(request->getServableName(), request->getServableVersion(), modelInstance, modelInstanceUnloadGuardPtr);
+}
+
 static Status getPipeline(ovms::Server& server, const InferenceRequest* request,
     InferenceResponse* response,
     std::unique_ptr<ovms::Pipeline>& pipelinePtr) {
@@ -833,6 +912,8 @@ DLL_PUBLIC OVMS_Status* OVMS_Inference(OVMS_Server* serverPtr, OVMS_InferenceReq
         return reinterpret_cast<OVMS_Status*>(new Status(StatusCode::NONEXISTENT_PTR, "inference response"));
     }
     auto req = reinterpret_cast<ovms::InferenceRequest*>(request);
+    // declared first so that input buffers are returned to the application after pipeline and model instance are released
+    InputBuffersReleaseGuard inputBuffersReleaseGuard(*req);
     ovms::Server& server = *reinterpret_cast<ovms::Server*>(serverPtr);
 
     SPDLOG_DEBUG("Processing C-API inference request for servable: {}; version: {}",
@@ -843,7 +924,7 @@ DLL_PUBLIC OVMS_Status* OVMS_Inference(OVMS_Server* serverPtr, OVMS_InferenceReq
     std::unique_ptr<ovms::Pipeline> pipelinePtr;
 
     std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
-    auto status = getModelInstance(server, req->getServableName(), req->getServableVersion(), modelInstance, modelInstanceUnloadGuard);
+    auto status = getModelInstance(server, req, modelInstance, modelInstanceUnloadGuard);
 
     std::unique_ptr<ovms::InferenceResponse> res(new ovms::InferenceResponse(req->getServableName(), req->getServableVersion()));
     if (status == StatusCode::MODEL_NAME_MISSING) {
@@ -930,7 +1011,7 @@ DLL_PUBLIC OVMS_Status* OVMS_GetServableState(OVMS_Server* serverPtr, const char
         if (modelInstance) {
             //    INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().reqFailGrpcPredict);
         }
-        SPDLOG_INFO("Getting modelInstance or pipeline failed. {}", status.string());
+        OVMS_LOG_RATE_LIMITED(spdlog::default_logger_raw(), spdlog::level::info, "Getting modelInstance or pipeline failed. {}", status.string());
         return reinterpret_cast<OVMS_Status*>(new Status(status));
     }
     *state = modelInstance->getStatus().isFailedLoading() ? OVMS_STATE_LOADING_FAILED : static_cast<OVMS_ServableState>(static_cast<int>(modelInstance->getStatus().getState()) / 10 - 1);
@@ -972,7 +1053,7 @@ DLL_PUBLIC OVMS_Status* OVMS_GetServableMetadata(OVMS_Server* serverPtr, const c
         if (modelInstance) {
             //    INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().reqFailGrpcPredict);
         }
-        SPDLOG_INFO("Getting modelInstance or pipeline failed. {}", status.string());
+        OVMS_LOG_RATE_LIMITED(spdlog::default_logger_raw(), spdlog::level::info, "Getting modelInstance or pipeline failed. {}", status.string());
         return reinterpret_cast<OVMS_Status*>(new Status(status));
     }
     *servableMetadata = reinterpret_cast<OVMS_ServableMetadata*>(new ovms::ServableMetadata(servableName, servableVersion, modelInstance->getInputsInfo(), modelInstance->getOutputsInfo(), modelInstance->getRTInfo()));
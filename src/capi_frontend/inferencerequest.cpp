@@ -15,7 +15,10 @@
 //*****************************************************************************
 #include "inferencerequest.hpp"
 
+#include <memory>
+
 #include "../status.hpp"
+#include "buffer.hpp"
 
 namespace ovms {
 // this constructor can be removed with prediction tests overhaul
@@ -43,6 +46,17 @@ Status InferenceRequest::setInputBuffer(const char* name, const void* addr, size
     }
     return it->second.setBuffer(addr, byteSize, bufferType, deviceId);
 }
+Status InferenceRequest::setInputBuffer(const char* name, const void* addr, size_t byteSize, OVMS_BufferType bufferType, std::optional<uint32_t> deviceId, OVMS_InputBufferReleaseFn releaseFn, void* releaseUserData) {
+    auto it = inputs.find(name);
+    if (it == inputs.end()) {
+        return StatusCode::NONEXISTENT_TENSOR_FOR_SET_BUFFER;
+    }
+    // checked before creating buffer so that failed call does not trigger release callback
+    if (it->second.getBuffer() != nullptr) {
+        return StatusCode::DOUBLE_BUFFER_SET;
+    }
+    return it->second.setBuffer(std::make_unique<Buffer>(addr, byteSize, bufferType, deviceId, releaseFn, releaseUserData));
+}
 Status InferenceRequest::removeInputBuffer(const char* name) {
     auto it = inputs.find(name);
     if (it == inputs.end()) {
@@ -50,6 +64,14 @@ Status InferenceRequest::removeInputBuffer(const char* name) {
     }
     return it->second.removeBuffer();
 }
+void InferenceRequest::releaseInputBuffersWithCallback() {
+    for (auto& [name, tensor] : inputs) {
+        const Buffer* buffer = tensor.getBuffer();
+        if ((buffer != nullptr) && buffer->hasReleaseCallback()) {
+            tensor.removeBuffer();
+        }
+    }
+}
 Status InferenceRequest::removeAllInputs() {
     inputs.clear();
     return StatusCode::OK;
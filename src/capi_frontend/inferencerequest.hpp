@@ -44,7 +44,10 @@ public:
     Status removeAllInputs();
 
     Status setInputBuffer(const char* name, const void* addr, size_t byteSize, OVMS_BufferType, std::optional<uint32_t> deviceId);
+    Status setInputBuffer(const char* name, const void* addr, size_t byteSize, OVMS_BufferType, std::optional<uint32_t> deviceId, OVMS_InputBufferReleaseFn releaseFn, void* releaseUserData);
     Status removeInputBuffer(const char* name);
+    // removes input buffers set with release callback, returning them to the application
+    void releaseInputBuffersWithCallback();
     Status addParameter(const char* parameterName, OVMS_DataType datatype, const void* data);
     Status removeParameter(const char* parameterName);
     const InferenceParameter* getParameter(const char* name) const;
@@ -26,6 +26,7 @@ struct ServerSettingsImpl {
     uint32_t grpcWorkers = 1;
     std::string grpcBindAddress = "0.0.0.0";
     std::optional<uint32_t> restWorkers;
+    std::optional<uint32_t> restReactors;
     std::optional<uint32_t> grpcMaxThreads;
     std::string restBindAddress = "0.0.0.0";
     bool metricsEnabled = false;
@@ -33,15 +34,24 @@ struct ServerSettingsImpl {
     std::string cpuExtensionLibraryPath;
     std::string logLevel = "INFO";
     std::string logPath;
+    bool logAsync = false;
 #ifdef MTR_ENABLED
     std::string tracePath;
 #endif
     std::optional<size_t> grpcMemoryQuota;
     std::string grpcChannelArguments;
+    std::string grpcCompression;
+    uint32_t maxStreamGraphs = 0;
+    uint32_t streamResumeGracePeriodSeconds = 0;
+    bool systemSharedMemoryEnabled = false;
+    std::string systemSharedMemoryKeyPrefix = "ovms_";
     uint32_t filesystemPollWaitSeconds = 1;
     uint32_t sequenceCleanerPollWaitMinutes = 5;
     uint32_t resourcesCleanerPollWaitSeconds = 1;
+    uint32_t tensorMemoryPoolSizeMb = 256;
     std::string cacheDir;
+    std::string trafficCapturePath;
+    double trafficCaptureRatio = 1.0;
 };
 
 struct ModelsSettingsImpl {
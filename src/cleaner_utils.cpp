@@ -16,8 +16,7 @@
 
 #include "cleaner_utils.hpp"
 
-#include <malloc.h>
-
+#include "allocator_stats.hpp"
 #include "global_sequences_viewer.hpp"
 #include "logging.hpp"
 #include "modelmanager.hpp"
@@ -28,8 +27,7 @@ FunctorSequenceCleaner::FunctorSequenceCleaner(GlobalSequencesViewer& globalSequ
 
 void FunctorSequenceCleaner::cleanup() {
     globalSequencesViewer.removeIdleSequences();
-    SPDLOG_TRACE("malloc_trim(0)");
-    malloc_trim(0);
+    releaseFreeMemory();
 }
 
 FunctorSequenceCleaner::~FunctorSequenceCleaner() = default;
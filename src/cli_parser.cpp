@@ -68,12 +68,20 @@ void CLIParser::parse(int argc, char** argv) {
                 "Number of worker threads in REST server - has no effect if rest_port is not set. Default value depends on number of CPUs. ",
                 cxxopts::value<uint32_t>(),
                 "REST_WORKERS")
+            ("rest_reactors",
+                "Number of REST server event loops accepting connections on rest_port with SO_REUSEPORT, rest_workers are split between them. Has no effect if rest_port is not set. Default is 1 - single listener without SO_REUSEPORT.",
+                cxxopts::value<uint32_t>(),
+                "REST_REACTORS")
             ("log_level",
                 "serving log level - one of TRACE, DEBUG, INFO, WARNING, ERROR",
                 cxxopts::value<std::string>()->default_value("INFO"), "LOG_LEVEL")
             ("log_path",
                 "Optional path to the log file",
                 cxxopts::value<std::string>(), "LOG_PATH")
+            ("log_async",
+                "Flag enabling asynchronous logging. Messages are written to console and log file by background thread, the oldest messages are dropped when it does not keep up.",
+                cxxopts::value<bool>()->default_value("false"),
+                "LOG_ASYNC")
 #ifdef MTR_ENABLED
             ("trace_path",
                 "Path to the trace file",
@@ -82,6 +90,25 @@ void CLIParser::parse(int argc, char** argv) {
             ("grpc_channel_arguments",
                 "A comma separated list of arguments to be passed to the gRPC server. (e.g. grpc.max_connection_age_ms=2000)",
                 cxxopts::value<std::string>(), "GRPC_CHANNEL_ARGUMENTS")
+            ("grpc_compression",
+                "gRPC response compression negotiated with the client: none, deflate or gzip. Can be set per method as a comma separated list, e.g. gzip,ServerLive=none,ModelInfer=deflate",
+                cxxopts::value<std::string>(), "GRPC_COMPRESSION")
+            ("max_stream_graphs",
+                "Maximum number of MediaPipe graphs kept alive for ModelStreamInfer streams, including graphs of streams waiting to be resumed. New streams are rejected when the limit is reached. Default is 0 - no limit.",
+                cxxopts::value<uint32_t>()->default_value("0"),
+                "MAX_STREAM_GRAPHS")
+            ("stream_resume_grace_period_seconds",
+                "Time for which MediaPipe graph of ModelStreamInfer stream with OVMS_MP_STREAM_ID parameter is kept after the stream ends, so the client can reconnect and continue on it. Default is 0 - streams are not resumable.",
+                cxxopts::value<uint32_t>()->default_value("0"),
+                "STREAM_RESUME_GRACE_PERIOD_SECONDS")
+            ("system_shared_memory_enable",
+                "Flag enabling registration of system shared memory regions with KServe SystemSharedMemoryRegister API. Default is false.",
+                cxxopts::value<bool>()->default_value("false"),
+                "SYSTEM_SHARED_MEMORY_ENABLE")
+            ("system_shared_memory_key_prefix",
+                "Prefix required in keys of shared memory objects which can be registered. Default is ovms_.",
+                cxxopts::value<std::string>()->default_value("ovms_"),
+                "SYSTEM_SHARED_MEMORY_KEY_PREFIX")
             ("file_system_poll_wait_seconds",
                 "Time interval between config and model versions changes detection. Default is 1. Zero or negative value disables changes monitoring.",
                 cxxopts::value<uint32_t>()->default_value("1"),
@@ -94,6 +121,10 @@ void CLIParser::parse(int argc, char** argv) {
                 "Time interval between two consecutive resources cleanup scans. Default is 1. Must be greater than 0.",
                 cxxopts::value<uint32_t>()->default_value("1"),
                 "CUSTOM_NODE_RESOURCES_CLEANER_INTERVAL_SECONDS")
+            ("tensor_memory_pool_size_mb",
+                "Maximum size of unused buffers kept for reuse by tensors created on the server side, per model version and for gather nodes of all pipelines. Default is 256. Zero value disables the pools.",
+                cxxopts::value<uint32_t>()->default_value("256"),
+                "TENSOR_MEMORY_POOL_SIZE_MB")
             ("cache_dir",
                 "Overrides model cache directory. By default cache files are saved into /opt/cache if the directory is present. When enabled, first model load will produce cache files.",
                 cxxopts::value<std::string>(),
@@ -109,7 +140,15 @@ void CLIParser::parse(int argc, char** argv) {
             ("cpu_extension",
                 "A path to shared library containing custom CPU layer implementation. Default: empty.",
                 cxxopts::value<std::string>()->default_value(""),
-                "CPU_EXTENSION");
+                "CPU_EXTENSION")
+            ("traffic_capture_path",
+                "Path to the file where sampled inference requests are recorded for replay with benchmark app. Default: empty - capture is disabled.",
+                cxxopts::value<std::string>(),
+                "TRAFFIC_CAPTURE_PATH")
+            ("traffic_capture_ratio",
+                "Part of each servable inference requests recorded when traffic_capture_path is set, from 0 (exclusive) to 1. Default: 1 - all requests are recorded.",
+                cxxopts::value<double>()->default_value("1"),
+                "TRAFFIC_CAPTURE_RATIO");
 
         options->add_options("multi model")
             ("config_path",
@@ -227,6 +266,9 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
     if (result->count("rest_workers"))
         serverSettings->restWorkers = result->operator[]("rest_workers").as<uint32_t>();
 
+    if (result->count("rest_reactors"))
+        serverSettings->restReactors = result->operator[]("rest_reactors").as<uint32_t>();
+
     if (result->count("batch_size"))
         modelsSettings->batchSize = result->operator[]("batch_size").as<std::string>();
 
@@ -264,6 +306,7 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
         serverSettings->logLevel = result->operator[]("log_level").as<std::string>();
     if (result->count("log_path"))
         serverSettings->logPath = result->operator[]("log_path").as<std::string>();
+    serverSettings->logAsync = result->operator[]("log_async").as<bool>();
 
 #ifdef MTR_ENABLED
     if (result->count("trace_path"))
@@ -273,9 +316,22 @@ void CLIParser::prepare(ServerSettingsImpl* serverSettings, ModelsSettingsImpl*
     if (result->count("grpc_channel_arguments"))
         serverSettings->grpcChannelArguments = result->operator[]("grpc_channel_arguments").as<std::string>();
 
+    if (result->count("grpc_compression"))
+        serverSettings->grpcCompression = result->operator[]("grpc_compression").as<std::string>();
+
+    serverSettings->maxStreamGraphs = result->operator[]("max_stream_graphs").as<uint32_t>();
+    serverSettings->streamResumeGracePeriodSeconds = result->operator[]("stream_resume_grace_period_seconds").as<uint32_t>();
+    serverSettings->systemSharedMemoryEnabled = result->operator[]("system_shared_memory_enable").as<bool>();
+    serverSettings->systemSharedMemoryKeyPrefix = result->operator[]("system_shared_memory_key_prefix").as<std::string>();
+
     serverSettings->filesystemPollWaitSeconds = result->operator[]("file_system_poll_wait_seconds").as<uint32_t>();
     serverSettings->sequenceCleanerPollWaitMinutes = result->operator[]("sequence_cleaner_poll_wait_minutes").as<uint32_t>();
     serverSettings->resourcesCleanerPollWaitSeconds = result->operator[]("custom_node_resources_cleaner_interval_seconds").as<uint32_t>();
+    serverSettings->tensorMemoryPoolSizeMb = result->operator[]("tensor_memory_pool_size_mb").as<uint32_t>();
+
+    if (result->count("traffic_capture_path"))
+        serverSettings->trafficCapturePath = result->operator[]("traffic_capture_path").as<std::string>();
+    serverSettings->trafficCaptureRatio = result->operator[]("traffic_capture_ratio").as<double>();
 
     if (result != nullptr && result->count("cache_dir")) {
         serverSettings->cacheDir = result->operator[]("cache_dir").as<std::string>();
@@ -31,9 +31,12 @@
 namespace ovms {
 
 const uint AVAILABLE_CORES = getCoreCount();
+// limit of user provided values does not depend on quota so that settings valid on host are not rejected in containers
+const uint HOST_CORES = getCpuTopology().hostCores;
 const uint MAX_PORT_NUMBER = std::numeric_limits<ushort>::max();
 
 const uint64_t DEFAULT_REST_WORKERS = AVAILABLE_CORES * 4.0;
+const uint32_t DEFAULT_REST_REACTORS = 1;
 const uint32_t DEFAULT_GRPC_MAX_THREADS = AVAILABLE_CORES * 8.0;
 const size_t DEFAULT_GRPC_MEMORY_QUOTA = (size_t)2 * 1024 * 1024 * 1024;  // 2GB
 const uint64_t MAX_REST_WORKERS = 10'000;
@@ -96,8 +99,8 @@ bool Config::validate() {
     }
 
     // check grpc_workers value
-    if (((grpcWorkers() > AVAILABLE_CORES) || (grpcWorkers() < 1))) {
-        std::cerr << "grpc_workers count should be from 1 to CPU core count : " << AVAILABLE_CORES << std::endl;
+    if (((grpcWorkers() > HOST_CORES) || (grpcWorkers() < 1))) {
+        std::cerr << "grpc_workers count should be from 1 to CPU core count : " << HOST_CORES << std::endl;
         return false;
     }
 
@@ -112,6 +115,17 @@ bool Config::validate() {
         return false;
     }
 
+    // each reactor needs thread for event loop and at least one worker
+    if ((restReactors() < 1) || (restReactors() > restWorkers() / 2)) {
+        std::cerr << "rest_reactors count should be from 1 to half of rest_workers: " << restWorkers() / 2 << std::endl;
+        return false;
+    }
+
+    if (this->serverSettings.restReactors.has_value() && restPort() == 0) {
+        std::cerr << "rest_reactors is set but rest_port is not set. rest_port is required to start rest servers" << std::endl;
+        return false;
+    }
+
     if (port() && (port() > MAX_PORT_NUMBER)) {
         std::cerr << "port number out of range from 0 to " << MAX_PORT_NUMBER << std::endl;
         return false;
@@ -167,6 +181,16 @@ bool Config::validate() {
         std::cerr << "Setting low_latency_transformation, max_sequence_number and idle_sequence_cleanup require setting stateful flag for the model." << std::endl;
         return false;
     }
+    // check traffic capture ratio
+    if (trafficCaptureRatio() <= 0 || trafficCaptureRatio() > 1) {
+        std::cerr << "traffic_capture_ratio should be greater than 0 and not greater than 1" << std::endl;
+        return false;
+    }
+    // check shared memory key prefix
+    if (systemSharedMemoryEnabled() && systemSharedMemoryKeyPrefix().find_first_not_of('/') == std::string::npos) {
+        std::cerr << "system_shared_memory_key_prefix cannot be empty when system_shared_memory_enable is set" << std::endl;
+        return false;
+    }
     return true;
 }
 
@@ -180,6 +204,7 @@ uint32_t Config::grpcWorkers() const { return this->serverSettings.grpcWorkers;
 uint32_t Config::grpcMaxThreads() const { return this->serverSettings.grpcMaxThreads.value_or(DEFAULT_GRPC_MAX_THREADS); }
 size_t Config::grpcMemoryQuota() const { return this->serverSettings.grpcMemoryQuota.value_or(DEFAULT_GRPC_MEMORY_QUOTA); }
 uint32_t Config::restWorkers() const { return this->serverSettings.restWorkers.value_or(DEFAULT_REST_WORKERS); }
+uint32_t Config::restReactors() const { return this->serverSettings.restReactors.value_or(DEFAULT_REST_REACTORS); }
 const std::string& Config::modelName() const { return this->modelsSettings.modelName; }
 const std::string& Config::modelPath() const { return this->modelsSettings.modelPath; }
 const std::string& Config::batchSize() const {
@@ -203,13 +228,22 @@ uint32_t Config::maxSequenceNumber() const { return this->modelsSettings.maxSequ
 bool Config::lowLatencyTransformation() const { return this->modelsSettings.lowLatencyTransformation.value_or(false); }
 const std::string& Config::logLevel() const { return this->serverSettings.logLevel; }
 const std::string& Config::logPath() const { return this->serverSettings.logPath; }
+bool Config::logAsync() const { return this->serverSettings.logAsync; }
 #ifdef MTR_ENABLED
 const std::string& Config::tracePath() const { return this->serverSettings.tracePath; }
 #endif
 const std::string& Config::grpcChannelArguments() const { return this->serverSettings.grpcChannelArguments; }
+const std::string& Config::grpcCompression() const { return this->serverSettings.grpcCompression; }
+uint32_t Config::maxStreamGraphs() const { return this->serverSettings.maxStreamGraphs; }
+uint32_t Config::streamResumeGracePeriodSeconds() const { return this->serverSettings.streamResumeGracePeriodSeconds; }
+bool Config::systemSharedMemoryEnabled() const { return this->serverSettings.systemSharedMemoryEnabled; }
+const std::string& Config::systemSharedMemoryKeyPrefix() const { return this->serverSettings.systemSharedMemoryKeyPrefix; }
 uint32_t Config::filesystemPollWaitSeconds() const { return this->serverSettings.filesystemPollWaitSeconds; }
 uint32_t Config::sequenceCleanerPollWaitMinutes() const { return this->serverSettings.sequenceCleanerPollWaitMinutes; }
 uint32_t Config::resourcesCleanerPollWaitSeconds() const { return this->serverSettings.resourcesCleanerPollWaitSeconds; }
+uint32_t Config::tensorMemoryPoolSizeMb() const { return this->serverSettings.tensorMemoryPoolSizeMb; }
 const std::string Config::cacheDir() const { return this->serverSettings.cacheDir; }
+const std::string& Config::trafficCapturePath() const { return this->serverSettings.trafficCapturePath; }
+double Config::trafficCaptureRatio() const { return this->serverSettings.trafficCaptureRatio; }
 
 }  // namespace ovms
@@ -150,6 +150,13 @@ public:
          */
     uint32_t restWorkers() const;
 
+    /**
+         * @brief Gets the number of REST server reactors
+         * 
+         * @return uint32_t
+         */
+    uint32_t restReactors() const;
+
     /**
          * @brief Get the model name
          * 
@@ -269,6 +276,13 @@ public:
         */
     const std::string& logPath() const;
 
+    /**
+     * @brief Get the asynchronous logging flag
+     *
+     * @return bool
+     */
+    bool logAsync() const;
+
 #ifdef MTR_ENABLED
     /**
         * @brief Get the log path
@@ -285,6 +299,41 @@ public:
         */
     const std::string& grpcChannelArguments() const;
 
+    /**
+     * @brief Get the gRPC response compression policy
+     *
+     * @return const std::string&
+     */
+    const std::string& grpcCompression() const;
+
+    /**
+     * @brief Get the maximum number of live streaming graphs
+     *
+     * @return uint32_t
+     */
+    uint32_t maxStreamGraphs() const;
+
+    /**
+     * @brief Get the time for which graph of ended stream waits for client to resume it
+     *
+     * @return uint32_t
+     */
+    uint32_t streamResumeGracePeriodSeconds() const;
+
+    /**
+     * @brief Get flag enabling registration of system shared memory regions
+     *
+     * @return bool
+     */
+    bool systemSharedMemoryEnabled() const;
+
+    /**
+     * @brief Get the prefix required in keys of registered shared memory objects
+     *
+     * @return const std::string&
+     */
+    const std::string& systemSharedMemoryKeyPrefix() const;
+
     /**
      * @brief Get the filesystem poll wait time in seconds
      * 
@@ -306,11 +355,32 @@ public:
      */
     uint32_t resourcesCleanerPollWaitSeconds() const;
 
+    /**
+     * @brief Get the maximum size of unused buffers kept by tensor memory pools in megabytes, 0 disables pools
+     * 
+     * @return uint32_t
+     */
+    uint32_t tensorMemoryPoolSizeMb() const;
+
     /**
          * @brief Model cache directory
          * 
          * @return const std::string& 
          */
     const std::string cacheDir() const;
+
+    /**
+     * @brief Get the path of traffic capture file
+     *
+     * @return const std::string&
+     */
+    const std::string& trafficCapturePath() const;
+
+    /**
+     * @brief Get the part of inference requests recorded in traffic capture
+     *
+     * @return double
+     */
+    double trafficCaptureRatio() const;
 };
 }  // namespace ovms
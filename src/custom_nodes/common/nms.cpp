@@ -0,0 +1,416 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "nms.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace ovms {
+namespace custom_nodes_common {
+
+void Boxes::reserve(size_t count) {
+    x1.reserve(count);
+    y1.reserve(count);
+    x2.reserve(count);
+    y2.reserve(count);
+    scores.reserve(count);
+}
+
+void Boxes::clear() {
+    x1.clear();
+    y1.clear();
+    x2.clear();
+    y2.clear();
+    scores.clear();
+}
+
+void Boxes::push_back(float x1, float y1, float x2, float y2, float score) {
+    this->x1.push_back(x1);
+    this->y1.push_back(y1);
+    this->x2.push_back(x2);
+    this->y2.push_back(y2);
+    this->scores.push_back(score);
+}
+
+namespace {
+constexpr size_t SIMD_WIDTH = 8;
+constexpr int32_t SUPPRESSED = -1;
+
+// Boxes copied in order of descending score, padded to SIMD_WIDTH with already suppressed entries
+struct SortedBoxes {
+    std::vector<size_t> order;
+    std::vector<float> x1, y1, x2, y2, areas, scores;
+    std::vector<int32_t> suppressed;
+
+    SortedBoxes(const Boxes& boxes) {
+        const size_t count = boxes.size();
+        order.resize(count);
+        std::iota(order.begin(), order.end(), 0);
+        // ties are resolved same as in multimap based nms2 - later box goes first
+        std::sort(order.begin(), order.end(), [&boxes](size_t a, size_t b) {
+            return boxes.scores[a] > boxes.scores[b] || (boxes.scores[a] == boxes.scores[b] && a > b);
+        });
+        const size_t padded = (count + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+        for (auto* v : {&x1, &y1, &x2, &y2, &areas, &scores}) {
+            v->resize(padded, 0.f);
+        }
+        suppressed.resize(padded, SUPPRESSED);
+        for (size_t i = 0; i < count; ++i) {
+            const size_t src = order[i];
+            x1[i] = boxes.x1[src];
+            y1[i] = boxes.y1[src];
+            x2[i] = boxes.x2[src];
+            y2[i] = boxes.y2[src];
+            areas[i] = (x2[i] - x1[i]) * (y2[i] - y1[i]);
+            scores[i] = boxes.scores[src];
+            suppressed[i] = 0;
+        }
+    }
+};
+
+struct SuppressionResult {
+    int neighbors = 0;
+    float scoresSum = 0.f;
+};
+
+inline bool overlaps(const SortedBoxes& b, size_t i, size_t j, float threshold) {
+    const float intersectionWidth = std::max(0.f, std::min(b.x2[i], b.x2[j]) - std::max(b.x1[i], b.x1[j]));
+    const float intersectionHeight = std::max(0.f, std::min(b.y2[i], b.y2[j]) - std::max(b.y1[i], b.y1[j]));
+    const float intersectionArea = intersectionWidth * intersectionHeight;
+    const float unionArea = b.areas[i] + b.areas[j] - intersectionArea;
+    return intersectionArea / unionArea > threshold;
+}
+
+// Suppresses boxes [begin, end) overlapping box i
+void suppressScalar(SortedBoxes& b, size_t i, size_t begin, size_t end, float threshold, SuppressionResult& result) {
+    for (size_t j = begin; j < end; ++j) {
+        if (b.suppressed[j] == 0 && overlaps(b, i, j, threshold)) {
+            b.suppressed[j] = SUPPRESSED;
+            ++result.neighbors;
+            result.scoresSum += b.scores[j];
+        }
+    }
+}
+
+#if defined(__x86_64__)
+// begin has to be multiple of SIMD_WIDTH, end is rounded up to padded size
+__attribute__((target("avx2,popcnt"))) void suppressAvx2(SortedBoxes& b, size_t i, size_t begin, size_t end, float threshold, SuppressionResult& result) {
+    const __m256 x1 = _mm256_set1_ps(b.x1[i]);
+    const __m256 y1 = _mm256_set1_ps(b.y1[i]);
+    const __m256 x2 = _mm256_set1_ps(b.x2[i]);
+    const __m256 y2 = _mm256_set1_ps(b.y2[i]);
+    const __m256 area = _mm256_set1_ps(b.areas[i]);
+    const __m256 thresholdV = _mm256_set1_ps(threshold);
+    const __m256 zero = _mm256_setzero_ps();
+    __m256 scoresSum = _mm256_setzero_ps();
+    for (size_t j = begin; j < end; j += SIMD_WIDTH) {
+        const __m256 intersectionWidth = _mm256_max_ps(zero,
+            _mm256_sub_ps(_mm256_min_ps(x2, _mm256_loadu_ps(&b.x2[j])), _mm256_max_ps(x1, _mm256_loadu_ps(&b.x1[j]))));
+        const __m256 intersectionHeight = _mm256_max_ps(zero,
+            _mm256_sub_ps(_mm256_min_ps(y2, _mm256_loadu_ps(&b.y2[j])), _mm256_max_ps(y1, _mm256_loadu_ps(&b.y1[j]))));
+        const __m256 intersectionArea = _mm256_mul_ps(intersectionWidth, intersectionHeight);
+        const __m256 unionArea = _mm256_sub_ps(_mm256_add_ps(area, _mm256_loadu_ps(&b.areas[j])), intersectionArea);
+        const __m256 overlapping = _mm256_cmp_ps(_mm256_div_ps(intersectionArea, unionArea), thresholdV, _CMP_GT_OQ);
+        const __m256 suppressed = _mm256_castsi256_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&b.suppressed[j])));
+        const __m256 newlySuppressed = _mm256_andnot_ps(suppressed, overlapping);
+        const int mask = _mm256_movemask_ps(newlySuppressed);
+        if (mask == 0) {
+            continue;
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(&b.suppressed[j]), _mm256_castps_si256(_mm256_or_ps(suppressed, newlySuppressed)));
+        result.neighbors += _mm_popcnt_u32(mask);
+        scoresSum = _mm256_add_ps(scoresSum, _mm256_and_ps(newlySuppressed, _mm256_loadu_ps(&b.scores[j])));
+    }
+    alignas(32) float sums[SIMD_WIDTH];
+    _mm256_store_ps(sums, scoresSum);
+    for (float sum : sums) {
+        result.scoresSum += sum;
+    }
+}
+
+bool hasAvx2() {
+    static const bool supported = []() {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+    }();
+    return supported;
+}
+#endif
+
+void suppress(SortedBoxes& b, size_t i, float threshold, SuppressionResult& result) {
+    const size_t count = b.order.size();
+    const size_t begin = i + 1;
+#if defined(__x86_64__)
+    if (hasAvx2()) {
+        const size_t alignedBegin = (begin + SIMD_WIDTH - 1) / SIMD_WIDTH * SIMD_WIDTH;
+        suppressScalar(b, i, begin, std::min(alignedBegin, count), threshold, result);
+        suppressAvx2(b, i, alignedBegin, b.suppressed.size(), threshold, result);
+        return;
+    }
+#endif
+    suppressScalar(b, i, begin, count, threshold, result);
+}
+
+// Each box is registered in every cell it covers. Boxes with positive intersection cover at least
+// one common cell, so only boxes from cells covered by kept box need to be compared.
+class Grid {
+    float originX, originY, cellSize;
+    size_t cols, rows;
+    std::vector<size_t> cellBegin;
+    std::vector<size_t> entries;  // indices of sorted boxes, ascending within each cell
+
+public:
+    explicit Grid(const SortedBoxes& b) {
+        const size_t count = b.order.size();
+        float minX = std::numeric_limits<float>::max(), minY = minX;
+        float maxX = std::numeric_limits<float>::lowest(), maxY = maxX;
+        double sizesSum = 0;
+        for (size_t i = 0; i < count; ++i) {
+            minX = std::min(minX, std::min(b.x1[i], b.x2[i]));
+            minY = std::min(minY, std::min(b.y1[i], b.y2[i]));
+            maxX = std::max(maxX, std::max(b.x1[i], b.x2[i]));
+            maxY = std::max(maxY, std::max(b.y1[i], b.y2[i]));
+            sizesSum += std::max(std::abs(b.x2[i] - b.x1[i]), std::abs(b.y2[i] - b.y1[i]));
+        }
+        originX = minX;
+        originY = minY;
+        if (!std::isfinite(maxX - minX) || !std::isfinite(maxY - minY)) {
+            // single cell holding all boxes
+            maxX = minX = maxY = minY = 0;
+            originX = originY = 0;
+        }
+        cellSize = std::max(1.f, static_cast<float>(sizesSum / count));
+        if (!std::isfinite(cellSize)) {
+            cellSize = std::numeric_limits<float>::max();
+        }
+        // keep number of cells proportional to number of boxes
+        while (((maxX - minX) / cellSize + 1) * ((maxY - minY) / cellSize + 1) > 4.f * count) {
+            cellSize *= 2;
+        }
+        cols = static_cast<size_t>((maxX - minX) / cellSize) + 1;
+        rows = static_cast<size_t>((maxY - minY) / cellSize) + 1;
+
+        cellBegin.assign(cols * rows + 1, 0);
+        for (size_t i = 0; i < count; ++i) {
+            forEachCell(b, i, [this](size_t cell) { ++cellBegin[cell + 1]; });
+        }
+        std::partial_sum(cellBegin.begin(), cellBegin.end(), cellBegin.begin());
+        entries.resize(cellBegin.back());
+        std::vector<size_t> fill(cellBegin.begin(), cellBegin.end() - 1);
+        for (size_t i = 0; i < count; ++i) {
+            forEachCell(b, i, [&](size_t cell) { entries[fill[cell]++] = i; });
+        }
+    }
+
+    template <typename Func>
+    void forEachCell(const SortedBoxes& b, size_t i, const Func& func) const {
+        const size_t col1 = toCell(std::min(b.x1[i], b.x2[i]) - originX, cols);
+        const size_t col2 = toCell(std::max(b.x1[i], b.x2[i]) - originX, cols);
+        const size_t row1 = toCell(std::min(b.y1[i], b.y2[i]) - originY, rows);
+        const size_t row2 = toCell(std::max(b.y1[i], b.y2[i]) - originY, rows);
+        for (size_t row = row1; row <= row2; ++row) {
+            for (size_t col = col1; col <= col2; ++col) {
+                func(row * cols + col);
+            }
+        }
+    }
+
+    const size_t* cellEntriesBegin(size_t cell) const { return entries.data() + cellBegin[cell]; }
+    const size_t* cellEntriesEnd(size_t cell) const { return entries.data() + cellBegin[cell + 1]; }
+
+private:
+    size_t toCell(float offset, size_t limit) const {
+        return std::min(limit - 1, static_cast<size_t>(std::max(0.f, offset / cellSize)));
+    }
+};
+
+void suppressInGrid(SortedBoxes& b, const Grid& grid, std::vector<size_t>& visitedBy, size_t i, float threshold, SuppressionResult& result) {
+    grid.forEachCell(b, i, [&](size_t cell) {
+        const size_t* end = grid.cellEntriesEnd(cell);
+        for (const size_t* it = std::upper_bound(grid.cellEntriesBegin(cell), end, i); it != end; ++it) {
+            const size_t j = *it;
+            if (visitedBy[j] == i) {
+                continue;
+            }
+            visitedBy[j] = i;
+            if (b.suppressed[j] == 0 && overlaps(b, i, j, threshold)) {
+                b.suppressed[j] = SUPPRESSED;
+                ++result.neighbors;
+                result.scoresSum += b.scores[j];
+            }
+        }
+    });
+}
+}  // namespace
+
+std::vector<size_t> nms(const Boxes& boxes, const NmsParameters& parameters) {
+    std::vector<size_t> kept;
+    const size_t count = boxes.size();
+    if (count == 0) {
+        return kept;
+    }
+    SortedBoxes sorted(boxes);
+    // with negative threshold also not intersecting boxes are suppressed, grid cannot be used
+    const bool useGrid = parameters.gridBucketingMinBoxes > 0 && count >= parameters.gridBucketingMinBoxes && parameters.iouThreshold >= 0;
+    std::unique_ptr<Grid> grid;
+    std::vector<size_t> visitedBy;
+    if (useGrid) {
+        grid = std::make_unique<Grid>(sorted);
+        visitedBy.assign(count, std::numeric_limits<size_t>::max());
+    }
+    for (size_t i = 0; i < count && kept.size() < parameters.maxOutputBoxes; ++i) {
+        if (sorted.suppressed[i] != 0) {
+            continue;
+        }
+        sorted.suppressed[i] = SUPPRESSED;
+        SuppressionResult result;
+        if (useGrid) {
+            suppressInGrid(sorted, *grid, visitedBy, i, parameters.iouThreshold, result);
+        } else {
+            suppress(sorted, i, parameters.iouThreshold, result);
+        }
+        if (result.neighbors >= parameters.minNeighbors && sorted.scores[i] + result.scoresSum >= parameters.minScoresSum) {
+            kept.push_back(sorted.order[i]);
+        }
+    }
+    return kept;
+}
+
+std::vector<size_t> decodeDetectionOutput(const float* data, size_t detectionsCount, size_t featuresCount,
+    int imageWidth, int imageHeight, float confidenceThreshold, int labelId, Boxes& boxes) {
+    std::vector<size_t> indices;
+    // first pass touches only 3 leading values of each row
+    for (size_t i = 0; i < detectionsCount; ++i) {
+        const float* detection = data + i * featuresCount;
+        if (static_cast<int>(detection[0]) == 0 && detection[2] >= confidenceThreshold &&
+            (labelId == -1 || static_cast<int>(detection[1]) == labelId)) {
+            indices.push_back(i);
+        }
+    }
+    const size_t offset = boxes.size();
+    const size_t accepted = indices.size();
+    for (auto* v : {&boxes.x1, &boxes.y1, &boxes.x2, &boxes.y2, &boxes.scores}) {
+        v->resize(offset + accepted);
+    }
+    float* x1 = boxes.x1.data() + offset;
+    float* y1 = boxes.y1.data() + offset;
+    float* x2 = boxes.x2.data() + offset;
+    float* y2 = boxes.y2.data() + offset;
+    float* scores = boxes.scores.data() + offset;
+    for (size_t i = 0; i < accepted; ++i) {
+        const float* detection = data + indices[i] * featuresCount;
+        // truncation to integer pixel coordinates the same as in cv::Point construction
+        const float xMin = static_cast<int>(detection[3] * imageWidth);
+        const float yMin = static_cast<int>(detection[4] * imageHeight);
+        const float xMax = static_cast<int>(detection[5] * imageWidth);
+        const float yMax = static_cast<int>(detection[6] * imageHeight);
+        x1[i] = std::min(xMin, xMax);
+        y1[i] = std::min(yMin, yMax);
+        x2[i] = std::max(xMin, xMax);
+        y2[i] = std::max(yMin, yMax);
+        scores[i] = detection[2];
+    }
+    return indices;
+}
+
+std::vector<size_t> decodeCornerBoxes(const float* data, size_t count, size_t featuresCount, float confidenceThreshold, Boxes& boxes) {
+    std::vector<size_t> indices;
+    for (size_t i = 0; i < count; ++i) {
+        const float* box = data + i * featuresCount;
+        if (box[4] >= confidenceThreshold) {
+            indices.push_back(i);
+        }
+    }
+    boxes.reserve(boxes.size() + indices.size());
+    for (size_t index : indices) {
+        const float* box = data + index * featuresCount;
+        boxes.push_back(box[0], box[1], box[2], box[3], box[4]);
+    }
+    return indices;
+}
+
+bool decodeEastBoxes(const float* scores, const float* geometry, int rows, int cols,
+    const EastDecodeParameters& parameters, Boxes& boxes, RotatedBoxes& rotatedBoxes) {
+    // Gather positions above threshold first, score map is mostly below threshold
+    std::vector<int> candidates;
+    for (int position = 0; position < rows * cols; ++position) {
+        if (scores[position] >= parameters.confidenceThreshold) {
+            candidates.push_back(position);
+        }
+    }
+    const size_t count = candidates.size();
+    std::vector<float> cosines(count), sines(count);
+    for (size_t i = 0; i < count; ++i) {
+        const float angle = geometry[candidates[i] * 5 + 4];
+        cosines[i] = std::cos(angle);
+        sines[i] = std::sin(angle);
+    }
+
+    boxes.reserve(boxes.size() + count);
+    rotatedBoxes.angles.reserve(rotatedBoxes.angles.size() + count);
+    rotatedBoxes.widths.reserve(rotatedBoxes.widths.size() + count);
+    rotatedBoxes.heights.reserve(rotatedBoxes.heights.size() + count);
+    for (size_t i = 0; i < count; ++i) {
+        const int position = candidates[i];
+        const float* g = geometry + position * 5;
+        const float cos = cosines[i];
+        const float sin = sines[i];
+        // feature maps are 4x smaller than the input image
+        const int offsetX = (position % cols) * 4;
+        const int offsetY = (position / cols) * 4;
+
+        const float h = g[0] + g[2];
+        const float w = g[1] + g[3];
+
+        const int p2x = offsetX + static_cast<int>(cos * g[1] + sin * g[2]);
+        const int p2y = offsetY + static_cast<int>(-sin * g[1] + cos * g[2]);
+        const int p1x = static_cast<int>(-sin * h) + p2x;
+        const int p1y = static_cast<int>(-cos * h) + p2y;
+        const int p3x = static_cast<int>(-cos * w) + p2x;
+        const int p3y = static_cast<int>(sin * w) + p2y;
+        const int p4x = p3x + p1x - p2x;
+        const int p4y = p3y + p1y - p2y;
+
+        int x1 = std::min(std::min(p1x, p2x), std::min(p3x, p4x));
+        int x2 = std::max(std::max(p1x, p2x), std::max(p3x, p4x));
+        int y1 = std::min(std::min(p1y, p2y), std::min(p3y, p4y));
+        int y2 = std::max(std::max(p1y, p2y), std::max(p3y, p4y));
+
+        x1 = std::max(0, static_cast<int>(x1 - (x2 - x1) * parameters.boxWidthAdjustment));
+        x2 = std::min(parameters.imageWidth, static_cast<int>(x2 + (x2 - x1) * parameters.boxWidthAdjustment));
+        y1 = std::max(0, static_cast<int>(y1 - (y2 - y1) * parameters.boxHeightAdjustment));
+        y2 = std::min(parameters.imageHeight, static_cast<int>(y2 + (y2 - y1) * parameters.boxHeightAdjustment));
+        if (x2 <= x1 || y2 <= y1) {
+            return false;
+        }
+
+        boxes.push_back(x1, y1, x2, y2, scores[position]);
+        rotatedBoxes.angles.push_back(g[4]);
+        rotatedBoxes.widths.push_back(w * (1.0f + parameters.boxWidthAdjustment));
+        rotatedBoxes.heights.push_back(h * (1.0f + parameters.boxHeightAdjustment));
+    }
+    return true;
+}
+
+}  // namespace custom_nodes_common
+}  // namespace ovms
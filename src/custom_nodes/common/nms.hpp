@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace ovms {
+namespace custom_nodes_common {
+
+/**
+ * @brief Axis aligned boxes in pixel coordinates kept in structure of arrays layout,
+ * so that one box can be compared against many others with SIMD instructions.
+ * Bottom right corner (x2, y2) is exclusive, same as cv::Rect::br().
+ */
+struct Boxes {
+    std::vector<float> x1;
+    std::vector<float> y1;
+    std::vector<float> x2;
+    std::vector<float> y2;
+    std::vector<float> scores;
+
+    size_t size() const { return scores.size(); }
+    void reserve(size_t count);
+    void clear();
+    void push_back(float x1, float y1, float x2, float y2, float score);
+};
+
+struct NmsParameters {
+    // boxes overlapping kept box with intersection over union larger than threshold are suppressed
+    float iouThreshold = 0.5f;
+    // box is kept only if it suppressed at least that many boxes
+    int minNeighbors = 0;
+    // box is kept only if sum of its score and scores of boxes it suppressed is at least that large
+    float minScoresSum = 0.f;
+    size_t maxOutputBoxes = std::numeric_limits<size_t>::max();
+    // number of boxes from which only boxes from the same cells of spatial grid are compared, 0 disables grid
+    size_t gridBucketingMinBoxes = 2048;
+};
+
+/**
+ * @brief Greedy non maximum suppression.
+ * Gives the same results as nms2 from east_ocr node.
+ *
+ * @return indices of kept boxes sorted by descending score
+ */
+std::vector<size_t> nms(const Boxes& boxes, const NmsParameters& parameters);
+
+/**
+ * @brief Decodes output of DetectionOutput layer with rows [image_id, label, conf, x_min, y_min, x_max, y_max]
+ * and normalized coordinates. Appends accepted detections to boxes.
+ *
+ * @param labelId accept only detections of that label, -1 accepts all labels
+ * @return indices of accepted rows
+ */
+std::vector<size_t> decodeDetectionOutput(const float* data, size_t detectionsCount, size_t featuresCount,
+    int imageWidth, int imageHeight, float confidenceThreshold, int labelId, Boxes& boxes);
+
+/**
+ * @brief Decodes boxes given as rows [x1, y1, x2, y2, score] in pixel coordinates. Appends accepted boxes to boxes.
+ *
+ * @return indices of accepted rows
+ */
+std::vector<size_t> decodeCornerBoxes(const float* data, size_t count, size_t featuresCount, float confidenceThreshold, Boxes& boxes);
+
+struct EastDecodeParameters {
+    float confidenceThreshold = 0.f;
+    float boxWidthAdjustment = 0.f;
+    float boxHeightAdjustment = 0.f;
+    // boxes are clipped to image size
+    int imageWidth = 0;
+    int imageHeight = 0;
+};
+
+// Rotated rectangles of EAST detections, including width/height adjustments
+struct RotatedBoxes {
+    std::vector<float> angles;
+    std::vector<float> widths;
+    std::vector<float> heights;
+};
+
+/**
+ * @brief Decodes EAST model output with scores [rows, cols] and RBOX geometry [rows, cols, 5]
+ * computed for 4 times smaller feature map than the image.
+ * Appends bounding boxes of rotated rectangles to boxes.
+ *
+ * @return false if any decoded box is empty
+ */
+bool decodeEastBoxes(const float* scores, const float* geometry, int rows, int cols,
+    const EastDecodeParameters& parameters, Boxes& boxes, RotatedBoxes& rotatedBoxes);
+
+}  // namespace custom_nodes_common
+}  // namespace ovms
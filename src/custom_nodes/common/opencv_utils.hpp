@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "../../custom_node_interface.h"
+#include "nms.hpp"
 #include "opencv2/opencv.hpp"
 
 template <typename T>
@@ -56,6 +57,12 @@ std::vector<T> reorder_to_nchw(const T* nhwcVector, int rows, int cols, int chan
     return nchwVector;
 }
 
+cv::Rect box_to_rect(const ovms::custom_nodes_common::Boxes& boxes, size_t index) {
+    return cv::Rect(
+        cv::Point(static_cast<int>(boxes.x1[index]), static_cast<int>(boxes.y1[index])),
+        cv::Point(static_cast<int>(boxes.x2[index]), static_cast<int>(boxes.y2[index])));
+}
+
 const cv::Mat nhwc_to_mat(const CustomNodeTensor* input) {
     uint64_t height = input->dims[1];
     uint64_t width = input->dims[2];
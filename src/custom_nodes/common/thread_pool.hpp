@@ -0,0 +1,156 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sched.h>
+
+namespace ovms {
+namespace custom_nodes_common {
+
+// Node libraries are built separately from the server and cannot use ovms::getCoreCount(),
+// this is its lightweight counterpart: cores allowed by CPU affinity, limited by cgroup v2 quota
+// of the container (cpu.max at cgroup root).
+inline size_t getAvailableCoresCount() {
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        cores = std::max(1, CPU_COUNT(&set));
+    }
+    std::ifstream cpuMax("/sys/fs/cgroup/cpu.max");
+    std::string quota;
+    double period = 0;
+    if (cpuMax >> quota >> period && quota != "max" && period > 0) {
+        try {
+            const double quotaCores = std::ceil(std::stod(quota) / period);
+            if (quotaCores >= 1) {
+                cores = std::min(cores, static_cast<size_t>(quotaCores));
+            }
+        } catch (const std::exception&) {
+        }
+    }
+    return cores;
+}
+
+// Fixed size pool of worker threads created once per node library instance,
+// so that execute() calls do not pay thread creation cost.
+class ThreadPool {
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopping = false;
+
+public:
+    // threadsCount equal to 0 means number of cores available to the process
+    explicit ThreadPool(size_t threadsCount = 0) {
+        if (threadsCount == 0) {
+            threadsCount = getAvailableCoresCount();
+        }
+        // calling thread takes part in parallelFor, so one worker less is needed
+        for (size_t i = 1; i < threadsCount; ++i) {
+            workers.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        condition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t getThreadsCount() const { return workers.size() + 1; }
+
+    // Calls func(i) for each i in [0, count) and blocks until all calls finish.
+    // Items are taken one by one so that uneven item costs are balanced between threads.
+    template <typename Func>
+    void parallelFor(size_t count, const Func& func) {
+        const size_t helpersCount = std::min(workers.size(), count > 0 ? count - 1 : 0);
+        if (helpersCount == 0) {
+            for (size_t i = 0; i < count; ++i) {
+                func(i);
+            }
+            return;
+        }
+        std::atomic<size_t> nextIndex{0};
+        size_t pendingHelpers = helpersCount;
+        std::mutex doneMutex;
+        std::condition_variable doneCondition;
+        auto work = [&]() {
+            for (size_t i = nextIndex++; i < count; i = nextIndex++) {
+                func(i);
+            }
+        };
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (size_t i = 0; i < helpersCount; ++i) {
+                tasks.emplace([&]() {
+                    work();
+                    std::unique_lock<std::mutex> doneLock(doneMutex);
+                    if (--pendingHelpers == 0) {
+                        doneCondition.notify_one();
+                    }
+                });
+            }
+        }
+        condition.notify_all();
+        work();
+        // helpers reference this stack frame, wait for all of them even if there is no work left
+        std::unique_lock<std::mutex> doneLock(doneMutex);
+        doneCondition.wait(doneLock, [&]() { return pendingHelpers == 0; });
+    }
+
+private:
+    void workerLoop() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+                if (stopping && tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop();
+            }
+            task();
+        }
+    }
+};
+}  // namespace custom_nodes_common
+}  // namespace ovms
@@ -18,9 +18,9 @@
 #include <vector>
 
 #include "../../custom_node_interface.h"
+#include "../common/nms.hpp"
 #include "../common/opencv_utils.hpp"
 #include "../common/utils.hpp"
-#include "nms.hpp"
 #include "opencv2/opencv.hpp"
 
 static constexpr const char* IMAGE_TENSOR_NAME = "image";
@@ -237,99 +237,34 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     NODE_ASSERT((numRows * 4) == imageHeight, "image is not x4 larger than score/geometry data");
     NODE_ASSERT((numCols * 4) == imageWidth, "image is not x4 larger than score/geometry data");
 
-    std::vector<cv::Rect> rects;
-    std::vector<float> scores;
-    std::vector<BoxMetadata> metadata;
+    ovms::custom_nodes_common::Boxes boxes;
+    ovms::custom_nodes_common::RotatedBoxes rotatedBoxes;
+    ovms::custom_nodes_common::EastDecodeParameters decodeParameters;
+    decodeParameters.confidenceThreshold = confidenceThreshold;
+    decodeParameters.boxWidthAdjustment = boxWidthAdjustment;
+    decodeParameters.boxHeightAdjustment = boxHeightAdjustment;
+    decodeParameters.imageWidth = originalImageWidth;
+    decodeParameters.imageHeight = originalImageHeight;
 
     // Extract the scores (probabilities), followed by the geometrical data used to derive potential bounding box coordinates that surround text
-    for (int y = 0; y < numRows; y++) {
-        float* scoresData = (float*)scoresTensor->data + (y * numCols);
-        float* geometryData = (float*)geometryTensor->data + (y * numCols * 5);
-
-        for (int x = 0; x < numCols; x++) {
-            float score = scoresData[x];
-            // If our score does not have sufficient probability, ignore it
-            if (score < confidenceThreshold) {
-                continue;
-            }
-
-            if (debugMode)
-                std::cout << "Found confidence: " << scoresData[x] << std::endl;
-
-            // Compute the offset factor as our resulting feature maps will be 4x smaller than the input image
-            int offsetX = x * 4;
-            int offsetY = y * 4;
-
-            // Extract the rotation angle for the prediction and then compute the sin and cosine
-            int dataOffset = (x * 5);
-            float angle = geometryData[dataOffset + 4];
-
-            if (debugMode)
-                std::cout << "Angle: " << angle << std::endl;
-            float cos = std::cos(angle);
-            float sin = std::sin(angle);
-
-            // Use the geometry volume to derive the width and height of the bounding box
-            float h = geometryData[dataOffset + 0] + geometryData[dataOffset + 2];
-            float w = geometryData[dataOffset + 1] + geometryData[dataOffset + 3];
-
-            cv::Point2i p2{
-                offsetX + static_cast<int>(cos * geometryData[dataOffset + 1] + sin * geometryData[dataOffset + 2]),
-                offsetY + static_cast<int>(-sin * geometryData[dataOffset + 1] + cos * geometryData[dataOffset + 2])};
-            cv::Point2i p1{
-                static_cast<int>(-sin * h) + p2.x,
-                static_cast<int>(-cos * h) + p2.y};
-            cv::Point2i p3{
-                static_cast<int>(-cos * w) + p2.x,
-                static_cast<int>(sin * w) + p2.y};
-            cv::Point2i p4{
-                p3.x + p1.x - p2.x,
-                p3.y + p1.y - p2.y};
-
-            int x1 = std::min(std::min(std::min(p2.x, p1.x), p3.x), p4.x);
-            int x2 = std::max(std::max(std::max(p2.x, p1.x), p3.x), p4.x);
-            int y1 = std::min(std::min(std::min(p2.y, p1.y), p3.y), p4.y);
-            int y2 = std::max(std::max(std::max(p2.y, p1.y), p3.y), p4.y);
-
-            x1 = std::max(0, (int)(x1 - (x2 - x1) * boxWidthAdjustment));
-            x2 = std::min(originalImageWidth, (int)(x2 + (x2 - x1) * boxWidthAdjustment));
-            y1 = std::max(0, (int)(y1 - (y2 - y1) * boxHeightAdjustment));
-            y2 = std::min(originalImageHeight, (int)(y2 + (y2 - y1) * boxHeightAdjustment));
-
-            if (debugMode) {
-                std::stringstream ss;
-                ss << "Angled polygon coordinates: " << std::endl;
-                ss << p4 << p3 << p1 << p2 << std::endl;
-                ss << "Polygon bounding box with no rotation: " << std::endl;
-                ss << cv::Point2i(x1, y1) << cv::Point2i(x2, y2) << std::endl;
-                ss << "---------------------------" << std::endl;
-                std::cout << ss.str() << std::endl;
-            }
-
-            NODE_ASSERT(x2 > x1, "detected box width must be greater than 0");
-            NODE_ASSERT(y2 > y1, "detected box height must be greater than 0");
-
-            NODE_ASSERT(x2 > x1, "detected box width must be greater than 0");
-            NODE_ASSERT(y2 > y1, "detected box height must be greater than 0");
-
-            rects.emplace_back(x1, y1, x2 - x1, y2 - y1);
-            scores.emplace_back(score);
-            metadata.emplace_back(BoxMetadata{angle, w * (1.0f + boxWidthAdjustment), h * (1.0f + boxHeightAdjustment)});
-        }
-    }
+    NODE_ASSERT(ovms::custom_nodes_common::decodeEastBoxes((float*)scoresTensor->data, (float*)geometryTensor->data, numRows, numCols, decodeParameters, boxes, rotatedBoxes),
+        "detected box width and height must be greater than 0");
 
     if (debugMode)
-        std::cout << "Total findings: " << rects.size() << std::endl;
+        std::cout << "Total findings: " << boxes.size() << std::endl;
 
+    ovms::custom_nodes_common::NmsParameters nmsParameters;
+    nmsParameters.iouThreshold = overlapThreshold;
+    nmsParameters.maxOutputBoxes = maxOutputBatch;
     std::vector<cv::Rect> filteredBoxes;
     std::vector<float> filteredScores;
     std::vector<BoxMetadata> filteredMetadata;
-    nms2(rects, scores, metadata, filteredBoxes, filteredScores, filteredMetadata, overlapThreshold);
-    NODE_ASSERT(filteredBoxes.size() == filteredScores.size(), "filtered boxes and scores are not equal length");
-    if (filteredBoxes.size() > maxOutputBatch) {
-        filteredBoxes.resize(maxOutputBatch);
-        filteredScores.resize(maxOutputBatch);
+    for (size_t index : ovms::custom_nodes_common::nms(boxes, nmsParameters)) {
+        filteredBoxes.emplace_back(box_to_rect(boxes, index));
+        filteredScores.emplace_back(boxes.scores[index]);
+        filteredMetadata.emplace_back(BoxMetadata{rotatedBoxes.angles[index], rotatedBoxes.widths[index], rotatedBoxes.heights[index]});
     }
+    NODE_ASSERT(filteredBoxes.size() == filteredScores.size(), "filtered boxes and scores are not equal length");
 
     if (debugMode) {
         std::cout << "Total findings after NMS2 (non max suppression) filter: " << filteredBoxes.size() << std::endl;
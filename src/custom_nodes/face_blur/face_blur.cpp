@@ -16,6 +16,7 @@
 #include <iostream>
 
 #include "../../custom_node_interface.h"
+#include "../common/nms.hpp"
 #include "../common/opencv_utils.hpp"
 #include "../common/utils.hpp"
 #include "opencv2/opencv.hpp"
@@ -112,23 +113,17 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     uint64_t detectionsCount = detectionTensor->dims[2];
     uint64_t featuresCount = detectionTensor->dims[3];
 
-    std::vector<cv::Rect> boxes;
+    ovms::custom_nodes_common::Boxes detectedBoxes;
+    std::vector<size_t> detectionIndices = ovms::custom_nodes_common::decodeDetectionOutput((float*)detectionTensor->data, detectionsCount, featuresCount, imageWidth, imageHeight, confidenceThreshold, -1, detectedBoxes);
 
-    for (uint64_t i = 0; i < detectionsCount; i++) {
-        float* detection = (float*)(detectionTensor->data + (i * featuresCount * sizeof(float)));
-        int imageId = static_cast<int>(detection[0]);
-        int labelId = static_cast<int>(detection[1]);
-        float confidence = detection[2];
-        int xMin = static_cast<int>(detection[3] * imageWidth);
-        int yMin = static_cast<int>(detection[4] * imageHeight);
-        int xMax = static_cast<int>(detection[5] * imageWidth);
-        int yMax = static_cast<int>(detection[6] * imageHeight);
-        if (imageId == 0 && confidence >= confidenceThreshold) {
-            auto box = cv::Rect(cv::Point(xMin, yMin), cv::Point(xMax, yMax));
-            boxes.emplace_back(box);
-            if (debugMode) {
-                std::cout << "Detection:\nImageID: " << imageId << "; LabelID:" << labelId << "; Confidence:" << confidence << "; Box:" << box << std::endl;
-            }
+    std::vector<cv::Rect> boxes;
+    boxes.reserve(detectedBoxes.size());
+    for (size_t i = 0; i < detectedBoxes.size(); i++) {
+        auto box = box_to_rect(detectedBoxes, i);
+        boxes.emplace_back(box);
+        if (debugMode) {
+            float* detection = (float*)detectionTensor->data + detectionIndices[i] * featuresCount;
+            std::cout << "Detection:\nImageID: " << static_cast<int>(detection[0]) << "; LabelID:" << static_cast<int>(detection[1]) << "; Confidence:" << detection[2] << "; Box:" << box << std::endl;
         }
     }
 
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "../../custom_node_interface.h"
+#include "../common/nms.hpp"
 #include "../common/opencv_utils.hpp"
 #include "../common/utils.hpp"
 #include "opencv2/opencv.hpp"
@@ -202,24 +203,24 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     int numDetections = static_cast<int>(_numDetections);
     int numItems = static_cast<int>(_numItems);
 
+    ovms::custom_nodes_common::Boxes detectedBoxes;
+    ovms::custom_nodes_common::decodeCornerBoxes((float*)boxesTensor->data, numDetections, numItems, confidenceThreshold, detectedBoxes);
+
     std::vector<cv::Rect> rects;
     std::vector<float> scores;
+    rects.reserve(detectedBoxes.size());
+    scores.reserve(detectedBoxes.size());
 
-    for (int i = 0; i < numDetections; i++) {
-        float* boxesData = (float*)boxesTensor->data + (i * numItems);
-        float score = boxesData[4];
-        if (score < confidenceThreshold) {
-            continue;
-        }
-
+    for (size_t i = 0; i < detectedBoxes.size(); i++) {
+        float score = detectedBoxes.scores[i];
         if (debugMode) {
             std::cout << "Found confidence: " << score << std::endl;
         }
 
-        float x1 = boxesData[0];
-        float y1 = boxesData[1];
-        float x2 = boxesData[2];
-        float y2 = boxesData[3];
+        float x1 = detectedBoxes.x1[i];
+        float y1 = detectedBoxes.y1[i];
+        float x2 = detectedBoxes.x2[i];
+        float y2 = detectedBoxes.y2[i];
         NODE_ASSERT(x2 > x1, "detected box width must be greater than 0");
         NODE_ASSERT(y2 > y1, "detected box height must be greater than 0");
 
@@ -20,6 +20,7 @@
 
 #include "../../custom_node_interface.h"
 #include "../common/custom_node_library_internal_manager.hpp"
+#include "../common/nms.hpp"
 #include "../common/opencv_utils.hpp"
 #include "../common/utils.hpp"
 #include "opencv2/opencv.hpp"
@@ -317,35 +318,28 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     uint64_t detectionsCount = detectionTensor->dims[2];
     uint64_t featuresCount = detectionTensor->dims[3];
 
+    ovms::custom_nodes_common::Boxes detectedBoxes;
+    std::vector<size_t> detectionIndices = ovms::custom_nodes_common::decodeDetectionOutput((float*)detectionTensor->data, detectionsCount, featuresCount, imageWidth, imageHeight, confidenceThreshold, filterLabelId, detectedBoxes);
+
     std::vector<cv::Rect> boxes;
     std::vector<cv::Vec4f> detections;
     std::vector<float> confidences;
     std::vector<int> labelIds;
+    boxes.reserve(detectedBoxes.size());
+    detections.reserve(detectedBoxes.size());
+    confidences.reserve(detectedBoxes.size());
+    labelIds.reserve(detectedBoxes.size());
 
-    for (uint64_t i = 0; i < detectionsCount; i++) {
-        float* detection = (float*)(detectionTensor->data + (i * featuresCount * sizeof(float)));
-        int imageId = static_cast<int>(detection[0]);
+    for (size_t i = 0; i < detectedBoxes.size(); i++) {
+        float* detection = (float*)detectionTensor->data + detectionIndices[i] * featuresCount;
         int labelId = static_cast<int>(detection[1]);
-        float confidence = detection[2];
-        int xMin = static_cast<int>(detection[3] * imageWidth);
-        int yMin = static_cast<int>(detection[4] * imageHeight);
-        int xMax = static_cast<int>(detection[5] * imageWidth);
-        int yMax = static_cast<int>(detection[6] * imageHeight);
-        if (imageId == 0 && confidence >= confidenceThreshold) {
-            if (filterLabelId != -1 && filterLabelId != labelId) {
-                if (debugMode) {
-                    std::cout << "Skipping label ID: " << labelId << std::endl;
-                }
-                continue;
-            }
-            auto box = cv::Rect(cv::Point(xMin, yMin), cv::Point(xMax, yMax));
-            boxes.emplace_back(box);
-            detections.emplace_back(detection[3], detection[4], detection[5], detection[6]);
-            confidences.emplace_back(confidence);
-            labelIds.emplace_back(labelId);
-            if (debugMode) {
-                std::cout << "Detection:\nImageID: " << imageId << "; LabelID:" << labelId << "; Confidence:" << confidence << "; Box:" << box << std::endl;
-            }
+        auto box = box_to_rect(detectedBoxes, i);
+        boxes.emplace_back(box);
+        detections.emplace_back(detection[3], detection[4], detection[5], detection[6]);
+        confidences.emplace_back(detectedBoxes.scores[i]);
+        labelIds.emplace_back(labelId);
+        if (debugMode) {
+            std::cout << "Detection:\nImageID: " << static_cast<int>(detection[0]) << "; LabelID:" << labelId << "; Confidence:" << detectedBoxes.scores[i] << "; Box:" << box << std::endl;
         }
     }
 
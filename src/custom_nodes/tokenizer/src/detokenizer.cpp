@@ -17,8 +17,8 @@
 #include <chrono>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <string>
-#include <vector>
 
 #include "custom_node_interface.h"  // NOLINT
 #include "model.hpp"
@@ -40,14 +40,19 @@
 // Consider using memory pool.
 #define DEFAULT_MAX_BUF_LEN 4096
 
+// Number of threads detokenizing batch in parallel, 0 means number of cores available to the process.
+#define DEFAULT_THREADS 0
+
 using namespace custom_nodes::tokenizer;
 
 int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeParam* params, int paramsCount) {
     bool debugMode = get_string_parameter("debug", params, paramsCount) == "true";
     std::string modelPath = get_string_parameter("model_path", params, paramsCount, "");
     NODE_ASSERT(!modelPath.empty(), "model_path cannot be empty");
+    int threads = get_int_parameter("threads", params, paramsCount, DEFAULT_THREADS);
+    NODE_ASSERT(threads >= 0, "threads param must not be negative");
     try {
-        auto cnlim = std::make_unique<BlingFireModel>(modelPath, debugMode);
+        auto cnlim = std::make_unique<BlingFireModel>(modelPath, debugMode, threads);
         if (!cnlim->isValid())
             throw std::exception();
         *customNodeLibraryInternalManager = cnlim.release();
@@ -139,10 +144,18 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
 
     BlingFireModel* model = static_cast<BlingFireModel*>(customNodeLibraryInternalManager);
 
-    std::vector<std::string> results;
-    for (uint64_t batch = 0; batch < logitsTensor->dims[0]; batch++) {
+    const uint64_t batchSize = logitsTensor->dims[0];
+    // validated in validateInputs() already, max string length below requires non empty batch
+    NODE_ASSERT(batchSize > 0, "batch size must be larger than 0");
+    const uint64_t maxTokensCount = inputIdsTensor->dims[1] + 1;  // +1 for generated token
+    const size_t textBufferSize = maxBufferLength + 1;            // +1 due to null ending
+
+    // Scratch buffers shared by whole batch so that each batch can be processed in parallel without allocations
+    auto ids = std::make_unique<int32_t[]>(batchSize * maxTokensCount);
+    auto texts = std::make_unique<char[]>(batchSize * textBufferSize);
+    auto textLengths = std::make_unique<size_t[]>(batchSize);
+    model->getThreadPool().parallelFor(batchSize, [&](size_t batch) {
         // get previous tokens of current batch for context
-        DEBUG_MSG("get previous tokens of batch " << batch);
         int64_t* inputIds = reinterpret_cast<int64_t*>(
             inputIdsTensor->data +
             batch * (inputIdsTensor->dims[1] * sizeof(int64_t)));
@@ -158,33 +171,27 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
         if (lastNonZeroIndex < 0)
             lastNonZeroIndex = 0;
 
-        std::vector<int64_t> previousTokens(inputIds, inputIds + distance);
+        int32_t* batchIds = ids.get() + batch * maxTokensCount;
+        std::transform(inputIds, inputIds + distance, batchIds,
+            [](int64_t val) { return static_cast<int32_t>(val); });
 
         // slice
-        DEBUG_MSG("slicing batch " << batch);
         float* logits = reinterpret_cast<float*>(
             logitsTensor->data +
             batch * (logitsTensor->dims[1] * logitsTensor->dims[2] * sizeof(float)) +  // offset by batch
             (lastNonZeroIndex * logitsTensor->dims[2] * sizeof(float)));               // offset to get last element of second dimension
 
         // argmax
-        DEBUG_MSG("argmax batch " << batch);
         float* result = std::max_element(logits, logits + logitsTensor->dims[2]);
-        int64_t token = std::distance(logits, result);
-        previousTokens.push_back(token);
+        batchIds[distance] = static_cast<int32_t>(std::distance(logits, result));
 
         // detokenize
-        DEBUG_MSG("detokenizing token batch " << batch);
-        auto text = model->detokenize(previousTokens, maxBufferLength);
-        DEBUG_MSG("detokenized token: (" << token << ") to: (" << text << ") for batch " << batch);
-        results.emplace_back(std::move(text));
-    }
+        textLengths[batch] = model->detokenize(batchIds, distance + 1, texts.get() + batch * textBufferSize, maxBufferLength);
+    });
+    DEBUG_MSG("detokenized " << batchSize << " texts using " << model->getThreadPool().getThreadsCount() << " threads");
 
     DEBUG_MSG("getting max string length");
-    size_t maxStringLength = 0;
-    for (const auto& str : results) {
-        maxStringLength = std::max(maxStringLength, str.size());
-    }
+    const size_t maxStringLength = *std::max_element(textLengths.get(), textLengths.get() + batchSize);
     size_t width = maxStringLength + 1;
 
     DEBUG_MSG("prepraing output tensor");
@@ -198,19 +205,19 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
     // Outputs allocation
     CustomNodeTensor& output = (*outputs)[0];
     output.name = OUTPUT_NAME_TEXTS;
-    output.dataBytes = width * results.size();
+    output.dataBytes = width * batchSize;
     output.data = (uint8_t*)malloc(output.dataBytes);
     output.dimsCount = 2;
     output.dims = (uint64_t*)malloc(output.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(output.dims != nullptr, "malloc has failed");
-    output.dims[0] = results.size();
+    output.dims[0] = batchSize;
     output.dims[1] = width;
     output.precision = U8;
 
     DEBUG_MSG("writing output");
-    for (size_t i = 0; i < results.size(); i++) {
-        std::memcpy(output.data + i * width, results[i].data(), results[i].size());
-        output.data[i * width + results[i].size()] = 0;
+    for (size_t i = 0; i < batchSize; i++) {
+        std::memcpy(output.data + i * width, texts.get() + i * textBufferSize, textLengths[i]);
+        std::memset(output.data + i * width + textLengths[i], 0, width - textLengths[i]);
     }
     DEBUG_MSG("execute() end");
     auto end = std::chrono::steady_clock::now();
@@ -31,15 +31,16 @@ namespace tokenizer {
 
 static std::atomic<int> maxId{0};
 
-BlingFireModel::BlingFireModel(const std::string& modelPath, bool debug) :
+BlingFireModel::BlingFireModel(const std::string& modelPath, bool debug, size_t threadsCount) :
     id(maxId++),
     debug(debug) {
     if (!std::filesystem::exists(modelPath)) {
         throw std::runtime_error("Model file does not exist: " + modelPath);
     }
     handle = BlingFire::LoadModel(modelPath.c_str());
+    threadPool = std::make_unique<ovms::custom_nodes_common::ThreadPool>(threadsCount);
     if (debug) {
-        std::cout << "[BlingFireModel] [" << id << "] Model loaded from: " << modelPath << std::endl;
+        std::cout << "[BlingFireModel] [" << id << "] Model loaded from: " << modelPath << "; threads: " << threadPool->getThreadsCount() << std::endl;
     }
 }
 
@@ -52,9 +53,22 @@ BlingFireModel::~BlingFireModel() {
     }
 }
 
+int BlingFireModel::tokenize(const char* text, size_t textLength, int32_t* ids, int maxIdsArrLength) {
+    const int idsLength = BlingFire::TextToIds(handle, text, textLength, ids, maxIdsArrLength);
+    // returned length is not truncated to the size of the buffer
+    return std::clamp(idsLength, 0, maxIdsArrLength);
+}
+
+size_t BlingFireModel::detokenize(const int32_t* ids, size_t idsCount, char* buffer, int maxBufferLength, bool skipSpecialTokens) {
+    buffer[0] = '\0';
+    BlingFire::IdsToText(handle, ids, idsCount, buffer, maxBufferLength, skipSpecialTokens);
+    buffer[maxBufferLength] = '\0';  // buffer has to be at least maxBufferLength + 1 long
+    return strnlen(buffer, maxBufferLength);
+}
+
 std::vector<int64_t> BlingFireModel::tokenize(const std::string& text, int maxIdsArrLength) {
     auto ids = std::make_unique<int32_t[]>(maxIdsArrLength);
-    const int idsLength = BlingFire::TextToIds(handle, text.c_str(), text.size(), ids.get(), maxIdsArrLength);
+    const int idsLength = tokenize(text.c_str(), text.size(), ids.get(), maxIdsArrLength);
     std::vector<int64_t> vec(idsLength);
     std::transform(ids.get(), ids.get() + idsLength, vec.begin(),
         [](int32_t val) { return static_cast<int64_t>(val); });
@@ -66,8 +80,7 @@ std::string BlingFireModel::detokenize(const std::vector<int64_t>& tokens, int m
     std::transform(tokens.begin(), tokens.end(), ids.get(),
         [](int64_t val) { return static_cast<int32_t>(val); });
     std::string str(maxBufferLength + 1, '\0');  // +1 due to null ending
-    BlingFire::IdsToText(handle, ids.get(), tokens.size(), str.data(), maxBufferLength, skipSpecialTokens);
-    str.resize(std::strlen(str.data()));  // remove all remaining zero bytes
+    str.resize(detokenize(ids.get(), tokens.size(), str.data(), maxBufferLength, skipSpecialTokens));  // remove all remaining zero bytes
     return str;
 }
 
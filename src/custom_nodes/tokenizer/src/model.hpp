@@ -14,10 +14,14 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "thread_pool.hpp"
+
 namespace custom_nodes {
 namespace tokenizer {
 
@@ -25,15 +29,24 @@ class BlingFireModel {
     int id;
     void* handle = nullptr;
     bool debug;
+    std::unique_ptr<ovms::custom_nodes_common::ThreadPool> threadPool;
 
 public:
-    BlingFireModel(const std::string& modelPath, bool debug = false);
+    // threadsCount equal to 0 means number of cores allowed by CPU affinity and cgroup quota
+    BlingFireModel(const std::string& modelPath, bool debug = false, size_t threadsCount = 0);
     ~BlingFireModel();
 
     bool isValid() const { return handle != nullptr; }
 
+    ovms::custom_nodes_common::ThreadPool& getThreadPool() { return *threadPool; }
+
     std::vector<int64_t> tokenize(const std::string& text, int maxIdsArrLength);
     std::string detokenize(const std::vector<int64_t>& tokens, int maxBufferLength, bool skipSpecialTokens = false);
+
+    // Allocation free variants used for batch processing, safe to be called concurrently.
+    // Return number of ids/characters written to the output buffer.
+    int tokenize(const char* text, size_t textLength, int32_t* ids, int maxIdsArrLength);
+    size_t detokenize(const int32_t* ids, size_t idsCount, char* buffer, int maxBufferLength, bool skipSpecialTokens = false);
 };
 
 }  // namespace tokenizer
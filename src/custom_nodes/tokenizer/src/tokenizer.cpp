@@ -13,11 +13,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <algorithm>
 #include <chrono>
 #include <cstring>
 #include <iostream>
+#include <memory>
 #include <string>
-#include <vector>
 
 #define __STDC_WANT_LIB_EXT1__ 1  // to ensure existence of strnlen
 #include <string.h>
@@ -37,6 +38,9 @@
 // Consider using memory pool.
 #define DEFAULT_MAX_ID_ARR_LEN 1024
 
+// Number of threads tokenizing texts of a batch in parallel, 0 means number of cores available to the process.
+#define DEFAULT_THREADS 0
+
 using namespace custom_nodes::tokenizer;
 
 #define DEBUG_MSG(str)                                   \
@@ -48,8 +52,10 @@ int initialize(void** customNodeLibraryInternalManager, const struct CustomNodeP
     bool debugMode = get_string_parameter("debug", params, paramsCount) == "true";
     std::string modelPath = get_string_parameter("model_path", params, paramsCount, "");
     NODE_ASSERT(!modelPath.empty(), "model_path cannot be empty");
+    int threads = get_int_parameter("threads", params, paramsCount, DEFAULT_THREADS);
+    NODE_ASSERT(threads >= 0, "threads param must not be negative");
     try {
-        auto cnlim = std::make_unique<BlingFireModel>(modelPath, debugMode);
+        auto cnlim = std::make_unique<BlingFireModel>(modelPath, debugMode, threads);
         if (!cnlim->isValid())
             throw std::exception();
         *customNodeLibraryInternalManager = cnlim.release();
@@ -110,6 +116,11 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
 
     BlingFireModel* model = static_cast<BlingFireModel*>(customNodeLibraryInternalManager);
 
+    const uint64_t batchSize = textTensor->dims[0];
+    const uint64_t maxTextLength = textTensor->dims[1];
+    // validated in validateInputs() already, max token size below requires non empty batch
+    NODE_ASSERT(batchSize > 0, "batch size must be larger than 0");
+
     *outputsCount = 3;
     *outputs = (struct CustomNodeTensor*)malloc(*outputsCount * sizeof(CustomNodeTensor));
     if ((*outputs) == nullptr) {
@@ -117,69 +128,71 @@ int execute(const struct CustomNodeTensor* inputs, int inputsCount, struct Custo
         return 1;
     }
 
-    std::vector<std::vector<int64_t>> ids(textTensor->dims[0]);
-    // For each batch, sequentially
-    for (uint64_t batch = 0; batch < textTensor->dims[0]; batch++) {
-        DEBUG_MSG("tokenizing batch " << batch);
-        const char* strStart = (const char*)textTensor->data + batch * textTensor->dims[1];
-        std::string text(strStart, strnlen(strStart, textTensor->dims[1]));
-        ids[batch] = model->tokenize(text, maxIdsArrLength);
-        DEBUG_MSG("tokenized batch " << batch << "; of string: " << text);
-    }
+    // Token ids of whole batch are gathered in single scratch buffer, one row of maxIdsArrLength per text,
+    // so that texts can be tokenized in parallel without per text allocations.
+    auto ids = std::make_unique<int32_t[]>(batchSize * maxIdsArrLength);
+    auto idsLengths = std::make_unique<size_t[]>(batchSize);
+    model->getThreadPool().parallelFor(batchSize, [&](size_t batch) {
+        const char* strStart = (const char*)textTensor->data + batch * maxTextLength;
+        idsLengths[batch] = model->tokenize(strStart, strnlen(strStart, maxTextLength), ids.get() + batch * maxIdsArrLength, maxIdsArrLength);
+    });
+    DEBUG_MSG("tokenized " << batchSize << " texts using " << model->getThreadPool().getThreadsCount() << " threads");
 
     DEBUG_MSG("getting max token size");
-    size_t maxTokenSize = 0;
-    for (const auto& id : ids) {
-        maxTokenSize = std::max(maxTokenSize, id.size());
-    }
+    const size_t maxTokenSize = *std::max_element(idsLengths.get(), idsLengths.get() + batchSize);
 
     DEBUG_MSG("preparing output tensors");
     CustomNodeTensor& tokens = (*outputs)[0];
     tokens.name = OUTPUT_NAME_TOKENS;
-    tokens.dataBytes = sizeof(int64_t) * maxTokenSize * ids.size();
+    tokens.dataBytes = sizeof(int64_t) * maxTokenSize * batchSize;
     tokens.data = (uint8_t*)malloc(tokens.dataBytes);
     tokens.dimsCount = 2;
     tokens.dims = (uint64_t*)malloc(tokens.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(tokens.dims != nullptr, "malloc has failed");
-    tokens.dims[0] = ids.size();
+    tokens.dims[0] = batchSize;
     tokens.dims[1] = maxTokenSize;
     tokens.precision = I64;
 
     CustomNodeTensor& attention = (*outputs)[1];
     attention.name = OUTPUT_NAME_ATTENTION;
-    attention.dataBytes = sizeof(int64_t) * maxTokenSize * ids.size();
+    attention.dataBytes = sizeof(int64_t) * maxTokenSize * batchSize;
     attention.data = (uint8_t*)malloc(attention.dataBytes);
     attention.dimsCount = 2;
     attention.dims = (uint64_t*)malloc(attention.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(attention.dims != nullptr, "malloc has failed");
-    attention.dims[0] = ids.size();
+    attention.dims[0] = batchSize;
     attention.dims[1] = maxTokenSize;
     attention.precision = I64;
 
     CustomNodeTensor& position = (*outputs)[2];
     position.name = OUTPUT_NAME_POSITION;
-    position.dataBytes = sizeof(int64_t) * maxTokenSize * ids.size();
+    position.dataBytes = sizeof(int64_t) * maxTokenSize * batchSize;
     position.data = (uint8_t*)malloc(position.dataBytes);
     position.dimsCount = 2;
     position.dims = (uint64_t*)malloc(position.dimsCount * sizeof(uint64_t));
     NODE_ASSERT(position.dims != nullptr, "malloc has failed");
-    position.dims[0] = ids.size();
+    position.dims[0] = batchSize;
     position.dims[1] = maxTokenSize;
     position.precision = I64;
     DEBUG_MSG("writing output");
 
-    for (size_t i = 0; i < ids.size(); i++) {
-        std::memcpy(tokens.data + i * maxTokenSize * sizeof(int64_t), ids[i].data(), ids[i].size() * sizeof(int64_t));
-        for (size_t j = 0; j < ids[i].size(); j++) {
-            ((int64_t*)attention.data)[i * maxTokenSize + j] = 1;
-        }
-        for (size_t j = 0; j < ids[i].size(); j++) {
-            ((int64_t*)position.data)[i * maxTokenSize + j] = j;
+    model->getThreadPool().parallelFor(batchSize, [&](size_t i) {
+        const int32_t* rowIds = ids.get() + i * maxIdsArrLength;
+        int64_t* rowTokens = (int64_t*)tokens.data + i * maxTokenSize;
+        int64_t* rowAttention = (int64_t*)attention.data + i * maxTokenSize;
+        int64_t* rowPosition = (int64_t*)position.data + i * maxTokenSize;
+        const size_t length = idsLengths[i];
+        for (size_t j = 0; j < length; j++) {
+            rowTokens[j] = rowIds[j];
+            rowAttention[j] = 1;
+            rowPosition[j] = j;
         }
-        for (size_t j = ids[i].size(); j < maxTokenSize; j++) {
-            ((int64_t*)attention.data)[i * maxTokenSize + j] = 0;
+        for (size_t j = length; j < maxTokenSize; j++) {
+            rowTokens[j] = 0;
+            rowAttention[j] = 0;
+            rowPosition[j] = 0;
         }
-    }
+    });
     auto end = std::chrono::steady_clock::now();
     DEBUG_MSG("execute() end; took " << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / 1000.f << " ms");
     return 0;
@@ -244,3 +244,49 @@ TEST_F(TokenizerFixtureTest, execute) {
     ASSERT_EQ(std::memcmp(outputs[2].tokens.data(), std::vector<int64_t>{23294, 241, 22174, 28618, 2515, 94, 31676}.data(), 7 * sizeof(int64_t)), 0);
     ASSERT_EQ(std::memcmp(outputs[2].attention.data(), std::vector<int64_t>{1, 1, 1, 1, 1, 1, 1}.data(), 7 * sizeof(int64_t)), 0);
 }
+
+TEST(TokenizerTest, execute_parallel_batch) {
+    void* model = nullptr;
+    struct CustomNodeParam params[2];
+    params[0].key = "model_path";
+    params[0].value = TEST_MODEL_FILE_PATH;
+    params[1].key = "threads";
+    params[1].value = "4";
+    ASSERT_EQ(initialize(&model, params, 2), 0);
+
+    std::vector<std::string> texts;
+    for (int i = 0; i < 64; i++) {
+        texts.emplace_back(std::string(i % 7, ' ') + "Hello world number " + std::to_string(i) + (i % 3 ? "!" : " こんにちは"));
+    }
+    struct CustomNodeTensor inputs[1];
+    struct CustomNodeTensor* outputs = nullptr;
+    int outputsCount = 0;
+    putStringsToTensor(texts, inputs[0]);
+    int ret = execute(inputs, 1, &outputs, &outputsCount, params, 2, model);
+    free(inputs[0].data);
+    free(inputs[0].dims);
+    ASSERT_EQ(ret, 0);
+    ASSERT_EQ(outputsCount, 3);
+    ASSERT_EQ(outputs[0].dims[0], texts.size());
+
+    BlingFireModel referenceModel(TEST_MODEL_FILE_PATH);
+    const size_t width = outputs[0].dims[1];
+    for (size_t i = 0; i < texts.size(); i++) {
+        auto expected = referenceModel.tokenize(texts[i], 1024);
+        ASSERT_LE(expected.size(), width);
+        const int64_t* tokens = (int64_t*)outputs[0].data + i * width;
+        const int64_t* attention = (int64_t*)outputs[1].data + i * width;
+        const int64_t* position = (int64_t*)outputs[2].data + i * width;
+        for (size_t j = 0; j < width; j++) {
+            if (j < expected.size()) {
+                EXPECT_EQ(tokens[j], expected[j]) << "batch: " << i << "; position: " << j;
+                EXPECT_EQ(attention[j], 1);
+                EXPECT_EQ(position[j], j);
+            } else {
+                EXPECT_EQ(attention[j], 0);
+            }
+        }
+    }
+    ASSERT_EQ(release(outputs, model), 0);
+    ASSERT_EQ(deinitialize(model), 0);
+}
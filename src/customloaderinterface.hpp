@@ -15,7 +15,11 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace ovms {
@@ -30,6 +34,27 @@ enum class CustomLoaderStatus {
     INTERNAL_ERROR     /*!< generic error */
 };
 
+/**
+     * @brief Memory returned by custom loader without copying.
+     * OVMS keeps owner alive as long as the data is used by the model, afterwards owner is released
+     * which allows loader to free or unmap the memory (e.g. in the owner deleter).
+     */
+struct CustomLoaderBuffer {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    std::shared_ptr<const void> owner;
+
+    CustomLoaderBuffer() = default;
+    CustomLoaderBuffer(const uint8_t* data, size_t size, std::shared_ptr<const void> owner) :
+        data(data),
+        size(size),
+        owner(std::move(owner)) {}
+    explicit CustomLoaderBuffer(std::shared_ptr<const std::vector<uint8_t>> buffer) :
+        data(buffer->data()),
+        size(buffer->size()),
+        owner(std::move(buffer)) {}
+};
+
 /**
      * @brief This class is the custom loader interface base class.
      * Custom Loader implementation shall derive from this base calss
@@ -114,4 +139,53 @@ public:
 // the types of the class factories
 typedef CustomLoaderInterface* createCustomLoader_t();
 
+/**
+     * @brief Custom loader interface v2, returning model buffers without copying.
+     * Loaders implementing it shall contain createCustomLoaderV2 factory function.
+     * It is a separate class so that layout of CustomLoaderInterface used by already built loaders does not change.
+     */
+class CustomLoaderInterfaceV2 : public CustomLoaderInterface {
+public:
+    /**
+         * @brief Load the model by the custom loader without copying its buffers
+         *
+         * Loader hands over ownership of decrypted or memory mapped buffers instead of filling vectors.
+         * For MODEL_TYPE_BLOB model buffer contains model compiled for target device, exported with
+         * ov::CompiledModel::export_model, and weights buffer is not used.
+         *
+         * @param model name required to be loaded - defined under model config in the config file
+         * @param base path where the required model files are present
+         * @param version of the model
+         * @param loader config parameters json as string
+         * @param model buffer
+         * @param weights buffer
+         * @return status (On success, the return value will specify the type of model (IR,ONNX,BLOB) returned in buffers)
+         */
+    virtual CustomLoaderStatus loadModelBuffers(const std::string& modelName,
+        const std::string& basePath,
+        const int version,
+        const std::string& loaderOptions,
+        CustomLoaderBuffer& modelBuffer,
+        CustomLoaderBuffer& weights) = 0;
+
+    /**
+         * @brief Load the model into vectors, copies buffers returned by loadModelBuffers
+         */
+    CustomLoaderStatus loadModel(const std::string& modelName,
+        const std::string& basePath,
+        const int version,
+        const std::string& loaderOptions,
+        std::vector<uint8_t>& modelBuffer,
+        std::vector<uint8_t>& weights) override {
+        CustomLoaderBuffer model;
+        CustomLoaderBuffer weightsBuffer;
+        CustomLoaderStatus status = loadModelBuffers(modelName, basePath, version, loaderOptions, model, weightsBuffer);
+        modelBuffer.assign(model.data, model.data + model.size);
+        weights.assign(weightsBuffer.data, weightsBuffer.data + weightsBuffer.size);
+        return status;
+    }
+};
+
+typedef CustomLoaderInterfaceV2* createCustomLoaderV2_t();
+
 }  // namespace ovms
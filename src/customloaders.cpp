@@ -24,7 +24,7 @@
 namespace ovms {
 
 Status CustomLoaders::add(std::string name, std::shared_ptr<CustomLoaderInterface> loaderInterface, void* library) {
-    auto loaderIt = newCustomLoaderInterfacePtrs.emplace(name, std::make_pair(library, loaderInterface));
+    auto loaderIt = newCustomLoaderInterfacePtrs.emplace(name, LoaderEntry{library, loaderInterface, nullptr});
     // if the loader already exists, print an error message
     if (!loaderIt.second) {
         SPDLOG_ERROR("The loader {} already exists in the config file", name);
@@ -34,6 +34,16 @@ Status CustomLoaders::add(std::string name, std::shared_ptr<CustomLoaderInterfac
     return StatusCode::OK;
 }
 
+Status CustomLoaders::addV2(std::string name, std::shared_ptr<CustomLoaderInterfaceV2> loaderInterface, void* library) {
+    auto loaderIt = newCustomLoaderInterfacePtrs.emplace(name, LoaderEntry{library, loaderInterface, loaderInterface});
+    if (!loaderIt.second) {
+        SPDLOG_ERROR("The loader {} already exists in the config file", name);
+        return StatusCode::CUSTOM_LOADER_EXISTS;
+    }
+
+    return StatusCode::OK;
+}
+
 Status CustomLoaders::remove(const std::string& name) {
     SPDLOG_INFO("Removing loader {} from loaders list", name);
     auto loaderIt = customLoaderInterfacePtrs.find(name);
@@ -54,7 +64,17 @@ std::shared_ptr<CustomLoaderInterface> CustomLoaders::find(const std::string& na
         return nullptr;
     }
 
-    return (loaderIt->second).second;
+    return (loaderIt->second).loaderInterface;
+}
+
+std::shared_ptr<CustomLoaderInterfaceV2> CustomLoaders::findV2(const std::string& name) {
+    auto loaderIt = customLoaderInterfacePtrs.find(name);
+
+    if (loaderIt == customLoaderInterfacePtrs.end()) {
+        return nullptr;
+    }
+
+    return (loaderIt->second).loaderInterfaceV2;
 }
 
 Status CustomLoaders::move(const std::string& name) {
@@ -74,7 +94,7 @@ Status CustomLoaders::finalize() {
     // By now the remaining loaders in current list are not there in new config. Delete them
     for (auto it = customLoaderInterfacePtrs.begin(); it != customLoaderInterfacePtrs.end(); it++) {
         SPDLOG_INFO("Loader {} is not there in new list.. deleting the same", it->first);
-        auto loaderPtr = (it->second).second;
+        auto loaderPtr = (it->second).loaderInterface;
         loaderPtr->loaderDeInit();
     }
 
@@ -23,6 +23,7 @@
 
 namespace ovms {
 class CustomLoaderInterface;
+class CustomLoaderInterfaceV2;
 class Status;
 /**
      * @brief Provides all customloaders
@@ -39,8 +40,15 @@ private:
          */
     CustomLoaders(const CustomLoaders&) = delete;
 
-    std::map<std::string, std::pair<void*, std::shared_ptr<CustomLoaderInterface>>> customLoaderInterfacePtrs;
-    std::map<std::string, std::pair<void*, std::shared_ptr<CustomLoaderInterface>>> newCustomLoaderInterfacePtrs;
+    struct LoaderEntry {
+        void* library;
+        std::shared_ptr<CustomLoaderInterface> loaderInterface;
+        // set only for loaders implementing interface v2
+        std::shared_ptr<CustomLoaderInterfaceV2> loaderInterfaceV2;
+    };
+
+    std::map<std::string, LoaderEntry> customLoaderInterfacePtrs;
+    std::map<std::string, LoaderEntry> newCustomLoaderInterfacePtrs;
 
     std::vector<std::string> currentCustomLoaderNames;
 
@@ -60,6 +68,13 @@ public:
          */
     Status add(std::string name, std::shared_ptr<CustomLoaderInterface> loaderInsterface, void* library);
 
+    /**
+         * @brief insert a new customloader implementing interface v2
+         * 
+         * @return status 
+         */
+    Status addV2(std::string name, std::shared_ptr<CustomLoaderInterfaceV2> loaderInterface, void* library);
+
     /**
          * @brief remove an existing customLoader referenced by it's name
          * 
@@ -74,6 +89,13 @@ public:
          */
     std::shared_ptr<CustomLoaderInterface> find(const std::string& name);
 
+    /**
+         * @brief find an existing customLoader implementing interface v2 referenced by it's name
+         * 
+         * @return pointer to customloader Interface v2 if found and loader implements it, else NULL
+         */
+    std::shared_ptr<CustomLoaderInterfaceV2> findV2(const std::string& name);
+
     /**
          * @brief move the existing loader from serviced map to new map.
          * 
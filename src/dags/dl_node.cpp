@@ -27,6 +27,7 @@
 #include "../ov_utils.hpp"
 #include "../ovinferrequestsqueue.hpp"
 #include "../prediction_service_utils.hpp"
+#include "../response_cache.hpp"
 #include "../timer.hpp"
 #include "dlnodesession.hpp"
 #include "nodestreamidguard.hpp"
@@ -35,9 +36,13 @@ namespace ovms {
 
 const uint WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS = 1;
 
-Status DLNode::getRealOutputName(ModelInstance& model, const std::string& alias, std::string* result) const {
+const std::string& DLNode::getModelOutputName(const std::string& alias) const {
     auto it = nodeOutputNameAlias.find(alias);
-    const auto& modelOutputName = it != nodeOutputNameAlias.end() ? it->second : alias;
+    return it != nodeOutputNameAlias.end() ? it->second : alias;
+}
+
+Status DLNode::getRealOutputName(ModelInstance& model, const std::string& alias, std::string* result) const {
+    const auto& modelOutputName = getModelOutputName(alias);
     auto jt = model.getOutputsInfo().find(modelOutputName);
     if (jt == model.getOutputsInfo().end()) {
         return StatusCode::INVALID_MISSING_OUTPUT;
@@ -78,10 +83,15 @@ Status DLNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessio
     auto& metadataTensorResultsPair = it.first->second;
     auto& tensorResults = metadataTensorResultsPair.second;
     Status status;
-    const uint waitTimeMicroseconds = 1;
-    auto& inferRequest = dlNodeSession.getInferRequest(waitTimeMicroseconds);
     auto& model = dlNodeSession.getModelInstance();
-    status = this->fetchResults(tensorResults, inferRequest, model, nodeSession.getSessionKey());
+    const auto* cachedResponse = dlNodeSession.getCachedResponse();
+    if (cachedResponse != nullptr) {
+        status = this->fetchCachedResults(tensorResults, *cachedResponse, nodeSession.getSessionKey());
+    } else {
+        const uint waitTimeMicroseconds = 1;
+        auto& inferRequest = dlNodeSession.getInferRequest(waitTimeMicroseconds);
+        status = this->fetchResults(tensorResults, inferRequest, model, nodeSession.getSessionKey());
+    }
     INCREMENT_IF_ENABLED(model.getMetricReporter().getInferRequestMetric(sessionMetadata.getContext()));
     return status;
 }
@@ -101,6 +111,9 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
     }
     double ovInferTime = this->getNodeSession(sessionKey).getTimer().elapsed<std::chrono::microseconds>(EXECUTE);
     OBSERVE_IF_ENABLED(model.getMetricReporter().inferenceTime, ovInferTime);
+    if (model.getAutoTuner()) {
+        model.getAutoTuner()->recordInferenceTime(ovInferTime);
+    }
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} infer request finished", getName(), sessionKey);
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Inference processing time for node {}; model name: {}; session: {} - {} ms",
         this->getName(),
@@ -108,7 +121,9 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
         sessionKey,
         ovInferTime / 1000);
 
-    static_cast<DLNodeSession&>(this->getNodeSession(sessionKey)).clearInputs();
+    auto& dlNodeSession = static_cast<DLNodeSession&>(this->getNodeSession(sessionKey));
+    dlNodeSession.clearInputs();
+    TensorMap cacheableOutputs;
 
     // Fill outputs map with result tensors. Fetch only those that are required in following nodes.
     for (const auto& node : this->next) {
@@ -138,6 +153,7 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
                         realModelOutputName);
                     return status;
                 }
+                cacheableOutputs.emplace(getModelOutputName(output_name), copiedTensor);
                 outputs.emplace(std::make_pair(output_name, TensorWithSource(std::move(copiedTensor))));
             } catch (const ov::Exception& e) {
                 Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
@@ -147,9 +163,41 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared", getName(), sessionKey, output_name);
         }
     }
+    dlNodeSession.insertToResponseCache(std::move(cacheableOutputs));
     return StatusCode::OK;
 }
 
+Status DLNode::fetchCachedResults(TensorWithSourceMap& outputs, const CachedResponse& cachedResponse, session_key_t sessionKey) {
+    ReleaseSessionGuard releaseSessionGuard(this->getNodeSession(sessionKey));
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Using cached response", getName(), sessionKey);
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            const auto& output_name = pair.first;
+            if (outputs.find(output_name) != outputs.end()) {
+                continue;
+            }
+            auto it = cachedResponse.tensors.find(getModelOutputName(output_name));
+            if (it == cachedResponse.tensors.end()) {
+                SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} Missing output: {} in cached response", getName(), sessionKey, output_name);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            // cached tensors are shared between sessions and never written to
+            outputs.emplace(std::make_pair(output_name, TensorWithSource(it->second)));
+        }
+    }
+    return StatusCode::OK;
+}
+
+std::set<std::string> DLNode::getRequestedModelOutputNames() const {
+    std::set<std::string> names;
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            names.insert(getModelOutputName(pair.first));
+        }
+    }
+    return names;
+}
+
 void DLNode::release(session_key_t sessionId) {
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Release node: {} sessionKey: {}", getName(), sessionId);
     getNodeSession(sessionId).release();
@@ -160,7 +208,7 @@ bool DLNode::tryDisarm(const session_key_t& sessionKey, const uint microseconds)
 
 std::unique_ptr<NodeSession> DLNode::createNodeSession(const NodeSessionMetadata& metadata, const CollapseDetails& collapsingDetails) {
     return std::make_unique<DLNodeSession>(metadata, getName(), previous.size(), collapsingDetails,
-        this->modelManager, this->modelName, this->modelVersion.value_or(0));
+        this->modelManager, this->modelName, this->modelVersion.value_or(0), getRequestedModelOutputNames());
 }
 
 }  // namespace ovms
@@ -30,6 +30,7 @@
 
 namespace ovms {
 
+struct CachedResponse;
 class ModelInstance;
 class ModelInstanceUnloadGuard;
 class NodeStreamIdGuard;
@@ -58,12 +59,15 @@ public:
 
 private:
     Status fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, session_key_t sessionKey);
+    Status fetchCachedResults(TensorWithSourceMap& outputs, const CachedResponse& cachedResponse, session_key_t sessionKey);
 
 public:
     void release(session_key_t sessionId) override;
 
 private:
+    const std::string& getModelOutputName(const std::string& alias) const;
     Status getRealOutputName(ModelInstance& model, const std::string& alias, std::string* result) const;
+    std::set<std::string> getRequestedModelOutputNames() const;
 
     Status executeInference(PipelineEventQueue& notifyEndQueue, ov::InferRequest& infer_request);
     bool tryDisarm(const session_key_t& sessionKey, const uint microseconds = 1) override;
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 
 #include "../logging.hpp"
 #include "../modelinstance.hpp"
@@ -25,6 +26,7 @@
 #include "../modelmanager.hpp"
 #include "../ov_utils.hpp"
 #include "../profiler.hpp"
+#include "../response_cache.hpp"
 #include "../shape.hpp"
 #include "../status.hpp"
 #include "../tensorinfo.hpp"
@@ -34,17 +36,19 @@
 #include "nodestreamidguard.hpp"
 
 namespace ovms {
-DLNodeSession::DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion) :
+DLNodeSession::DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> requestedOutputs) :
     NodeSession(metadata, nodeName, inputsCount, collapsingDetails),
     modelManager(manager),
     modelName(modelName),
-    modelVersion(modelVersion) {}
+    modelVersion(modelVersion),
+    requestedOutputs(std::move(requestedOutputs)) {}
 
-DLNodeSession::DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion) :
+DLNodeSession::DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> requestedOutputs) :
     NodeSession(std::move(metadata), nodeName, inputsCount, collapsingDetails),
     modelManager(manager),
     modelName(modelName),
-    modelVersion(modelVersion) {}
+    modelVersion(modelVersion),
+    requestedOutputs(std::move(requestedOutputs)) {}
 
 DLNodeSession::~DLNodeSession() = default;
 
@@ -83,6 +87,19 @@ Status DLNodeSession::requestExecuteRequiredResources() {
     if (!status.ok()) {
         return status;
     }
+    auto* responseCache = this->model->getResponseCache();
+    if (responseCache != nullptr) {
+        this->responseCacheKey = computeResponseCacheKey(this->inputHandler->getInputs(), this->requestedOutputs);
+        this->timer->start(EXECUTE);
+        this->cachedResponse = responseCache->find(this->responseCacheKey.value());
+        this->timer->stop(EXECUTE);
+        if (this->cachedResponse) {
+            // time of serving from cache is reported as inference time, so latency metrics include hits
+            OBSERVE_IF_ENABLED(this->model->getMetricReporter().inferenceTime, this->timer->elapsed<std::chrono::microseconds>(EXECUTE));
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] Response cache hit for model: {} session: {}", getName(), getModelName(), getSessionKey());
+            return status;
+        }
+    }
     this->timer->start(GET_INFER_REQUEST);
     this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(model->getInferRequestsQueue(), model->getMetricReporter());
     return status;
@@ -210,6 +227,12 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
             notifyEndQueue.push({node, getSessionKey()});
             return status;
         }
+        if (this->cachedResponse) {
+            // results are already available, infer request is not acquired at all
+            this->inputHandler->clearInputs();
+            notifyEndQueue.push({node, getSessionKey()});
+            return status;
+        }
     }
     auto streamIdOpt = this->nodeStreamIdGuard->tryGetId(waitForStreamIdTimeoutMicroseconds);
     if (!streamIdOpt) {
@@ -221,6 +244,9 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint waitForSt
     this->timer->stop(GET_INFER_REQUEST);
     double getInferRequestTime = this->timer->elapsed<std::chrono::microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->model->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    if (this->model->getAutoTuner()) {
+        this->model->getAutoTuner()->recordWaitTime(getInferRequestTime);
+    }
     status = setInputsForInference(inferRequest);
     if (!status.ok()) {
         notifyEndQueue.push({node, getSessionKey()});
@@ -309,7 +335,20 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
     return StatusCode::OK;
 }
 
+void DLNodeSession::insertToResponseCache(TensorMap outputs) {
+    if (!this->responseCacheKey.has_value()) {
+        return;
+    }
+    auto* responseCache = this->model->getResponseCache();
+    if (responseCache != nullptr) {
+        responseCache->insert(std::move(this->responseCacheKey.value()), std::move(outputs));
+        this->responseCacheKey.reset();
+    }
+}
+
 void DLNodeSession::release() {
+    this->cachedResponse.reset();
+    this->responseCacheKey.reset();
     this->nodeStreamIdGuard.reset();
     this->model.reset();
     this->modelUnloadGuard.reset();
@@ -17,14 +17,17 @@
 
 #include <memory>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
 
 #include <openvino/openvino.hpp>
 
 #include "../modelversion.hpp"
+#include "../response_cache.hpp"
 #include "nodesession.hpp"
 #include "pipelineeventqueue.hpp"
+#include "tensormap.hpp"
 
 namespace ovms {
 
@@ -45,13 +48,20 @@ class DLNodeSession : public NodeSession {
     const std::string& modelName;
     const model_version_t modelVersion;
 
+    // model outputs (before output_mapping) consumed by following nodes, part of response cache key
+    const std::set<std::string> requestedOutputs;
+    std::optional<ResponseCacheKey> responseCacheKey;
+    std::shared_ptr<const CachedResponse> cachedResponse;
+
 public:
-    DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion);
-    DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion);
+    DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> requestedOutputs = {});
+    DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelManager& manager, const std::string& modelName, model_version_t modelVersion, std::set<std::string> requestedOutputs = {});
     virtual ~DLNodeSession();
 
     ov::InferRequest& getInferRequest(const uint microseconds);
     ModelInstance& getModelInstance();
+    const CachedResponse* getCachedResponse() const { return cachedResponse.get(); }
+    void insertToResponseCache(TensorMap outputs);
 
 private:
     Status requestExecuteRequiredResources();
@@ -74,7 +74,7 @@ Status EntryNode<RequestType>::fetchResults(TensorWithSourceMap& outputs) {
     }
     InputSink<TensorWithSourceMap&> inputSink(outputs);
     bool isPipeline = true;
-    return deserializePredictRequest<ConcreteTensorProtoDeserializator>(*request, inputsInfo, inputSink, isPipeline);
+    return deserializePredictRequest<ConcreteTensorProtoDeserializator>(*request, *inputsInfo, inputSink, isPipeline);
 }
 
 template <>
@@ -116,7 +116,7 @@ const Status EntryNode<RequestType>::validate() {
     static const std::set<std::string> optionalInputNames = {};
     return request_validation_utils::validate(
         *request,
-        inputsInfo,
+        *inputsDescriptors,
         getRequestServableName(*request),
         1,
         optionalInputNames);  // Pipelines are not versioned and always reports version 1
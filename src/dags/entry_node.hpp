@@ -17,10 +17,12 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 
 #include <openvino/openvino.hpp>
 
 #include "../logging.hpp"
+#include "../tensor_descriptor.hpp"
 #include "../tensorinfo.hpp"
 #include "node.hpp"
 
@@ -31,15 +33,29 @@ extern const std::string ENTRY_NODE_NAME;
 template <typename RequestType>
 class EntryNode : public Node {
     const RequestType* request;
-    const tensor_map_t inputsInfo;
+    const std::shared_ptr<const tensor_map_t> inputsInfo;
+    const std::shared_ptr<const TensorDescriptorTable> inputsDescriptors;
 
 public:
     EntryNode(const RequestType* request,
         const tensor_map_t& inputsInfo,
         std::optional<int32_t> demultiplyCount = std::nullopt) :
+        EntryNode(request, std::make_shared<const tensor_map_t>(inputsInfo), demultiplyCount) {}
+
+    EntryNode(const RequestType* request,
+        std::shared_ptr<const tensor_map_t> inputsInfo,
+        std::optional<int32_t> demultiplyCount = std::nullopt) :
+        EntryNode(request, inputsInfo, std::make_shared<const TensorDescriptorTable>(*inputsInfo), demultiplyCount) {}
+
+    // Shares inputs metadata and descriptors owned by pipeline execution plan instead of building them per request
+    EntryNode(const RequestType* request,
+        std::shared_ptr<const tensor_map_t> inputsInfo,
+        std::shared_ptr<const TensorDescriptorTable> inputsDescriptors,
+        std::optional<int32_t> demultiplyCount = std::nullopt) :
         Node(ENTRY_NODE_NAME, demultiplyCount),
         request(request),
-        inputsInfo(inputsInfo) {}
+        inputsInfo(std::move(inputsInfo)),
+        inputsDescriptors(std::move(inputsDescriptors)) {}
 
     Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override;
 
@@ -51,7 +67,8 @@ protected:
 
 public:
     // Entry nodes have no dependency
-    void addDependency(Node&, const Aliases&) override {
+    using Node::addDependency;
+    void addDependency(Node&, std::shared_ptr<const Aliases>) override {
         throw std::logic_error("This node cannot have dependency");
     }
 
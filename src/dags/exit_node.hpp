@@ -30,15 +30,19 @@ extern const std::string DEFAULT_PIPELINE_NAME;
 template <typename ResponseType>
 class ExitNode : public Node {
     ResponseType* response;
-    const tensor_map_t outputsInfo;
+    const std::shared_ptr<const tensor_map_t> outputsInfo;
     bool useSharedOutputContent;
     const std::string& pipelineName;
 
 public:
     ExitNode(ResponseType* response, const tensor_map_t& outputsInfo, std::set<std::string> gatherFromNode = {}, bool useSharedOutputContent = true, const std::string& pipelineName = DEFAULT_PIPELINE_NAME) :
+        ExitNode(response, std::make_shared<const tensor_map_t>(outputsInfo), std::move(gatherFromNode), useSharedOutputContent, pipelineName) {}
+
+    // Shares outputs metadata owned by pipeline execution plan instead of copying it per request
+    ExitNode(ResponseType* response, std::shared_ptr<const tensor_map_t> outputsInfo, std::set<std::string> gatherFromNode = {}, bool useSharedOutputContent = true, const std::string& pipelineName = DEFAULT_PIPELINE_NAME) :
         Node(EXIT_NODE_NAME, std::nullopt, std::move(gatherFromNode)),
         response(response),
-        outputsInfo(outputsInfo),
+        outputsInfo(std::move(outputsInfo)),
         useSharedOutputContent(useSharedOutputContent),
         pipelineName(pipelineName) {
     }
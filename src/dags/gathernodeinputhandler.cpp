@@ -22,6 +22,7 @@
 #include "../ov_utils.hpp"
 #include "../profiler.hpp"
 #include "../status.hpp"
+#include "../tensor_memory_pool.hpp"
 #include "../tensorinfo.hpp"
 #include "nodesessionmetadata.hpp"
 
@@ -110,8 +111,14 @@ Status GatherNodeInputHandler::notifyFinishedDependency() {
     return StatusCode::OK;
 }
 
+// Consolidated tensors are not bound to single model instance, so gather nodes of all pipelines share one pool
+static ov::Allocator getGatherTensorAllocator() {
+    static std::shared_ptr<TensorMemoryPool> pool = std::make_shared<TensorMemoryPool>("gather nodes", TensorMemoryPool::getConfiguredMaxCachedBytes());
+    return pool->getAllocator();
+}
+
 Status GatherNodeInputHandler::prepareConsolidatedTensor(ov::Tensor& tensorOut, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape) const {
-    return createSharedTensor(tensorOut, precision, shape);
+    return createSharedTensor(tensorOut, precision, shape, getGatherTensorAllocator());
 }
 
 }  // namespace ovms
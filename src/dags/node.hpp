@@ -51,7 +51,8 @@ protected:
     std::unordered_map<session_key_t, std::unique_ptr<NodeSession>> nodeSessions;
 
     // Input/Output name mapping and list of required inputs from previous nodes
-    std::unordered_map<std::string, Aliases> tensorNamesMapping;
+    // Mappings are shared with pipeline execution plan so that connecting nodes does not copy them
+    std::unordered_map<std::string, std::shared_ptr<const Aliases>> tensorNamesMapping;
 
     const std::optional<int32_t> demultiplexCount;
     const std::optional<std::set<std::string>> gatherFrom;
@@ -75,15 +76,19 @@ public:
     Status setInputs(const Node& dependency, TensorWithSourceMap& inputs, NodeSessionMetadata& metadata);
     Status setInputs(const Node& dependency, SessionResults& inputs);
 
-    virtual void addDependency(Node& node, const Aliases& tensorNamesMapping) {
+    virtual void addDependency(Node& node, std::shared_ptr<const Aliases> tensorNamesMapping) {
         this->previous.emplace_back(node);
-        this->tensorNamesMapping[node.getName()] = tensorNamesMapping;
+        this->tensorNamesMapping[node.getName()] = std::move(tensorNamesMapping);
+    }
+
+    void addDependency(Node& node, const Aliases& tensorNamesMapping) {
+        this->addDependency(node, std::make_shared<const Aliases>(tensorNamesMapping));
     }
 
     virtual void addDependant(Node& node) { this->next.emplace_back(node); }
 
     const Aliases& getMappingByDependency(const Node& dependency) {
-        return tensorNamesMapping.at(dependency.getName());
+        return *tensorNamesMapping.at(dependency.getName());
     }
 
     std::vector<session_key_t> getReadySessions() const;
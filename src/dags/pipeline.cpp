@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <utility>
@@ -35,20 +36,29 @@ using DeferredNodeSessions = std::vector<std::pair<std::reference_wrapper<Node>,
 
 Pipeline::~Pipeline() = default;
 
-Pipeline::Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name) :
+Pipeline::Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name, std::shared_ptr<LogRateLimiter> errorLogRateLimiter) :
     name(name),
     entry(entry),
     exit(exit),
-    reporter(reporter) {}
+    reporter(reporter),
+    errorLogRateLimiter(errorLogRateLimiter ? std::move(errorLogRateLimiter) : std::make_shared<LogRateLimiter>(LOG_RATE_LIMIT_INTERVAL)) {}
 
 void Pipeline::push(std::unique_ptr<Node> node) {
     nodes.emplace_back(std::move(node));
 }
+void Pipeline::reserve(size_t nodesCount) {
+    nodes.reserve(nodesCount);
+}
+
 void Pipeline::connect(Node& from, Node& to, const Aliases& tensorNamesMapping) {
+    connect(from, to, std::make_shared<const Aliases>(tensorNamesMapping));
+}
+
+void Pipeline::connect(Node& from, Node& to, std::shared_ptr<const Aliases> tensorNamesMapping) {
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Connecting from: {}, to: {}", from.getName(), to.getName());
-    printNodeConnections(to.getName(), from.getName(), tensorNamesMapping);
+    printNodeConnections(to.getName(), from.getName(), *tensorNamesMapping);
     from.addDependant(to);
-    to.addDependency(from, tensorNamesMapping);
+    to.addDependency(from, std::move(tensorNamesMapping));
 }
 
 void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs) {
@@ -81,7 +91,8 @@ inline static void setFailIfNotFailEarlier(ovms::Status& earlierStatusCode, ovms
 #define CHECK_AND_LOG_ERROR(NODE)                                                                                                          \
     if (!status.ok()) {                                                                                                                    \
         setFailIfNotFailEarlier(firstErrorStatus, status);                                                                                 \
-        SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} session: {} failed with ret code: {}, error message: {}", \
+        OVMS_LOG_WITH_RATE_LIMITER(*errorLogRateLimiter, dag_executor_logger, spdlog::level::warn,                                         \
+            "Executing pipeline: {} node: {} session: {} failed with ret code: {}, error message: {}",                                     \
             getName(), NODE.getName(), sessionKey, status.getCode(), status.string());                                                     \
     }
 
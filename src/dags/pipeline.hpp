@@ -26,6 +26,7 @@
 namespace ovms {
 
 class ExecutionContext;
+class LogRateLimiter;
 class ServableMetricReporter;
 class Node;
 
@@ -40,17 +41,21 @@ class Pipeline {
     Node& entry;
     Node& exit;
     ServableMetricReporter& reporter;
+    // shared by pipelines created from the same definition, so that failing requests do not flood the log
+    std::shared_ptr<LogRateLimiter> errorLogRateLimiter;
 
 public:
-    Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name = "default_name");
+    Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name = "default_name", std::shared_ptr<LogRateLimiter> errorLogRateLimiter = nullptr);
 
     void push(std::unique_ptr<Node> node);
+    void reserve(size_t nodesCount);
     ~Pipeline();
 
     Node& getEntry() const { return this->entry; }
     Node& getExit() const { return this->exit; }
 
     static void connect(Node& from, Node& to, const Aliases& tensorNamesMapping);
+    static void connect(Node& from, Node& to, std::shared_ptr<const Aliases> tensorNamesMapping);
 
     Status execute(ExecutionContext context);
     const std::string& getName() const {
@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "pipeline_execution_plan.hpp"
+
+#include <queue>
+#include <unordered_map>
+#include <utility>
+
+#include "../logging.hpp"
+#include "../status.hpp"
+
+namespace ovms {
+
+Status PipelineExecutionPlan::compile(const std::string& pipelineName,
+    const std::vector<NodeInfo>& nodeInfos,
+    const pipeline_connections_t& connections,
+    const std::map<std::string, std::shared_ptr<CNLIMWrapper>>& nodeResources,
+    const tensor_map_t& inputsInfo,
+    const tensor_map_t& outputsInfo,
+    std::shared_ptr<const PipelineExecutionPlan>& plan) {
+    std::unordered_map<std::string, size_t> definitionIndexes;
+    definitionIndexes.reserve(nodeInfos.size());
+    for (size_t i = 0; i < nodeInfos.size(); ++i) {
+        definitionIndexes.emplace(nodeInfos[i].nodeName, i);
+    }
+
+    // Kahn's algorithm over definition indexes
+    std::vector<size_t> inDegree(nodeInfos.size(), 0);
+    std::vector<std::vector<std::pair<size_t, const Aliases*>>> dependants(nodeInfos.size());
+    for (const auto& [dependantName, dependencies] : connections) {
+        auto dependantIt = definitionIndexes.find(dependantName);
+        if (dependantIt == definitionIndexes.end()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Pipeline: {} execution plan refers to missing node: {}", pipelineName, dependantName);
+            return StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_NODE;
+        }
+        for (const auto& [dependencyName, aliases] : dependencies) {
+            auto dependencyIt = definitionIndexes.find(dependencyName);
+            if (dependencyIt == definitionIndexes.end()) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Pipeline: {} execution plan refers to missing node: {}", pipelineName, dependencyName);
+                return StatusCode::PIPELINE_NODE_REFERING_TO_MISSING_NODE;
+            }
+            dependants[dependencyIt->second].emplace_back(dependantIt->second, &aliases);
+            ++inDegree[dependantIt->second];
+        }
+    }
+    std::queue<size_t> ready;
+    for (size_t i = 0; i < nodeInfos.size(); ++i) {
+        if (inDegree[i] == 0) {
+            ready.push(i);
+        }
+    }
+    std::vector<size_t> planIndexes(nodeInfos.size());
+    std::vector<size_t> order;
+    order.reserve(nodeInfos.size());
+    while (!ready.empty()) {
+        size_t current = ready.front();
+        ready.pop();
+        planIndexes[current] = order.size();
+        order.push_back(current);
+        for (const auto& [dependant, aliases] : dependants[current]) {
+            if (--inDegree[dependant] == 0) {
+                ready.push(dependant);
+            }
+        }
+    }
+    if (order.size() != nodeInfos.size()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Pipeline: {} cannot be ordered topologically", pipelineName);
+        return StatusCode::PIPELINE_CYCLE_FOUND;
+    }
+
+    auto compiled = std::make_shared<PipelineExecutionPlan>();
+    compiled->nodeInfos.reserve(order.size());
+    compiled->nodeResources.reserve(order.size());
+    for (size_t definitionIndex : order) {
+        const auto& info = nodeInfos[definitionIndex];
+        compiled->nodeInfos.push_back(info);
+        auto resourcesIt = nodeResources.find(info.nodeName);
+        compiled->nodeResources.push_back(resourcesIt != nodeResources.end() ? resourcesIt->second : nullptr);
+    }
+    for (size_t definitionIndex : order) {
+        for (const auto& [dependant, aliases] : dependants[definitionIndex]) {
+            compiled->connections.push_back({planIndexes[definitionIndex], planIndexes[dependant], std::make_shared<const Aliases>(*aliases)});
+        }
+    }
+    compiled->inputsInfo = std::make_shared<const tensor_map_t>(inputsInfo);
+    compiled->inputsDescriptors = std::make_shared<const TensorDescriptorTable>(*compiled->inputsInfo);
+    compiled->outputsInfo = std::make_shared<const tensor_map_t>(outputsInfo);
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Pipeline: {} execution plan compiled with {} nodes and {} connections",
+        pipelineName, compiled->nodeInfos.size(), compiled->connections.size());
+    plan = std::move(compiled);
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../tensor_descriptor.hpp"
+#include "../tensorinfo.hpp"
+#include "aliases.hpp"
+#include "nodeinfo.hpp"
+
+namespace ovms {
+class CNLIMWrapper;
+class Status;
+
+/**
+ * @brief Immutable description of pipeline graph compiled once per pipeline definition validation.
+ * Nodes are stored in topological order and referenced by index, connections carry
+ * aliases shared with created nodes so that per request pipeline construction
+ * does not need to copy or look up anything by name.
+ */
+class PipelineExecutionPlan {
+public:
+    struct Connection {
+        size_t dependencyIndex;
+        size_t dependantIndex;
+        std::shared_ptr<const Aliases> aliases;
+    };
+
+private:
+    std::vector<NodeInfo> nodeInfos;
+    std::vector<std::shared_ptr<CNLIMWrapper>> nodeResources;
+    std::vector<Connection> connections;
+    std::shared_ptr<const tensor_map_t> inputsInfo;
+    // built from inputsInfo, used by entry nodes to validate requests
+    std::shared_ptr<const TensorDescriptorTable> inputsDescriptors;
+    std::shared_ptr<const tensor_map_t> outputsInfo;
+
+public:
+    PipelineExecutionPlan() = default;
+
+    static Status compile(const std::string& pipelineName,
+        const std::vector<NodeInfo>& nodeInfos,
+        const pipeline_connections_t& connections,
+        const std::map<std::string, std::shared_ptr<CNLIMWrapper>>& nodeResources,
+        const tensor_map_t& inputsInfo,
+        const tensor_map_t& outputsInfo,
+        std::shared_ptr<const PipelineExecutionPlan>& plan);
+
+    const std::vector<NodeInfo>& getNodeInfos() const { return nodeInfos; }
+    const std::shared_ptr<CNLIMWrapper>& getNodeResources(size_t nodeIndex) const { return nodeResources[nodeIndex]; }
+    const std::vector<Connection>& getConnections() const { return connections; }
+    const std::shared_ptr<const tensor_map_t>& getInputsInfo() const { return inputsInfo; }
+    const std::shared_ptr<const TensorDescriptorTable>& getInputsDescriptors() const { return inputsDescriptors; }
+    const std::shared_ptr<const tensor_map_t>& getOutputsInfo() const { return outputsInfo; }
+};
+}  // namespace ovms
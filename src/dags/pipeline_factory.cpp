@@ -29,17 +29,17 @@
 namespace ovms {
 
 bool PipelineFactory::definitionExists(const std::string& name) const {
-    std::shared_lock lock(definitionsMtx);
-    return definitions.find(name) != definitions.end();
+    return findDefinitionByName(name) != nullptr;
 }
 
 PipelineDefinition* PipelineFactory::findDefinitionByName(const std::string& name) const {
-    std::shared_lock lock(definitionsMtx);
-    auto it = definitions.find(name);
-    if (it == std::end(definitions)) {
+    RcuReadGuard guard;
+    const auto& snapshot = definitionsSnapshot.read();
+    auto it = snapshot.find(name);
+    if (it == std::end(snapshot)) {
         return nullptr;
     } else {
-        return it->second.get();
+        return it->second;
     }
 }
 
@@ -77,6 +77,11 @@ Status PipelineFactory::createDefinition(const std::string& pipelineName,
 
     std::unique_lock lock(definitionsMtx);
     definitions[pipelineName] = std::move(pipelineDefinition);
+    auto snapshot = std::make_unique<std::map<std::string, PipelineDefinition*>>();
+    for (const auto& [name, definition] : definitions) {
+        snapshot->emplace(name, definition.get());
+    }
+    definitionsSnapshot.publish(std::move(snapshot));
 
     return validationResult;
 }
@@ -123,14 +128,12 @@ const std::vector<std::string> PipelineFactory::getPipelinesNames() const {
 
 template <typename RequestType, typename ResponseType>
 Status PipelineFactory::create(std::unique_ptr<Pipeline>& pipeline, const std::string& name, const RequestType* request, ResponseType* response, ModelManager& manager) const {
-    std::shared_lock lock(definitionsMtx);
-    if (!definitionExists(name)) {
+    auto definition = findDefinitionByName(name);
+    if (definition == nullptr) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline with requested name: {} does not exist", name);
         return StatusCode::PIPELINE_DEFINITION_NAME_MISSING;
     }
-    auto& definition = *definitions.at(name);
-    lock.unlock();
-    return definition.create(pipeline, request, response, manager);
+    return definition->create(pipeline, request, response, manager);
 }
 
 template Status PipelineFactory::create<::KFSRequest, ::KFSResponse>(std::unique_ptr<Pipeline>& pipeline, const std::string& name, const ::KFSRequest* request, ::KFSResponse* response, ModelManager& manager) const;
@@ -29,6 +29,7 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../rcu_snapshot.hpp"
 #include "nodeinfo.hpp"
 
 namespace ovms {
@@ -42,6 +43,8 @@ class Status;
 class PipelineFactory {
     std::map<std::string, std::unique_ptr<PipelineDefinition>> definitions;
     mutable std::shared_mutex definitionsMtx;
+    // definitions are never removed, request path lookups read published copy of name to definition mapping
+    RcuSnapshot<std::map<std::string, PipelineDefinition*>> definitionsSnapshot;
 
 public:
     Status createDefinition(const std::string& pipelineName,
@@ -36,6 +36,7 @@
 #include "nodeinfo.hpp"
 #include "nodestreamidguard.hpp"
 #include "pipeline.hpp"
+#include "pipeline_execution_plan.hpp"
 #include "pipelinedefinitionunloadguard.hpp"
 
 namespace ovms {
@@ -63,6 +64,7 @@ PipelineDefinition::PipelineDefinition(const std::string& pipelineName,
     nodeInfos(nodeInfos),
     connections(connections),
     reporter(std::make_unique<ServableMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
+    errorLogRateLimiter(std::make_shared<LogRateLimiter>(LOG_RATE_LIMIT_INTERVAL)),
     status(SCHEDULER_CLASS_NAME, this->pipelineName) {}
 
 Status PipelineDefinition::validate(ModelManager& manager) {
@@ -103,6 +105,10 @@ Status PipelineDefinition::validate(ModelManager& manager) {
     if (!validationResult.ok()) {
         return validationResult;
     }
+    validationResult = PipelineExecutionPlan::compile(getName(), nodeInfos, connections, nodeResources, inputsInfo, outputsInfo, executionPlan);
+    if (!validationResult.ok()) {
+        return validationResult;
+    }
     lock.unlock();
     notifier.passed = true;
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Finished validation of pipeline: {}", getName());
@@ -166,6 +172,10 @@ Status PipelineDefinition::reload(ModelManager& manager, const std::vector<NodeI
     while (requestsHandlesCounter > 0) {
         std::this_thread::sleep_for(std::chrono::microseconds(1));
     }
+    {
+        std::unique_lock lock(metadataMtx);
+        this->executionPlan.reset();
+    }
     // deinitialize all resources that are associated with nodes that are currently in PipelineDefinition, but not in nodeInfos
     deinitializeNodeResources(calculateNodeInfosDiff(nodeInfos));
     this->nodeInfos = std::move(nodeInfos);
@@ -181,6 +191,10 @@ void PipelineDefinition::retire(ModelManager& manager) {
     while (requestsHandlesCounter > 0) {
         std::this_thread::sleep_for(std::chrono::microseconds(1));
     }
+    {
+        std::unique_lock lock(metadataMtx);
+        this->executionPlan.reset();
+    }
     // deinitalize all resources
     deinitializeNodeResources(this->nodeInfos);
     this->nodeResources.clear();
@@ -245,44 +259,52 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
         return status;
     }
 
-    std::unordered_map<std::string, std::unique_ptr<Node>> nodes;
+    auto plan = getExecutionPlan();
+    if (!plan) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Requested pipeline: {} has no execution plan", getName());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const auto& planNodeInfos = plan->getNodeInfos();
+    std::vector<std::unique_ptr<Node>> nodes;
+    nodes.reserve(planNodeInfos.size());
     EntryNode<RequestType>* entry = nullptr;
     ExitNode<ResponseType>* exit = nullptr;
 
-    for (const auto& info : nodeInfos) {
+    for (size_t i = 0; i < planNodeInfos.size(); ++i) {
+        const auto& info = planNodeInfos[i];
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Creating pipeline: {}. Adding nodeName: {}, modelName: {}",
             getName(), info.nodeName, info.modelName);
         switch (info.kind) {
         case NodeKind::ENTRY: {
-            auto node = std::make_unique<EntryNode<RequestType>>(request, getInputsInfo(), info.demultiplyCount);
+            auto node = std::make_unique<EntryNode<RequestType>>(request, plan->getInputsInfo(), plan->getInputsDescriptors(), info.demultiplyCount);
             entry = node.get();
-            nodes.emplace(info.nodeName, std::move(node));
+            nodes.emplace_back(std::move(node));
             break;
         }
         case NodeKind::DL:
-            nodes.emplace(info.nodeName, std::make_unique<DLNode>(
-                                             info.nodeName,
-                                             info.modelName,
-                                             info.modelVersion,
-                                             manager,
-                                             info.outputNameAliases,
-                                             info.demultiplyCount,
-                                             info.gatherFromNode));
+            nodes.emplace_back(std::make_unique<DLNode>(
+                info.nodeName,
+                info.modelName,
+                info.modelVersion,
+                manager,
+                info.outputNameAliases,
+                info.demultiplyCount,
+                info.gatherFromNode));
             break;
         case NodeKind::CUSTOM:
-            nodes.emplace(info.nodeName, std::make_unique<CustomNode>(
-                                             info.nodeName,
-                                             info.library,
-                                             info.parameters,
-                                             info.outputNameAliases,
-                                             info.demultiplyCount,
-                                             info.gatherFromNode,
-                                             nodeResources.at(info.nodeName)));
+            nodes.emplace_back(std::make_unique<CustomNode>(
+                info.nodeName,
+                info.library,
+                info.parameters,
+                info.outputNameAliases,
+                info.demultiplyCount,
+                info.gatherFromNode,
+                plan->getNodeResources(i)));
             break;
         case NodeKind::EXIT: {
-            auto node = std::make_unique<ExitNode<ResponseType>>(response, getOutputsInfo(), info.gatherFromNode, useSharedOutputContentFn(request), getName());
+            auto node = std::make_unique<ExitNode<ResponseType>>(response, plan->getOutputsInfo(), info.gatherFromNode, useSharedOutputContentFn(request), getName());
             exit = node.get();
-            nodes.emplace(info.nodeName, std::move(node));
+            nodes.emplace_back(std::move(node));
             break;
         }
         default:
@@ -290,17 +312,16 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
             throw std::invalid_argument("unknown node kind");
         }
     }
-    for (const auto& kv : connections) {
-        const auto& dependantNode = nodes.at(kv.first);
-        for (const auto& pair : kv.second) {
-            const auto& dependencyNode = nodes.at(pair.first);
-            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Connecting pipeline: {}, from: {}, to: {}", getName(), dependencyNode->getName(), dependantNode->getName());
-            Pipeline::connect(*dependencyNode, *dependantNode, pair.second);
-        }
+    for (const auto& connection : plan->getConnections()) {
+        auto& dependencyNode = *nodes[connection.dependencyIndex];
+        auto& dependantNode = *nodes[connection.dependantIndex];
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Connecting pipeline: {}, from: {}, to: {}", getName(), dependencyNode.getName(), dependantNode.getName());
+        Pipeline::connect(dependencyNode, dependantNode, connection.aliases);
     }
-    pipeline = std::make_unique<Pipeline>(*entry, *exit, *this->reporter, pipelineName);
-    for (auto& kv : nodes) {
-        pipeline->push(std::move(kv.second));
+    pipeline = std::make_unique<Pipeline>(*entry, *exit, *this->reporter, pipelineName, errorLogRateLimiter);
+    pipeline->reserve(nodes.size());
+    for (auto& node : nodes) {
+        pipeline->push(std::move(node));
     }
     return status;
 }
@@ -1068,6 +1089,11 @@ const tensor_map_t PipelineDefinition::getOutputsInfo() const {
     return copy;
 }
 
+std::shared_ptr<const PipelineExecutionPlan> PipelineDefinition::getExecutionPlan() const {
+    std::shared_lock lock(metadataMtx);
+    return executionPlan;
+}
+
 static std::shared_ptr<const TensorInfo> applyDemultiplexerShapeForTensor(const std::shared_ptr<const TensorInfo>& tensorInfo, int32_t demultiplyCount) {
     return tensorInfo->createCopyWithDemultiplexerDimensionPrefix(demultiplyCount ? Dimension(demultiplyCount) : Dimension::any());
 }
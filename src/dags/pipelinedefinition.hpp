@@ -39,6 +39,7 @@
 
 namespace ovms {
 class CNLIMWrapper;
+class LogRateLimiter;
 class MetricConfig;
 class MetricRegistry;
 class ModelManager;
@@ -46,6 +47,7 @@ class ServableMetricReporter;
 class NodeValidator;
 class Pipeline;
 class PipelineDefinitionUnloadGuard;
+class PipelineExecutionPlan;
 class Status;
 
 class PipelineDefinition {
@@ -81,6 +83,8 @@ protected:
 
 private:
     mutable std::shared_mutex metadataMtx;
+    // compiled during validation and shared by all pipelines created from this definition
+    std::shared_ptr<const PipelineExecutionPlan> executionPlan;
     std::atomic<uint64_t> requestsHandlesCounter = 0;
     std::condition_variable loadedNotify;
 
@@ -89,6 +93,9 @@ private:
 
     std::unique_ptr<ServableMetricReporter> reporter;
 
+    // limits logging of failed executions of pipelines created from this definition
+    std::shared_ptr<LogRateLimiter> errorLogRateLimiter;
+
 protected:
     PipelineDefinitionStatus status;
 
@@ -159,6 +166,7 @@ protected:
 public:
     const tensor_map_t getInputsInfo() const;
     const tensor_map_t getOutputsInfo() const;
+    std::shared_ptr<const PipelineExecutionPlan> getExecutionPlan() const;
 
 private:
     static Status getCustomNodeMetadata(const NodeInfo& customNodeInfo, tensor_map_t& inputsInfo, metadata_fn callback, const std::string& pipelineName, void* customNodeLibraryInternalManager);
@@ -97,7 +97,8 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
     return ov::Tensor(precision, shape, const_cast<void*>(reinterpret_cast<const void*>(buffer.data())));
 }
 ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
-    const std::shared_ptr<const TensorInfo>& tensorInfo) {
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const ov::Allocator& allocator) {
     OVMS_PROFILE_FUNCTION();
     OV_LOGGER("ov::Shape()");
     ov::Shape shape;
@@ -108,7 +109,7 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
 
     ov::element::Type precision = tensorInfo->getOvPrecision();
     OV_LOGGER("ov::Tensor({}, shape)", toString(ovms::ovElementTypeToOvmsPrecision(precision)));
-    ov::Tensor tensor(precision, shape);
+    ov::Tensor tensor(precision, shape, allocator);
     return tensor;
 }
 }  // namespace ovms
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -32,6 +33,7 @@
 #include "capi_frontend/inferencetensor.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "logging.hpp"
+#include "precision_conversion.hpp"
 #include "profiler.hpp"
 #include "status.hpp"
 #include "tensor_conversion.hpp"
@@ -54,19 +56,54 @@ ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo,
     const std::string& buffer);
 ov::Tensor makeTensor(const ::KFSRequest::InferInputTensor& requestInput,
-    const std::shared_ptr<const TensorInfo>& tensorInfo);
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const ov::Allocator& allocator);
 
 ov::Tensor makeTensor(const InferenceTensor& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo);
 
 class ConcreteTensorProtoDeserializator {
+    template <typename T, typename ContentsType>
+    static ov::Tensor deserializeTypedContents(
+        const ::KFSRequest::InferInputTensor& requestInput,
+        const std::shared_ptr<const TensorInfo>& tensorInfo,
+        const google::protobuf::RepeatedField<ContentsType>& contents,
+        const ov::Allocator& allocator) {
+        ov::Tensor tensor = makeTensor(requestInput, tensorInfo, allocator);
+        size_t count = std::min(static_cast<size_t>(contents.size()), tensor.get_size());
+        convertContents(contents.data(), reinterpret_cast<T*>(tensor.data()), count);
+        return tensor;
+    }
+
+    static ov::Tensor deserializeWirePrecisionContents(
+        const ::KFSRequest::InferInputTensor& requestInput,
+        const std::shared_ptr<const TensorInfo>& tensorInfo,
+        const std::string& buffer,
+        const ov::Allocator& allocator) {
+        OVMS_PROFILE_FUNCTION();
+        ov::Tensor tensor = makeTensor(requestInput, tensorInfo, allocator);
+        const uint16_t* source = reinterpret_cast<const uint16_t*>(buffer.data());
+        size_t count = std::min(buffer.size() / sizeof(uint16_t), tensor.get_size());
+        if (tensorInfo->getWirePrecision() == ovms::Precision::BF16) {
+            convertBf16ToFp32(source, reinterpret_cast<float*>(tensor.data()), count);
+        } else {
+            convertFp16ToFp32(source, reinterpret_cast<float*>(tensor.data()), count);
+        }
+        return tensor;
+    }
+
 public:
     static ov::Tensor deserializeTensorProto(
         const ::KFSRequest::InferInputTensor& requestInput,
         const std::shared_ptr<const TensorInfo>& tensorInfo,
-        const std::string* buffer) {
+        const std::string* buffer,
+        const ov::Allocator& allocator) {
         OVMS_PROFILE_FUNCTION();
         if (nullptr != buffer) {
+            if ((tensorInfo->getWirePrecision() != ovms::Precision::UNDEFINED) &&
+                (requestInput.datatype() == wirePrecisionToKFSPrecision(tensorInfo->getWirePrecision()))) {
+                return deserializeWirePrecisionContents(requestInput, tensorInfo, *buffer, allocator);
+            }
             switch (tensorInfo->getPrecision()) {
             case ovms::Precision::FP64:
             case ovms::Precision::FP32:
@@ -94,122 +131,34 @@ public:
         } else {
             switch (tensorInfo->getPrecision()) {
                 // bool_contents
-            case ovms::Precision::BOOL: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                bool* ptr = reinterpret_cast<bool*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().bool_contents()) {
-                    ptr[i++] = *(const_cast<bool*>(reinterpret_cast<const bool*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::BOOL:
+                return deserializeTypedContents<bool>(requestInput, tensorInfo, requestInput.contents().bool_contents(), allocator);
                 /// int_contents
-            case ovms::Precision::I8: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int8_t* ptr = reinterpret_cast<int8_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int_contents()) {
-                    ptr[i++] = *(const_cast<int8_t*>(reinterpret_cast<const int8_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::I16: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int16_t* ptr = reinterpret_cast<int16_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int_contents()) {
-                    ptr[i++] = *(const_cast<int16_t*>(reinterpret_cast<const int16_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::I32: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int32_t* ptr = reinterpret_cast<int32_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int_contents()) {
-                    ptr[i++] = *(const_cast<int32_t*>(reinterpret_cast<const int32_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::I8:
+                return deserializeTypedContents<int8_t>(requestInput, tensorInfo, requestInput.contents().int_contents(), allocator);
+            case ovms::Precision::I16:
+                return deserializeTypedContents<int16_t>(requestInput, tensorInfo, requestInput.contents().int_contents(), allocator);
+            case ovms::Precision::I32:
+                return deserializeTypedContents<int32_t>(requestInput, tensorInfo, requestInput.contents().int_contents(), allocator);
                 /// int64_contents
-            case ovms::Precision::I64: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                int64_t* ptr = reinterpret_cast<int64_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().int64_contents()) {
-                    ptr[i++] = *(const_cast<int64_t*>(reinterpret_cast<const int64_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::I64:
+                return deserializeTypedContents<int64_t>(requestInput, tensorInfo, requestInput.contents().int64_contents(), allocator);
                 // uint_contents
-            case ovms::Precision::U8: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint8_t* ptr = reinterpret_cast<uint8_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint_contents()) {
-                    ptr[i++] = *(const_cast<uint8_t*>(reinterpret_cast<const uint8_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::U16: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint16_t* ptr = reinterpret_cast<uint16_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint_contents()) {
-                    ptr[i++] = *(const_cast<uint16_t*>(reinterpret_cast<const uint16_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
-            case ovms::Precision::U32: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint32_t* ptr = reinterpret_cast<uint32_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint_contents()) {
-                    ptr[i++] = *(const_cast<uint32_t*>(reinterpret_cast<const uint32_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::U8:
+                return deserializeTypedContents<uint8_t>(requestInput, tensorInfo, requestInput.contents().uint_contents(), allocator);
+            case ovms::Precision::U16:
+                return deserializeTypedContents<uint16_t>(requestInput, tensorInfo, requestInput.contents().uint_contents(), allocator);
+            case ovms::Precision::U32:
+                return deserializeTypedContents<uint32_t>(requestInput, tensorInfo, requestInput.contents().uint_contents(), allocator);
                 // uint64_contents
-            case ovms::Precision::U64: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                uint64_t* ptr = reinterpret_cast<uint64_t*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().uint64_contents()) {
-                    ptr[i++] = *(const_cast<uint64_t*>(reinterpret_cast<const uint64_t*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::U64:
+                return deserializeTypedContents<uint64_t>(requestInput, tensorInfo, requestInput.contents().uint64_contents(), allocator);
                 // fp32_contents
-            case ovms::Precision::FP32: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                float* ptr = reinterpret_cast<float*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().fp32_contents()) {
-                    ptr[i++] = *(const_cast<float*>(reinterpret_cast<const float*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::FP32:
+                return deserializeTypedContents<float>(requestInput, tensorInfo, requestInput.contents().fp32_contents(), allocator);
                 // fp64_contentes
-            case ovms::Precision::FP64: {
-                ov::Tensor tensor = makeTensor(requestInput, tensorInfo);
-                double* ptr = reinterpret_cast<double*>(tensor.data());
-                size_t i = 0;
-                for (auto& number : requestInput.contents().fp64_contents()) {
-                    ptr[i++] = *(const_cast<double*>(reinterpret_cast<const double*>(&number)));
-                }
-                return tensor;
-                break;
-            }
+            case ovms::Precision::FP64:
+                return deserializeTypedContents<double>(requestInput, tensorInfo, requestInput.contents().fp64_contents(), allocator);
             case ovms::Precision::FP16:
             case ovms::Precision::U1:
             case ovms::Precision::CUSTOM:
@@ -227,7 +176,8 @@ public:
 
     static ov::Tensor deserializeTensorProto(
         const InferenceTensor& requestInput,
-        const std::shared_ptr<const TensorInfo>& tensorInfo) {
+        const std::shared_ptr<const TensorInfo>& tensorInfo,
+        const ov::Allocator& allocator) {
         OVMS_PROFILE_FUNCTION();
         switch (tensorInfo->getPrecision()) {
         case ovms::Precision::FP64:
@@ -258,7 +208,8 @@ public:
     }
     static ov::Tensor deserializeTensorProto(
         const tensorflow::TensorProto& requestInput,
-        const std::shared_ptr<const TensorInfo>& tensorInfo) {
+        const std::shared_ptr<const TensorInfo>& tensorInfo,
+        const ov::Allocator& allocator) {
         OVMS_PROFILE_FUNCTION();
         switch (tensorInfo->getPrecision()) {
         case ovms::Precision::FP32:
@@ -277,7 +228,7 @@ public:
                 OV_LOGGER("ov::Shape::push_back({})", requestInput.tensor_shape().dim(i).size());
                 shape.push_back(requestInput.tensor_shape().dim(i).size());
             }
-            ov::Tensor tensor(ov::element::f16, shape);
+            ov::Tensor tensor(ov::element::f16, shape, allocator);
             // Needs conversion due to zero padding for each value:
             // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L55
             uint16_t* ptr = (uint16_t*)tensor.data();
@@ -292,7 +243,7 @@ public:
             for (std::int64_t i = 0; i < requestInput.tensor_shape().dim_size(); i++) {
                 shape.push_back(requestInput.tensor_shape().dim(i).size());
             }
-            ov::Tensor tensor(ov::element::u16, shape);
+            ov::Tensor tensor(ov::element::u16, shape, allocator);
             // Needs conversion due to zero padding for each value:
             // https://github.com/tensorflow/tensorflow/blob/v2.2.0/tensorflow/core/framework/tensor.proto#L55
             uint16_t* ptr = (uint16_t*)tensor.data();
@@ -313,23 +264,26 @@ public:
 template <class TensorProtoDeserializator>
 ov::Tensor deserializeTensorProto(
     const tensorflow::TensorProto& requestInput,
-    const std::shared_ptr<const TensorInfo>& tensorInfo) {
-    return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo);
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const ov::Allocator& allocator = ov::Allocator()) {
+    return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo, allocator);
 }
 
 template <class TensorProtoDeserializator>
 ov::Tensor deserializeTensorProto(
     const ::KFSRequest::InferInputTensor& requestInput,
     const std::shared_ptr<const TensorInfo>& tensorInfo,
-    const std::string* buffer) {
-    return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo, buffer);
+    const std::string* buffer,
+    const ov::Allocator& allocator = ov::Allocator()) {
+    return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo, buffer, allocator);
 }
 
 template <class TensorProtoDeserializator>
 ov::Tensor deserializeTensorProto(
     const InferenceTensor& requestInput,
-    const std::shared_ptr<const TensorInfo>& tensorInfo) {
-    return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo);
+    const std::shared_ptr<const TensorInfo>& tensorInfo,
+    const ov::Allocator& allocator = ov::Allocator()) {
+    return TensorProtoDeserializator::deserializeTensorProto(requestInput, tensorInfo, allocator);
 }
 
 template <class Requester>
@@ -346,7 +300,8 @@ template <class TensorProtoDeserializator, class Sink>
 Status deserializePredictRequest(
     const tensorflow::serving::PredictRequest& request,
     const tensor_map_t& inputMap,
-    Sink& inputSink, bool isPipeline) {
+    Sink& inputSink, bool isPipeline,
+    const ov::Allocator& allocator = ov::Allocator()) {
     OVMS_PROFILE_FUNCTION();
     Status status;
     for (const auto& pair : inputMap) {
@@ -365,15 +320,15 @@ Status deserializePredictRequest(
                 switch (tensorInfo->getPreProcessingHint()) {
                 case TensorInfo::ProcessingHint::STRING_1D_U8:
                     SPDLOG_DEBUG("Request contains input in 1D string format: {}", name);
-                    RETURN_IF_ERR(convertStringRequestToOVTensor1D(requestInput, tensor, nullptr));
+                    RETURN_IF_ERR(convertStringRequestToOVTensor1D(requestInput, tensor, nullptr, allocator));
                     break;
                 case TensorInfo::ProcessingHint::STRING_2D_U8:
                     SPDLOG_DEBUG("Request contains input in 2D string format: {}", name);
-                    RETURN_IF_ERR(convertStringRequestToOVTensor2D(requestInput, tensor, nullptr));
+                    RETURN_IF_ERR(convertStringRequestToOVTensor2D(requestInput, tensor, nullptr, allocator));
                     break;
                 case TensorInfo::ProcessingHint::IMAGE:
                     SPDLOG_DEBUG("Request contains input in native file format: {}", name);
-                    RETURN_IF_ERR(convertNativeFileFormatRequestTensorToOVTensor(requestInput, tensor, tensorInfo, nullptr));
+                    RETURN_IF_ERR(convertNativeFileFormatRequestTensorToOVTensor(requestInput, tensor, tensorInfo, nullptr, allocator));
                     break;
                 default:
                     SPDLOG_DEBUG("Request input: {} requires conversion but endpoint specifies no processing hint. Number of dimensions: {}; precision: {}; demultiplexer: {}",
@@ -383,7 +338,7 @@ Status deserializePredictRequest(
             } else {
                 // Data Array Format
                 tensor = deserializeTensorProto<TensorProtoDeserializator>(
-                    requestInput, tensorInfo);
+                    requestInput, tensorInfo, allocator);
             }
 
             if (!tensor) {
@@ -417,7 +372,8 @@ template <class TensorProtoDeserializator, class Sink>
 Status deserializePredictRequest(
     const ::KFSRequest& request,
     const tensor_map_t& inputMap,
-    Sink& inputSink, bool isPipeline) {
+    Sink& inputSink, bool isPipeline,
+    const ov::Allocator& allocator = ov::Allocator()) {
     OVMS_PROFILE_FUNCTION();
     Status status;
     bool deserializeFromSharedInputContents = request.raw_input_contents().size() > 0;
@@ -439,15 +395,15 @@ Status deserializePredictRequest(
                 switch (tensorInfo->getPreProcessingHint()) {
                 case TensorInfo::ProcessingHint::STRING_1D_U8:
                     SPDLOG_DEBUG("Request contains input in 1D string format: {}", name);
-                    RETURN_IF_ERR(convertStringRequestToOVTensor1D(*requestInputItr, tensor, bufferLocation));
+                    RETURN_IF_ERR(convertStringRequestToOVTensor1D(*requestInputItr, tensor, bufferLocation, allocator));
                     break;
                 case TensorInfo::ProcessingHint::STRING_2D_U8:
                     SPDLOG_DEBUG("Request contains input in 2D string format: {}", name);
-                    RETURN_IF_ERR(convertStringRequestToOVTensor2D(*requestInputItr, tensor, bufferLocation));
+                    RETURN_IF_ERR(convertStringRequestToOVTensor2D(*requestInputItr, tensor, bufferLocation, allocator));
                     break;
                 case TensorInfo::ProcessingHint::IMAGE:
                     SPDLOG_DEBUG("Request contains input in native file format: {}", name);
-                    RETURN_IF_ERR(convertNativeFileFormatRequestTensorToOVTensor(*requestInputItr, tensor, tensorInfo, bufferLocation));
+                    RETURN_IF_ERR(convertNativeFileFormatRequestTensorToOVTensor(*requestInputItr, tensor, tensorInfo, bufferLocation, allocator));
                     break;
                 default:
                     SPDLOG_DEBUG("Request input: {} requires conversion but endpoint specifies no processing hint. Number of dimensions: {}; precision: {}; demultiplexer: {}",
@@ -455,7 +411,7 @@ Status deserializePredictRequest(
                     return StatusCode::NOT_IMPLEMENTED;
                 }
             } else {
-                tensor = deserializeTensorProto<TensorProtoDeserializator>(*requestInputItr, tensorInfo, bufferLocation);
+                tensor = deserializeTensorProto<TensorProtoDeserializator>(*requestInputItr, tensorInfo, bufferLocation, allocator);
                 if (!tensor) {
                     status = StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
                     SPDLOG_DEBUG(status.string());
@@ -488,7 +444,8 @@ template <class TensorProtoDeserializator, class Sink>
 Status deserializePredictRequest(
     const InferenceRequest& request,
     const tensor_map_t& inputMap,
-    Sink& inputSink, bool isPipeline) {
+    Sink& inputSink, bool isPipeline,
+    const ov::Allocator& allocator = ov::Allocator()) {
     OVMS_PROFILE_FUNCTION();
     Status status;
     for (const auto& [name, tensorInfo] : inputMap) {
@@ -505,7 +462,7 @@ Status deserializePredictRequest(
                 SPDLOG_DEBUG("Request contains binary input: {}", name);
                 return StatusCode::NOT_IMPLEMENTED;
             } else { */
-            tensor = deserializeTensorProto<TensorProtoDeserializator>(*requestInputPtr, tensorInfo);
+            tensor = deserializeTensorProto<TensorProtoDeserializator>(*requestInputPtr, tensorInfo, allocator);
             if (!tensor) {
                 status = StatusCode::OV_UNSUPPORTED_DESERIALIZATION_PRECISION;
                 SPDLOG_DEBUG(status.string());
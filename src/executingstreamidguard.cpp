@@ -46,4 +46,45 @@ ExecutingStreamIdGuard::~ExecutingStreamIdGuard() {
 int ExecutingStreamIdGuard::getId() { return this->id_; }
 ov::InferRequest& ExecutingStreamIdGuard::getInferRequest() { return this->inferRequest; }
 
+HedgeStreamGuard::HedgeStreamGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
+    inferRequestsQueue_(inferRequestsQueue),
+    reporter(reporter) {}
+
+HedgeStreamGuard::~HedgeStreamGuard() {
+    release();
+}
+
+bool HedgeStreamGuard::tryAcquire() {
+    if (this->id_.has_value()) {
+        return true;
+    }
+    this->id_ = this->inferRequestsQueue_.tryToGetIdleStream();
+    if (!this->id_.has_value()) {
+        return false;
+    }
+    INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    return true;
+}
+
+void HedgeStreamGuard::release() {
+    if (!this->id_.has_value()) {
+        return;
+    }
+    DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    this->inferRequestsQueue_.returnStream(this->id_.value());
+    this->id_.reset();
+    this->completed = false;
+}
+
+ov::InferRequest& HedgeStreamGuard::getInferRequest() {
+    return this->inferRequestsQueue_.getInferRequest(this->id_.value());
+}
+
+ov::InferRequest& HedgeStreamGuard::getCompletedRequest(ov::InferRequest& primary) {
+    if (this->completed && this->id_.has_value()) {
+        return getInferRequest();
+    }
+    return primary;
+}
+
 }  //  namespace ovms
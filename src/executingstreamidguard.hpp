@@ -15,6 +15,8 @@
 //*****************************************************************************
 #pragma once
 
+#include <optional>
+
 namespace ov {
 class InferRequest;
 }
@@ -48,4 +50,30 @@ private:
     ModelMetricReporter& reporter;
 };
 
+/**
+ * @brief Holds additional infer request used for hedged inference. Unlike ExecutingStreamIdGuard
+ * it never waits for idle stream and returns it on destruction, after response serialization.
+ */
+struct HedgeStreamGuard {
+    HedgeStreamGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
+    ~HedgeStreamGuard();
+
+    bool tryAcquire();
+    void release();
+    bool isAcquired() const { return this->id_.has_value(); }
+    ov::InferRequest& getInferRequest();
+
+    void setCompleted() { this->completed = true; }
+    /**
+     * @brief Gets infer request which outputs should be used in response
+     */
+    ov::InferRequest& getCompletedRequest(ov::InferRequest& primary);
+
+private:
+    OVInferRequestsQueue& inferRequestsQueue_;
+    ModelMetricReporter& reporter;
+    std::optional<int> id_;
+    bool completed = false;
+};
+
 }  //  namespace ovms
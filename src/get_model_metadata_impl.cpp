@@ -21,6 +21,7 @@
 #include "dags/pipelinedefinitionstatus.hpp"
 #include "dags/pipelinedefinitionunloadguard.hpp"
 #include "execution_context.hpp"
+#include "model_metadata_cache.hpp"
 #include "modelinstance.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelmanager.hpp"
@@ -45,19 +46,21 @@ GetModelMetadataImpl::GetModelMetadataImpl(ovms::Server& ovmsServer) :
 Status GetModelMetadataImpl::getModelStatus(
     const tensorflow::serving::GetModelMetadataRequest* request,
     tensorflow::serving::GetModelMetadataResponse* response,
-    ExecutionContext context) const {
+    ExecutionContext context,
+    std::string* jsonResponse) const {
     auto status = validate(request);
     if (!status.ok()) {
         return status;
     }
-    return getModelStatus(request, response, modelManager, context);
+    return getModelStatus(request, response, modelManager, context, jsonResponse);
 }
 
 Status GetModelMetadataImpl::getModelStatus(
     const tensorflow::serving::GetModelMetadataRequest* request,
     tensorflow::serving::GetModelMetadataResponse* response,
     ModelManager& manager,
-    ExecutionContext context) {
+    ExecutionContext context,
+    std::string* jsonResponse) {
     const auto& name = request->model_spec().name();
     model_version_t version = request->model_spec().has_version() ? request->model_spec().version().value() : 0;
 
@@ -70,6 +73,9 @@ Status GetModelMetadataImpl::getModelStatus(
         }
         auto status = buildResponse(*pipelineDefinition, response, manager);
         INCREMENT_IF_ENABLED(pipelineDefinition->getMetricReporter().getGetModelMetadataRequestMetric(context, status.ok()));
+        if (status.ok() && jsonResponse) {
+            status = serializeResponse2Json(response, jsonResponse);
+        }
         return status;
     }
 
@@ -90,7 +96,7 @@ Status GetModelMetadataImpl::getModelStatus(
         }
     }
 
-    auto status = buildResponse(instance, response);
+    auto status = buildResponse(instance, response, jsonResponse);
     INCREMENT_IF_ENABLED(instance->getMetricReporter().getGetModelMetadataRequestMetric(context, status.ok()));
     return status;
 }
@@ -140,7 +146,8 @@ void GetModelMetadataImpl::convert(
 
 Status GetModelMetadataImpl::buildResponse(
     std::shared_ptr<ModelInstance> instance,
-    tensorflow::serving::GetModelMetadataResponse* response) {
+    tensorflow::serving::GetModelMetadataResponse* response,
+    std::string* jsonResponse) {
 
     std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
 
@@ -150,15 +157,20 @@ Status GetModelMetadataImpl::buildResponse(
         return status;
     }
 
-    response->Clear();
-    response->mutable_model_spec()->set_name(instance->getName());
-    response->mutable_model_spec()->mutable_version()->set_value(instance->getVersion());
-
-    tensorflow::serving::SignatureDefMap def;
-    convert(instance->getInputsInfo(), ((*def.mutable_signature_def())["serving_default"]).mutable_inputs());
-    convert(instance->getOutputsInfo(), ((*def.mutable_signature_def())["serving_default"]).mutable_outputs());
-
-    (*response->mutable_metadata())["signature_def"].PackFrom(def);
+    const ModelMetadataCache* metadataCache = instance->getMetadataCache();
+    std::unique_ptr<ModelMetadataCache> temporaryMetadataCache;
+    if (metadataCache == nullptr) {
+        temporaryMetadataCache = std::make_unique<ModelMetadataCache>(instance->getName(), instance->getVersion(), instance->getInputsInfo(), instance->getOutputsInfo());
+        metadataCache = temporaryMetadataCache.get();
+    }
+    if (jsonResponse && !metadataCache->getTfsJson().empty()) {
+        *jsonResponse = metadataCache->getTfsJson();
+        return StatusCode::OK;
+    }
+    *response = metadataCache->getTfsResponse();
+    if (jsonResponse) {
+        return serializeResponse2Json(response, jsonResponse);
+    }
     return StatusCode::OK;
 }
 
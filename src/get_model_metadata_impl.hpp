@@ -51,9 +51,13 @@ public:
         const tensor_map_t& from,
         proto_signature_map_t* to);
 
+    /**
+     * @brief Copies response prepared on model load. When jsonResponse is set, only REST API json response is written.
+     */
     static Status buildResponse(
         std::shared_ptr<ModelInstance> instance,
-        tensorflow::serving::GetModelMetadataResponse* response);
+        tensorflow::serving::GetModelMetadataResponse* response,
+        std::string* jsonResponse = nullptr);
     static Status buildResponse(
         PipelineDefinition& pipelineDefinition,
         tensorflow::serving::GetModelMetadataResponse* response,
@@ -61,13 +65,14 @@ public:
 
     Status getModelStatus(
         const tensorflow::serving::GetModelMetadataRequest* request,
-        tensorflow::serving::GetModelMetadataResponse* response, ExecutionContext context) const;
+        tensorflow::serving::GetModelMetadataResponse* response, ExecutionContext context, std::string* jsonResponse = nullptr) const;
 
     static Status getModelStatus(
         const tensorflow::serving::GetModelMetadataRequest* request,
         tensorflow::serving::GetModelMetadataResponse* response,
         ModelManager& manager,
-        ExecutionContext context);
+        ExecutionContext context,
+        std::string* jsonResponse = nullptr);
     static Status createGrpcRequest(const std::string& model_name, std::optional<int64_t> model_version, tensorflow::serving::GetModelMetadataRequest* request);
     static Status serializeResponse2Json(const tensorflow::serving::GetModelMetadataResponse* response, std::string* output);
 };
@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "grpc_compression.hpp"
+
+#include <vector>
+
+#include <grpcpp/server_context.h>
+
+#include "logging.hpp"
+#include "stringutils.hpp"
+
+namespace ovms {
+
+static std::optional<grpc_compression_algorithm> parseAlgorithm(const std::string& name) {
+    if (name == "none") {
+        return GRPC_COMPRESS_NONE;
+    }
+    if (name == "deflate") {
+        return GRPC_COMPRESS_DEFLATE;
+    }
+    if (name == "gzip") {
+        return GRPC_COMPRESS_GZIP;
+    }
+    return std::nullopt;
+}
+
+Status GrpcCompressionPolicy::parse(const std::string& policy, GrpcCompressionPolicy& result) {
+    GrpcCompressionPolicy parsed;
+    for (std::string entry : tokenize(policy, ',')) {
+        erase_spaces(entry);
+        if (entry.empty()) {
+            continue;
+        }
+        std::vector<std::string> methodAndAlgorithm = tokenize(entry, '=');
+        if (methodAndAlgorithm.size() == 1) {
+            auto algorithm = parseAlgorithm(methodAndAlgorithm[0]);
+            if (!algorithm || parsed.defaultAlgorithm) {
+                return Status(StatusCode::GRPC_COMPRESSION_WRONG_FORMAT, policy);
+            }
+            parsed.defaultAlgorithm = algorithm;
+        } else if (methodAndAlgorithm.size() == 2 && !methodAndAlgorithm[0].empty()) {
+            auto algorithm = parseAlgorithm(methodAndAlgorithm[1]);
+            if (!algorithm || !parsed.methodAlgorithms.emplace(methodAndAlgorithm[0], algorithm.value()).second) {
+                return Status(StatusCode::GRPC_COMPRESSION_WRONG_FORMAT, policy);
+            }
+        } else {
+            return Status(StatusCode::GRPC_COMPRESSION_WRONG_FORMAT, policy);
+        }
+    }
+    result = std::move(parsed);
+    return StatusCode::OK;
+}
+
+std::optional<grpc_compression_algorithm> GrpcCompressionPolicy::getAlgorithm(const std::string& method) const {
+    if (!methodAlgorithms.empty()) {
+        auto separator = method.rfind('/');
+        auto it = methodAlgorithms.find(separator == std::string::npos ? method : method.substr(separator + 1));
+        if (it != methodAlgorithms.end()) {
+            return it->second;
+        }
+    }
+    return defaultAlgorithm;
+}
+
+namespace {
+class GrpcCompressionInterceptor : public ::grpc::experimental::Interceptor {
+    ::grpc::experimental::ServerRpcInfo* info;
+    grpc_compression_algorithm algorithm;
+
+public:
+    GrpcCompressionInterceptor(::grpc::experimental::ServerRpcInfo* info, grpc_compression_algorithm algorithm) :
+        info(info),
+        algorithm(algorithm) {}
+
+    void Intercept(::grpc::experimental::InterceptorBatchMethods* methods) override {
+        if (methods->QueryInterceptionHookPoint(::grpc::experimental::InterceptionHookPoints::POST_RECV_INITIAL_METADATA)) {
+            // gRPC core selects algorithm for compression level from the ones accepted by the client,
+            // ranked gzip, deflate. Low level prefers gzip, high level prefers deflate.
+            info->server_context()->set_compression_level(algorithm == GRPC_COMPRESS_GZIP ? GRPC_COMPRESS_LEVEL_LOW : GRPC_COMPRESS_LEVEL_HIGH);
+        }
+        methods->Proceed();
+    }
+};
+}  // namespace
+
+::grpc::experimental::Interceptor* GrpcCompressionInterceptorFactory::CreateServerInterceptor(::grpc::experimental::ServerRpcInfo* info) {
+    auto algorithm = policy->getAlgorithm(info->method());
+    if (!algorithm || algorithm.value() == GRPC_COMPRESS_NONE) {
+        return nullptr;
+    }
+    SPDLOG_TRACE("Response compression requested for gRPC method: {}", info->method());
+    return new GrpcCompressionInterceptor(info, algorithm.value());
+}
+}  // namespace ovms
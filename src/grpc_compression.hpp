@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <grpc/compression.h>
+#include <grpcpp/support/server_interceptor.h>
+
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Response compression algorithms selected per gRPC method.
+ *
+ * Policy is parsed from comma separated list of entries. Entry "algorithm" sets the default
+ * for all methods, entry "Method=algorithm" overrides it for single method, e.g.:
+ * "gzip" or "deflate,ModelInfer=gzip,ServerLive=none".
+ * Algorithm is negotiated with the client: when the client does not accept the configured algorithm,
+ * the other one it accepts is used, or the response is not compressed.
+ * Requests compressed by the client are always accepted regardless of the policy.
+ */
+class GrpcCompressionPolicy {
+    std::optional<grpc_compression_algorithm> defaultAlgorithm;
+    std::unordered_map<std::string, grpc_compression_algorithm> methodAlgorithms;
+
+public:
+    static Status parse(const std::string& policy, GrpcCompressionPolicy& result);
+
+    bool empty() const { return !defaultAlgorithm.has_value() && methodAlgorithms.empty(); }
+
+    /**
+     * @brief Returns algorithm configured for method.
+     *
+     * @param method full method name, e.g. /inference.GRPCInferenceService/ModelInfer or method name only
+     */
+    std::optional<grpc_compression_algorithm> getAlgorithm(const std::string& method) const;
+};
+
+/**
+ * @brief Creates interceptors which set response compression of each call according to the policy.
+ */
+class GrpcCompressionInterceptorFactory : public ::grpc::experimental::ServerInterceptorFactoryInterface {
+    std::shared_ptr<const GrpcCompressionPolicy> policy;
+
+public:
+    explicit GrpcCompressionInterceptorFactory(std::shared_ptr<const GrpcCompressionPolicy> policy) :
+        policy(std::move(policy)) {}
+    ::grpc::experimental::Interceptor* CreateServerInterceptor(::grpc::experimental::ServerRpcInfo* info) override;
+};
+}  // namespace ovms
@@ -80,6 +80,7 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::INVALID_UNEXPECTED_INPUT, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_NO_OF_SHAPE_DIMENSIONS, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_BATCH_SIZE, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_SHAPE, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_BUFFER_TYPE, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_DEVICE_ID, grpc::StatusCode::INVALID_ARGUMENT},
@@ -89,6 +90,15 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::INVALID_VALUE_COUNT, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_CONTENT_SIZE, grpc::StatusCode::INVALID_ARGUMENT},
         {StatusCode::INVALID_MESSAGE_STRUCTURE, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::INVALID_CHUNKED_REQUEST, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::CHUNKED_REQUEST_INCOMPLETE, grpc::StatusCode::CANCELLED},
+        {StatusCode::SHM_REGION_ALREADY_REGISTERED, grpc::StatusCode::ALREADY_EXISTS},
+        {StatusCode::SHM_REGION_MISSING, grpc::StatusCode::NOT_FOUND},
+        {StatusCode::SHM_REGION_MAPPING_FAILED, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::INVALID_SHM_PARAMETERS, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::SHM_OUT_OF_BOUNDS, grpc::StatusCode::INVALID_ARGUMENT},
+        {StatusCode::SHM_DISABLED, grpc::StatusCode::PERMISSION_DENIED},
+        {StatusCode::SHM_KEY_NOT_ALLOWED, grpc::StatusCode::PERMISSION_DENIED},
         {StatusCode::UNSUPPORTED_LAYOUT, grpc::StatusCode::INVALID_ARGUMENT},
         // Binary input
         {StatusCode::INVALID_NO_OF_CHANNELS, grpc::StatusCode::INVALID_ARGUMENT},
@@ -99,8 +109,10 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, grpc::StatusCode::ABORTED},
         // ALREADY_EXISTS
         {StatusCode::SEQUENCE_ALREADY_EXISTS, grpc::StatusCode::ALREADY_EXISTS},
+        {StatusCode::MEDIAPIPE_STREAM_ALREADY_ATTACHED, grpc::StatusCode::ALREADY_EXISTS},
         // UNAVAILABLE
         {StatusCode::MAX_SEQUENCE_NUMBER_REACHED, grpc::StatusCode::UNAVAILABLE},
+        {StatusCode::MEDIAPIPE_MAX_STREAMS_REACHED, grpc::StatusCode::UNAVAILABLE},
         {StatusCode::MODEL_VERSION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
         {StatusCode::PIPELINE_DEFINITION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
         {StatusCode::MEDIAPIPE_DEFINITION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
@@ -16,8 +16,10 @@
 #include "grpcservermodule.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -34,6 +36,7 @@
 #include <unistd.h>
 
 #include "config.hpp"
+#include "grpc_compression.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
 #include "logging.hpp"
 #include "model_service.hpp"
@@ -131,6 +134,12 @@ Status GRPCServerModule::start(const ovms::Config& config) {
         SPDLOG_ERROR(status.string());
         return status;
     }
+    auto compressionPolicy = std::make_shared<GrpcCompressionPolicy>();
+    status = GrpcCompressionPolicy::parse(config.grpcCompression(), *compressionPolicy);
+    if (!status.ok()) {
+        SPDLOG_ERROR(status.string());
+        return status;
+    }
 
     ServerBuilder builder;
     builder.SetMaxReceiveMessageSize(GIGABYTE);
@@ -138,6 +147,8 @@ Status GRPCServerModule::start(const ovms::Config& config) {
     builder.AddListeningPort(config.grpcBindAddress() + ":" + std::to_string(config.port()), grpc::InsecureServerCredentials());
     builder.RegisterService(&tfsPredictService);
     builder.RegisterService(&tfsModelService);
+    kfsGrpcInferenceService.configureStreamSessions(config.maxStreamGraphs(), std::chrono::seconds(config.streamResumeGracePeriodSeconds()));
+    kfsGrpcInferenceService.configureSharedMemory(config.systemSharedMemoryEnabled(), config.systemSharedMemoryKeyPrefix());
     builder.RegisterService(&kfsGrpcInferenceService);
     for (auto& [name, value] : channel_arguments) {
         // gRPC accept arguments of two types, int and string. We will attempt to
@@ -177,6 +188,12 @@ Status GRPCServerModule::start(const ovms::Config& config) {
         return status;
     }
     for (uint i = 0; i < grpcServersCount; ++i) {
+        // builder hands interceptor creators over to the server it builds
+        if (!compressionPolicy->empty()) {
+            std::vector<std::unique_ptr<::grpc::experimental::ServerInterceptorFactoryInterface>> interceptorCreators;
+            interceptorCreators.emplace_back(std::make_unique<GrpcCompressionInterceptorFactory>(compressionPolicy));
+            builder.experimental().SetInterceptorCreators(std::move(interceptorCreators));
+        }
         std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
         if (server == nullptr) {
             std::stringstream ss;
@@ -205,6 +222,8 @@ void GRPCServerModule::shutdown() {
         SPDLOG_INFO("Shutdown gRPC server");
     }
     servers.clear();
+    kfsGrpcInferenceService.getStreamSessionRegistry().stopCleaner();
+    kfsGrpcInferenceService.getStreamSessionRegistry().closeAll();
     state = ModuleState::SHUTDOWN;
     SPDLOG_INFO("{} shutdown", GRPC_SERVER_MODULE_NAME);
 }
@@ -24,10 +24,12 @@
 #include <utility>
 #include <vector>
 
+#include <google/protobuf/util/json_util.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 #include <spdlog/spdlog.h>
 
+#include "allocator_stats.hpp"
 #include "config.hpp"
 #include "dags/pipeline.hpp"
 #include "dags/pipelinedefinition.hpp"
@@ -37,6 +39,7 @@
 #include "get_model_metadata_impl.hpp"
 #include "grpcservermodule.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "metric_module.hpp"
 #include "metric_registry.hpp"
@@ -91,6 +94,8 @@ const std::string HttpRestApiHandler::kfs_serverliveRegexExp =
     R"(/v2/health/live)";
 const std::string HttpRestApiHandler::kfs_servermetadataRegexExp =
     R"(/v2)";
+const std::string HttpRestApiHandler::kfs_systemsharedmemoryRegexExp =
+    R"(/v2/systemsharedmemory(?:/region/([^/]+))?/(status|register|unregister))";
 
 const std::string HttpRestApiHandler::metricsRegexExp = R"((.?)\/metrics(\?(.*))?)";
 
@@ -105,6 +110,7 @@ HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_
     kfs_serverreadyRegex(kfs_serverreadyRegexExp),
     kfs_serverliveRegex(kfs_serverliveRegexExp),
     kfs_servermetadataRegex(kfs_servermetadataRegexExp),
+    kfs_systemsharedmemoryRegex(kfs_systemsharedmemoryRegexExp),
     metricsRegex(metricsRegexExp),
     timeout_in_ms(timeout_in_ms),
     ovmsServer(ovmsServer),
@@ -180,6 +186,9 @@ void HttpRestApiHandler::registerAll() {
     registerHandler(KFS_GetServerMetadata, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
         return processServerMetadataKFSRequest(request_components, response, request_body);
     });
+    registerHandler(KFS_SystemSharedMemory, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
+        return processSystemSharedMemoryKFSRequest(request_components, response, request_body);
+    });
     registerHandler(Metrics, [this](const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components) -> Status {
         return processMetrics(request_components, response, request_body);
     });
@@ -220,6 +229,51 @@ Status HttpRestApiHandler::processServerMetadataKFSRequest(const HttpRequestComp
     return StatusCode::OK;
 }
 
+Status HttpRestApiHandler::processSystemSharedMemoryKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
+    if (request_components.processing_method == "register") {
+        ::inference::SystemSharedMemoryRegisterRequest grpc_request;
+        ::inference::SystemSharedMemoryRegisterResponse grpc_response;
+        google::protobuf::util::JsonParseOptions opts;
+        if (!google::protobuf::util::JsonStringToMessage(request_body, &grpc_request, opts).ok()) {
+            SPDLOG_DEBUG("Parsing shared memory register request failed");
+            return StatusCode::JSON_INVALID;
+        }
+        grpc_request.set_name(request_components.shared_memory_region);
+        return kfsGrpcImpl.SystemSharedMemoryRegisterImpl(&grpc_request, &grpc_response);
+    }
+    if (request_components.processing_method == "unregister") {
+        ::inference::SystemSharedMemoryUnregisterRequest grpc_request;
+        ::inference::SystemSharedMemoryUnregisterResponse grpc_response;
+        grpc_request.set_name(request_components.shared_memory_region);
+        return kfsGrpcImpl.SystemSharedMemoryUnregisterImpl(&grpc_request, &grpc_response);
+    }
+    ::inference::SystemSharedMemoryStatusRequest grpc_request;
+    ::inference::SystemSharedMemoryStatusResponse grpc_response;
+    grpc_request.set_name(request_components.shared_memory_region);
+    auto status = kfsGrpcImpl.SystemSharedMemoryStatusImpl(&grpc_request, &grpc_response);
+    if (!status.ok()) {
+        return status;
+    }
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartArray();
+    for (const auto& [name, region] : grpc_response.regions()) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(region.name().c_str());
+        writer.Key("key");
+        writer.String(region.key().c_str());
+        writer.Key("offset");
+        writer.Uint64(region.offset());
+        writer.Key("byte_size");
+        writer.Uint64(region.byte_size());
+        writer.EndObject();
+    }
+    writer.EndArray();
+    response = buffer.GetString();
+    return StatusCode::OK;
+}
+
 void HttpRestApiHandler::parseParams(Value& scope, Document& doc) {
     Value::ConstMemberIterator itr = scope.FindMember("parameters");
     if (itr != scope.MemberEnd()) {
@@ -292,6 +346,9 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
     size_t binary_input_offset = 0;
     for (int i = 0; i < grpc_request.mutable_inputs()->size(); i++) {
         auto input = grpc_request.mutable_inputs()->Mutable(i);
+        if (usesSharedMemory(input->parameters())) {
+            continue;
+        }
         auto binary_data_size_parameter = input->parameters().find("binary_data_size");
         size_t binary_input_size = 0;
         if (binary_data_size_parameter != input->parameters().end()) {
@@ -437,6 +494,10 @@ Status HttpRestApiHandler::processMetrics(const HttpRequestComponents& request_c
         return StatusCode::REST_INVALID_URL;
     }
 
+    auto allocatorMetricReporter = this->modelManager.getAllocatorMetricReporter();
+    if (allocatorMetricReporter) {
+        allocatorMetricReporter->update();
+    }
     auto metricModule = dynamic_cast<const MetricModule*>(module);
     response = metricModule->getRegistry().collect();
 
@@ -465,20 +526,8 @@ Status HttpRestApiHandler::processModelReadyKFSRequest(const HttpRequestComponen
     return StatusCode::MODEL_VERSION_NOT_LOADED_YET;
 }
 
-void HttpRestApiHandler::convertShapeType(Value& scope, Document& doc) {
-    for (SizeType i = 0; i < scope.Size(); i++) {
-        Value data = scope[i].GetObject()["shape"].GetArray();
-        Value shape(rapidjson::kArrayType);
-        for (SizeType j = 0; j < data.Size(); j++) {
-            shape.PushBack(atoi(data[j].GetString()), doc.GetAllocator());
-        }
-        scope[i].GetObject()["shape"] = shape;
-    }
-}
-
 Status HttpRestApiHandler::processModelMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body) {
     ::KFSModelMetadataRequest grpc_request;
-    ::KFSModelMetadataResponse grpc_response;
     std::string modelName(request_components.model_name);
     grpc_request.set_name(modelName);
     if (request_components.model_version.has_value()) {
@@ -486,31 +535,7 @@ Status HttpRestApiHandler::processModelMetadataKFSRequest(const HttpRequestCompo
     }
     std::string modelVersionLog = request_components.model_version.has_value() ? std::to_string(request_components.model_version.value()) : DEFAULT_VERSION;
     SPDLOG_DEBUG("Processing REST request for model: {}; version: {}", modelName, modelVersionLog);
-    Status gstatus = kfsGrpcImpl.ModelMetadataImpl(nullptr, &grpc_request, &grpc_response, ExecutionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelMetadata});
-    if (!gstatus.ok()) {
-        return gstatus;
-    }
-    std::string output;
-    google::protobuf::util::JsonPrintOptions opts;
-    // This parameter forces JSON writer to not omit empty shape in case of scalar tensor
-    opts.always_print_primitive_fields = true;
-    google::protobuf::util::Status status = google::protobuf::util::MessageToJsonString(grpc_response, &output, opts);
-    if (!status.ok()) {
-        return StatusCode::JSON_SERIALIZATION_ERROR;
-    }
-
-    Document doc;
-    doc.Parse(output.c_str());
-
-    convertShapeType(doc["inputs"], doc);
-    convertShapeType(doc["outputs"], doc);
-
-    rapidjson::StringBuffer buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    doc.Accept(writer);
-
-    response = buffer.GetString();
-    return StatusCode::OK;
+    return kfsGrpcImpl.ModelMetadataJsonImpl(&grpc_request, response, ExecutionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelMetadata});
 }
 
 static Status parseInferenceHeaderContentLength(HttpRequestComponents& requestComponents,
@@ -577,6 +602,16 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             requestComponents.type = ConfigReload;
             return StatusCode::OK;
         }
+        if (std::regex_match(request_path, sm, kfs_systemsharedmemoryRegex)) {
+            requestComponents.shared_memory_region = sm[1];
+            requestComponents.processing_method = sm[2];
+            if (requestComponents.processing_method == "status" ||
+                (requestComponents.processing_method == "register" && requestComponents.shared_memory_region.empty())) {
+                return StatusCode::REST_UNSUPPORTED_METHOD;
+            }
+            requestComponents.type = KFS_SystemSharedMemory;
+            return StatusCode::OK;
+        }
         return (std::regex_match(request_path, sm, modelstatusRegex) ||
                    std::regex_match(request_path, sm, kfs_serverliveRegex) ||
                    std::regex_match(request_path, sm, configStatusRegex) ||
@@ -625,6 +660,15 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
             requestComponents.type = KFS_GetServerMetadata;
             return StatusCode::OK;
         }
+        if (std::regex_match(request_path, sm, kfs_systemsharedmemoryRegex)) {
+            requestComponents.shared_memory_region = sm[1];
+            requestComponents.processing_method = sm[2];
+            if (requestComponents.processing_method != "status") {
+                return StatusCode::REST_UNSUPPORTED_METHOD;
+            }
+            requestComponents.type = KFS_SystemSharedMemory;
+            return StatusCode::OK;
+        }
         if (std::regex_match(request_path, sm, kfs_modelmetadataRegex)) {
             requestComponents.model_name = sm[1];
             std::string model_version_str = sm[2];
@@ -876,11 +920,7 @@ Status HttpRestApiHandler::processModelMetadataRequest(
     if (!status.ok()) {
         return status;
     }
-    status = grpcGetModelMetadataImpl.getModelStatus(&grpc_request, &grpc_response, ExecutionContext(ExecutionContext::Interface::REST, ExecutionContext::Method::GetModelMetadata));
-    if (!status.ok()) {
-        return status;
-    }
-    status = grpcGetModelMetadataImpl.serializeResponse2Json(&grpc_response, response);
+    status = grpcGetModelMetadataImpl.getModelStatus(&grpc_request, &grpc_response, ExecutionContext(ExecutionContext::Interface::REST, ExecutionContext::Method::GetModelMetadata), response);
     if (!status.ok()) {
         return status;
     }
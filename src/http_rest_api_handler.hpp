@@ -48,6 +48,7 @@ enum RequestType { Predict,
     KFS_GetServerReady,
     KFS_GetServerLive,
     KFS_GetServerMetadata,
+    KFS_SystemSharedMemory,
     Metrics };
 
 struct HttpRequestComponents {
@@ -58,6 +59,7 @@ struct HttpRequestComponents {
     std::optional<std::string_view> model_version_label;
     std::string processing_method;
     std::string model_subresource;
+    std::string shared_memory_region;
     std::optional<int> inferenceHeaderContentLength;
 };
 
@@ -81,6 +83,7 @@ public:
     static const std::string kfs_serverreadyRegexExp;
     static const std::string kfs_serverliveRegexExp;
     static const std::string kfs_servermetadataRegexExp;
+    static const std::string kfs_systemsharedmemoryRegexExp;
     /**
      * @brief Construct a new HttpRest Api Handler
      *
@@ -191,8 +194,6 @@ public:
 
     Status processConfigReloadRequest(std::string& response, ModelManager& manager);
 
-    void convertShapeType(rapidjson::Value& scope, rapidjson::Document& doc);
-
     Status processConfigStatusRequest(std::string& response, ModelManager& manager);
     Status processModelMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processModelReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
@@ -202,6 +203,7 @@ public:
     Status processServerReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerLiveKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerMetadataKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+    Status processSystemSharedMemoryKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
 
 private:
     const std::regex predictionRegex;
@@ -216,6 +218,7 @@ private:
     const std::regex kfs_serverreadyRegex;
     const std::regex kfs_serverliveRegex;
     const std::regex kfs_servermetadataRegex;
+    const std::regex kfs_systemsharedmemoryRegex;
 
     const std::regex metricsRegex;
 
@@ -113,6 +113,7 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
         {StatusCode::INVALID_UNEXPECTED_INPUT, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_NO_OF_SHAPE_DIMENSIONS, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_BATCH_SIZE, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_SHAPE, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_BUFFER_TYPE, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_DEVICE_ID, net_http::HTTPStatusCode::BAD_REQUEST},
@@ -122,6 +123,13 @@ static const net_http::HTTPStatusCode http(const ovms::Status& status) {
         {StatusCode::INVALID_VALUE_COUNT, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_CONTENT_SIZE, net_http::HTTPStatusCode::BAD_REQUEST},
         {StatusCode::INVALID_MESSAGE_STRUCTURE, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::SHM_REGION_ALREADY_REGISTERED, net_http::HTTPStatusCode::CONFLICT},
+        {StatusCode::SHM_REGION_MISSING, net_http::HTTPStatusCode::NOT_FOUND},
+        {StatusCode::SHM_REGION_MAPPING_FAILED, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::INVALID_SHM_PARAMETERS, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::SHM_OUT_OF_BOUNDS, net_http::HTTPStatusCode::BAD_REQUEST},
+        {StatusCode::SHM_DISABLED, net_http::HTTPStatusCode::FORBIDDEN},
+        {StatusCode::SHM_KEY_NOT_ALLOWED, net_http::HTTPStatusCode::FORBIDDEN},
         {StatusCode::UNSUPPORTED_LAYOUT, net_http::HTTPStatusCode::BAD_REQUEST},
 
         // Deserialization
@@ -233,10 +241,34 @@ private:
     std::unique_ptr<HttpRestApiHandler> handler_;
 };
 
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms) {
+HttpServer::HttpServer(std::vector<std::unique_ptr<http_server>>&& reactors) :
+    reactors(std::move(reactors)) {}
+
+HttpServer::~HttpServer() {
+    terminate();
+    waitForTermination();
+}
+
+void HttpServer::terminate() {
+    for (auto& reactor : reactors) {
+        if (!reactor->is_terminating()) {
+            reactor->Terminate();
+        }
+    }
+}
+
+void HttpServer::waitForTermination() {
+    for (auto& reactor : reactors) {
+        reactor->WaitForTermination();
+    }
+    reactors.clear();
+}
+
+static std::unique_ptr<http_server> createAndStartReactor(const std::string& address, int port, int num_threads, bool reusePort, std::shared_ptr<RestApiRequestDispatcher> dispatcher) {
     auto options = std::make_unique<net_http::ServerOptions>();
     options->AddPort(static_cast<uint32_t>(port));
     options->SetAddress(address);
+    options->SetReusePort(reusePort);
     options->SetExecutor(std::make_unique<RequestExecutor>(num_threads));
 
     auto server = net_http::CreateEvHTTPServer(std::move(options));
@@ -245,9 +277,6 @@ std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address
         return nullptr;
     }
 
-    std::shared_ptr<RestApiRequestDispatcher> dispatcher =
-        std::make_shared<RestApiRequestDispatcher>(ovmsServer, timeout_in_ms);
-
     net_http::RequestHandlerOptions handler_options;
     server->RegisterRequestDispatcher(
         [dispatcher](net_http::ServerRequestInterface* req) {
@@ -255,11 +284,34 @@ std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address
         },
         handler_options);
 
-    if (server->StartAcceptingRequests()) {
-        SPDLOG_INFO("REST server listening on port {} with {} threads", port, num_threads);
-        return server;
+    if (!server->StartAcceptingRequests()) {
+        return nullptr;
+    }
+    return server;
+}
+
+std::unique_ptr<HttpServer> createAndStartHttpServer(const std::string& address, int port, int num_threads, int num_reactors, ovms::Server& ovmsServer, int timeout_in_ms) {
+    if (num_reactors < 1) {
+        num_reactors = 1;
     }
+    std::shared_ptr<RestApiRequestDispatcher> dispatcher =
+        std::make_shared<RestApiRequestDispatcher>(ovmsServer, timeout_in_ms);
 
-    return nullptr;
+    // single reactor binds as before, so port collisions are still detected
+    const bool reusePort = num_reactors > 1;
+    std::vector<std::unique_ptr<http_server>> reactors;
+    for (int i = 0; i < num_reactors; ++i) {
+        // event loop occupies one thread of reactor executor
+        const int reactorThreads = num_threads / num_reactors + (i < num_threads % num_reactors ? 1 : 0);
+        auto reactor = createAndStartReactor(address, port, reactorThreads, reusePort, dispatcher);
+        if (reactor == nullptr) {
+            SPDLOG_ERROR("Failed to start REST server reactor {} of {}", i + 1, num_reactors);
+            HttpServer startedReactors(std::move(reactors));
+            return nullptr;
+        }
+        reactors.emplace_back(std::move(reactor));
+    }
+    SPDLOG_INFO("REST server listening on port {} with {} threads in {} reactors", port, num_threads, num_reactors);
+    return std::make_unique<HttpServer>(std::move(reactors));
 }
 }  // namespace ovms
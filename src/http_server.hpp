@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wall"
@@ -28,14 +29,34 @@ class Server;
 
 using http_server = tensorflow::serving::net_http::HTTPServerInterface;
 
+/**
+ * @brief REST server made of reactors - net_http servers with own event loop and executor.
+ * With more than one reactor all of them listen on the same port with SO_REUSEPORT,
+ * kernel distributes new connections and each connection is served by reactor which accepted it.
+ */
+class HttpServer {
+public:
+    HttpServer(std::vector<std::unique_ptr<http_server>>&& reactors);
+    ~HttpServer();
+
+    size_t getReactorsCount() const { return reactors.size(); }
+
+    void terminate();
+    void waitForTermination();
+
+private:
+    std::vector<std::unique_ptr<http_server>> reactors;
+};
+
 /**
  * @brief Creates a and starts Http Server
  * 
  * @param port 
- * @param num_threads 
+ * @param num_threads total number of threads, split between reactors
+ * @param num_reactors number of event loops accepting connections
  * @param timeout_in_m not implemented
  *  
- * @return std::unique_ptr<http_server> 
+ * @return std::unique_ptr<HttpServer> 
  */
-std::unique_ptr<http_server> createAndStartHttpServer(const std::string& address, int port, int num_threads, ovms::Server& ovmsServer, int timeout_in_ms = -1);
+std::unique_ptr<HttpServer> createAndStartHttpServer(const std::string& address, int port, int num_threads, int num_reactors, ovms::Server& ovmsServer, int timeout_in_ms = -1);
 }  // namespace ovms
@@ -34,8 +34,10 @@ Status HTTPServerModule::start(const ovms::Config& config) {
     const std::string server_address = config.restBindAddress() + ":" + std::to_string(config.restPort());
     int workers = config.restWorkers() ? config.restWorkers() : 10;
 
-    SPDLOG_INFO("Will start {} REST workers", workers);
-    server = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, this->ovmsServer);
+    int reactors = config.restReactors();
+
+    SPDLOG_INFO("Will start {} REST workers in {} reactors", workers, reactors);
+    server = ovms::createAndStartHttpServer(config.restBindAddress(), config.restPort(), workers, reactors, this->ovmsServer);
     if (server == nullptr) {
         std::stringstream ss;
         ss << "at " << server_address;
@@ -53,8 +55,8 @@ void HTTPServerModule::shutdown() {
         return;
     SPDLOG_INFO("{} shutting down", HTTP_SERVER_MODULE_NAME);
     state = ModuleState::STARTED_SHUTDOWN;
-    server->Terminate();
-    server->WaitForTermination();
+    server->terminate();
+    server->waitForTermination();
     server.reset();
     SPDLOG_INFO("Shutdown HTTP server");
     state = ModuleState::SHUTDOWN;
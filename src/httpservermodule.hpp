@@ -25,7 +25,7 @@ namespace ovms {
 class Config;
 class Server;
 class HTTPServerModule : public Module {
-    std::unique_ptr<ovms::http_server> server;
+    std::unique_ptr<ovms::HttpServer> server;
     Server& ovmsServer;
 
 public:
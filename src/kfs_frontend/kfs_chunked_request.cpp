@@ -0,0 +1,168 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "kfs_chunked_request.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "../logging.hpp"
+#include "../status.hpp"
+#include "kfs_utils.hpp"
+
+namespace ovms {
+
+const std::string CHUNKED_REQUEST_PARAMETER_NAME = "chunked_request";
+const std::string FINAL_CHUNK_PARAMETER_NAME = "final_chunk";
+const std::string RESPONSE_CHUNK_SIZE_PARAMETER_NAME = "response_chunk_size";
+
+// Contents buffers are preallocated up to that size, larger ones grow while chunks arrive
+static constexpr size_t MAX_PREALLOCATED_CONTENT_SIZE = 1024 * 1024 * 1024;
+// Value of expected size when it cannot be computed from request
+static constexpr size_t UNKNOWN_SIZE = 0;
+
+static bool getBoolParameter(const KFSRequest& request, const std::string& name) {
+    auto it = request.parameters().find(name);
+    return it != request.parameters().end() && it->second.bool_param();
+}
+
+bool isChunkedRequest(const KFSRequest& request) {
+    return getBoolParameter(request, CHUNKED_REQUEST_PARAMETER_NAME);
+}
+
+static size_t computeExpectedSize(const KFSTensorInputProto& input) {
+    if (input.datatype() == "BYTES") {
+        return UNKNOWN_SIZE;
+    }
+    size_t size = KFSDataTypeSize(input.datatype());
+    for (int64_t dim : input.shape()) {
+        if (dim < 0 || __builtin_mul_overflow(size, static_cast<size_t>(dim), &size)) {
+            return UNKNOWN_SIZE;
+        }
+    }
+    return size;
+}
+
+Status ChunkedRequestAssembler::addChunk(KFSRequest& chunk) {
+    if (complete) {
+        return Status(StatusCode::INTERNAL_ERROR, "Chunked request already complete");
+    }
+    const bool finalChunk = getBoolParameter(chunk, FINAL_CHUNK_PARAMETER_NAME);
+    if (!started) {
+        if (!isChunkedRequest(chunk)) {
+            return Status(StatusCode::INVALID_CHUNKED_REQUEST, "first chunk requires " + CHUNKED_REQUEST_PARAMETER_NAME + " parameter");
+        }
+        if (chunk.raw_input_contents_size() != 0 && chunk.raw_input_contents_size() != chunk.inputs_size()) {
+            return Status(StatusCode::INVALID_CHUNKED_REQUEST, "raw_input_contents count has to match inputs count");
+        }
+        auto it = chunk.parameters().find(RESPONSE_CHUNK_SIZE_PARAMETER_NAME);
+        if (it != chunk.parameters().end()) {
+            if (it->second.int64_param() <= 0) {
+                return Status(StatusCode::INVALID_CHUNKED_REQUEST, RESPONSE_CHUNK_SIZE_PARAMETER_NAME + " has to be greater than 0");
+            }
+            responseChunkSize = it->second.int64_param();
+        }
+        request = std::move(chunk);
+        request.mutable_parameters()->erase(CHUNKED_REQUEST_PARAMETER_NAME);
+        request.mutable_parameters()->erase(FINAL_CHUNK_PARAMETER_NAME);
+        request.mutable_parameters()->erase(RESPONSE_CHUNK_SIZE_PARAMETER_NAME);
+        if (!finalChunk && request.raw_input_contents_size() == 0) {
+            for (int i = 0; i < request.inputs_size(); ++i) {
+                request.add_raw_input_contents();
+            }
+        }
+        expectedSizes.clear();
+        for (int i = 0; i < request.raw_input_contents_size(); ++i) {
+            expectedSizes.push_back(computeExpectedSize(request.inputs(i)));
+            if (expectedSizes[i] != UNKNOWN_SIZE && expectedSizes[i] <= MAX_PREALLOCATED_CONTENT_SIZE) {
+                request.mutable_raw_input_contents(i)->reserve(expectedSizes[i]);
+            }
+        }
+        started = true;
+    } else {
+        if (chunk.inputs_size() != 0) {
+            return Status(StatusCode::INVALID_CHUNKED_REQUEST, "inputs can be defined only in first chunk");
+        }
+        if (!chunk.id().empty() && chunk.id() != request.id()) {
+            return Status(StatusCode::INVALID_CHUNKED_REQUEST, "chunk id differs from request id");
+        }
+        if (chunk.raw_input_contents_size() != 0 && chunk.raw_input_contents_size() != request.raw_input_contents_size()) {
+            return Status(StatusCode::INVALID_CHUNKED_REQUEST, "raw_input_contents count has to match inputs count");
+        }
+        for (int i = 0; i < chunk.raw_input_contents_size(); ++i) {
+            request.mutable_raw_input_contents(i)->append(chunk.raw_input_contents(i));
+        }
+    }
+    for (size_t i = 0; i < expectedSizes.size(); ++i) {
+        if (expectedSizes[i] != UNKNOWN_SIZE && request.raw_input_contents(i).size() > expectedSizes[i]) {
+            return Status(StatusCode::INVALID_CHUNKED_REQUEST, "received more data than expected for input: " + request.inputs(i).name());
+        }
+    }
+    complete = finalChunk;
+    if (complete) {
+        SPDLOG_DEBUG("Assembled chunked request for servable: {}; id: {}", request.model_name(), request.id());
+    }
+    return StatusCode::OK;
+}
+
+void ChunkedRequestAssembler::reset() {
+    request.Clear();
+    expectedSizes.clear();
+    responseChunkSize = DEFAULT_RESPONSE_CHUNK_SIZE;
+    started = false;
+    complete = false;
+}
+
+bool writeResponseInChunks(KFSResponse& response, size_t chunkSize, const StreamResponseWriter& write) {
+    chunkSize = std::max<size_t>(chunkSize, 1);
+    google::protobuf::RepeatedPtrField<std::string> contents;
+    contents.Swap(response.mutable_raw_output_contents());
+    const std::string id = response.id();
+
+    ::inference::ModelStreamInferResponse message;
+    KFSResponse* chunk = message.mutable_infer_response();
+    chunk->Swap(&response);
+    int outputIndex = 0;
+    size_t offset = 0;
+    while (true) {
+        for (int i = 0; i < contents.size(); ++i) {
+            chunk->add_raw_output_contents();
+        }
+        size_t budget = chunkSize;
+        while (budget > 0 && outputIndex < contents.size()) {
+            std::string& content = *contents.Mutable(outputIndex);
+            size_t size = std::min(budget, content.size() - offset);
+            chunk->mutable_raw_output_contents(outputIndex)->assign(content, offset, size);
+            offset += size;
+            budget -= size;
+            if (offset == content.size()) {
+                std::string().swap(content);
+                ++outputIndex;
+                offset = 0;
+            }
+        }
+        const bool finalChunk = outputIndex == contents.size();
+        (*chunk->mutable_parameters())[FINAL_CHUNK_PARAMETER_NAME].set_bool_param(finalChunk);
+        if (!write(message)) {
+            return false;
+        }
+        if (finalChunk) {
+            return true;
+        }
+        chunk->Clear();
+        chunk->set_id(id);
+    }
+}
+}  // namespace ovms
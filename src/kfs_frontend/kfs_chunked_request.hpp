@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "kfs_grpc_inference_service.hpp"
+
+namespace ovms {
+class Status;
+
+// Request parameter marking the first message of request sent in chunks over ModelStreamInfer
+extern const std::string CHUNKED_REQUEST_PARAMETER_NAME;
+// Request and response parameter marking the last message of chunked request or response
+extern const std::string FINAL_CHUNK_PARAMETER_NAME;
+// Request parameter limiting size of raw output contents in single response message
+extern const std::string RESPONSE_CHUNK_SIZE_PARAMETER_NAME;
+
+constexpr size_t DEFAULT_RESPONSE_CHUNK_SIZE = 4 * 1024 * 1024;
+
+bool isChunkedRequest(const KFSRequest& request);
+
+/**
+ * @brief Assembles inference request sent over ModelStreamInfer in multiple messages,
+ * so that a client does not need to serialize huge tensors into single gRPC message.
+ *
+ * First chunk contains whole request (model name, inputs with shapes, requested outputs, parameters)
+ * with parameter chunked_request set to true and raw_input_contents containing initial
+ * part of each input. Following chunks contain only raw_input_contents, one entry per input,
+ * which are appended to the contents received so far. The last chunk has parameter final_chunk set to true.
+ */
+class ChunkedRequestAssembler {
+    KFSRequest request;
+    std::vector<size_t> expectedSizes;
+    size_t responseChunkSize = DEFAULT_RESPONSE_CHUNK_SIZE;
+    bool started = false;
+    bool complete = false;
+
+public:
+    /**
+     * @brief Adds next message of the stream. Contents of the chunk are moved out.
+     */
+    Status addChunk(KFSRequest& chunk);
+
+    bool isStarted() const { return started; }
+    bool isComplete() const { return complete; }
+    const KFSRequest& getRequest() const { return request; }
+    size_t getResponseChunkSize() const { return responseChunkSize; }
+    void reset();
+};
+
+using StreamResponseWriter = std::function<bool(const ::inference::ModelStreamInferResponse&)>;
+
+/**
+ * @brief Writes response as stream messages with raw_output_contents of at most chunkSize bytes in total.
+ * First message contains whole response metadata, following ones only id and raw_output_contents
+ * with one entry per output, to be appended by the client. The last message has parameter final_chunk set to true.
+ * Raw output contents are released from the response while being sent.
+ *
+ * @return false if writing to the stream failed
+ */
+bool writeResponseInChunks(KFSResponse& response, size_t chunkSize, const StreamResponseWriter& write);
+}  // namespace ovms
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "kfs_grpc_inference_service.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -22,6 +23,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include "../capi_frontend/inferencerequest.hpp"
+#include "../capi_frontend/inferenceresponse.hpp"
 #include "../dags/pipeline.hpp"
 #include "../dags/pipelinedefinition.hpp"
 #include "../dags/pipelinedefinitionstatus.hpp"
@@ -29,12 +32,16 @@
 #include "../deserialization.hpp"
 #include "../execution_context.hpp"
 #include "../grpc_utils.hpp"
+#include "../kfs_frontend/kfs_chunked_request.hpp"
+#include "../kfs_frontend/kfs_shared_memory.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
+#include "../logging.hpp"
 #if (MEDIAPIPE_DISABLE == 0)
 #include "../mediapipe_internal/mediapipegraphdefinition.hpp"
 #include "../mediapipe_internal/mediapipegraphexecutor.hpp"
 #endif
 #include "../metric.hpp"
+#include "../model_metadata_cache.hpp"
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
 #include "../modelmanager.hpp"
@@ -47,6 +54,7 @@
 #include "../stringutils.hpp"
 #include "../tensorinfo.hpp"
 #include "../timer.hpp"
+#include "../traffic_capture.hpp"
 #include "../version.hpp"
 
 namespace {
@@ -62,6 +70,9 @@ Status KFSInferenceServiceImpl::getModelInstance(const KFSRequest* request,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
     OVMS_PROFILE_FUNCTION();
+    if (auto router = this->modelManager.findModelRouterByName(request->model_name())) {
+        return router->route(this->modelManager, getRequestShapes(request), modelInstance, modelInstanceUnloadGuardPtr);
+    }
     model_version_t requestedVersion = 0;
     if (!request->model_version().empty()) {
         auto versionRead = stoi64(request->model_version());
@@ -188,6 +199,15 @@ Status KFSInferenceServiceImpl::ServerMetadataImpl(::grpc::ServerContext* contex
 }
 
 Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response, ExecutionContext executionContext) {
+    return getModelMetadata(request, response, nullptr, executionContext);
+}
+
+Status KFSInferenceServiceImpl::ModelMetadataJsonImpl(const KFSModelMetadataRequest* request, std::string& response, ExecutionContext executionContext) {
+    KFSModelMetadataResponse protoResponse;
+    return getModelMetadata(request, &protoResponse, &response, executionContext);
+}
+
+Status KFSInferenceServiceImpl::getModelMetadata(const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response, std::string* jsonResponse, ExecutionContext executionContext) {
     const auto& name = request->name();
     const auto& versionString = request->version();
 
@@ -205,6 +225,9 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
             }
             auto status = buildResponse(*mediapipeGraphDefinition, response);
             // INCREMENT_IF_ENABLED(pipelineDefinition->getMetricReporter().getModelReadyMetric(executionContext, status.ok())); TODO metrics
+            if (status.ok() && jsonResponse) {
+                status = serializeKfsModelMetadataToJson(*response, *jsonResponse);
+            }
             return status;
 #else
             return Status(StatusCode::MODEL_NAME_MISSING);
@@ -212,6 +235,9 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
         }
         auto status = buildResponse(*pipelineDefinition, response);
         INCREMENT_IF_ENABLED(pipelineDefinition->getMetricReporter().getModelMetadataMetric(executionContext, status.ok()));
+        if (status.ok() && jsonResponse) {
+            status = serializeKfsModelMetadataToJson(*response, *jsonResponse);
+        }
         return status;
     }
     std::shared_ptr<ModelInstance> instance = nullptr;
@@ -238,7 +264,7 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
             return Status(StatusCode::MODEL_VERSION_MISSING);
         }
     }
-    auto status = buildResponse(*model, *instance, response);
+    auto status = buildResponse(*model, *instance, response, jsonResponse);
     INCREMENT_IF_ENABLED(instance->getMetricReporter().getModelMetadataMetric(executionContext, status.ok()));
 
     return status;
@@ -261,10 +287,10 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
             return grpc(status);
         }
     } catch (const std::exception& e) {
-        SPDLOG_ERROR("Caught exception in InferenceServiceImpl for servable: {} exception: {}", servableName, e.what());
+        OVMS_LOG_RATE_LIMITED(spdlog::default_logger_raw(), spdlog::level::err, "Caught exception in InferenceServiceImpl for servable: {} exception: {}", servableName, e.what());
         return grpc(Status(StatusCode::UNKNOWN_ERROR, e.what()));
     } catch (...) {
-        SPDLOG_ERROR("Caught unknown exception in InferenceServiceImpl for servable: {}", servableName);
+        OVMS_LOG_RATE_LIMITED(spdlog::default_logger_raw(), spdlog::level::err, "Caught unknown exception in InferenceServiceImpl for servable: {}", servableName);
         return grpc(Status(StatusCode::UNKNOWN_ERROR));
     }
     double requestTotal = timer.elapsed<std::chrono::microseconds>(TOTAL);
@@ -281,6 +307,92 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
     return grpc(ModelStreamInferImpl(context, stream));
 }
 
+::grpc::Status KFSInferenceServiceImpl::SystemSharedMemoryStatus(::grpc::ServerContext* context, const ::inference::SystemSharedMemoryStatusRequest* request, ::inference::SystemSharedMemoryStatusResponse* response) {
+    (void)context;
+    return grpc(SystemSharedMemoryStatusImpl(request, response));
+}
+
+::grpc::Status KFSInferenceServiceImpl::SystemSharedMemoryRegister(::grpc::ServerContext* context, const ::inference::SystemSharedMemoryRegisterRequest* request, ::inference::SystemSharedMemoryRegisterResponse* response) {
+    (void)context;
+    return grpc(SystemSharedMemoryRegisterImpl(request, response));
+}
+
+::grpc::Status KFSInferenceServiceImpl::SystemSharedMemoryUnregister(::grpc::ServerContext* context, const ::inference::SystemSharedMemoryUnregisterRequest* request, ::inference::SystemSharedMemoryUnregisterResponse* response) {
+    (void)context;
+    return grpc(SystemSharedMemoryUnregisterImpl(request, response));
+}
+
+Status KFSInferenceServiceImpl::SystemSharedMemoryStatusImpl(const ::inference::SystemSharedMemoryStatusRequest* request, ::inference::SystemSharedMemoryStatusResponse* response) {
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> regions;
+    auto status = this->sharedMemoryRegistry.getRegions(request->name(), regions);
+    if (!status.ok()) {
+        return status;
+    }
+    for (const auto& region : regions) {
+        auto& regionStatus = (*response->mutable_regions())[region->getName()];
+        regionStatus.set_name(region->getName());
+        regionStatus.set_key(region->getKey());
+        regionStatus.set_offset(region->getOffset());
+        regionStatus.set_byte_size(region->getByteSize());
+    }
+    return StatusCode::OK;
+}
+
+Status KFSInferenceServiceImpl::SystemSharedMemoryRegisterImpl(const ::inference::SystemSharedMemoryRegisterRequest* request, ::inference::SystemSharedMemoryRegisterResponse* response) {
+    return this->sharedMemoryRegistry.registerRegion(request->name(), request->key(), request->offset(), request->byte_size());
+}
+
+Status KFSInferenceServiceImpl::SystemSharedMemoryUnregisterImpl(const ::inference::SystemSharedMemoryUnregisterRequest* request, ::inference::SystemSharedMemoryUnregisterResponse* response) {
+    return this->sharedMemoryRegistry.unregisterRegion(request->name());
+}
+
+Status KFSInferenceServiceImpl::ModelInferSharedMemoryImpl(const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
+    OVMS_PROFILE_FUNCTION();
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ovms::Pipeline> pipelinePtr;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
+    if (!status.ok() && status != StatusCode::MODEL_NAME_MISSING) {
+        SPDLOG_DEBUG("Getting modelInstance failed. {}", status.string());
+        return status;
+    }
+    // Request is converted to C-API request which binds external buffers as input tensors without copying
+    model_version_t version = modelInstance ? modelInstance->getVersion() : 1;
+    InferenceRequest inferenceRequest(request->model_name().c_str(), version);
+    InferenceResponse inferenceResponse(request->model_name(), version);
+    SharedMemoryRequest sharedMemoryRequest;
+    status = sharedMemoryRequest.prepare(*request, this->sharedMemoryRegistry, inferenceRequest);
+    if (!status.ok()) {
+        if (modelInstance) {
+            INCREMENT_IF_ENABLED(modelInstance->getMetricReporter().requestFailGrpcModelInfer);
+        }
+        return status;
+    }
+    if (modelInstance) {
+        reporterOut = &modelInstance->getMetricReporter();
+        status = modelInstance->infer(&inferenceRequest, &inferenceResponse, modelInstanceUnloadGuard);
+    } else {
+        SPDLOG_DEBUG("Requested model: {} does not exist. Searching for pipeline with that name...", request->model_name());
+        status = this->modelManager.createPipeline(pipelinePtr, request->model_name(), &inferenceRequest, &inferenceResponse);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Getting pipeline failed. Shared memory requests are supported only for models and DAGs. {}", status.string());
+            return status;
+        }
+        reporterOut = &pipelinePtr->getMetricReporter();
+        status = pipelinePtr->execute(executionContext);
+    }
+    INCREMENT_IF_ENABLED(reporterOut->getInferRequestMetric(executionContext, status.ok()));
+    if (!status.ok()) {
+        return status;
+    }
+    status = sharedMemoryRequest.serializeResponse(inferenceResponse, *response);
+    if (!status.ok()) {
+        return status;
+    }
+    response->set_id(request->id());
+    return StatusCode::OK;
+}
+
 Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
     OVMS_PROFILE_FUNCTION();
     std::shared_ptr<ovms::ModelInstance> modelInstance;
@@ -288,6 +400,12 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
 
     std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
     SPDLOG_DEBUG("ModelInfer requested name: {}, version: {}", request->model_name(), request->model_version());
+    if (requestUsesSharedMemory(*request)) {
+        return this->ModelInferSharedMemoryImpl(request, response, executionContext, reporterOut);
+    }
+    if (auto* trafficRecorder = this->modelManager.getTrafficRecorder()) {
+        trafficRecorder->capture(TrafficApi::KFS, request->model_name(), *request);
+    }
     auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
     if (status == StatusCode::MODEL_NAME_MISSING) {
         SPDLOG_DEBUG("Requested model: {} does not exist. Searching for pipeline with that name...", request->model_name());
@@ -331,25 +449,142 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
 
 Status KFSInferenceServiceImpl::ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
     OVMS_PROFILE_FUNCTION();
-#if (MEDIAPIPE_DISABLE == 0)
     ::inference::ModelInferRequest firstRequest;
     if (!stream->Read(&firstRequest)) {
         Status status = StatusCode::MEDIAPIPE_UNINITIALIZED_STREAM_CLOSURE;
         SPDLOG_DEBUG(status.string());
         return status;
     }
-    std::shared_ptr<MediapipeGraphExecutor> executor;
-    auto status = this->modelManager.createPipeline(executor, firstRequest.model_name(), &firstRequest, nullptr /* response not present in streaming api */);
+    if (isChunkedRequest(firstRequest)) {
+        return this->ModelChunkedStreamInferImpl(context, firstRequest, stream);
+    }
+#if (MEDIAPIPE_DISABLE == 0)
+    const std::string streamId = MediapipeGraphExecutor::getStreamId(firstRequest);
+    if (!streamId.empty() && this->streamSessionRegistry->isResumeEnabled()) {
+        return this->ModelResumableStreamInferImpl(streamId, firstRequest, stream);
+    }
+    auto status = this->streamSessionRegistry->admit();
     if (!status.ok()) {
+        SPDLOG_DEBUG("Rejecting stream to: {}; {}", firstRequest.model_name(), status.string());
         return status;
     }
-    return executor->inferStream(firstRequest, *stream);
+    std::shared_ptr<MediapipeGraphExecutor> executor;
+    status = this->modelManager.createPipeline(executor, firstRequest.model_name(), &firstRequest, nullptr /* response not present in streaming api */);
+    if (status.ok()) {
+        status = executor->inferStream(firstRequest, *stream);
+    }
+    this->streamSessionRegistry->release();
+    return status;
 #else
     SPDLOG_DEBUG("Mediapipe support was disabled during build process...");
     return StatusCode::NOT_IMPLEMENTED;
 #endif
 }
 
+Status KFSInferenceServiceImpl::ModelResumableStreamInferImpl(const std::string& streamId, ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
+#if (MEDIAPIPE_DISABLE == 0)
+    OVMS_PROFILE_FUNCTION();
+    auto& registry = *this->streamSessionRegistry;
+    std::shared_ptr<StreamSession> parkedSession;
+    auto status = registry.resume(streamId, parkedSession);
+    if (!status.ok()) {
+        return status;
+    }
+    auto session = std::static_pointer_cast<MediapipeStreamSession>(parkedSession);
+    if (session) {
+        status = session->validate(firstRequest);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Stream session: {} cannot be resumed by request to: {}; {}", streamId, firstRequest.model_name(), status.string());
+            registry.detach(streamId);
+            return status;
+        }
+    } else {
+        status = registry.admit();
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Rejecting stream to: {}; {}", firstRequest.model_name(), status.string());
+            registry.remove(streamId);
+            return status;
+        }
+        std::shared_ptr<MediapipeGraphExecutor> executor;
+        status = this->modelManager.createPipeline(executor, firstRequest.model_name(), &firstRequest, nullptr /* response not present in streaming api */);
+        if (status.ok()) {
+            session = std::make_shared<MediapipeStreamSession>(std::move(executor), true);
+            status = session->open(firstRequest);
+        }
+        if (!status.ok()) {
+            registry.remove(streamId);
+            registry.release();
+            return status;
+        }
+        registry.attach(streamId, session);
+    }
+    status = session->serve(firstRequest, *stream);
+    if (status.ok() && !session->hasError()) {
+        registry.detach(streamId);
+        return StatusCode::OK;
+    }
+    // graph cannot be resumed after error
+    registry.remove(streamId);
+    registry.release();
+    auto finishStatus = session->finish();
+    return status.ok() ? finishStatus : status;
+#else
+    return StatusCode::NOT_IMPLEMENTED;
+#endif
+}
+
+void KFSInferenceServiceImpl::configureStreamSessions(uint32_t maxStreamGraphs, std::chrono::milliseconds resumeGracePeriod) {
+    this->streamSessionRegistry = std::make_unique<StreamSessionRegistry>(maxStreamGraphs, resumeGracePeriod);
+    this->streamSessionRegistry->startCleaner();
+}
+
+Status KFSInferenceServiceImpl::ModelChunkedStreamInferImpl(::grpc::ServerContext* context, ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
+    OVMS_PROFILE_FUNCTION();
+    ChunkedRequestAssembler assembler;
+    auto status = assembler.addChunk(firstRequest);
+    while (status.ok()) {
+        if (assembler.isComplete()) {
+            KFSResponse response;
+            ServableMetricReporter* reporter = nullptr;
+            Timer<TIMER_END> timer;
+            timer.start(TOTAL);
+            status = this->ModelInferImpl(context, &assembler.getRequest(), &response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer}, reporter);
+            timer.stop(TOTAL);
+            if (status.ok() && reporter) {
+                OBSERVE_IF_ENABLED(reporter->requestTimeGrpc, timer.elapsed<std::chrono::microseconds>(TOTAL));
+            }
+            const size_t responseChunkSize = assembler.getResponseChunkSize();
+            assembler.reset();
+            bool written = false;
+            if (status.ok()) {
+                written = writeResponseInChunks(response, responseChunkSize, [stream](const ::inference::ModelStreamInferResponse& message) { return stream->Write(message); });
+            } else {
+                // request was consumed entirely, so stream can be used for next requests
+                ::inference::ModelStreamInferResponse message;
+                *message.mutable_error_message() = status.string();
+                written = stream->Write(message);
+            }
+            if (!written) {
+                SPDLOG_DEBUG("Writing chunked response to disconnected client");
+                return StatusCode::OK;
+            }
+        }
+        ::inference::ModelInferRequest chunk;
+        if (!stream->Read(&chunk)) {
+            break;
+        }
+        status = assembler.addChunk(chunk);
+    }
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Chunked request processing failed: {}", status.string());
+        return status;
+    }
+    if (assembler.isStarted()) {
+        return StatusCode::CHUNKED_REQUEST_INCOMPLETE;
+    }
+    return StatusCode::OK;
+}
+
 Status KFSInferenceServiceImpl::buildResponse(
     std::shared_ptr<ModelInstance> instance,
     KFSGetModelStatusResponse* response) {
@@ -379,19 +614,21 @@ Status KFSInferenceServiceImpl::buildResponse(
 }
 #endif
 
-static void addReadyVersions(Model& model,
-    KFSModelMetadataResponse* response) {
+static model_versions_t getReadyVersions(Model& model) {
+    model_versions_t readyVersions;
     auto modelVersions = model.getModelVersionsMapCopy();
     for (auto& [modelVersion, modelInstance] : modelVersions) {
         if (modelInstance.getStatus().getState() == ModelVersionState::AVAILABLE)
-            response->add_versions(std::to_string(modelVersion));
+            readyVersions.push_back(modelVersion);
     }
+    return readyVersions;
 }
 
 Status KFSInferenceServiceImpl::buildResponse(
     Model& model,
     ModelInstance& instance,
-    KFSModelMetadataResponse* response) {
+    KFSModelMetadataResponse* response,
+    std::string* jsonResponse) {
 
     std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
 
@@ -401,25 +638,27 @@ Status KFSInferenceServiceImpl::buildResponse(
         return status;
     }
 
-    response->Clear();
-    response->set_name(instance.getName());
-    addReadyVersions(model, response);
-    response->set_platform(PLATFORM);
-
-    for (const auto& input : instance.getInputsInfo()) {
-        convert(input, response->add_inputs());
+    const ModelMetadataCache* metadataCache = instance.getMetadataCache();
+    std::unique_ptr<ModelMetadataCache> temporaryMetadataCache;
+    if (metadataCache == nullptr) {
+        temporaryMetadataCache = std::make_unique<ModelMetadataCache>(instance.getName(), instance.getVersion(), instance.getInputsInfo(), instance.getOutputsInfo());
+        metadataCache = temporaryMetadataCache.get();
     }
-
-    for (const auto& output : instance.getOutputsInfo()) {
-        convert(output, response->add_outputs());
+    const model_versions_t readyVersions = getReadyVersions(model);
+    if (jsonResponse && metadataCache->writeKfsJson(readyVersions, *jsonResponse)) {
+        return StatusCode::OK;
+    }
+    metadataCache->buildKfsResponse(readyVersions, response);
+    if (jsonResponse) {
+        return serializeKfsModelMetadataToJson(*response, *jsonResponse);
     }
-
     return StatusCode::OK;
 }
 
 KFSInferenceServiceImpl::KFSInferenceServiceImpl(const Server& server) :
     ovmsServer(server),
-    modelManager(dynamic_cast<const ServableManagerModule*>(this->ovmsServer.getModule(SERVABLE_MANAGER_MODULE_NAME))->getServableManager()) {
+    modelManager(dynamic_cast<const ServableManagerModule*>(this->ovmsServer.getModule(SERVABLE_MANAGER_MODULE_NAME))->getServableManager()),
+    streamSessionRegistry(std::make_unique<StreamSessionRegistry>(0, std::chrono::milliseconds(0))) {
     if (nullptr == this->ovmsServer.getModule(SERVABLE_MANAGER_MODULE_NAME)) {
         const char* message = "Tried to create kserve inference service impl without servable manager module";
         SPDLOG_ERROR(message);
@@ -487,7 +726,11 @@ void KFSInferenceServiceImpl::convert(
     const std::pair<std::string, std::shared_ptr<const TensorInfo>>& from,
     KFSModelMetadataResponse::TensorMetadata* to) {
     to->set_name(from.first);
-    to->set_datatype(ovmsPrecisionToKFSPrecision(from.second->getPrecision()));
+    if (from.second->getWirePrecision() != Precision::UNDEFINED) {
+        to->set_datatype(wirePrecisionToKFSPrecision(from.second->getWirePrecision()));
+    } else {
+        to->set_datatype(ovmsPrecisionToKFSPrecision(from.second->getPrecision()));
+    }
     for (auto& dim : from.second->getShape()) {
         if (dim.isStatic()) {
             to->add_shape(dim.getStaticValue());
@@ -15,6 +15,8 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -24,6 +26,9 @@
 #include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
 #include "src/kfserving_api/grpc_predict_v2.pb.h"
 
+#include "../shared_memory_registry.hpp"
+#include "../stream_session_registry.hpp"
+
 using inference::GRPCInferenceService;
 using KFSServerMetadataRequest = inference::ServerMetadataRequest;
 using KFSServerMetadataResponse = inference::ServerMetadataResponse;
@@ -54,17 +59,34 @@ class Status;
 class TensorInfo;
 class PipelineDefinition;
 
+extern const std::string PLATFORM;
+
 class KFSInferenceServiceImpl : public GRPCInferenceService::Service {
 protected:
     const Server& ovmsServer;
     ModelManager& modelManager;
+    SharedMemoryRegistry sharedMemoryRegistry;
+    std::unique_ptr<StreamSessionRegistry> streamSessionRegistry;
 
 public:
     Status ModelReadyImpl(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response, ExecutionContext executionContext);
     Status ServerMetadataImpl(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response);
     Status ModelMetadataImpl(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response, ExecutionContext executionContext);
+    /**
+     * @brief Model metadata in REST API json format. For model versions it is written from response prepared on model load.
+     */
+    Status ModelMetadataJsonImpl(const KFSModelMetadataRequest* request, std::string& response, ExecutionContext executionContext);
     Status ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut);
     Status ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream);
+    Status ModelInferSharedMemoryImpl(const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut);
+    Status SystemSharedMemoryStatusImpl(const ::inference::SystemSharedMemoryStatusRequest* request, ::inference::SystemSharedMemoryStatusResponse* response);
+    Status SystemSharedMemoryRegisterImpl(const ::inference::SystemSharedMemoryRegisterRequest* request, ::inference::SystemSharedMemoryRegisterResponse* response);
+    Status SystemSharedMemoryUnregisterImpl(const ::inference::SystemSharedMemoryUnregisterRequest* request, ::inference::SystemSharedMemoryUnregisterResponse* response);
+    Status ModelChunkedStreamInferImpl(::grpc::ServerContext* context, ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream);
+    Status ModelResumableStreamInferImpl(const std::string& streamId, ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream);
+    void configureStreamSessions(uint32_t maxStreamGraphs, std::chrono::milliseconds resumeGracePeriod);
+    StreamSessionRegistry& getStreamSessionRegistry() { return *this->streamSessionRegistry; }
+    void configureSharedMemory(bool enabled, const std::string& keyPrefix) { this->sharedMemoryRegistry.configure(enabled, keyPrefix); }
     KFSInferenceServiceImpl(const Server& server);
     ::grpc::Status ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) override;
     ::grpc::Status ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) override;
@@ -73,7 +95,10 @@ public:
     ::grpc::Status ModelMetadata(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response) override;
     ::grpc::Status ModelInfer(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response) override;
     ::grpc::Status ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) override;
-    static Status buildResponse(Model& model, ModelInstance& instance, KFSModelMetadataResponse* response);
+    ::grpc::Status SystemSharedMemoryStatus(::grpc::ServerContext* context, const ::inference::SystemSharedMemoryStatusRequest* request, ::inference::SystemSharedMemoryStatusResponse* response) override;
+    ::grpc::Status SystemSharedMemoryRegister(::grpc::ServerContext* context, const ::inference::SystemSharedMemoryRegisterRequest* request, ::inference::SystemSharedMemoryRegisterResponse* response) override;
+    ::grpc::Status SystemSharedMemoryUnregister(::grpc::ServerContext* context, const ::inference::SystemSharedMemoryUnregisterRequest* request, ::inference::SystemSharedMemoryUnregisterResponse* response) override;
+    static Status buildResponse(Model& model, ModelInstance& instance, KFSModelMetadataResponse* response, std::string* jsonResponse = nullptr);
     static Status buildResponse(PipelineDefinition& pipelineDefinition, KFSModelMetadataResponse* response);
     static Status buildResponse(std::shared_ptr<ModelInstance> instance, KFSGetModelStatusResponse* response);
     static Status buildResponse(PipelineDefinition& pipelineDefinition, KFSGetModelStatusResponse* response);
@@ -83,6 +108,7 @@ public:
     static Status getModelReady(const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response, const ModelManager& manager, ExecutionContext executionContext);
 
 protected:
+    Status getModelMetadata(const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response, std::string* jsonResponse, ExecutionContext executionContext);
     Status getModelInstance(const KFSRequest* request,
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr);
@@ -0,0 +1,203 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "kfs_shared_memory.hpp"
+
+#include <cstring>
+#include <optional>
+#include <sstream>
+#include <utility>
+
+#include "../capi_frontend/buffer.hpp"
+#include "../capi_frontend/capi_utils.hpp"
+#include "../capi_frontend/inferencerequest.hpp"
+#include "../capi_frontend/inferenceresponse.hpp"
+#include "../logging.hpp"
+#include "../shared_memory_registry.hpp"
+#include "../status.hpp"
+#include "kfs_utils.hpp"
+
+namespace ovms {
+
+const std::string SHARED_MEMORY_REGION_PARAMETER_NAME = "shared_memory_region";
+const std::string SHARED_MEMORY_OFFSET_PARAMETER_NAME = "shared_memory_offset";
+const std::string SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME = "shared_memory_byte_size";
+
+using KFSParameters = ::google::protobuf::Map<std::string, ::inference::InferParameter>;
+
+bool usesSharedMemory(const KFSParameters& parameters) {
+    return parameters.count(SHARED_MEMORY_REGION_PARAMETER_NAME) > 0;
+}
+
+bool requestUsesSharedMemory(const KFSRequest& request) {
+    for (const auto& input : request.inputs()) {
+        if (usesSharedMemory(input.parameters())) {
+            return true;
+        }
+    }
+    for (const auto& output : request.outputs()) {
+        if (usesSharedMemory(output.parameters())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static Status getSizeParameter(const KFSParameters& parameters, const std::string& name, const std::string& tensorName, std::optional<size_t>& value) {
+    auto it = parameters.find(name);
+    if (it == parameters.end()) {
+        return StatusCode::OK;
+    }
+    if (it->second.parameter_choice_case() != ::inference::InferParameter::ParameterChoiceCase::kInt64Param || it->second.int64_param() < 0) {
+        return Status(StatusCode::INVALID_SHM_PARAMETERS, name + " has to be non negative int64 parameter; tensor: " + tensorName);
+    }
+    value = it->second.int64_param();
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRequest::getBuffer(const SharedMemoryRegistry& registry, const std::string& tensorName, const KFSParameters& parameters, std::string& regionName, size_t& offset, size_t& byteSize, char** buffer) {
+    const auto& regionParameter = parameters.at(SHARED_MEMORY_REGION_PARAMETER_NAME);
+    if (regionParameter.parameter_choice_case() != ::inference::InferParameter::ParameterChoiceCase::kStringParam) {
+        return Status(StatusCode::INVALID_SHM_PARAMETERS, SHARED_MEMORY_REGION_PARAMETER_NAME + " has to be string parameter; tensor: " + tensorName);
+    }
+    regionName = regionParameter.string_param();
+    std::optional<size_t> offsetParameter;
+    std::optional<size_t> byteSizeParameter;
+    auto status = getSizeParameter(parameters, SHARED_MEMORY_OFFSET_PARAMETER_NAME, tensorName, offsetParameter);
+    if (!status.ok()) {
+        return status;
+    }
+    status = getSizeParameter(parameters, SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME, tensorName, byteSizeParameter);
+    if (!status.ok()) {
+        return status;
+    }
+    if (!byteSizeParameter.has_value()) {
+        return Status(StatusCode::INVALID_SHM_PARAMETERS, SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME + " is required; tensor: " + tensorName);
+    }
+    std::shared_ptr<const SharedMemoryRegion> region;
+    status = registry.getRegion(regionName, region);
+    if (!status.ok()) {
+        return status;
+    }
+    offset = offsetParameter.value_or(0);
+    byteSize = byteSizeParameter.value();
+    status = region->getBuffer(offset, byteSize, buffer);
+    if (!status.ok()) {
+        return status;
+    }
+    regions.push_back(std::move(region));
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRequest::prepare(const KFSRequest& request, const SharedMemoryRegistry& registry, InferenceRequest& inferenceRequest) {
+    int rawInputContentsIndex = 0;
+    for (const auto& input : request.inputs()) {
+        OVMS_DataType datatype = getPrecisionAsOVMSDataType(KFSPrecisionToOvmsPrecision(input.datatype()));
+        if (datatype == OVMS_DATATYPE_UNDEFINED) {
+            return Status(StatusCode::INVALID_PRECISION, "datatype: " + input.datatype() + " is not supported in requests using shared memory; input: " + input.name());
+        }
+        auto status = inferenceRequest.addInput(input.name().c_str(), datatype, input.shape().data(), input.shape_size());
+        if (!status.ok()) {
+            return status;
+        }
+        const void* data = nullptr;
+        size_t byteSize = 0;
+        if (usesSharedMemory(input.parameters())) {
+            std::string regionName;
+            size_t offset = 0;
+            char* buffer = nullptr;
+            status = getBuffer(registry, input.name(), input.parameters(), regionName, offset, byteSize, &buffer);
+            if (!status.ok()) {
+                return status;
+            }
+            data = buffer;
+        } else if (rawInputContentsIndex < request.raw_input_contents_size()) {
+            const std::string& contents = request.raw_input_contents(rawInputContentsIndex++);
+            data = contents.data();
+            byteSize = contents.size();
+        } else {
+            return Status(StatusCode::INVALID_MESSAGE_STRUCTURE, "in requests using shared memory, inputs have to be placed in shared memory or in raw_input_contents; input: " + input.name());
+        }
+        status = inferenceRequest.setInputBuffer(input.name().c_str(), data, byteSize, OVMS_BUFFERTYPE_CPU, std::nullopt);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    if (rawInputContentsIndex != request.raw_input_contents_size()) {
+        return Status(StatusCode::INVALID_MESSAGE_STRUCTURE, "raw_input_contents count has to match number of inputs not placed in shared memory");
+    }
+    for (const auto& output : request.outputs()) {
+        if (!usesSharedMemory(output.parameters())) {
+            continue;
+        }
+        OutputBinding binding;
+        auto status = getBuffer(registry, output.name(), output.parameters(), binding.regionName, binding.offset, binding.byteSize, &binding.buffer);
+        if (!status.ok()) {
+            return status;
+        }
+        outputBindings.emplace(output.name(), std::move(binding));
+    }
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRequest::serializeResponse(const InferenceResponse& inferenceResponse, KFSResponse& response) const {
+    response.set_model_name(inferenceResponse.getServableName());
+    response.set_model_version(std::to_string(inferenceResponse.getServableVersion()));
+    size_t boundOutputsCount = 0;
+    for (uint32_t i = 0; i < inferenceResponse.getOutputCount(); ++i) {
+        const std::string* name = nullptr;
+        const InferenceTensor* tensor = nullptr;
+        auto status = inferenceResponse.getOutput(i, &name, &tensor);
+        if (!status.ok()) {
+            return status;
+        }
+        auto* output = response.add_outputs();
+        output->set_name(*name);
+        output->set_datatype(ovmsPrecisionToKFSPrecision(getOVMSDataTypeAsPrecision(tensor->getDataType())));
+        for (auto dim : tensor->getShape()) {
+            output->add_shape(dim);
+        }
+        const Buffer* buffer = tensor->getBuffer();
+        const size_t byteSize = buffer ? buffer->getByteSize() : 0;
+        auto it = outputBindings.find(*name);
+        if (it == outputBindings.end()) {
+            // raw_output_contents hold only outputs not placed in shared memory
+            std::string* contents = response.add_raw_output_contents();
+            if (byteSize > 0) {
+                contents->assign(static_cast<const char*>(buffer->data()), byteSize);
+            }
+            continue;
+        }
+        const OutputBinding& binding = it->second;
+        if (byteSize > binding.byteSize) {
+            std::stringstream ss;
+            ss << "Output: " << *name << " size: " << byteSize << " exceeds " << SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME << ": " << binding.byteSize;
+            return Status(StatusCode::SHM_OUT_OF_BOUNDS, ss.str());
+        }
+        if (byteSize > 0) {
+            std::memcpy(binding.buffer, buffer->data(), byteSize);
+        }
+        auto& parameters = *output->mutable_parameters();
+        parameters[SHARED_MEMORY_REGION_PARAMETER_NAME].set_string_param(binding.regionName);
+        parameters[SHARED_MEMORY_OFFSET_PARAMETER_NAME].set_int64_param(binding.offset);
+        parameters[SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME].set_int64_param(byteSize);
+        ++boundOutputsCount;
+    }
+    if (boundOutputsCount != outputBindings.size()) {
+        return Status(StatusCode::INVALID_MISSING_OUTPUT, "output requested in shared memory is not produced by servable");
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "kfs_grpc_inference_service.hpp"
+
+namespace ovms {
+class InferenceRequest;
+class InferenceResponse;
+class SharedMemoryRegion;
+class SharedMemoryRegistry;
+class Status;
+
+// Tensor parameters referencing data placed in registered system shared memory region
+extern const std::string SHARED_MEMORY_REGION_PARAMETER_NAME;
+extern const std::string SHARED_MEMORY_OFFSET_PARAMETER_NAME;
+extern const std::string SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME;
+
+bool usesSharedMemory(const ::google::protobuf::Map<std::string, ::inference::InferParameter>& parameters);
+bool requestUsesSharedMemory(const KFSRequest& request);
+
+/**
+ * @brief Binds tensors of KServe request referencing system shared memory regions.
+ *
+ * Input data is not copied - request is converted to C-API request with input buffers
+ * pointing to shared memory or raw_input_contents of the original request. Inputs placed
+ * in shared memory do not have entries in raw_input_contents.
+ * Outputs requested with shared memory parameters are written to the regions and
+ * have empty entries in raw_output_contents of the response.
+ * Referenced regions are kept mapped until the object is destroyed, even if unregistered in the meantime.
+ */
+class SharedMemoryRequest {
+    struct OutputBinding {
+        std::string regionName;
+        size_t offset;
+        size_t byteSize;
+        char* buffer;
+    };
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> regions;
+    std::unordered_map<std::string, OutputBinding> outputBindings;
+
+    Status getBuffer(const SharedMemoryRegistry& registry, const std::string& tensorName, const ::google::protobuf::Map<std::string, ::inference::InferParameter>& parameters, std::string& regionName, size_t& offset, size_t& byteSize, char** buffer);
+
+public:
+    Status prepare(const KFSRequest& request, const SharedMemoryRegistry& registry, InferenceRequest& inferenceRequest);
+    Status serializeResponse(const InferenceResponse& inferenceResponse, KFSResponse& response) const;
+};
+}  // namespace ovms
@@ -105,6 +105,20 @@ const KFSDataType& ovmsPrecisionToKFSPrecision(Precision precision) {
     return it->second;
 }
 
+const KFSDataType& wirePrecisionToKFSPrecision(Precision wirePrecision) {
+    static const KFSDataType fp16{"FP16"};
+    static const KFSDataType bf16{"BF16"};
+    static const KFSDataType invalid{"INVALID"};
+    switch (wirePrecision) {
+    case Precision::FP16:
+        return fp16;
+    case Precision::BF16:
+        return bf16;
+    default:
+        return invalid;
+    }
+}
+
 std::string tensorShapeToString(const KFSShapeType& shape) {
     std::ostringstream oss;
     oss << "(";
@@ -25,6 +25,8 @@ std::string tensorShapeToString(const KFSShapeType& tensorShape);
 
 Precision KFSPrecisionToOvmsPrecision(const KFSDataType& s);
 const KFSDataType& ovmsPrecisionToKFSPrecision(Precision precision);
+// compact datatypes are accepted and returned only for tensors configured with wire_precision
+const KFSDataType& wirePrecisionToKFSPrecision(Precision wirePrecision);
 
 size_t KFSDataTypeSize(const KFSDataType& datatype);
 Status prepareConsolidatedTensorImpl(KFSResponse* response, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape, char*& tensorOut, size_t size);
@@ -20,6 +20,8 @@
 #endif
 #include <vector>
 
+#include <spdlog/async.h>
+
 namespace ovms {
 
 std::shared_ptr<spdlog::logger> gcs_logger = std::make_shared<spdlog::logger>("gcs");
@@ -36,6 +38,31 @@ std::shared_ptr<spdlog::logger> mediapipe_logger = std::make_shared<spdlog::logg
 std::shared_ptr<spdlog::logger> ov_logger = std::make_shared<spdlog::logger>("openvino");
 #endif
 const std::string default_pattern = "[%Y-%m-%d %T.%e][%t][%n][%l][%s:%#] %v";
+const size_t ASYNC_LOG_QUEUE_SIZE = 8192;
+const std::chrono::seconds ASYNC_LOG_FLUSH_INTERVAL{1};
+static bool asyncLoggingEnabled = false;
+
+static std::vector<std::shared_ptr<spdlog::logger>*> get_ovms_loggers() {
+    return {&gcs_logger,
+        &azurestorage_logger,
+        &s3_logger,
+        &modelmanager_logger,
+        &dag_executor_logger,
+        &sequence_manager_logger,
+        &capi_logger,
+#if (MEDIAPIPE_DISABLE == 0)
+        &mediapipe_logger,
+#endif
+#if (OV_TRACING == 1)
+        &ov_logger,
+#endif
+    };
+}
+
+static std::shared_ptr<spdlog::logger> create_async_logger(const std::string& name, const std::vector<spdlog::sink_ptr>& sinks = {}) {
+    // request threads never wait for the writer thread, oldest messages are dropped when it does not keep up
+    return std::make_shared<spdlog::async_logger>(name, begin(sinks), end(sinks), spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+}
 
 static void set_log_level(const std::string log_level, std::shared_ptr<spdlog::logger> logger) {
     logger->set_level(spdlog::level::info);
@@ -56,8 +83,18 @@ static void set_log_level(const std::string log_level, std::shared_ptr<spdlog::l
     }
 }
 
-static void register_loggers(const std::string& log_level, std::vector<spdlog::sink_ptr> sinks) {
-    auto serving_logger = std::make_shared<spdlog::logger>("serving", begin(sinks), end(sinks));
+static void register_loggers(const std::string& log_level, std::vector<spdlog::sink_ptr> sinks, bool async) {
+    std::shared_ptr<spdlog::logger> serving_logger;
+    if (async) {
+        // single writer thread, so sinks are not written concurrently
+        spdlog::init_thread_pool(ASYNC_LOG_QUEUE_SIZE, 1);
+        for (auto* logger : get_ovms_loggers()) {
+            *logger = create_async_logger((*logger)->name());
+        }
+        serving_logger = create_async_logger("serving", sinks);
+    } else {
+        serving_logger = std::make_shared<spdlog::logger>("serving", begin(sinks), end(sinks));
+    }
     serving_logger->set_pattern(default_pattern);
     gcs_logger->set_pattern(default_pattern);
     azurestorage_logger->set_pattern(default_pattern);
@@ -102,9 +139,35 @@ static void register_loggers(const std::string& log_level, std::vector<spdlog::s
     set_log_level(log_level, ov_logger);
 #endif
     spdlog::set_default_logger(serving_logger);
+    if (async) {
+        // messages below flush level are written to sinks by the writer thread but may stay buffered
+        spdlog::flush_every(ASYNC_LOG_FLUSH_INTERVAL);
+        asyncLoggingEnabled = true;
+    }
 }
 
-void configure_logger(const std::string& log_level, const std::string& log_path) {
+static std::shared_ptr<spdlog::logger> create_sync_logger_copy(const std::shared_ptr<spdlog::logger>& logger) {
+    auto copy = std::make_shared<spdlog::logger>(logger->name(), begin(logger->sinks()), end(logger->sinks()));
+    copy->set_pattern(default_pattern);
+    copy->set_level(logger->level());
+    copy->flush_on(logger->flush_level());
+    return copy;
+}
+
+static void warn_if_compiled_out(const std::string& log_level) {
+    int requestedLevel = SPDLOG_LEVEL_INFO;
+    if (log_level == "TRACE") {
+        requestedLevel = SPDLOG_LEVEL_TRACE;
+    } else if (log_level == "DEBUG") {
+        requestedLevel = SPDLOG_LEVEL_DEBUG;
+    }
+    if (requestedLevel < SPDLOG_ACTIVE_LEVEL) {
+        SPDLOG_WARN("Log level: {} was requested but messages below level: {} were excluded during build", log_level,
+            spdlog::level::to_string_view(static_cast<spdlog::level::level_enum>(SPDLOG_ACTIVE_LEVEL)));
+    }
+}
+
+void configure_logger(const std::string& log_level, const std::string& log_path, bool async) {
     static bool wasRun = false;
     if (wasRun) {
         SPDLOG_WARN("Tried to configure loggers twice. Keeping previous settings.");
@@ -116,7 +179,8 @@ void configure_logger(const std::string& log_level, const std::string& log_path)
     if (!log_path.empty()) {
         sinks.push_back(std::make_shared<spdlog::sinks::basic_file_sink_mt>(log_path));
     }
-    register_loggers(log_level, sinks);
+    register_loggers(log_level, sinks, async);
+    warn_if_compiled_out(log_level);
 #if (MEDIAPIPE_DISABLE == 0)
     if (log_level == "DEBUG" || log_level == "TRACE")
         FLAGS_minloglevel = google::INFO;
@@ -124,7 +188,28 @@ void configure_logger(const std::string& log_level, const std::string& log_path)
         FLAGS_minloglevel = google::WARNING;
     else  // ERROR, FATAL
         FLAGS_minloglevel = google::ERROR;
+    // per request calculator messages are logged with VLOG(1)
+    FLAGS_v = (log_level == "TRACE") ? 1 : 0;
 #endif
 }
 
+void shutdown_logger() {
+    if (!asyncLoggingEnabled) {
+        return;
+    }
+    for (auto* logger : get_ovms_loggers()) {
+        (*logger)->flush();
+    }
+    auto servingLogger = spdlog::default_logger();
+    servingLogger->flush();
+    // writer thread exits after writing all queued messages
+    spdlog::shutdown();
+    asyncLoggingEnabled = false;
+    // messages logged later, e.g. from destructors, are written synchronously
+    for (auto* logger : get_ovms_loggers()) {
+        *logger = create_sync_logger_copy(*logger);
+    }
+    spdlog::set_default_logger(create_sync_logger_copy(servingLogger));
+}
+
 }  // namespace ovms
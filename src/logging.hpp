@@ -15,6 +15,9 @@
 //*****************************************************************************
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -41,6 +44,76 @@ extern std::shared_ptr<spdlog::logger> ov_logger;
 #define OV_LOGGER(...)
 #endif
 
-void configure_logger(const std::string& log_level, const std::string& log_path);
+/**
+ * @brief Allows one message per interval from a log call site.
+ *
+ * Used on request paths where the same failure may be logged for every request.
+ */
+class LogRateLimiter {
+    const int64_t intervalNs;
+    std::atomic<int64_t> nextAllowedNs{0};
+    std::atomic<uint64_t> suppressed{0};
+
+public:
+    explicit LogRateLimiter(std::chrono::milliseconds interval) :
+        intervalNs(std::chrono::duration_cast<std::chrono::nanoseconds>(interval).count()) {}
+
+    /**
+     * @brief Checks whether message can be logged now.
+     *
+     * @param suppressedCount number of messages suppressed since last allowed one
+     */
+    bool allow(uint64_t& suppressedCount, std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now()) {
+        const int64_t nowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        int64_t nextAllowed = nextAllowedNs.load(std::memory_order_relaxed);
+        if (nowNs < nextAllowed || !nextAllowedNs.compare_exchange_strong(nextAllowed, nowNs + intervalNs, std::memory_order_relaxed)) {
+            suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        suppressedCount = suppressed.exchange(0, std::memory_order_relaxed);
+        return true;
+    }
+};
+
+const std::chrono::milliseconds LOG_RATE_LIMIT_INTERVAL{1000};
+
+// Logs message if rateLimiter allows it, compiled out below SPDLOG_ACTIVE_LEVEL
+#define OVMS_LOG_WITH_RATE_LIMITER(rateLimiter, logger, level, ...)                                                   \
+    do {                                                                                                              \
+        if (SPDLOG_ACTIVE_LEVEL <= static_cast<int>(level) && (logger)->should_log(level)) {                          \
+            uint64_t suppressedCount = 0;                                                                             \
+            if ((rateLimiter).allow(suppressedCount)) {                                                               \
+                if (suppressedCount > 0) {                                                                            \
+                    SPDLOG_LOGGER_CALL(logger, level, "Suppressed {} messages from the same place", suppressedCount); \
+                }                                                                                                     \
+                SPDLOG_LOGGER_CALL(logger, level, __VA_ARGS__);                                                       \
+            }                                                                                                         \
+        }                                                                                                             \
+    } while (0)
+
+// Logs at most one message per LOG_RATE_LIMIT_INTERVAL from the call site, compiled out below SPDLOG_ACTIVE_LEVEL
+#define OVMS_LOG_RATE_LIMITED(logger, level, ...)                                            \
+    do {                                                                                     \
+        if (SPDLOG_ACTIVE_LEVEL <= static_cast<int>(level) && (logger)->should_log(level)) { \
+            static ovms::LogRateLimiter rateLimiter(ovms::LOG_RATE_LIMIT_INTERVAL);          \
+            OVMS_LOG_WITH_RATE_LIMITER(rateLimiter, logger, level, __VA_ARGS__);             \
+        }                                                                                    \
+    } while (0)
+
+/**
+ * @brief Configures sinks and levels of all loggers.
+ *
+ * In asynchronous mode messages are passed through bounded queue to background thread
+ * writing them to sinks, so request threads do not wait for console or file output.
+ * When the queue is full, oldest messages are dropped.
+ */
+void configure_logger(const std::string& log_level, const std::string& log_path, bool async = false);
+
+/**
+ * @brief Writes out messages queued by asynchronous loggers and stops the writer thread.
+ *
+ * Loggers are switched to synchronous mode afterwards. Does nothing for synchronous logging.
+ */
+void shutdown_logger();
 
 }  // namespace ovms
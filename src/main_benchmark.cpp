@@ -14,15 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <future>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <random>
 #include <sstream>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include <cxxopts.hpp>
@@ -31,8 +35,13 @@
 #include <sysexits.h>
 
 #include "capi_frontend/capi_utils.hpp"
+#include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "kfs_frontend/kfs_utils.hpp"
 #include "ovms.h"  // NOLINT
 #include "stringutils.hpp"
+#include "tfs_frontend/tfs_utils.hpp"
+#include "threadsafequeue.hpp"
+#include "traffic_capture.hpp"
 
 namespace {
 
@@ -110,7 +119,16 @@ void BenchmarkCLIParser::parse(int argc, char** argv) {
             ("seed",
                 "Random values generator seed.",
                 cxxopts::value<uint64_t>(),
-                "SEED");
+                "SEED")
+            // traffic replay
+            ("replay_path",
+                "Path to traffic log captured by server with traffic_capture_path. When set, requests from the log are sent with captured timing instead of synthetic workload.",
+                cxxopts::value<std::string>(),
+                "REPLAY_PATH")
+            ("replay_speed",
+                "Replay speed multiplier. 2 sends requests twice as fast as captured.",
+                cxxopts::value<double>()->default_value("1"),
+                "REPLAY_SPEED");
 
         result = std::make_unique<cxxopts::ParseResult>(options->parse(argc, argv));
 
@@ -333,6 +351,188 @@ void triggerInferenceInALoopResetRequest(
     averagePureLatency = std::accumulate(latenciesPure.begin(), latenciesPure.end(), 0) / (double(niterPerThread) * 1'000);
 }
 
+bool succeeded(OVMS_Status* status) {
+    if (status == nullptr) {
+        return true;
+    }
+    OVMS_StatusDelete(status);
+    return false;
+}
+
+bool addReplayInput(OVMS_InferenceRequest* request, const std::string& name, OVMS_DataType datatype, const signed_shape_t& shape, const std::string& data) {
+    return datatype != OVMS_DATATYPE_UNDEFINED &&
+           succeeded(OVMS_InferenceRequestAddInput(request, name.c_str(), datatype, shape.data(), shape.size())) &&
+           succeeded(OVMS_InferenceRequestInputSetData(request, name.c_str(), data.data(), data.size(), OVMS_BUFFERTYPE_CPU, 0));
+}
+
+// Only inputs sent as raw bytes can be passed to C API without conversion, other requests are skipped.
+OVMS_InferenceRequest* createReplayRequest(OVMS_Server* server, const ::inference::ModelInferRequest& proto) {
+    if (proto.raw_input_contents_size() != proto.inputs_size()) {
+        return nullptr;
+    }
+    std::optional<int64_t> version = proto.model_version().empty() ? 0 : ovms::stoi64(proto.model_version());
+    OVMS_InferenceRequest* request{nullptr};
+    if (!version.has_value() || !succeeded(OVMS_InferenceRequestNew(&request, server, proto.model_name().c_str(), version.value()))) {
+        return nullptr;
+    }
+    for (int i = 0; i < proto.inputs_size(); ++i) {
+        const auto& input = proto.inputs(i);
+        signed_shape_t shape(input.shape().begin(), input.shape().end());
+        OVMS_DataType datatype = ovms::getPrecisionAsOVMSDataType(ovms::KFSPrecisionToOvmsPrecision(input.datatype()));
+        if (!addReplayInput(request, input.name(), datatype, shape, proto.raw_input_contents(i))) {
+            OVMS_InferenceRequestDelete(request);
+            return nullptr;
+        }
+    }
+    return request;
+}
+
+OVMS_InferenceRequest* createReplayRequest(OVMS_Server* server, const tensorflow::serving::PredictRequest& proto) {
+    OVMS_InferenceRequest* request{nullptr};
+    if (!succeeded(OVMS_InferenceRequestNew(&request, server, proto.model_spec().name().c_str(), proto.model_spec().version().value()))) {
+        return nullptr;
+    }
+    for (const auto& [name, tensor] : proto.inputs()) {
+        signed_shape_t shape;
+        for (const auto& dim : tensor.tensor_shape().dim()) {
+            shape.push_back(dim.size());
+        }
+        OVMS_DataType datatype = ovms::getPrecisionAsOVMSDataType(ovms::TFSPrecisionToOvmsPrecision(tensor.dtype()));
+        if (tensor.tensor_content().empty() || !addReplayInput(request, name, datatype, shape, tensor.tensor_content())) {
+            OVMS_InferenceRequestDelete(request);
+            return nullptr;
+        }
+    }
+    return request;
+}
+
+struct ReplayItem {
+    std::chrono::microseconds arrivalOffset;
+    // owns buffers of request inputs
+    std::unique_ptr<google::protobuf::Message> proto;
+    OVMS_InferenceRequest* request{nullptr};
+};
+
+template <typename RequestType>
+void prepareReplayItem(OVMS_Server* server, const ovms::TrafficRecord& record, ReplayItem& item) {
+    auto proto = std::make_unique<RequestType>();
+    if (proto->ParseFromString(record.payload)) {
+        item.request = createReplayRequest(server, *proto);
+    }
+    item.proto = std::move(proto);
+}
+
+double percentile(std::vector<uint64_t> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    size_t index = std::min(values.size() - 1, static_cast<size_t>(p * values.size()));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index] / 1'000.0;
+}
+
+int replayTraffic(OVMS_Server* server, const std::string& replayPath, double speed, size_t threadCount) {
+    std::vector<ovms::TrafficRecord> records;
+    auto status = ovms::TrafficLogReader::readAll(replayPath, records);
+    if (!status.ok()) {
+        std::cerr << "Could not read traffic log: " << replayPath << "; " << status.string() << std::endl;
+        return EX_DATAERR;
+    }
+    std::vector<ReplayItem> items;
+    size_t skipped = 0;
+    for (const auto& record : records) {
+        ReplayItem item;
+        item.arrivalOffset = std::chrono::microseconds(static_cast<uint64_t>(record.arrivalOffsetUs / speed));
+        if (record.api == ovms::TrafficApi::KFS) {
+            prepareReplayItem<::inference::ModelInferRequest>(server, record, item);
+        } else {
+            prepareReplayItem<tensorflow::serving::PredictRequest>(server, record, item);
+        }
+        if (item.request == nullptr) {
+            ++skipped;
+            continue;
+        }
+        items.emplace_back(std::move(item));
+    }
+    records.clear();
+    std::cout << "Requests to replay: " << items.size() << "; skipped unsupported: " << skipped << std::endl;
+    if (items.empty()) {
+        return EX_DATAERR;
+    }
+    // records are written in capture order which may differ slightly from arrival order
+    std::stable_sort(items.begin(), items.end(), [](const auto& a, const auto& b) { return a.arrivalOffset < b.arrivalOffset; });
+    const auto firstOffset = items.front().arrivalOffset;
+
+    ovms::ThreadSafeQueue<size_t> queue;
+    std::atomic<bool> dispatchFinished{false};
+    std::atomic<size_t> failed{0};
+    std::vector<uint64_t> latenciesUs(items.size(), 0);
+    std::vector<uint64_t> delaysUs(items.size(), 0);
+    // not vector<bool> since workers write it concurrently
+    std::vector<uint8_t> completed(items.size(), 0);
+    auto replayStart = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> workerThreads;
+    for (size_t i = 0; i < threadCount; ++i) {
+        workerThreads.emplace_back([&]() {
+            while (true) {
+                bool finished = dispatchFinished.load();
+                auto index = queue.tryPull(1'000);
+                if (!index.has_value()) {
+                    if (finished) {
+                        break;
+                    }
+                    continue;
+                }
+                auto& item = items[index.value()];
+                auto inferenceStart = std::chrono::high_resolution_clock::now();
+                OVMS_InferenceResponse* response{nullptr};
+                if (succeeded(OVMS_Inference(server, item.request, &response))) {
+                    OVMS_InferenceResponseDelete(response);
+                } else {
+                    ++failed;
+                }
+                auto inferenceEnd = std::chrono::high_resolution_clock::now();
+                auto scheduled = replayStart + (item.arrivalOffset - firstOffset);
+                delaysUs[index.value()] = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::microseconds>(inferenceStart - scheduled).count());
+                latenciesUs[index.value()] = std::chrono::duration_cast<std::chrono::microseconds>(inferenceEnd - inferenceStart).count();
+                completed[index.value()] = 1;
+            }
+        });
+    }
+    std::cout << "Benchmark starting replay with speed: " << speed << std::endl;
+    for (size_t i = 0; i < items.size() && !shutdown_request; ++i) {
+        std::this_thread::sleep_until(replayStart + (items[i].arrivalOffset - firstOffset));
+        queue.push(i);
+    }
+    dispatchFinished = true;
+    std::for_each(workerThreads.begin(), workerThreads.end(), [](auto& t) { t.join(); });
+    auto replayEnd = std::chrono::high_resolution_clock::now();
+    auto wholeTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(replayEnd - replayStart).count();
+
+    std::vector<uint64_t> completedLatencies;
+    std::vector<uint64_t> completedDelays;
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (completed[i]) {
+            completedLatencies.push_back(latenciesUs[i]);
+            completedDelays.push_back(delaysUs[i]);
+        }
+        OVMS_InferenceRequestDelete(items[i].request);
+    }
+    const size_t count = completedLatencies.size();
+    std::cout << "Replayed requests: " << count << "; failed: " << failed << std::endl;
+    if (count == 0) {
+        return EX_OK;
+    }
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Captured duration: " << (items.back().arrivalOffset - firstOffset).count() / 1'000.0 << "ms; replay duration: " << wholeTimeUs / 1'000.0 << "ms" << std::endl;
+    std::cout << "FPS: " << double(count) / wholeTimeUs * 1'000'000 << std::endl;
+    std::cout << "Average latency pure C-API inference:" << std::accumulate(completedLatencies.begin(), completedLatencies.end(), uint64_t(0)) / (double(count) * 1'000) << "ms" << std::endl;
+    std::cout << "Latency p50: " << percentile(completedLatencies, 0.5) << "ms; p90: " << percentile(completedLatencies, 0.9) << "ms; p99: " << percentile(completedLatencies, 0.99) << "ms" << std::endl;
+    // requests start later than captured when all workers are busy
+    std::cout << "Average delay behind captured timing:" << std::accumulate(completedDelays.begin(), completedDelays.end(), uint64_t(0)) / (double(count) * 1'000) << "ms; p99: " << percentile(completedDelays, 0.99) << "ms" << std::endl;
+    return EX_OK;
+}
+
 }  // namespace
 
 enum Mode {
@@ -391,6 +591,11 @@ int main(int argc, char** argv) {
         return 1;
     }
     std::cout << "Mode requested: " <<  modeParam << std::endl;
+    double replaySpeed = cliparser.result->operator[]("replay_speed").as<double>();
+    if (replaySpeed <= 0) {
+        std::cerr << "Replay speed has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
 
     OVMS_Status* res = OVMS_ServerStartFromConfigurationFile(srv, serverSettings, modelsSettings);
 
@@ -409,6 +614,15 @@ int main(int argc, char** argv) {
 
     std::cout << "Server ready for inference" << std::endl;
 
+    if (cliparser.result->count("replay_path")) {
+        size_t replayThreads = cliparser.result->operator[]("nireq").as<uint32_t>() * cliparser.result->operator[]("threads_per_ireq").as<uint32_t>();
+        int exitCode = replayTraffic(srv, cliparser.result->operator[]("replay_path").as<std::string>(), replaySpeed, std::max<size_t>(1, replayThreads));
+        OVMS_ServerDelete(srv);
+        OVMS_ModelsSettingsDelete(modelsSettings);
+        OVMS_ServerSettingsDelete(serverSettings);
+        return exitCode;
+    }
+
     ///////////////////////
     // model parameters
     ///////////////////////
@@ -72,7 +72,7 @@ public:
     }
 
     absl::Status Process(CalculatorContext* cc) final {
-        LOG(INFO) << "PyTensorOvTensorConverterCalculator [Node: " << cc->NodeName() << "] Process start";
+        VLOG(1) << "PyTensorOvTensorConverterCalculator [Node: " << cc->NodeName() << "] Process start";
         py::gil_scoped_acquire acquire;
         try {
             PythonBackend pythonBackend;
@@ -157,7 +157,7 @@ public:
             return absl::Status(absl::StatusCode::kUnknown, "Unexpected error occurred");
         }
 
-        LOG(INFO) << "PyTensorOvTensorConverterCalculator [Node: " << cc->NodeName() << "] Process end";
+        VLOG(1) << "PyTensorOvTensorConverterCalculator [Node: " << cc->NodeName() << "] Process end";
         return absl::OkStatus();
     }
 };
@@ -186,18 +186,18 @@ public:
     }
 
     absl::Status Process(CalculatorContext* cc) final {
-        LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process start";
+        VLOG(1) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process start";
         py::gil_scoped_acquire acquire;
         try {
             if (generatorInitialized()) {
                 if (receivedNewData(cc)) {
-                    LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Node is already processing data. Create new stream for another request.";
+                    VLOG(1) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Node is already processing data. Create new stream for another request.";
                     return absl::Status(absl::StatusCode::kResourceExhausted, "Node is already processing data. Create new stream for another request.");
                 }
                 if (!generatorFinished()) {
                     generate(cc, outputTimestamp);
                 } else {
-                    LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] finished generating. Reseting the generator.";
+                    VLOG(1) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] finished generating. Reseting the generator.";
                     resetGenerator();
                 }
             } else {
@@ -231,7 +231,7 @@ public:
             LOG(INFO) << "Unexpected error occurred during node " << cc->NodeName() << " execution";
             return absl::Status(absl::StatusCode::kUnknown, "Unexpected error occurred");
         }
-        LOG(INFO) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process end";
+        VLOG(1) << "PythonExecutorCalculator [Node: " << cc->NodeName() << "] Process end";
         return absl::OkStatus();
     }
 };
@@ -69,21 +69,26 @@ Status MediapipeFactory::createDefinition(const std::string& pipelineName,
     }
     std::unique_lock lock(definitionsMtx);
     definitions.insert({pipelineName, std::move(graphDefinition)});
+    auto snapshot = std::make_unique<std::map<std::string, MediapipeGraphDefinition*>>();
+    for (const auto& [name, definition] : definitions) {
+        snapshot->emplace(name, definition.get());
+    }
+    definitionsSnapshot.publish(std::move(snapshot));
     return stat;
 }
 
 bool MediapipeFactory::definitionExists(const std::string& name) const {
-    std::shared_lock lock(definitionsMtx);
-    return this->definitions.find(name) != this->definitions.end();
+    return findDefinitionByName(name) != nullptr;
 }
 
 MediapipeGraphDefinition* MediapipeFactory::findDefinitionByName(const std::string& name) const {
-    std::shared_lock lock(definitionsMtx);
-    auto it = definitions.find(name);
-    if (it == std::end(definitions)) {
+    RcuReadGuard guard;
+    const auto& snapshot = definitionsSnapshot.read();
+    auto it = snapshot.find(name);
+    if (it == std::end(snapshot)) {
         return nullptr;
     } else {
-        return it->second.get();
+        return it->second;
     }
 }
 
@@ -104,13 +109,12 @@ Status MediapipeFactory::create(std::shared_ptr<MediapipeGraphExecutor>& pipelin
     const KFSRequest* request,
     KFSResponse* response,
     ModelManager& manager) const {
-    std::shared_lock lock(definitionsMtx);
-    if (!definitionExists(name)) {
+    auto definition = findDefinitionByName(name);
+    if (definition == nullptr) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Mediapipe with requested name: {} does not exist", name);
         return StatusCode::MEDIAPIPE_DEFINITION_NAME_MISSING;
     }
-    auto& definition = *definitions.at(name);
-    auto status = definition.create(pipeline, request, response);
+    auto status = definition->create(pipeline, request, response);
     return status;
 }
 
@@ -30,6 +30,7 @@
 #include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
 #pragma GCC diagnostic pop
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../rcu_snapshot.hpp"
 
 namespace ovms {
 
@@ -43,6 +44,8 @@ class PythonBackend;
 class MediapipeFactory {
     std::map<std::string, std::shared_ptr<MediapipeGraphDefinition>> definitions;
     mutable std::shared_mutex definitionsMtx;
+    // definitions are never removed, request path lookups read published copy of name to definition mapping
+    RcuSnapshot<std::map<std::string, MediapipeGraphDefinition*>> definitionsSnapshot;
     PythonBackend* pythonBackend{nullptr};
 
 public:
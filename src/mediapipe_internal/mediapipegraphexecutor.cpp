@@ -542,6 +542,16 @@ enum : unsigned int {
 
 constexpr size_t STARTING_TIMESTAMP = 0;
 const std::string MediapipeGraphExecutor::TIMESTAMP_PARAMETER_NAME = "OVMS_MP_TIMESTAMP";
+const std::string MediapipeGraphExecutor::STREAM_ID_PARAMETER_NAME = "OVMS_MP_STREAM_ID";
+
+std::string MediapipeGraphExecutor::getStreamId(const KFSRequest& request) {
+    auto it = request.parameters().find(STREAM_ID_PARAMETER_NAME);
+    if (it == request.parameters().end() ||
+        it->second.parameter_choice_case() != inference::InferParameter::ParameterChoiceCase::kStringParam) {
+        return "";
+    }
+    return it->second.string_param();
+}
 
 const std::string PYTHON_SESSION_SIDE_PACKET_TAG = "py";
 
@@ -553,6 +563,10 @@ static std::map<std::string, mediapipe::Packet> createInputSidePackets(const KFS
             SPDLOG_DEBUG("Ignored: {}; parameter in request for: {}; Paremeter is reserved for MediaPipe input packet timestamps", name, request->model_name());
             continue;
         }
+        if (name == MediapipeGraphExecutor::STREAM_ID_PARAMETER_NAME) {
+            SPDLOG_DEBUG("Ignored: {}; parameter in request for: {}; Paremeter is reserved for resumable streams", name, request->model_name());
+            continue;
+        }
         if (valueChoice.parameter_choice_case() == inference::InferParameter::ParameterChoiceCase::kStringParam) {
             inputSidePackets[name] = mediapipe::MakePacket<std::string>(valueChoice.string_param());
         } else if (valueChoice.parameter_choice_case() == inference::InferParameter::ParameterChoiceCase::kInt64Param) {
@@ -989,22 +1003,56 @@ static bool streamSynchronizedWrite(::grpc::ServerReaderWriterInterface<::infere
 
 Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>& stream) {
     SPDLOG_DEBUG("Start streaming KServe request mediapipe graph: {} execution", this->name);
-    std::mutex streamWriterMutex;
+    try {
+        MediapipeStreamSession session(*this, false);
+        OVMS_RETURN_ON_FAIL(session.open(firstRequest));
+        OVMS_RETURN_ON_FAIL(session.serve(firstRequest, stream));
+        return session.finish();
+    } catch (...) {
+        return Status(StatusCode::UNKNOWN_ERROR, "Exception while processing MediaPipe graph");  // To be displayed in method level above
+    }
+}
+
+MediapipeStreamSession::MediapipeStreamSession(MediapipeGraphExecutor& executor, bool resumable) :
+    executor(executor),
+    resumable(resumable) {}
+
+MediapipeStreamSession::MediapipeStreamSession(std::shared_ptr<MediapipeGraphExecutor> executor, bool resumable) :
+    executorOwner(std::move(executor)),
+    executor(*executorOwner),
+    resumable(resumable) {}
+
+MediapipeStreamSession::~MediapipeStreamSession() = default;
+
+void MediapipeStreamSession::setStream(KFSStream* stream) {
+    const std::lock_guard<std::mutex> lock(this->streamWriterMutex);
+    this->currentStream = stream;
+}
+
+Status MediapipeStreamSession::open(const KFSRequest& firstRequest) {
     try {
         // Init
-        ::mediapipe::CalculatorGraph graph;
-        MP_RETURN_ON_FAIL(graph.Initialize(this->config), "graph initialization", StatusCode::MEDIAPIPE_GRAPH_INITIALIZATION_ERROR);
+        MP_RETURN_ON_FAIL(graph.Initialize(this->executor.config), "graph initialization", StatusCode::MEDIAPIPE_GRAPH_INITIALIZATION_ERROR);
 
         // Installing observers
-        for (const auto& outputName : this->outputNames) {
-            MP_RETURN_ON_FAIL(graph.ObserveOutputStream(outputName, [&stream, &streamWriterMutex, &outputName, this](const ::mediapipe::Packet& packet) -> absl::Status {
+        for (const auto& outputName : this->executor.outputNames) {
+            MP_RETURN_ON_FAIL(graph.ObserveOutputStream(outputName, [&outputName, this](const ::mediapipe::Packet& packet) -> absl::Status {
                 try {
                     ::inference::ModelStreamInferResponse resp;
-                    OVMS_RETURN_MP_ERROR_ON_FAIL(serializePacket(outputName, *resp.mutable_infer_response(), packet), "error in serialization");
-                    *resp.mutable_infer_response()->mutable_model_name() = this->name;
-                    *resp.mutable_infer_response()->mutable_model_version() = this->version;
+                    OVMS_RETURN_MP_ERROR_ON_FAIL(this->executor.serializePacket(outputName, *resp.mutable_infer_response(), packet), "error in serialization");
+                    *resp.mutable_infer_response()->mutable_model_name() = this->executor.name;
+                    *resp.mutable_infer_response()->mutable_model_version() = this->executor.version;
                     resp.mutable_infer_response()->mutable_parameters()->operator[](MediapipeGraphExecutor::TIMESTAMP_PARAMETER_NAME).set_int64_param(packet.Timestamp().Value());
-                    if (!streamSynchronizedWrite(stream, streamWriterMutex, resp)) {
+                    const std::lock_guard<std::mutex> lock(this->streamWriterMutex);
+                    if (this->currentStream == nullptr) {
+                        SPDLOG_DEBUG("Graph {}: no stream attached, dropping packet from output stream: {}", this->executor.name, outputName);
+                        return absl::OkStatus();
+                    }
+                    if (!this->currentStream->Write(resp)) {
+                        if (this->resumable) {
+                            SPDLOG_DEBUG("Graph {}: client disconnected, dropping packet from output stream: {}", this->executor.name, outputName);
+                            return absl::OkStatus();
+                        }
                         return absl::Status(absl::StatusCode::kCancelled, "client disconnected");
                     }
                     return absl::OkStatus();
@@ -1023,12 +1071,25 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
             SPDLOG_DEBUG("Failed to insert predefined input side packet: {} with error: {}", PYTHON_SESSION_SIDE_PACKET_TAG, absMessage);
             return Status(StatusCode::MEDIAPIPE_GRAPH_INITIALIZATION_ERROR, std::move(absMessage));
         }
-        inputSidePackets[PYTHON_SESSION_SIDE_PACKET_TAG] = mediapipe::MakePacket<PythonNodeResourcesMap>(this->pythonNodeResourcesMap).At(mediapipe::Timestamp(STARTING_TIMESTAMP));
+        inputSidePackets[PYTHON_SESSION_SIDE_PACKET_TAG] = mediapipe::MakePacket<PythonNodeResourcesMap>(this->executor.pythonNodeResourcesMap).At(mediapipe::Timestamp(STARTING_TIMESTAMP));
 #endif
         MP_RETURN_ON_FAIL(graph.StartRun(inputSidePackets), "graph start", StatusCode::MEDIAPIPE_GRAPH_START_ERROR);
+        this->started = true;
+        return StatusCode::OK;
+    } catch (...) {
+        return Status(StatusCode::UNKNOWN_ERROR, "Exception while processing MediaPipe graph");
+    }
+}
 
+Status MediapipeStreamSession::validate(const KFSRequest& firstRequest) const {
+    return this->executor.validateSubsequentRequest(firstRequest);
+}
+
+Status MediapipeStreamSession::serve(const KFSRequest& firstRequest, KFSStream& stream) {
+    this->setStream(&stream);
+    try {
         // Deserialize first request
-        OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->partialDeserialize(
+        OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->executor.partialDeserialize(
                                                   std::shared_ptr<const KFSRequest>(&firstRequest,
                                                       // Custom deleter to avoid deallocation by custom holder
                                                       // Conversion to shared_ptr is required for unified deserialization method
@@ -1043,29 +1104,57 @@ Status MediapipeGraphExecutor::inferStream(const KFSRequest& firstRequest, ::grp
         // lifetime is extended to lifetime of deserialized Packets.
         auto req = std::make_shared<::inference::ModelInferRequest>();
         while (stream.Read(req.get())) {
-            auto pstatus = this->validateSubsequentRequest(*req);
+            auto pstatus = this->executor.validateSubsequentRequest(*req);
             if (pstatus.ok()) {
-                OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->partialDeserialize(req, graph), "partial deserialization of subsequent requests");
+                OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(this->executor.partialDeserialize(req, graph), "partial deserialization of subsequent requests");
             } else {
                 OVMS_WRITE_ERROR_ON_FAIL_AND_CONTINUE(pstatus, "validate subsequent requests");
             }
             if (graph.HasError()) {
-                SPDLOG_DEBUG("Graph {}: encountered an error, stopping the execution", this->name);
+                SPDLOG_DEBUG("Graph {}: encountered an error, stopping the execution", this->executor.name);
                 break;
             }
             req = std::make_shared<::inference::ModelInferRequest>();
         }
+        if (this->resumable && !graph.HasError()) {
+            // graph keeps running after stream ends, deliver outputs of already received requests first
+            SPDLOG_DEBUG("Graph {}: Waiting until idle before detaching stream...", this->executor.name);
+            auto absStatus = graph.WaitUntilIdle();
+            if (!absStatus.ok()) {
+                SPDLOG_DEBUG("Graph {}: waiting until idle failed: {}", this->executor.name, absStatus.ToString());
+            }
+        }
+    } catch (...) {
+        this->setStream(nullptr);
+        return Status(StatusCode::UNKNOWN_ERROR, "Exception while processing MediaPipe graph");
+    }
+    this->setStream(nullptr);
+    return StatusCode::OK;
+}
 
-        SPDLOG_DEBUG("Graph {}: Closing packet sources...", this->name);
-        // Close input streams
-        MP_RETURN_ON_FAIL(graph.CloseAllPacketSources(), "closing all packet sources", StatusCode::MEDIAPIPE_GRAPH_CLOSE_INPUT_STREAM_ERROR);
+bool MediapipeStreamSession::hasError() const {
+    return graph.HasError();
+}
 
-        SPDLOG_DEBUG("Graph {}: Closed all packet sources. Waiting untill done...", this->name);
-        MP_RETURN_ON_FAIL(graph.WaitUntilDone(), "waiting until done", StatusCode::MEDIAPIPE_EXECUTION_ERROR);
-        SPDLOG_DEBUG("Graph {}: Done execution", this->name);
+Status MediapipeStreamSession::finish() {
+    if (!this->started || this->finished) {
         return StatusCode::OK;
-    } catch (...) {
-        return Status(StatusCode::UNKNOWN_ERROR, "Exception while processing MediaPipe graph");  // To be displayed in method level above
+    }
+    this->finished = true;
+    SPDLOG_DEBUG("Graph {}: Closing packet sources...", this->executor.name);
+    // Close input streams
+    MP_RETURN_ON_FAIL(graph.CloseAllPacketSources(), "closing all packet sources", StatusCode::MEDIAPIPE_GRAPH_CLOSE_INPUT_STREAM_ERROR);
+
+    SPDLOG_DEBUG("Graph {}: Closed all packet sources. Waiting untill done...", this->executor.name);
+    MP_RETURN_ON_FAIL(graph.WaitUntilDone(), "waiting until done", StatusCode::MEDIAPIPE_EXECUTION_ERROR);
+    SPDLOG_DEBUG("Graph {}: Done execution", this->executor.name);
+    return StatusCode::OK;
+}
+
+void MediapipeStreamSession::close() {
+    auto status = this->finish();
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Graph {}: closing stream session failed: {}", this->executor.name, status.string());
     }
 }
 
@@ -17,6 +17,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -24,6 +25,7 @@
 
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
 #include "../metric.hpp"
+#include "../stream_session_registry.hpp"
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 #include "mediapipe/framework/calculator_graph.h"
@@ -37,7 +39,11 @@ class Status;
 class PythonNodeResources;
 class PythonBackend;
 
+using KFSStream = ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>;
+
 class MediapipeGraphExecutor {
+    friend class MediapipeStreamSession;
+
     const std::string name;
     const std::string version;
     const ::mediapipe::CalculatorGraphConfig config;
@@ -60,6 +66,8 @@ protected:
 
 public:
     static const std::string TIMESTAMP_PARAMETER_NAME;
+    static const std::string STREAM_ID_PARAMETER_NAME;
+    static std::string getStreamId(const KFSRequest& request);
     MediapipeGraphExecutor(const std::string& name, const std::string& version, const ::mediapipe::CalculatorGraphConfig& config,
         stream_types_mapping_t inputTypes,
         stream_types_mapping_t outputTypes,
@@ -70,4 +78,49 @@ public:
 
     Status inferStream(const ::inference::ModelInferRequest& firstRequest, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>& stream);
 };
+
+/**
+ * @brief Running graph of streaming request. It may serve several consecutive client streams.
+ *
+ * Outputs produced while no stream is attached are dropped. In resumable session failed write
+ * to disconnected client does not stop the graph.
+ */
+class MediapipeStreamSession : public StreamSession {
+    std::shared_ptr<MediapipeGraphExecutor> executorOwner;
+    MediapipeGraphExecutor& executor;
+    const bool resumable;
+
+    std::mutex streamWriterMutex;
+    KFSStream* currentStream = nullptr;
+    bool started = false;
+    bool finished = false;
+
+    ::mediapipe::CalculatorGraph graph;
+
+    void setStream(KFSStream* stream);
+
+public:
+    MediapipeStreamSession(MediapipeGraphExecutor& executor, bool resumable);
+    MediapipeStreamSession(std::shared_ptr<MediapipeGraphExecutor> executor, bool resumable);
+    ~MediapipeStreamSession() override;
+
+    /**
+     * @brief Initializes and starts the graph, first request provides input side packets.
+     */
+    Status open(const KFSRequest& firstRequest);
+    /**
+     * @brief Checks whether first request of resumed stream targets the same servable.
+     */
+    Status validate(const KFSRequest& firstRequest) const;
+    /**
+     * @brief Pushes requests of the stream into the graph until client stops sending.
+     */
+    Status serve(const KFSRequest& firstRequest, KFSStream& stream);
+    bool hasError() const;
+    /**
+     * @brief Closes input streams and waits for the graph to finish.
+     */
+    Status finish();
+    void close() override;
+};
 }  // namespace ovms
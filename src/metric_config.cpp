@@ -44,6 +44,17 @@ const std::string METRIC_NAME_CURRENT_REQUESTS = "ovms_current_requests";
 const std::string METRIC_NAME_REQUEST_TIME = "ovms_request_time_us";
 const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME = "ovms_wait_for_infer_req_time_us";
 
+const std::string METRIC_NAME_RESPONSE_CACHE_HITS = "ovms_response_cache_hits";
+const std::string METRIC_NAME_RESPONSE_CACHE_MISSES = "ovms_response_cache_misses";
+const std::string METRIC_NAME_RESPONSE_CACHE_EVICTIONS = "ovms_response_cache_evictions";
+
+const std::string METRIC_NAME_WARMUP_TIME = "ovms_warmup_time_us";
+
+const std::string METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES = "ovms_allocator_allocated_bytes";
+const std::string METRIC_NAME_ALLOCATOR_ACTIVE_BYTES = "ovms_allocator_active_bytes";
+const std::string METRIC_NAME_ALLOCATOR_RESIDENT_BYTES = "ovms_allocator_resident_bytes";
+const std::string METRIC_NAME_ALLOCATOR_FRAGMENTATION = "ovms_allocator_fragmentation_ratio";
+
 bool MetricConfig::validateEndpointPath(const std::string& endpoint) {
     std::regex valid_endpoint_regex("^/[a-zA-Z0-9]*$");
     return std::regex_match(endpoint, valid_endpoint_regex);
@@ -36,6 +36,17 @@ extern const std::string METRIC_NAME_CURRENT_REQUESTS;
 extern const std::string METRIC_NAME_REQUEST_TIME;
 extern const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME;
 
+extern const std::string METRIC_NAME_RESPONSE_CACHE_HITS;
+extern const std::string METRIC_NAME_RESPONSE_CACHE_MISSES;
+extern const std::string METRIC_NAME_RESPONSE_CACHE_EVICTIONS;
+
+extern const std::string METRIC_NAME_WARMUP_TIME;
+
+extern const std::string METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES;
+extern const std::string METRIC_NAME_ALLOCATOR_ACTIVE_BYTES;
+extern const std::string METRIC_NAME_ALLOCATOR_RESIDENT_BYTES;
+extern const std::string METRIC_NAME_ALLOCATOR_FRAGMENTATION;
+
 class Status;
 /**
      * @brief This class represents metrics configuration
@@ -74,7 +85,15 @@ private:
 
     std::unordered_set<std::string> additionalMetricFamilies = {
         {METRIC_NAME_INFER_REQ_QUEUE_SIZE},
-        {METRIC_NAME_INFER_REQ_ACTIVE}};
+        {METRIC_NAME_INFER_REQ_ACTIVE},
+        {METRIC_NAME_RESPONSE_CACHE_HITS},
+        {METRIC_NAME_RESPONSE_CACHE_MISSES},
+        {METRIC_NAME_RESPONSE_CACHE_EVICTIONS},
+        {METRIC_NAME_WARMUP_TIME},
+        {METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES},
+        {METRIC_NAME_ALLOCATOR_ACTIVE_BYTES},
+        {METRIC_NAME_ALLOCATOR_RESIDENT_BYTES},
+        {METRIC_NAME_ALLOCATOR_FRAGMENTATION}};
 
     std::unordered_set<std::string> defaultMetricFamilies = {
         {METRIC_NAME_CURRENT_REQUESTS},
@@ -99,18 +99,29 @@ void Model::updateDefaultVersion(int ignoredVersion) {
     } else {
         SPDLOG_INFO("Model: {} will not have default version since no version is available.", getName());
     }
+    updateVersionsSnapshot();
 }
 
-const std::shared_ptr<ModelInstance> Model::getDefaultModelInstance() const {
+void Model::updateVersionsSnapshot() {
+    auto snapshot = std::make_unique<VersionsSnapshot>();
     std::shared_lock lock(modelVersionsMtx);
-    auto defaultVersion = getDefaultVersion();
-    const auto modelInstanceIt = modelVersions.find(defaultVersion);
+    snapshot->versions = modelVersions;
+    snapshot->defaultVersion = defaultVersion;
+    auto defaultIt = modelVersions.find(defaultVersion);
+    if (defaultIt != modelVersions.end()) {
+        snapshot->defaultInstance = defaultIt->second;
+    }
+    versionsSnapshot.publish(std::move(snapshot));
+}
 
-    if (modelVersions.end() == modelInstanceIt) {
-        SPDLOG_WARN("Default version: {} for model: {} not found", defaultVersion, getName());
+const std::shared_ptr<ModelInstance> Model::getDefaultModelInstance() const {
+    RcuReadGuard guard;
+    const auto& snapshot = versionsSnapshot.read();
+    if (!snapshot.defaultInstance) {
+        SPDLOG_WARN("Default version: {} for model: {} not found", snapshot.defaultVersion, getName());
         return nullptr;
     }
-    return modelInstanceIt->second;
+    return snapshot.defaultInstance;
 }
 
 std::shared_ptr<ovms::ModelInstance> Model::modelInstanceFactory(const std::string& modelName, const model_version_t modelVersion, ov::Core& ieCore, MetricRegistry* registry, const MetricConfig* metricConfig) {
@@ -131,6 +142,7 @@ Status Model::addVersion(const ModelConfig& config, ov::Core& ieCore, MetricRegi
     std::unique_lock lock(modelVersionsMtx);
     modelVersions.emplace(version, modelInstance);
     lock.unlock();
+    updateVersionsSnapshot();
     auto status = modelInstance->loadModel(config);
     if (!status.ok()) {
         return status;
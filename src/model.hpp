@@ -27,6 +27,7 @@
 #include "modelchangesubscription.hpp"
 #include "modelconfig.hpp"
 #include "modelversion.hpp"
+#include "rcu_snapshot.hpp"
 
 namespace ov {
 class Core;
@@ -63,6 +64,17 @@ private:
       */
     void updateDefaultVersion(int ignoredVersion = 0);
 
+    struct VersionsSnapshot {
+        std::map<model_version_t, std::shared_ptr<ModelInstance>> versions;
+        model_version_t defaultVersion = 0;
+        std::shared_ptr<ModelInstance> defaultInstance;
+    };
+
+    /**
+     * @brief Copy of modelVersions and default version read by request path lookups without locking
+     */
+    RcuSnapshot<VersionsSnapshot> versionsSnapshot;
+
 protected:
     /**
          * @brief Model name
@@ -80,6 +92,11 @@ protected:
          */
     model_version_t defaultVersion = 0;
 
+    /**
+         * @brief Publishes modelVersions and default version to request path lookups, has to be called after each change
+         */
+    void updateVersionsSnapshot();
+
     /**
          * @brief Get default version
          *
@@ -173,9 +190,10 @@ public:
          * @return specific model version
          */
     const std::shared_ptr<ModelInstance> getModelInstanceByVersion(const model_version_t& version) const {
-        std::shared_lock lock(modelVersionsMtx);
-        auto it = modelVersions.find(version);
-        return it != modelVersions.end() ? it->second : nullptr;
+        RcuReadGuard guard;
+        const auto& versions = versionsSnapshot.read().versions;
+        auto it = versions.find(version);
+        return it != versions.end() ? it->second : nullptr;
     }
 
     /**
@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_auto_tuner.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+std::string AutoTuneSettings::toString() const {
+    return "nireq: " + std::to_string(nireq) + "; streams: " + std::to_string(streams);
+}
+
+ModelAutoTuner::ModelAutoTuner(const AutoTuneConfig& config, const AutoTuneSettings& initialSettings, clock::time_point now) :
+    config(config),
+    settings(initialSettings),
+    windowStart(now),
+    baselineSettings(initialSettings) {}
+
+void ModelAutoTuner::recordWaitTime(double microseconds) {
+    waitTimeUs.fetch_add(static_cast<uint64_t>(microseconds), std::memory_order_relaxed);
+}
+
+void ModelAutoTuner::recordInferenceTime(double microseconds) {
+    requests.fetch_add(1, std::memory_order_relaxed);
+    inferenceTimeUs.fetch_add(static_cast<uint64_t>(microseconds), std::memory_order_relaxed);
+}
+
+std::optional<AutoTuneSettings> ModelAutoTuner::evaluate(clock::time_point now) {
+    const auto elapsed = std::chrono::duration<double>(now - windowStart).count();
+    if (elapsed < config.intervalSeconds) {
+        return std::nullopt;
+    }
+    windowStart = now;
+    const uint64_t windowRequests = requests.exchange(0);
+    const double windowWaitTimeUs = waitTimeUs.exchange(0);
+    const double windowInferenceTimeUs = inferenceTimeUs.exchange(0);
+    if (windowRequests < MIN_WINDOW_REQUESTS) {
+        // not enough traffic to judge settings, trial continues in next window
+        return std::nullopt;
+    }
+    const double throughput = windowRequests / elapsed;
+    const double averageWaitTimeUs = windowWaitTimeUs / windowRequests;
+    const double averageInferenceTimeUs = windowInferenceTimeUs / windowRequests;
+    const double latency = averageWaitTimeUs + averageInferenceTimeUs;
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Auto-tuner window: {}; throughput: {:.1f} rps; wait: {:.0f} us; inference: {:.0f} us",
+        settings.toString(), throughput, averageWaitTimeUs, averageInferenceTimeUs);
+
+    if (trialInProgress) {
+        return evaluateTrial(throughput, latency);
+    }
+    if (cooldownWindows > 0) {
+        --cooldownWindows;
+        return std::nullopt;
+    }
+    if (averageWaitTimeUs > SATURATION_WAIT_RATIO * averageInferenceTimeUs) {
+        return proposeScaleUp(throughput, latency);
+    }
+    // average number of infer requests busy with inference
+    const double busyInferRequests = windowInferenceTimeUs / (elapsed * 1000000);
+    const uint32_t neededNireq = std::max(config.minNireq, static_cast<uint32_t>(std::ceil(busyInferRequests * 2)));
+    if (busyInferRequests * 4 < settings.nireq && neededNireq < settings.nireq) {
+        AutoTuneSettings next = settings;
+        next.nireq = std::max(neededNireq, settings.nireq / 2);
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Auto-tuner releases idle infer requests: {} -> {}", settings.nireq, next.nireq);
+        settings = next;
+        // traffic changed, previously failed trials may succeed now
+        nireqExhausted = false;
+        streamsExhausted = false;
+        return next;
+    }
+    return std::nullopt;
+}
+
+std::optional<AutoTuneSettings> ModelAutoTuner::proposeScaleUp(double throughput, double latency) {
+    AutoTuneSettings next = settings;
+    if (!nireqExhausted && settings.nireq < config.maxNireq) {
+        next.nireq = std::min(config.maxNireq, settings.nireq + std::max(1u, settings.nireq / 2));
+    } else if (!streamsExhausted && settings.streams < config.maxStreams) {
+        next.streams = settings.streams + 1;
+        next.nireq = std::max(settings.nireq, next.streams);
+    } else {
+        return std::nullopt;
+    }
+    baselineSettings = settings;
+    baselineThroughput = throughput;
+    baselineLatency = latency;
+    trialInProgress = true;
+    settings = next;
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Auto-tuner trial: {} -> {}", baselineSettings.toString(), next.toString());
+    return next;
+}
+
+std::optional<AutoTuneSettings> ModelAutoTuner::evaluateTrial(double throughput, double latency) {
+    trialInProgress = false;
+    const bool throughputImproved = throughput >= baselineThroughput * (1 + MIN_IMPROVEMENT);
+    const bool latencyImproved = latency <= baselineLatency * (1 - MIN_IMPROVEMENT) &&
+                                 throughput >= baselineThroughput * (1 - MIN_IMPROVEMENT);
+    if (throughputImproved || latencyImproved) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Auto-tuner keeps: {}; throughput: {:.1f} -> {:.1f} rps; latency: {:.0f} -> {:.0f} us",
+            settings.toString(), baselineThroughput, throughput, baselineLatency, latency);
+        return std::nullopt;
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Auto-tuner reverts: {} -> {}; throughput: {:.1f} -> {:.1f} rps; latency: {:.0f} -> {:.0f} us",
+        settings.toString(), baselineSettings.toString(), baselineThroughput, throughput, baselineLatency, latency);
+    if (settings.streams != baselineSettings.streams) {
+        streamsExhausted = true;
+    } else {
+        nireqExhausted = true;
+    }
+    cooldownWindows = COOLDOWN_WINDOWS;
+    settings = baselineSettings;
+    return settings;
+}
+
+void ModelAutoTuner::rejectSettings(const AutoTuneSettings& appliedSettings) {
+    if (trialInProgress) {
+        if (settings.streams != baselineSettings.streams) {
+            streamsExhausted = true;
+        } else {
+            nireqExhausted = true;
+        }
+    }
+    trialInProgress = false;
+    cooldownWindows = COOLDOWN_WINDOWS;
+    settings = appliedSettings;
+}
+}  // namespace ovms
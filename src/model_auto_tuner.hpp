@@ -0,0 +1,120 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace ovms {
+
+/**
+ * @brief Bounds of the online tuning of model execution settings.
+ */
+struct AutoTuneConfig {
+    uint32_t minNireq = 1;
+    uint32_t maxNireq = 1;
+    // 0 - number of streams is not tuned
+    uint32_t maxStreams = 0;
+    uint32_t intervalSeconds = 30;
+
+    bool operator==(const AutoTuneConfig& rhs) const {
+        return minNireq == rhs.minNireq &&
+               maxNireq == rhs.maxNireq &&
+               maxStreams == rhs.maxStreams &&
+               intervalSeconds == rhs.intervalSeconds;
+    }
+    bool operator!=(const AutoTuneConfig& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+struct AutoTuneSettings {
+    uint32_t nireq = 1;
+    uint32_t streams = 1;
+
+    bool operator==(const AutoTuneSettings& rhs) const {
+        return nireq == rhs.nireq && streams == rhs.streams;
+    }
+    bool operator!=(const AutoTuneSettings& rhs) const {
+        return !(*this == rhs);
+    }
+    std::string toString() const;
+};
+
+/**
+ * @brief Adjusts nireq and number of streams of a model instance to observed traffic.
+ *
+ * Time requests wait for an infer request and inference time are accumulated over
+ * evaluation windows. When requests wait for infer requests, the model is saturated and
+ * a trial with more infer requests (and then more streams) is proposed. The trial is kept
+ * only if throughput or latency improved in the next window, otherwise previous settings
+ * are restored and no trials are made for a cooldown period. Infer requests which are
+ * mostly idle are released.
+ */
+class ModelAutoTuner {
+public:
+    using clock = std::chrono::steady_clock;
+
+    // requests wait for infer request longer than this part of inference time
+    static constexpr double SATURATION_WAIT_RATIO = 0.1;
+    static constexpr double MIN_IMPROVEMENT = 0.05;
+    static constexpr uint32_t COOLDOWN_WINDOWS = 10;
+    static constexpr uint64_t MIN_WINDOW_REQUESTS = 16;
+
+    ModelAutoTuner(const AutoTuneConfig& config, const AutoTuneSettings& initialSettings, clock::time_point now = clock::now());
+
+    void recordWaitTime(double microseconds);
+    void recordInferenceTime(double microseconds);
+
+    /**
+     * @brief Closes evaluation window if interval passed.
+     *
+     * @return settings to apply, nullopt if current settings should stay
+     */
+    std::optional<AutoTuneSettings> evaluate(clock::time_point now = clock::now());
+
+    /**
+     * @brief Restores settings from before last proposal when they could not be applied.
+     */
+    void rejectSettings(const AutoTuneSettings& appliedSettings);
+
+    const AutoTuneSettings& getSettings() const { return settings; }
+    const AutoTuneConfig& getConfig() const { return config; }
+
+private:
+    std::optional<AutoTuneSettings> evaluateTrial(double throughput, double latency);
+    std::optional<AutoTuneSettings> proposeScaleUp(double throughput, double latency);
+
+    const AutoTuneConfig config;
+    AutoTuneSettings settings;
+
+    std::atomic<uint64_t> requests{0};
+    std::atomic<uint64_t> waitTimeUs{0};
+    std::atomic<uint64_t> inferenceTimeUs{0};
+    clock::time_point windowStart;
+
+    bool trialInProgress = false;
+    AutoTuneSettings baselineSettings;
+    double baselineThroughput = 0;
+    double baselineLatency = 0;
+    uint32_t cooldownWindows = 0;
+    bool nireqExhausted = false;
+    bool streamsExhausted = false;
+};
+}  // namespace ovms
@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_hedging.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ovms {
+
+HedgingPolicy::HedgingPolicy(const HedgingConfig& config) :
+    config(config) {
+    samples.reserve(LATENCY_WINDOW);
+}
+
+std::optional<std::chrono::microseconds> HedgingPolicy::getHedgeDelay() const {
+    const int64_t threshold = thresholdUs.load(std::memory_order_relaxed);
+    if (threshold == 0) {
+        return std::nullopt;
+    }
+    return std::chrono::microseconds(threshold);
+}
+
+void HedgingPolicy::recordInferenceTime(double microseconds) {
+    std::unique_lock<std::mutex> lock(mtx);
+    tokens = std::min(MAX_TOKENS, tokens + config.maxExtraLoad);
+    if (samples.size() < LATENCY_WINDOW) {
+        samples.push_back(microseconds);
+    } else {
+        samples[nextSample] = microseconds;
+    }
+    nextSample = (nextSample + 1) % LATENCY_WINDOW;
+    ++samplesSinceUpdate;
+    if (samples.size() >= MIN_SAMPLES && (samples.size() == MIN_SAMPLES || samplesSinceUpdate >= THRESHOLD_UPDATE_INTERVAL)) {
+        samplesSinceUpdate = 0;
+        updateThreshold();
+    }
+}
+
+void HedgingPolicy::updateThreshold() {
+    std::vector<double> sorted(samples);
+    // nearest-rank percentile, rank is 1-based
+    const size_t rank = static_cast<size_t>(std::ceil(sorted.size() * config.latencyPercentile / 100));
+    const size_t index = std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    thresholdUs.store(std::max<int64_t>(1, static_cast<int64_t>(sorted[index])), std::memory_order_relaxed);
+}
+
+bool HedgingPolicy::tryAcquireHedge() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (tokens < 1) {
+        return false;
+    }
+    tokens -= 1;
+    return true;
+}
+
+void HedgingPolicy::releaseHedge() {
+    std::unique_lock<std::mutex> lock(mtx);
+    tokens = std::min(MAX_TOKENS, tokens + 1);
+}
+}  // namespace ovms
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace ovms {
+
+struct HedgingConfig {
+    // requests running longer than this percentile of recent inference times are hedged
+    double latencyPercentile = 99;
+    // hedged inferences as a share of all inferences
+    double maxExtraLoad = 0.05;
+
+    bool operator==(const HedgingConfig& rhs) const {
+        return latencyPercentile == rhs.latencyPercentile &&
+               maxExtraLoad == rhs.maxExtraLoad;
+    }
+    bool operator!=(const HedgingConfig& rhs) const {
+        return !(*this == rhs);
+    }
+};
+
+/**
+ * @brief Decides when inference is duplicated on another infer request to cut tail latency.
+ *
+ * Inference times of recent requests are kept in a window. Inference which did not complete
+ * within configured percentile of them may be hedged. Number of hedges is limited with token
+ * bucket refilled by each inference with maxExtraLoad tokens.
+ */
+class HedgingPolicy {
+public:
+    static constexpr size_t LATENCY_WINDOW = 1024;
+    static constexpr size_t MIN_SAMPLES = 100;
+    static constexpr size_t THRESHOLD_UPDATE_INTERVAL = 64;
+    static constexpr double MAX_TOKENS = 10;
+
+    HedgingPolicy(const HedgingConfig& config);
+
+    /**
+     * @brief Gets time after which inference should be hedged.
+     *
+     * @return nullopt until enough inference times are recorded
+     */
+    std::optional<std::chrono::microseconds> getHedgeDelay() const;
+    /**
+     * @brief Records inference time and refills hedging budget.
+     */
+    void recordInferenceTime(double microseconds);
+    /**
+     * @brief Takes hedge from the budget.
+     *
+     * @return false when budget is exhausted
+     */
+    bool tryAcquireHedge();
+    /**
+     * @brief Returns hedge taken with tryAcquireHedge that was not started.
+     */
+    void releaseHedge();
+
+    const HedgingConfig& getConfig() const { return config; }
+
+private:
+    void updateThreshold();
+
+    const HedgingConfig config;
+
+    std::mutex mtx;
+    std::vector<double> samples;
+    size_t nextSample = 0;
+    size_t samplesSinceUpdate = 0;
+    double tokens = 0;
+    // microseconds, 0 - not enough samples
+    std::atomic<int64_t> thresholdUs{0};
+};
+}  // namespace ovms
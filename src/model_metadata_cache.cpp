@@ -0,0 +1,126 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_metadata_cache.hpp"
+
+#include <google/protobuf/util/json_util.h>
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include "get_model_metadata_impl.hpp"
+#include "logging.hpp"
+#include "status.hpp"
+
+namespace ovms {
+static const std::string KFS_JSON_EMPTY_VERSIONS = "\"versions\":[]";
+
+// proto json writer prints int64 as strings, KServe REST API expects numbers in shapes
+static void convertShapeType(rapidjson::Value& scope, rapidjson::Document& doc) {
+    for (rapidjson::SizeType i = 0; i < scope.Size(); i++) {
+        rapidjson::Value data = scope[i].GetObject()["shape"].GetArray();
+        rapidjson::Value shape(rapidjson::kArrayType);
+        for (rapidjson::SizeType j = 0; j < data.Size(); j++) {
+            shape.PushBack(atoi(data[j].GetString()), doc.GetAllocator());
+        }
+        scope[i].GetObject()["shape"] = shape;
+    }
+}
+
+Status serializeKfsModelMetadataToJson(const KFSModelMetadataResponse& response, std::string& output) {
+    std::string protoJson;
+    google::protobuf::util::JsonPrintOptions opts;
+    // This parameter forces JSON writer to not omit empty shape in case of scalar tensor
+    opts.always_print_primitive_fields = true;
+    google::protobuf::util::Status status = google::protobuf::util::MessageToJsonString(response, &protoJson, opts);
+    if (!status.ok()) {
+        return StatusCode::JSON_SERIALIZATION_ERROR;
+    }
+
+    rapidjson::Document doc;
+    doc.Parse(protoJson.c_str());
+
+    convertShapeType(doc["inputs"], doc);
+    convertShapeType(doc["outputs"], doc);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    doc.Accept(writer);
+
+    output = buffer.GetString();
+    return StatusCode::OK;
+}
+
+ModelMetadataCache::ModelMetadataCache(const std::string& name, model_version_t version, const tensor_map_t& inputs, const tensor_map_t& outputs) {
+    tfsResponse.mutable_model_spec()->set_name(name);
+    tfsResponse.mutable_model_spec()->mutable_version()->set_value(version);
+    tensorflow::serving::SignatureDefMap def;
+    GetModelMetadataImpl::convert(inputs, ((*def.mutable_signature_def())["serving_default"]).mutable_inputs());
+    GetModelMetadataImpl::convert(outputs, ((*def.mutable_signature_def())["serving_default"]).mutable_outputs());
+    (*tfsResponse.mutable_metadata())["signature_def"].PackFrom(def);
+    auto status = GetModelMetadataImpl::serializeResponse2Json(&tfsResponse, &tfsJson);
+    if (!status.ok()) {
+        tfsJson.clear();
+    }
+
+    kfsResponse.set_name(name);
+    kfsResponse.set_platform(PLATFORM);
+    for (const auto& input : inputs) {
+        KFSInferenceServiceImpl::convert(input, kfsResponse.add_inputs());
+    }
+    for (const auto& output : outputs) {
+        KFSInferenceServiceImpl::convert(output, kfsResponse.add_outputs());
+    }
+    std::string kfsJson;
+    status = serializeKfsModelMetadataToJson(kfsResponse, kfsJson);
+    auto versionsPosition = kfsJson.find(KFS_JSON_EMPTY_VERSIONS);
+    if (!status.ok() || versionsPosition == std::string::npos) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Metadata json for model: {}; version: {} will be serialized on each request", name, version);
+        return;
+    }
+    // versions list is the only part which changes between requests
+    const size_t versionsValuePosition = versionsPosition + KFS_JSON_EMPTY_VERSIONS.size() - 2;
+    kfsJsonBeforeVersions = kfsJson.substr(0, versionsValuePosition);
+    kfsJsonAfterVersions = kfsJson.substr(versionsValuePosition + 2);
+}
+
+void ModelMetadataCache::buildKfsResponse(const model_versions_t& readyVersions, KFSModelMetadataResponse* response) const {
+    *response = kfsResponse;
+    for (const auto& version : readyVersions) {
+        response->add_versions(std::to_string(version));
+    }
+}
+
+bool ModelMetadataCache::writeKfsJson(const model_versions_t& readyVersions, std::string& output) const {
+    if (kfsJsonBeforeVersions.empty()) {
+        return false;
+    }
+    output.clear();
+    output.reserve(kfsJsonBeforeVersions.size() + kfsJsonAfterVersions.size() + readyVersions.size() * 8 + 2);
+    output += kfsJsonBeforeVersions;
+    output += '[';
+    for (size_t i = 0; i < readyVersions.size(); ++i) {
+        if (i > 0) {
+            output += ',';
+        }
+        output += '"';
+        output += std::to_string(readyVersions[i]);
+        output += '"';
+    }
+    output += ']';
+    output += kfsJsonAfterVersions;
+    return true;
+}
+}  // namespace ovms
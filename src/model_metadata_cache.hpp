@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <string>
+#include <vector>
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wall"
+#pragma GCC diagnostic ignored "-Wunused-but-set-variable"
+#include "tensorflow_serving/apis/get_model_metadata.pb.h"
+#pragma GCC diagnostic pop
+
+#include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "modelversion.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief Serializes KServe model metadata response into REST API json format
+ */
+Status serializeKfsModelMetadataToJson(const KFSModelMetadataResponse& response, std::string& output);
+
+/**
+ * @brief Metadata responses of a single loaded model version in proto and json form.
+ * Built once after the version is loaded and immutable afterwards, so metadata requests only copy or write prepared content.
+ * KServe responses list ready versions of the whole model which change independently, they are inserted on each request.
+ */
+class ModelMetadataCache {
+    tensorflow::serving::GetModelMetadataResponse tfsResponse;
+    std::string tfsJson;
+    KFSModelMetadataResponse kfsResponse;
+    std::string kfsJsonBeforeVersions;
+    std::string kfsJsonAfterVersions;
+
+public:
+    ModelMetadataCache(const std::string& name, model_version_t version, const tensor_map_t& inputs, const tensor_map_t& outputs);
+
+    const tensorflow::serving::GetModelMetadataResponse& getTfsResponse() const {
+        return tfsResponse;
+    }
+
+    /**
+     * @brief TensorFlow Serving API REST response, empty if serialization failed
+     */
+    const std::string& getTfsJson() const {
+        return tfsJson;
+    }
+
+    void buildKfsResponse(const model_versions_t& readyVersions, KFSModelMetadataResponse* response) const;
+
+    /**
+     * @brief Writes KServe API REST response
+     *
+     * @return false if json form is not available
+     */
+    bool writeKfsJson(const model_versions_t& readyVersions, std::string& output) const;
+};
+}  // namespace ovms
@@ -321,6 +321,46 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
             {{"name", modelName}, {"version", std::to_string(modelVersion)}});
         THROW_IF_NULL(this->currentRequests, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_RESPONSE_CACHE_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of requests served from the response cache.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->responseCacheHits = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->responseCacheHits, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_RESPONSE_CACHE_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of response cache lookups which required inference.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->responseCacheMisses = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->responseCacheMisses, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_RESPONSE_CACHE_EVICTIONS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of response cache entries removed due to memory limit or expiration.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->responseCacheEvictions = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->responseCacheEvictions, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_WARMUP_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Time of the model warm-up performed before the version became available.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->warmupTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->warmupTime, "cannot create metric");
+    }
 }
 
 }  // namespace ovms
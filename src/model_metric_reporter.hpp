@@ -148,6 +148,12 @@ public:
     std::unique_ptr<MetricGauge> inferReqActive;
     std::unique_ptr<MetricGauge> currentRequests;
 
+    std::unique_ptr<MetricCounter> responseCacheHits;
+    std::unique_ptr<MetricCounter> responseCacheMisses;
+    std::unique_ptr<MetricCounter> responseCacheEvictions;
+
+    std::unique_ptr<MetricGauge> warmupTime;
+
     ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
 };
 
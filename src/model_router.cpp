@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_router.hpp"
+
+#include <utility>
+
+#include "logging.hpp"
+#include "modelinstance.hpp"
+#include "modelinstanceunloadguard.hpp"
+#include "modelmanager.hpp"
+#include "status.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+Status ModelRouter::parseNode(const rapidjson::Value& node, std::shared_ptr<ModelRouter>& router) {
+    const std::string routerName = node["name"].GetString();
+    std::vector<ModelRouterVariant> variants;
+    for (const auto& variantNode : node["variants"].GetArray()) {
+        ModelRouterVariant variant;
+        variant.modelName = variantNode["model_name"].GetString();
+        if (variantNode.HasMember("model_version")) {
+            variant.modelVersion = variantNode["model_version"].GetInt64();
+        }
+        if (variantNode.HasMember("max_batch_size")) {
+            variant.maxBatchSize = variantNode["max_batch_size"].GetUint64();
+        }
+        if (variantNode.HasMember("max_in_flight_requests")) {
+            variant.maxInFlightRequests = variantNode["max_in_flight_requests"].GetUint64();
+        }
+        if (variant.modelName == routerName) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Model router: {} cannot use itself as variant", routerName);
+            return StatusCode::MODEL_ROUTER_NAME_OCCUPIED;
+        }
+        variants.emplace_back(std::move(variant));
+    }
+    router = std::make_shared<ModelRouter>(routerName, std::move(variants));
+    return StatusCode::OK;
+}
+
+bool ModelRouter::accepts(const ModelInstance& instance, const ModelRouterVariant& variant, const request_shapes_t& requestShapes) {
+    const auto& inputsInfo = instance.getInputsInfo();
+    for (const auto& [inputName, shape] : requestShapes) {
+        auto it = inputsInfo.find(inputName);
+        if (it == inputsInfo.end()) {
+            return false;
+        }
+        if (!it->second->getShape().match(ov::Shape(shape))) {
+            return false;
+        }
+        if (!variant.maxBatchSize.has_value()) {
+            continue;
+        }
+        auto batchIndex = it->second->getLayout().getBatchIndex();
+        if (batchIndex.has_value() && batchIndex.value() < shape.size() && shape[batchIndex.value()] > variant.maxBatchSize.value()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Status ModelRouter::route(const ModelManager& manager, const request_shapes_t& requestShapes,
+    std::shared_ptr<ModelInstance>& modelInstance,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const {
+    std::shared_ptr<ModelInstance> leastLoadedInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> leastLoadedGuard;
+    uint64_t leastLoadedCount = 0;
+    for (const auto& variant : this->variants) {
+        std::shared_ptr<ModelInstance> instance;
+        std::unique_ptr<ModelInstanceUnloadGuard> guard;
+        auto status = manager.getModelInstance(variant.modelName, variant.modelVersion, instance, guard);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Model router: {} skipping variant: {}; {}", this->name, variant.modelName, status.string());
+            continue;
+        }
+        if (!accepts(*instance, variant, requestShapes)) {
+            SPDLOG_DEBUG("Model router: {} variant: {} does not accept request inputs", this->name, variant.modelName);
+            continue;
+        }
+        // count includes the request being routed
+        const uint64_t inFlight = instance->getPredictRequestsHandlesCount();
+        if (!variant.maxInFlightRequests.has_value() || inFlight <= variant.maxInFlightRequests.value()) {
+            SPDLOG_DEBUG("Model router: {} routing request to: {}; version: {}", this->name, variant.modelName, instance->getVersion());
+            modelInstance = std::move(instance);
+            modelInstanceUnloadGuardPtr = std::move(guard);
+            return StatusCode::OK;
+        }
+        if (!leastLoadedInstance || inFlight < leastLoadedCount) {
+            leastLoadedInstance = std::move(instance);
+            leastLoadedGuard = std::move(guard);
+            leastLoadedCount = inFlight;
+        }
+    }
+    if (!leastLoadedInstance) {
+        SPDLOG_DEBUG("Model router: {} has no variant accepting request inputs", this->name);
+        return StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT;
+    }
+    SPDLOG_DEBUG("Model router: {} all variants overloaded, routing request to: {}", this->name, leastLoadedInstance->getName());
+    modelInstance = std::move(leastLoadedInstance);
+    modelInstanceUnloadGuardPtr = std::move(leastLoadedGuard);
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <rapidjson/document.h>
+
+#include "modelversion.hpp"
+#include "shape.hpp"
+
+namespace ovms {
+class ModelInstance;
+class ModelInstanceUnloadGuard;
+class ModelManager;
+class Status;
+
+using request_shapes_t = std::map<std::string, shape_t>;
+
+/**
+ * @brief Model serving requests on behalf of model router.
+ */
+struct ModelRouterVariant {
+    std::string modelName;
+    // 0 - default version
+    model_version_t modelVersion = 0;
+    // requests with larger batch are not routed to the variant
+    std::optional<size_t> maxBatchSize;
+    // variant is overloaded when it serves that many requests
+    std::optional<uint64_t> maxInFlightRequests;
+};
+
+/**
+ * @brief Servable dispatching each request to one of models serving the same task, e.g. quantized
+ * and full precision model or models with different input resolutions.
+ *
+ * Variants are checked in configuration order. The first variant which accepts request input shapes
+ * and batch size, and is not overloaded, serves the request. When all accepting variants are
+ * overloaded, the one with the least in-flight requests is used.
+ */
+class ModelRouter {
+    const std::string name;
+    const std::vector<ModelRouterVariant> variants;
+
+public:
+    ModelRouter(const std::string& name, std::vector<ModelRouterVariant> variants) :
+        name(name),
+        variants(std::move(variants)) {}
+
+    const std::string& getName() const { return name; }
+    const std::vector<ModelRouterVariant>& getVariants() const { return variants; }
+
+    static Status parseNode(const rapidjson::Value& node, std::shared_ptr<ModelRouter>& router);
+
+    /**
+     * @brief Selects model instance serving the request
+     *
+     * @return MODEL_ROUTER_NO_MATCHING_VARIANT when no loaded variant accepts the request
+     */
+    Status route(const ModelManager& manager, const request_shapes_t& requestShapes,
+        std::shared_ptr<ModelInstance>& modelInstance,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const;
+
+    /**
+     * @brief Checks if model instance accepts request inputs without reshape
+     */
+    static bool accepts(const ModelInstance& instance, const ModelRouterVariant& variant, const request_shapes_t& requestShapes);
+};
+}  // namespace ovms
@@ -0,0 +1,252 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_warmup.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <random>
+#include <utility>
+
+#include "filesystem.hpp"
+#include "logging.hpp"
+#include "precision_conversion.hpp"
+#include "shape.hpp"
+
+namespace ovms {
+
+const std::string WARMUP_SAMPLES_DIRECTORY = "warmup";
+const std::string WARMUP_SAMPLE_FILE_EXTENSION = ".bin";
+
+static size_t getWarmupDimension(const Dimension& dim, bool upperBound) {
+    if (dim.isStatic()) {
+        return dim.getStaticValue();
+    }
+    if (dim.isAny()) {
+        return 1;
+    }
+    return std::max<dimension_value_t>(1, upperBound ? dim.getMaxValue() : dim.getMinValue());
+}
+
+static ov::Shape createWarmupShape(const Shape& shape, bool upperBound) {
+    ov::Shape warmupShape;
+    warmupShape.reserve(shape.size());
+    for (const auto& dim : shape) {
+        warmupShape.push_back(getWarmupDimension(dim, upperBound));
+    }
+    return warmupShape;
+}
+
+std::vector<warmup_shapes_t> createWarmupShapeBuckets(const tensor_map_t& inputsInfo) {
+    warmup_shapes_t lowerBounds;
+    warmup_shapes_t upperBounds;
+    for (const auto& [name, tensorInfo] : inputsInfo) {
+        lowerBounds[tensorInfo->getName()] = createWarmupShape(tensorInfo->getShape(), false);
+        upperBounds[tensorInfo->getName()] = createWarmupShape(tensorInfo->getShape(), true);
+    }
+    std::vector<warmup_shapes_t> buckets{std::move(lowerBounds)};
+    if (upperBounds != buckets.front()) {
+        buckets.push_back(std::move(upperBounds));
+    }
+    return buckets;
+}
+
+static std::mt19937& getWarmupRandomGenerator() {
+    // fixed seed so that warm-up is reproducible
+    static thread_local std::mt19937 generator(2023);
+    return generator;
+}
+
+template <typename T>
+static void fillUniform(ov::Tensor& tensor) {
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    T* data = static_cast<T*>(tensor.data());
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = static_cast<T>(distribution(getWarmupRandomGenerator()));
+    }
+}
+
+static void fillUniformHalf(ov::Tensor& tensor, void (*convertFromFp32)(const float*, uint16_t*, size_t)) {
+    std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+    std::vector<float> values(tensor.get_size());
+    for (auto& value : values) {
+        value = distribution(getWarmupRandomGenerator());
+    }
+    convertFromFp32(values.data(), static_cast<uint16_t*>(tensor.data()), values.size());
+}
+
+// integer inputs are often indices or masks, 0 and 1 are valid values for most of them
+template <typename T>
+static void fillBinary(ov::Tensor& tensor) {
+    std::bernoulli_distribution distribution;
+    T* data = static_cast<T*>(tensor.data());
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = static_cast<T>(distribution(getWarmupRandomGenerator()));
+    }
+}
+
+static void fillRandom(ov::Tensor& tensor) {
+    switch (tensor.get_element_type()) {
+    case ov::element::Type_t::f64:
+        return fillUniform<double>(tensor);
+    case ov::element::Type_t::f32:
+        return fillUniform<float>(tensor);
+    case ov::element::Type_t::f16:
+        return fillUniformHalf(tensor, convertFp32ToFp16);
+    case ov::element::Type_t::bf16:
+        return fillUniformHalf(tensor, convertFp32ToBf16);
+    case ov::element::Type_t::i64:
+        return fillBinary<int64_t>(tensor);
+    case ov::element::Type_t::i32:
+        return fillBinary<int32_t>(tensor);
+    case ov::element::Type_t::i16:
+        return fillBinary<int16_t>(tensor);
+    case ov::element::Type_t::i8:
+        return fillBinary<int8_t>(tensor);
+    case ov::element::Type_t::u64:
+        return fillBinary<uint64_t>(tensor);
+    case ov::element::Type_t::u32:
+        return fillBinary<uint32_t>(tensor);
+    case ov::element::Type_t::u16:
+        return fillBinary<uint16_t>(tensor);
+    case ov::element::Type_t::u8:
+    case ov::element::Type_t::boolean:
+        return fillBinary<uint8_t>(tensor);
+    default:
+        std::memset(tensor.data(), 0, tensor.get_byte_size());
+    }
+}
+
+static bool readSample(ov::Tensor& tensor, const std::string& sampleFilePath) {
+    std::ifstream file(sampleFilePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Warm-up sample file: {} could not be opened, using random data", sampleFilePath);
+        return false;
+    }
+    const std::streamsize fileSize = file.tellg();
+    if (fileSize < 0 || static_cast<size_t>(fileSize) != tensor.get_byte_size()) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Warm-up sample file: {} size: {} does not match tensor size: {} for shape: {}, using random data",
+            sampleFilePath, fileSize, tensor.get_byte_size(), shapeToString(tensor.get_shape()));
+        return false;
+    }
+    file.seekg(0);
+    return static_cast<bool>(file.read(static_cast<char*>(tensor.data()), fileSize));
+}
+
+ov::Tensor createWarmupTensor(const TensorInfo& tensorInfo, const ov::Shape& shape, const std::string& sampleFilePath) {
+    ov::Tensor tensor(tensorInfo.getOvPrecision(), shape);
+    if (tensor.get_byte_size() == 0) {
+        return tensor;
+    }
+    if (sampleFilePath.empty() || !readSample(tensor, sampleFilePath)) {
+        fillRandom(tensor);
+    }
+    return tensor;
+}
+
+static void inferInParallel(std::vector<ov::InferRequest*>& inferRequests) {
+    // all started inferences have to finish before error is reported
+    std::exception_ptr error;
+    size_t started = 0;
+    try {
+        for (; started < inferRequests.size(); ++started) {
+            inferRequests[started]->start_async();
+        }
+    } catch (...) {
+        error = std::current_exception();
+    }
+    for (size_t i = 0; i < started; ++i) {
+        try {
+            inferRequests[i]->wait();
+        } catch (...) {
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+namespace {
+// warm-up tensors must not stay referenced by infer requests after warm-up, also when it fails
+class WarmupTensorsRestorer {
+public:
+    WarmupTensorsRestorer(std::vector<ov::InferRequest*>& inferRequests, const tensor_map_t& inputsInfo) :
+        inferRequests(inferRequests),
+        originalTensors(inferRequests.size()) {
+        for (size_t i = 0; i < inferRequests.size(); ++i) {
+            for (const auto& [name, tensorInfo] : inputsInfo) {
+                try {
+                    originalTensors[i].emplace_back(tensorInfo->getName(), inferRequests[i]->get_tensor(tensorInfo->getName()));
+                } catch (const ov::Exception& e) {
+                    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Could not get original tensor: {} before warm-up: {}", tensorInfo->getName(), e.what());
+                }
+            }
+        }
+    }
+    WarmupTensorsRestorer(const WarmupTensorsRestorer&) = delete;
+    WarmupTensorsRestorer& operator=(const WarmupTensorsRestorer&) = delete;
+    ~WarmupTensorsRestorer() {
+        for (size_t i = 0; i < inferRequests.size(); ++i) {
+            for (auto& [name, tensor] : originalTensors[i]) {
+                try {
+                    inferRequests[i]->set_tensor(name, tensor);
+                } catch (const ov::Exception& e) {
+                    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Could not restore original tensor: {} after warm-up: {}", name, e.what());
+                }
+            }
+            try {
+                for (auto&& state : inferRequests[i]->query_state()) {
+                    state.reset();
+                }
+            } catch (const ov::Exception& e) {
+                SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Could not reset infer request state after warm-up: {}", e.what());
+            }
+        }
+    }
+
+private:
+    std::vector<ov::InferRequest*>& inferRequests;
+    std::vector<std::vector<std::pair<std::string, ov::Tensor>>> originalTensors;
+};
+}  // namespace
+
+void warmUpInferRequests(std::vector<ov::InferRequest*>& inferRequests, const tensor_map_t& inputsInfo, uint32_t iterations, const std::string& samplesDirectory) {
+    WarmupTensorsRestorer restorer(inferRequests, inputsInfo);
+    for (const auto& bucket : createWarmupShapeBuckets(inputsInfo)) {
+        for (const auto& [name, tensorInfo] : inputsInfo) {
+            std::string sampleFilePath;
+            if (!samplesDirectory.empty()) {
+                sampleFilePath = FileSystem::joinPath({samplesDirectory, tensorInfo->getMappedName() + WARMUP_SAMPLE_FILE_EXTENSION});
+            }
+            const ov::Shape& shape = bucket.at(tensorInfo->getName());
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Warm-up input: {}; shape: {}", tensorInfo->getMappedName(), shapeToString(shape));
+            // infer requests only read inputs so they can share tensors
+            ov::Tensor tensor = createWarmupTensor(*tensorInfo, shape, sampleFilePath);
+            for (auto* inferRequest : inferRequests) {
+                inferRequest->set_tensor(tensorInfo->getName(), tensor);
+            }
+        }
+        for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+            inferInParallel(inferRequests);
+        }
+    }
+}
+}  // namespace ovms
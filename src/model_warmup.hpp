@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+// subdirectory of model version directory with warm-up samples
+extern const std::string WARMUP_SAMPLES_DIRECTORY;
+extern const std::string WARMUP_SAMPLE_FILE_EXTENSION;
+
+using warmup_shapes_t = std::map<std::string, ov::Shape>;
+
+/**
+ * @brief Creates shapes of model inputs used in warm-up, keyed by model input names.
+ * Model with static inputs has single shape bucket. When any input has dimension ranges,
+ * second bucket with upper bounds of the ranges is created. Unbounded dimensions are set to 1.
+ */
+std::vector<warmup_shapes_t> createWarmupShapeBuckets(const tensor_map_t& inputsInfo);
+
+/**
+ * @brief Creates warm-up input tensor. Data is read from the sample file when it exists
+ * and its size matches tensor byte size, otherwise tensor is filled with random data.
+ *
+ * @param tensorInfo model input
+ * @param shape tensor shape
+ * @param sampleFilePath raw tensor data file, empty for random data
+ */
+ov::Tensor createWarmupTensor(const TensorInfo& tensorInfo, const ov::Shape& shape, const std::string& sampleFilePath = "");
+
+/**
+ * @brief Runs inference on all infer requests in parallel for each shape bucket.
+ * Original input tensors and variable states of infer requests are restored afterwards.
+ *
+ * @param inferRequests infer requests to warm up
+ * @param inputsInfo model inputs
+ * @param iterations number of inferences executed on each infer request for each shape bucket
+ * @param samplesDirectory directory with sample files, empty for random data
+ */
+void warmUpInferRequests(std::vector<ov::InferRequest*>& inferRequests, const tensor_map_t& inputsInfo, uint32_t iterations, const std::string& samplesDirectory = "");
+}  // namespace ovms
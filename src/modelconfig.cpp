@@ -132,6 +132,23 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shape configuration mismatch", this->name);
         return true;
     }
+    if ((this->responseCacheSizeMb != rhs.responseCacheSizeMb) ||
+        (this->responseCacheTtlSeconds != rhs.responseCacheTtlSeconds)) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to response cache mismatch", this->name);
+        return true;
+    }
+    if (this->autoTuneConfig != rhs.autoTuneConfig) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to auto-tune configuration mismatch", this->name);
+        return true;
+    }
+    if (this->hedgingConfig != rhs.hedgingConfig) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to hedging configuration mismatch", this->name);
+        return true;
+    }
+    if (this->wirePrecisions != rhs.wirePrecisions) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to wire precision mismatch", this->name);
+        return true;
+    }
     if (isCustomLoaderConfigChanged(rhs)) {
         return true;
     }
@@ -451,6 +468,29 @@ Status ModelConfig::parseLayoutParameter(const std::string& command) {
     return parseLayoutParameter(node);
 }
 
+Status ModelConfig::parseWirePrecisionParameter(const rapidjson::Value& node) {
+    if (!node.IsObject()) {
+        return StatusCode::WIRE_PRECISION_WRONG_FORMAT;
+    }
+    wire_precisions_map_t wirePrecisions;
+    for (auto it = node.MemberBegin(); it != node.MemberEnd(); ++it) {
+        if (!it->value.IsString()) {
+            return StatusCode::WIRE_PRECISION_WRONG_FORMAT;
+        }
+        std::string precisionStr = it->value.GetString();
+        std::transform(precisionStr.begin(), precisionStr.end(), precisionStr.begin(), ::toupper);
+        Precision precision = fromString(precisionStr);
+        if (precision != Precision::FP16 && precision != Precision::BF16) {
+            SPDLOG_ERROR("Unsupported wire precision: {} for tensor: {}", it->value.GetString(), it->name.GetString());
+            return StatusCode::WIRE_PRECISION_WRONG_FORMAT;
+        }
+        wirePrecisions[it->name.GetString()] = precision;
+    }
+    setWirePrecisions(wirePrecisions);
+
+    return StatusCode::OK;
+}
+
 Status ModelConfig::parseShape(ShapeInfo& shapeInfo, const std::string& str) {
     if (str == "auto") {
         SPDLOG_LOGGER_WARN(modelmanager_logger, "Shape auto is deprecated. Use model dynamic shapes instead. Check (https://docs.openvino.ai/2023.2/ovms_docs_dynamic_shape_dynamic_model.html#doxid-ovms-docs-dynamic-shape-dynamic-model)");
@@ -614,6 +654,13 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         }
     }
 
+    if (v.HasMember("wire_precision")) {
+        Status status = this->parseWirePrecisionParameter(v["wire_precision"]);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+
     if (v.HasMember("plugin_config")) {
         auto status = parsePluginConfig(v["plugin_config"]);
         if (!status.ok()) {
@@ -656,6 +703,62 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         this->setMaxSequenceNumber(v["max_sequence_number"].GetUint());
     }
 
+    if (v.HasMember("response_cache")) {
+        if (this->isStateful()) {
+            SPDLOG_ERROR("Response cache parameter was set for stateful model {}.", v["name"].GetString());
+            return StatusCode::RESPONSE_CACHE_WITH_STATEFUL_MODEL;
+        }
+        const auto& responseCache = v["response_cache"];
+        this->setResponseCacheSizeMb(responseCache["max_size_mb"].GetUint64());
+        if (responseCache.HasMember("ttl_seconds")) {
+            this->setResponseCacheTtlSeconds(responseCache["ttl_seconds"].GetUint());
+        }
+    }
+
+    if (v.HasMember("warmup")) {
+        const auto& warmup = v["warmup"];
+        this->setWarmupIterations(warmup.HasMember("iterations") ? warmup["iterations"].GetUint() : 1);
+        if (warmup.HasMember("inputs")) {
+            this->setWarmupSampleFiles(std::string(warmup["inputs"].GetString()) == "files");
+        }
+    }
+
+    if (v.HasMember("auto_tune")) {
+        const auto& autoTune = v["auto_tune"];
+        AutoTuneConfig autoTuneConfig;
+        autoTuneConfig.maxNireq = autoTune["max_nireq"].GetUint();
+        if (autoTune.HasMember("min_nireq")) {
+            autoTuneConfig.minNireq = autoTune["min_nireq"].GetUint();
+        }
+        if (autoTune.HasMember("max_streams")) {
+            autoTuneConfig.maxStreams = autoTune["max_streams"].GetUint();
+        }
+        if (autoTune.HasMember("interval_seconds")) {
+            autoTuneConfig.intervalSeconds = autoTune["interval_seconds"].GetUint();
+        }
+        if (autoTuneConfig.minNireq > autoTuneConfig.maxNireq) {
+            SPDLOG_ERROR("Auto-tune min_nireq: {} is greater than max_nireq: {} for model {}.", autoTuneConfig.minNireq, autoTuneConfig.maxNireq, v["name"].GetString());
+            return StatusCode::AUTO_TUNE_WRONG_BOUNDS;
+        }
+        this->setAutoTuneConfig(autoTuneConfig);
+    }
+
+    if (v.HasMember("hedging")) {
+        if (this->isStateful()) {
+            SPDLOG_ERROR("Hedging parameter was set for stateful model {}.", v["name"].GetString());
+            return StatusCode::HEDGING_WITH_STATEFUL_MODEL;
+        }
+        const auto& hedging = v["hedging"];
+        HedgingConfig hedgingConfig;
+        if (hedging.HasMember("latency_percentile")) {
+            hedgingConfig.latencyPercentile = hedging["latency_percentile"].GetDouble();
+        }
+        if (hedging.HasMember("max_extra_load")) {
+            hedgingConfig.maxExtraLoad = hedging["max_extra_load"].GetDouble();
+        }
+        this->setHedgingConfig(hedgingConfig);
+    }
+
     if (v.HasMember("model_version_policy")) {
         rapidjson::StringBuffer buffer;
         buffer.Clear();
@@ -687,6 +790,9 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
     if (getModelVersionPolicy()) {
         SPDLOG_DEBUG("model_version_policy: {}", std::string(*getModelVersionPolicy()));
     }
+    for (auto& [tensorName, wirePrecision] : getWirePrecisions()) {
+        SPDLOG_DEBUG("wire_precision: {}: {}", tensorName, toString(wirePrecision));
+    }
     SPDLOG_DEBUG("nireq: {}", getNireq());
     SPDLOG_DEBUG("target_device: {}", getTargetDevice());
     SPDLOG_DEBUG("plugin_config:");
@@ -711,6 +817,23 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         SPDLOG_DEBUG("low_latency_transformation: {}", isLowLatencyTransformationUsed());
     }
 
+    if (getResponseCacheSizeMb() > 0) {
+        SPDLOG_DEBUG("response_cache: max_size_mb: {}; ttl_seconds: {}", getResponseCacheSizeMb(), getResponseCacheTtlSeconds());
+    }
+
+    if (getAutoTuneConfig().has_value()) {
+        SPDLOG_DEBUG("auto_tune: min_nireq: {}; max_nireq: {}; max_streams: {}; interval_seconds: {}", getAutoTuneConfig()->minNireq,
+            getAutoTuneConfig()->maxNireq, getAutoTuneConfig()->maxStreams, getAutoTuneConfig()->intervalSeconds);
+    }
+
+    if (getHedgingConfig().has_value()) {
+        SPDLOG_DEBUG("hedging: latency_percentile: {}; max_extra_load: {}", getHedgingConfig()->latencyPercentile, getHedgingConfig()->maxExtraLoad);
+    }
+
+    if (getWarmupIterations() > 0) {
+        SPDLOG_DEBUG("warmup: iterations: {}; inputs: {}", getWarmupIterations(), isWarmupSampleFilesUsed() ? "files" : "random");
+    }
+
     // Model Cache options
     if (v.HasMember("allow_cache")) {
         setAllowCache(v["allow_cache"].GetBool());
@@ -27,7 +27,10 @@
 #include <rapidjson/document.h>
 
 #include "layout_configuration.hpp"
+#include "model_auto_tuner.hpp"
+#include "model_hedging.hpp"
 #include "modelversion.hpp"
+#include "precision.hpp"
 #include "shape.hpp"
 #include "status.hpp"
 
@@ -37,6 +40,7 @@ class ModelVersionPolicy;
 using mapping_config_t = std::unordered_map<std::string, std::string>;
 using plugin_config_t = std::map<std::string, ov::Any>;
 using custom_loader_options_config_t = std::map<std::string, std::string>;
+using wire_precisions_map_t = std::map<std::string, Precision>;
 
 extern const std::string ANONYMOUS_INPUT_NAME;
 extern const std::string MAPPING_CONFIG_JSON;
@@ -122,6 +126,36 @@ private:
          */
     bool isAllowCacheTrue = false;
 
+    /**
+         * @brief Response cache memory limit, 0 disables response cache
+         */
+    size_t responseCacheSizeMb = 0;
+
+    /**
+         * @brief Response cache entries time to live, 0 means entries do not expire
+         */
+    uint32_t responseCacheTtlSeconds = 0;
+
+    /**
+         * @brief Number of warm-up inferences executed on each infer request before model becomes available, 0 disables warm-up
+         */
+    uint32_t warmupIterations = 0;
+
+    /**
+         * @brief Flag determining if warm-up uses sample files from model version directory instead of random data
+         */
+    bool warmupSampleFiles = false;
+
+    /**
+         * @brief Bounds of online nireq and streams tuning, tuning is disabled when not set
+         */
+    std::optional<AutoTuneConfig> autoTuneConfig;
+
+    /**
+         * @brief Hedged execution settings, hedging is disabled when not set
+         */
+    std::optional<HedgingConfig> hedgingConfig;
+
     /**
          * @brief Model version
          */
@@ -148,6 +182,11 @@ private:
          */
     layout_configurations_map_t layouts;
 
+    /**
+         * @brief Map of precisions used on the wire for FP32 tensors
+         */
+    wire_precisions_map_t wirePrecisions;
+
     /**
          * @brief Input mapping configuration
          */
@@ -389,6 +428,114 @@ public:
         this->isAllowCacheTrue = allowCache;
     }
 
+    /**
+         * @brief Get the response cache memory limit in megabytes
+         * 
+         * @return size_t
+         */
+    size_t getResponseCacheSizeMb() const {
+        return this->responseCacheSizeMb;
+    }
+
+    /**
+         * @brief Set the response cache memory limit in megabytes
+         * 
+         * @param responseCacheSizeMb
+         */
+    void setResponseCacheSizeMb(size_t responseCacheSizeMb) {
+        this->responseCacheSizeMb = responseCacheSizeMb;
+    }
+
+    /**
+         * @brief Get the response cache entries time to live
+         * 
+         * @return uint32_t
+         */
+    uint32_t getResponseCacheTtlSeconds() const {
+        return this->responseCacheTtlSeconds;
+    }
+
+    /**
+         * @brief Set the response cache entries time to live
+         * 
+         * @param responseCacheTtlSeconds
+         */
+    void setResponseCacheTtlSeconds(uint32_t responseCacheTtlSeconds) {
+        this->responseCacheTtlSeconds = responseCacheTtlSeconds;
+    }
+
+    /**
+         * @brief Get the number of warm-up iterations
+         * 
+         * @return uint32_t
+         */
+    uint32_t getWarmupIterations() const {
+        return this->warmupIterations;
+    }
+
+    /**
+         * @brief Set the number of warm-up iterations
+         * 
+         * @param warmupIterations
+         */
+    void setWarmupIterations(uint32_t warmupIterations) {
+        this->warmupIterations = warmupIterations;
+    }
+
+    /**
+         * @brief Checks if warm-up uses sample files
+         * 
+         * @return bool
+         */
+    bool isWarmupSampleFilesUsed() const {
+        return this->warmupSampleFiles;
+    }
+
+    /**
+         * @brief Set if warm-up uses sample files
+         * 
+         * @param warmupSampleFiles
+         */
+    void setWarmupSampleFiles(bool warmupSampleFiles) {
+        this->warmupSampleFiles = warmupSampleFiles;
+    }
+
+    /**
+         * @brief Get the auto-tune config
+         * 
+         * @return const std::optional<AutoTuneConfig>&
+         */
+    const std::optional<AutoTuneConfig>& getAutoTuneConfig() const {
+        return this->autoTuneConfig;
+    }
+
+    /**
+         * @brief Set the auto-tune config
+         * 
+         * @param autoTuneConfig
+         */
+    void setAutoTuneConfig(const std::optional<AutoTuneConfig>& autoTuneConfig) {
+        this->autoTuneConfig = autoTuneConfig;
+    }
+
+    /**
+         * @brief Get the hedging config
+         * 
+         * @return const std::optional<HedgingConfig>&
+         */
+    const std::optional<HedgingConfig>& getHedgingConfig() const {
+        return this->hedgingConfig;
+    }
+
+    /**
+         * @brief Set the hedging config
+         * 
+         * @param hedgingConfig
+         */
+    void setHedgingConfig(const std::optional<HedgingConfig>& hedgingConfig) {
+        this->hedgingConfig = hedgingConfig;
+    }
+
     /**
          * @brief Checks if given device is used as single target device.
          * 
@@ -667,6 +814,15 @@ public:
          */
     Status parseLayoutParameter(const std::string& command);
 
+    /**
+         * @brief Parses value from json and extracts wire precisions info
+         * 
+         * @param node
+         * 
+         * @return status
+         */
+    Status parseWirePrecisionParameter(const rapidjson::Value& node);
+
     /**
          * @brief Returns true if any input shape specified in shapes map is in AUTO mode
          * 
@@ -787,6 +943,24 @@ public:
         this->layout = LayoutConfiguration();
     }
 
+    /**
+         * @brief Get the wire precisions
+         * 
+         * @return const wire_precisions_map_t& 
+         */
+    const wire_precisions_map_t& getWirePrecisions() const {
+        return this->wirePrecisions;
+    }
+
+    /**
+         * @brief Set the wire precisions
+         * 
+         * @param wirePrecisions 
+         */
+    void setWirePrecisions(const wire_precisions_map_t& wirePrecisions) {
+        this->wirePrecisions = wirePrecisions;
+    }
+
     /**
          * @brief Get the version
          * 
@@ -16,20 +16,28 @@
 #include "modelinstance.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
+#include <exception>
 #include <iostream>
+#include <istream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <set>
+#include <streambuf>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <dirent.h>
-#include <malloc.h>
 #include <openvino/runtime/compiled_model.hpp>
 #include <spdlog/spdlog.h>
 #include <sys/types.h>
 
+#include "allocator_stats.hpp"
 #include "capi_frontend/inferencerequest.hpp"
 #include "capi_frontend/inferenceresponse.hpp"
 #include "config.hpp"
@@ -42,6 +50,7 @@
 #include "layout_configuration.hpp"
 #include "logging.hpp"
 #include "model_metric_reporter.hpp"
+#include "model_warmup.hpp"
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "ov_utils.hpp"
@@ -52,6 +61,7 @@
 #include "shape.hpp"
 #include "status.hpp"
 #include "stringutils.hpp"
+#include "systeminfo.hpp"
 #include "tensorinfo.hpp"
 #include "timer.hpp"
 
@@ -80,7 +90,8 @@ ModelInstance::ModelInstance(const std::string& name, model_version_t version, o
     version(version),
     subscriptionManager(std::string("model: ") + name + std::string(" version: ") + std::to_string(version)),
     status(name, version),
-    reporter(std::make_unique<ModelMetricReporter>(metricConfig, registry, name, version)) {
+    reporter(std::make_unique<ModelMetricReporter>(metricConfig, registry, name, version)),
+    tensorMemoryPool(std::make_shared<TensorMemoryPool>(std::string("model: ") + name + std::string(" version: ") + std::to_string(version), TensorMemoryPool::getConfiguredMaxCachedBytes())) {
     isCustomLoaderConfigChanged = false;
 }
 
@@ -168,9 +179,43 @@ static Status validateConfigurationAgainstNetwork(const ModelConfig& config, std
     return StatusCode::OK;
 }
 
+static Status applyWirePrecision(const ModelConfig& config, const std::string& name, std::shared_ptr<const TensorInfo>& info) {
+    const auto& wirePrecisions = config.getWirePrecisions();
+    auto it = wirePrecisions.find(name);
+    if (it == wirePrecisions.end()) {
+        it = wirePrecisions.find(info->getMappedName());
+    }
+    if (it == wirePrecisions.end()) {
+        return StatusCode::OK;
+    }
+    if (info->getPrecision() != Precision::FP32) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Wire precision: {} configured for tensor: {} with precision: {}; only FP32 tensors are supported",
+            toString(it->second), name, info->getPrecisionAsString());
+        return StatusCode::WIRE_PRECISION_UNSUPPORTED;
+    }
+    info = info->createCopyWithWirePrecision(it->second);
+    return StatusCode::OK;
+}
+
+template <typename PortType>
+static std::optional<ov::Layout> getPortLayout(const PortType& port, Layout& defaultLayout) {
+    OV_LOGGER("port: {}, port.get_partial_shape().size()", reinterpret_cast<const void*>(&port));
+    defaultLayout = Layout::getDefaultLayout(port.get_partial_shape().size());
+    OV_LOGGER("port: {}, port.get_rt_info()", reinterpret_cast<const void*>(&port));
+    return getLayoutFromRTMap(port.get_rt_info());
+}
+
 const Layout ModelInstance::getReportedTensorLayout(const ModelConfig& config, const std::string& name, bool isInput) {
     Layout defaultLayout;
-    if (isInput) {
+    if (!this->model) {
+        // model imported from compiled blob, only compiled model ports are available
+        OV_LOGGER("ov::CompiledModel: {}, compiledModel->{}(\"{}\")", reinterpret_cast<const void*>(this->compiledModel.get()), isInput ? "input" : "output", name);
+        auto networkSpecifiedLayout = isInput ? getPortLayout(this->compiledModel->input(name), defaultLayout) : getPortLayout(this->compiledModel->output(name), defaultLayout);
+        if (networkSpecifiedLayout.has_value()) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reporting layout from compiled model RTMap: {}; for tensor name: {}", networkSpecifiedLayout.value().to_string(), name);
+            return Layout::fromOvLayout(networkSpecifiedLayout.value());
+        }
+    } else if (isInput) {
         OV_LOGGER("ov::Model model: {}, model->input(\"{}\")", reinterpret_cast<const void*>(this->model.get()), name);
         const auto& input = this->model->input(name);
         OV_LOGGER("input: {}, input.get_partial_shape().size()", reinterpret_cast<const void*>(&input));
@@ -431,6 +476,8 @@ Status ModelInstance::gatherReshapeInfo(bool isBatchingModeAuto, const DynamicMo
 }
 
 Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicModelParameter& parameter) {
+    this->inputsDescriptors = TensorDescriptorTable();
+    this->metadataCache.reset();
     this->inputsInfo.clear();
 
     std::map<std::string, ov::PartialShape> modelShapes;
@@ -486,6 +533,10 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
                 precision,
                 shape,
                 layout);
+            auto wirePrecisionStatus = applyWirePrecision(config, name, info);
+            if (!wirePrecisionStatus.ok()) {
+                return wirePrecisionStatus;
+            }
 
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Input {}", info->asString());
             this->inputsInfo[info->getMappedName()] = std::move(info);
@@ -538,6 +589,10 @@ Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
                 precision,
                 shape,
                 layout);
+            auto wirePrecisionStatus = applyWirePrecision(config, name, info);
+            if (!wirePrecisionStatus.ok()) {
+                return wirePrecisionStatus;
+            }
 
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Output {}", info->asString());
 
@@ -565,6 +620,68 @@ Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
     return StatusCode::OK;
 }
 
+template <typename PortType>
+static Status createImportedTensorInfo(const PortType& port, const std::string& mappingName, const Layout& layout, std::shared_ptr<const TensorInfo>& info) {
+    const std::string& name = port.get_any_name();
+    Shape shape(port.get_partial_shape());
+    if (!layout.isCompatible(shape)) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Layout: {}; incompatible with shape: {}; for tensor name: {}", layout, shape.toString(), name);
+        return StatusCode::LAYOUT_INCOMPATIBLE_WITH_SHAPE;
+    }
+    info = std::make_shared<TensorInfo>(name, mappingName, ovElementTypeToOvmsPrecision(port.get_element_type()), shape, layout);
+    return StatusCode::OK;
+}
+
+Status ModelInstance::loadImportedTensors(const ModelConfig& config) {
+    // compiled blob cannot be reshaped nor have its layout changed
+    if (config.getBatchingMode() != FIXED || config.getBatchSize().has_value() || !config.getShapes().empty() || config.getLayout().isSet() || !config.getLayouts().empty()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Model: {}; version: {}; imported from compiled blob does not support batch size, shape and layout parameters",
+            getName(), getVersion());
+        return StatusCode::IMPORTED_MODEL_RESHAPE_NOT_SUPPORTED;
+    }
+    this->inputsDescriptors = TensorDescriptorTable();
+    this->metadataCache.reset();
+    this->inputsInfo.clear();
+    this->outputsInfo.clear();
+    try {
+        OV_LOGGER("ov::CompiledModel: {}, compiledModel->inputs()", reinterpret_cast<void*>(compiledModel.get()));
+        for (const auto& input : this->compiledModel->inputs()) {
+            const std::string& name = input.get_any_name();
+            std::shared_ptr<const TensorInfo> info;
+            auto status = createImportedTensorInfo(input, config.getMappingInputByKey(name), getReportedTensorLayout(config, name, true), info);
+            if (!status.ok()) {
+                return status;
+            }
+            status = applyWirePrecision(config, name, info);
+            if (!status.ok()) {
+                return status;
+            }
+            SPDLOG_LOGGER_INFO(modelmanager_logger, "Input {}", info->asString());
+            this->inputsInfo[info->getMappedName()] = std::move(info);
+        }
+        OV_LOGGER("ov::CompiledModel: {}, compiledModel->outputs()", reinterpret_cast<void*>(compiledModel.get()));
+        for (const auto& output : this->compiledModel->outputs()) {
+            const std::string& name = output.get_any_name();
+            std::shared_ptr<const TensorInfo> info;
+            auto status = createImportedTensorInfo(output, config.getMappingOutputByKey(name), getReportedTensorLayout(config, name, false), info);
+            if (!status.ok()) {
+                return status;
+            }
+            status = applyWirePrecision(config, name, info);
+            if (!status.ok()) {
+                return status;
+            }
+            SPDLOG_LOGGER_INFO(modelmanager_logger, "Output {}", info->asString());
+            this->outputsInfo[info->getMappedName()] = std::move(info);
+        }
+    } catch (const std::exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to get tensors of imported model: {}; version: {}; from OpenVINO with error: {}",
+            getName(), getVersion(), e.what());
+        return StatusCode::UNKNOWN_ERROR;
+    }
+    return StatusCode::OK;
+}
+
 // Temporary methods. To be replaces with proper storage class.
 static bool dirExists(const std::string& path) {
     if (FileSystem::isPathEscaped(path)) {
@@ -614,6 +731,9 @@ std::string ModelInstance::findModelFilePathWithExtension(const std::string& ext
 
 uint ModelInstance::getNumOfParallelInferRequestsUnbounded(const ModelConfig& modelConfig) {
     uint numberOfParallelInferRequests = 0;
+    if (tunedNireq.has_value()) {
+        return tunedNireq.value();
+    }
     if (modelConfig.getNireq() > 0) {
         return modelConfig.getNireq();
     }
@@ -660,11 +780,26 @@ Status ModelInstance::loadOVModel() {
     return StatusCode::OK;
 }
 
+static void setNumberOfStreams(plugin_config_t& pluginConfig, uint32_t streams) {
+    pluginConfig["NUM_STREAMS"] = std::to_string(streams);
+}
+
+namespace {
+// reads compiled blob directly from loader memory
+class CustomLoaderBufferStreamBuf : public std::streambuf {
+public:
+    explicit CustomLoaderBufferStreamBuf(const CustomLoaderBuffer& buffer) {
+        char* begin = const_cast<char*>(reinterpret_cast<const char*>(buffer.data));
+        setg(begin, begin, begin + buffer.size);
+    }
+};
+}  // namespace
+
 Status ModelInstance::loadOVModelUsingCustomLoader() {
     SPDLOG_DEBUG("Try reading model using a custom loader");
     try {
-        std::vector<uint8_t> modelBinary;
-        std::vector<uint8_t> weights;
+        CustomLoaderBuffer modelBuffer;
+        CustomLoaderBuffer weights;
 
         SPDLOG_INFO("loading ov::Model for model: {} basepath: {} <> {} version: {}", getName(), getPath(), this->config.getBasePath().c_str(), getVersion());
 
@@ -678,10 +813,23 @@ Status ModelInstance::loadOVModelUsingCustomLoader() {
             throw std::invalid_argument("customloader not exisiting");
         }
 
-        CustomLoaderStatus res = customLoaderInterfacePtr->loadModel(this->config.getName(),
-            this->config.getBasePath(),
-            getVersion(),
-            this->config.getCustomLoaderOptionsConfigStr(), modelBinary, weights);
+        CustomLoaderStatus res;
+        auto customLoaderInterfaceV2Ptr = customloaders.findV2(loaderName);
+        if (customLoaderInterfaceV2Ptr != nullptr) {
+            res = customLoaderInterfaceV2Ptr->loadModelBuffers(this->config.getName(),
+                this->config.getBasePath(),
+                getVersion(),
+                this->config.getCustomLoaderOptionsConfigStr(), modelBuffer, weights);
+        } else {
+            auto modelVector = std::make_shared<std::vector<uint8_t>>();
+            auto weightsVector = std::make_shared<std::vector<uint8_t>>();
+            res = customLoaderInterfacePtr->loadModel(this->config.getName(),
+                this->config.getBasePath(),
+                getVersion(),
+                this->config.getCustomLoaderOptionsConfigStr(), *modelVector, *weightsVector);
+            modelBuffer = CustomLoaderBuffer(std::move(modelVector));
+            weights = CustomLoaderBuffer(std::move(weightsVector));
+        }
 
         if (res == CustomLoaderStatus::MODEL_LOAD_ERROR) {
             return StatusCode::FILE_INVALID;
@@ -691,16 +839,40 @@ Status ModelInstance::loadOVModelUsingCustomLoader() {
             return StatusCode::INTERNAL_ERROR;
         }
 
-        std::string strModel(modelBinary.begin(), modelBinary.end());
+        if ((modelBuffer.data == nullptr) && (modelBuffer.size > 0)) {
+            SPDLOG_ERROR("Custom loader: {} returned empty model buffer for model: {} version: {}", loaderName, getName(), getVersion());
+            return StatusCode::INTERNAL_ERROR;
+        }
+
+        if (res == CustomLoaderStatus::MODEL_TYPE_BLOB) {
+            CustomLoaderBufferStreamBuf blobBuffer(modelBuffer);
+            std::istream blobStream(&blobBuffer);
+            plugin_config_t pluginConfig = prepareDefaultPluginConfig(this->config);
+            if (tunedStreams.has_value()) {
+                setNumberOfStreams(pluginConfig, tunedStreams.value());
+            }
+            OV_LOGGER("ov::Core: {}, targetDevice: {}, ieCore.import_model(blobStream, targetDevice, pluginConfig)", reinterpret_cast<void*>(&ieCore), this->targetDevice);
+            compiledModel = std::make_shared<ov::CompiledModel>(ieCore.import_model(blobStream, this->targetDevice, pluginConfig));
+            model.reset();
+            return StatusCode::OK;
+        }
 
+        // only model topology is copied, weights are used directly from loader memory
+        std::string strModel(reinterpret_cast<const char*>(modelBuffer.data), modelBuffer.size);
+        std::shared_ptr<ov::Model> loadedModel;
         if (res == CustomLoaderStatus::MODEL_TYPE_IR) {
-            ov::Tensor tensorWts(ov::element::u8, ov::Shape{weights.size()});
-            std::memcpy(tensorWts.data(), weights.data(), weights.size());
-            model = ieCore.read_model(strModel, tensorWts);
+            ov::Tensor tensorWts(ov::element::u8, ov::Shape{weights.size}, const_cast<uint8_t*>(weights.data));
+            loadedModel = ieCore.read_model(strModel, tensorWts);
         } else if (res == CustomLoaderStatus::MODEL_TYPE_ONNX) {
-            model = ieCore.read_model(strModel, ov::Tensor());
-        } else if (res == CustomLoaderStatus::MODEL_TYPE_BLOB) {
-            return StatusCode::INTERNAL_ERROR;
+            loadedModel = ieCore.read_model(strModel, ov::Tensor());
+        }
+        if (loadedModel) {
+            // loader memory is released together with the model which references it
+            ov::Model* rawModel = loadedModel.get();
+            model = std::shared_ptr<ov::Model>(rawModel, [loadedModel = std::move(loadedModel), weightsOwner = std::move(weights.owner)](ov::Model*) mutable {
+                loadedModel.reset();
+                weightsOwner.reset();
+            });
         }
     } catch (ov::Exception& e) {
         SPDLOG_ERROR("Error: {}; occurred during loading ov::Model for model: {} version: {}", e.what(), getName(), getVersion());
@@ -719,6 +891,12 @@ void ModelInstance::loadCompiledModelPtr(const plugin_config_t& pluginConfig) {
 
 plugin_config_t ModelInstance::prepareDefaultPluginConfig(const ModelConfig& config) {
     plugin_config_t pluginConfig = config.getPluginConfig();
+    // CPU plugin respects affinity but not cgroup quota and would size its thread pools to all host cores.
+    // Virtual devices (AUTO, HETERO, MULTI) do not accept INFERENCE_NUM_THREADS, it has to be set for them in plugin config.
+    const auto& topology = getCpuTopology();
+    if ((config.getTargetDevice() == "CPU") && topology.isQuotaLimited() && (pluginConfig.count("INFERENCE_NUM_THREADS") == 0)) {
+        pluginConfig["INFERENCE_NUM_THREADS"] = std::to_string(topology.availableCores);
+    }
     if ((pluginConfig.count("NUM_STREAMS") == 1) || (pluginConfig.count("PERFORMANCE_HINT") == 1)) {
         return pluginConfig;
     } else {
@@ -729,6 +907,9 @@ plugin_config_t ModelInstance::prepareDefaultPluginConfig(const ModelConfig& con
 
 Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
     plugin_config_t pluginConfig = prepareDefaultPluginConfig(config);
+    if (tunedStreams.has_value()) {
+        setNumberOfStreams(pluginConfig, tunedStreams.value());
+    }
     try {
         loadCompiledModelPtr(pluginConfig);
     } catch (ov::Exception& e) {
@@ -829,6 +1010,179 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     return StatusCode::OK;
 }
 
+void ModelInstance::prepareResponseCache(const ModelConfig& config) {
+    if (config.getResponseCacheSizeMb() == 0) {
+        responseCache.reset();
+        return;
+    }
+    // recreated on every load so that responses of previous model are never returned
+    responseCache = std::make_unique<ResponseCache>(
+        config.getResponseCacheSizeMb() * 1024 * 1024,
+        std::chrono::seconds(config.getResponseCacheTtlSeconds()),
+        this->getMetricReporter().responseCacheHits.get(),
+        this->getMetricReporter().responseCacheMisses.get(),
+        this->getMetricReporter().responseCacheEvictions.get());
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Response cache enabled for model: {}; version: {}; max size: {} MB; ttl: {} s",
+        getName(), getVersion(), config.getResponseCacheSizeMb(), config.getResponseCacheTtlSeconds());
+}
+
+static std::string getWarmupSamplesDirectory(const ModelConfig& config) {
+    if (!config.isWarmupSampleFilesUsed()) {
+        return "";
+    }
+    return FileSystem::joinPath({config.getPath(), WARMUP_SAMPLES_DIRECTORY});
+}
+
+void ModelInstance::warmUpModel(const ModelConfig& config, const DynamicModelParameter& parameter) {
+    this->status.setWarmupTime(std::chrono::microseconds(0));
+    SET_IF_ENABLED(this->getMetricReporter().warmupTime, 0);
+    if (config.getWarmupIterations() == 0) {
+        return;
+    }
+    if (parameter.isBatchSizeRequested() || parameter.isAnyShapeRequested()) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Skipping warm-up of model: {}; version: {} reloaded for request batch size or shape", getName(), getVersion());
+        return;
+    }
+    const std::string samplesDirectory = getWarmupSamplesDirectory(config);
+    const uint32_t numberOfParallelInferRequests = getNumOfParallelInferRequests(config);
+    std::vector<ov::InferRequest*> inferRequests;
+    for (uint32_t i = 0; i < numberOfParallelInferRequests; ++i) {
+        inferRequests.push_back(&inferRequestsQueue->getInferRequest(i));
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Warming up model: {}; version: {}; iterations: {}; infer requests: {}; inputs: {}",
+        getName(), getVersion(), config.getWarmupIterations(), inferRequests.size(), samplesDirectory.empty() ? "random" : samplesDirectory);
+    auto start = std::chrono::high_resolution_clock::now();
+    try {
+        warmUpInferRequests(inferRequests, getInputsInfo(), config.getWarmupIterations(), samplesDirectory);
+    } catch (const std::exception& e) {
+        // model is still usable, only first requests will be slower
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Warm-up of model: {}; version: {} failed: {}", getName(), getVersion(), e.what());
+        return;
+    }
+    auto warmupTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+    this->status.setWarmupTime(warmupTime);
+    SET_IF_ENABLED(this->getMetricReporter().warmupTime, warmupTime.count());
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Warm-up of model: {}; version: {} finished in: {} ms", getName(), getVersion(), warmupTime.count() / 1000);
+}
+
+void ModelInstance::prepareAutoTuner(const ModelConfig& config) {
+    if (!config.getAutoTuneConfig().has_value()) {
+        autoTuner.reset();
+        return;
+    }
+    if (!this->model) {
+        // imported compiled blob cannot be compiled again with different settings
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Auto-tuning is not supported for model: {}; version: {}; imported from compiled blob",
+            getName(), getVersion());
+        autoTuner.reset();
+        return;
+    }
+    const AutoTuneConfig& autoTuneConfig = config.getAutoTuneConfig().value();
+    AutoTuneSettings settings;
+    settings.nireq = getNumOfParallelInferRequests(config);
+    settings.streams = getNumOfStreams();
+    autoTuner = std::make_unique<ModelAutoTuner>(autoTuneConfig, settings);
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Auto-tuning enabled for model: {}; version: {}; {}; nireq bounds: [{}, {}]; max streams: {}; interval: {} s",
+        getName(), getVersion(), settings.toString(), autoTuneConfig.minNireq, autoTuneConfig.maxNireq, autoTuneConfig.maxStreams, autoTuneConfig.intervalSeconds);
+}
+
+void ModelInstance::prepareHedgingPolicy(const ModelConfig& config) {
+    if (!config.getHedgingConfig().has_value()) {
+        hedgingPolicy.reset();
+        return;
+    }
+    const HedgingConfig& hedgingConfig = config.getHedgingConfig().value();
+    hedgingPolicy = std::make_unique<HedgingPolicy>(hedgingConfig);
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Hedging enabled for model: {}; version: {}; latency percentile: {}; max extra load: {}",
+        getName(), getVersion(), hedgingConfig.latencyPercentile, hedgingConfig.maxExtraLoad);
+}
+
+void ModelInstance::autoTune() {
+    AutoTuneSettings previous;
+    AutoTuneSettings next;
+    ModelConfig currentConfig;
+    std::shared_ptr<ov::Model> currentModel;
+    std::shared_ptr<ov::CompiledModel> currentCompiledModel;
+    tensor_map_t currentInputsInfo;
+    {
+        // skip evaluation when model is being loaded, it will be evaluated in next cycle
+        std::unique_lock<std::recursive_mutex> loadingLock(loadingMutex, std::try_to_lock);
+        if (!loadingLock.owns_lock() || !autoTuner || !this->model || getStatus().getState() != ModelVersionState::AVAILABLE) {
+            return;
+        }
+        previous = autoTuner->getSettings();
+        auto proposed = autoTuner->evaluate();
+        if (!proposed.has_value() || proposed.value() == previous) {
+            return;
+        }
+        next = proposed.value();
+        currentConfig = this->config;
+        currentModel = this->model;
+        currentCompiledModel = this->compiledModel;
+        currentInputsInfo = getInputsInfo();
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Auto-tuning model: {}; version: {}; {} -> {}", getName(), getVersion(), previous.toString(), next.toString());
+    // compilation and warm-up do not hold loading lock, so that reloads and unloads are not blocked meanwhile
+    std::shared_ptr<ov::CompiledModel> tunedCompiledModel = currentCompiledModel;
+    std::unique_ptr<OVInferRequestsQueue> tunedInferRequestsQueue;
+    auto status = prepareAutoTuneSettings(currentConfig, currentModel, currentInputsInfo, previous, next, tunedCompiledModel, tunedInferRequestsQueue);
+    std::unique_lock<std::recursive_mutex> loadingLock(loadingMutex);
+    // model reloaded or unloaded meanwhile has new auto-tuner and prepared settings are outdated
+    if (this->compiledModel != currentCompiledModel || getStatus().getState() != ModelVersionState::AVAILABLE) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Model: {}; version: {} changed during auto-tuning, discarding {}", getName(), getVersion(), next.toString());
+        return;
+    }
+    if (!status.ok()) {
+        autoTuner->rejectSettings(previous);
+        return;
+    }
+    applyAutoTuneSettings(previous, next, std::move(tunedCompiledModel), std::move(tunedInferRequestsQueue));
+}
+
+Status ModelInstance::prepareAutoTuneSettings(const ModelConfig& config, const std::shared_ptr<ov::Model>& model, const tensor_map_t& inputsInfo,
+    const AutoTuneSettings& previous, const AutoTuneSettings& next,
+    std::shared_ptr<ov::CompiledModel>& tunedCompiledModel, std::unique_ptr<OVInferRequestsQueue>& tunedInferRequestsQueue) {
+    try {
+        if (next.streams != previous.streams) {
+            plugin_config_t pluginConfig = prepareDefaultPluginConfig(config);
+            setNumberOfStreams(pluginConfig, next.streams);
+            OV_LOGGER("ov::Core: {}, ov::Model: {}, targetDevice: {}, ieCore.compile_model(model, targetDevice, pluginConfig", reinterpret_cast<void*>(&ieCore), reinterpret_cast<void*>(model.get()), this->targetDevice);
+            tunedCompiledModel = std::make_shared<ov::CompiledModel>(ieCore.compile_model(model, this->targetDevice, pluginConfig));
+        }
+        tunedInferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*tunedCompiledModel, next.nireq);
+        if (config.getWarmupIterations() > 0) {
+            std::vector<ov::InferRequest*> inferRequests;
+            for (uint32_t i = 0; i < next.nireq; ++i) {
+                inferRequests.push_back(&tunedInferRequestsQueue->getInferRequest(i));
+            }
+            warmUpInferRequests(inferRequests, inputsInfo, config.getWarmupIterations(), getWarmupSamplesDirectory(config));
+        }
+    } catch (const std::exception& e) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Auto-tuning model: {}; version: {} to {} failed: {}", getName(), getVersion(), next.toString(), e.what());
+        return StatusCode::CANNOT_COMPILE_MODEL_INTO_TARGET_DEVICE;
+    }
+    return StatusCode::OK;
+}
+
+void ModelInstance::applyAutoTuneSettings(const AutoTuneSettings& previous, const AutoTuneSettings& next,
+    std::shared_ptr<ov::CompiledModel> tunedCompiledModel, std::unique_ptr<OVInferRequestsQueue> tunedInferRequestsQueue) {
+    // only the swap blocks incoming requests
+    this->status.setLoading();
+    while (!canUnloadInstance()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(UNLOAD_AVAILABILITY_CHECKING_INTERVAL_MILLISECONDS));
+    }
+    this->compiledModel = std::move(tunedCompiledModel);
+    this->inferRequestsQueue = std::move(tunedInferRequestsQueue);
+    tunedNireq = next.nireq;
+    if (next.streams != previous.streams) {
+        tunedStreams = next.streams;
+    }
+    SET_IF_ENABLED(this->getMetricReporter().streams, next.streams);
+    SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, next.nireq);
+    this->status.setAvailable();
+    modelLoadedNotify.notify_all();
+}
+
 void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicModelParameter& parameter) {
     if (parameter.isBatchSizeRequested()) {
         OV_LOGGER("ov::Model: {}, ov::set_batch({})", reinterpret_cast<void*>(this->model.get()), parameter.getBatchSize());
@@ -873,21 +1227,37 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             return status;
         }
 
-        status = loadTensors(this->config, needsToApplyLayoutConfiguration, parameter);
-        if (!status.ok()) {
-            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
-            return status;
-        }
-        status = loadOVCompiledModel(this->config);
-        if (!status.ok()) {
-            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
-            return status;
+        if (!this->model && this->compiledModel) {
+            // compiled blob imported by custom loader
+            status = loadImportedTensors(this->config);
+            if (!status.ok()) {
+                this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+                return status;
+            }
+            SET_IF_ENABLED(getMetricReporter().streams, getNumOfStreams());
+        } else {
+            status = loadTensors(this->config, needsToApplyLayoutConfiguration, parameter);
+            if (!status.ok()) {
+                this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+                return status;
+            }
+            status = loadOVCompiledModel(this->config);
+            if (!status.ok()) {
+                this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+                return status;
+            }
         }
+        this->inputsDescriptors = TensorDescriptorTable(this->inputsInfo, this->config.getShapes());
+        this->metadataCache = std::make_unique<const ModelMetadataCache>(getName(), getVersion(), getInputsInfo(), getOutputsInfo());
         status = prepareInferenceRequestsQueue(this->config);
         if (!status.ok()) {
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        prepareResponseCache(this->config);
+        warmUpModel(this->config, parameter);
+        prepareAutoTuner(this->config);
+        prepareHedgingPolicy(this->config);
     } catch (const ov::Exception& e) {
         SPDLOG_ERROR("exception occurred while loading model: {}", e.what());
         this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
@@ -939,6 +1309,8 @@ Status ModelInstance::loadModel(const ModelConfig& config) {
     }
     this->status = ModelVersionStatus(config.getName(), config.getVersion());
     this->status.setLoading();
+    tunedNireq.reset();
+    tunedStreams.reset();
     return loadModelImpl(config);
 }
 
@@ -955,6 +1327,11 @@ Status ModelInstance::reloadModel(const ModelConfig& config, const DynamicModelP
         isCustomLoaderConfigChanged = false;
         retireModel(isCustomLoaderConfigChanged);
     }
+    if (this->config.isReloadRequired(config)) {
+        // settings were tuned for previous configuration
+        tunedNireq.reset();
+        tunedStreams.reset();
+    }
     return loadModelImpl(config, parameter);
 }
 
@@ -1124,10 +1501,15 @@ void ModelInstance::unloadModelComponents() {
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, 0);
     SET_IF_ENABLED(this->getMetricReporter().streams, 0);
     inferRequestsQueue.reset();
+    responseCache.reset();
+    metadataCache.reset();
+    // tensors still held by clients return their buffers to the pool which is released with the last of them
+    tensorMemoryPool->clear();
     compiledModel.reset();
     model.reset();
     outputsInfo.clear();
     inputsInfo.clear();
+    inputsDescriptors = TensorDescriptorTable();
     modelFiles.clear();
 
     if (this->config.isCustomLoaderRequiredToLoadModel()) {
@@ -1143,7 +1525,7 @@ void ModelInstance::unloadModelComponents() {
             customLoaderInterfacePtr->unloadModel(getName(), getVersion());
         }
     }
-    malloc_trim(0);
+    releaseFreeMemory();
 }
 
 const std::set<std::string>& ModelInstance::getOptionalInputNames() {
@@ -1154,9 +1536,19 @@ const std::set<std::string>& ModelInstance::getOptionalInputNames() {
 template <typename RequestType>
 const Status ModelInstance::validate(const RequestType* request) {
     OVMS_PROFILE_FUNCTION();
+    const tensor_map_t& inputsInfo = getInputsInfo();
+    if (this->inputsDescriptors.describes(inputsInfo)) {
+        return request_validation_utils::validate(
+            *request,
+            this->inputsDescriptors,
+            getName(),
+            getVersion(),
+            this->getOptionalInputNames(),
+            getModelConfig().getBatchingMode());
+    }
     return request_validation_utils::validate(
         *request,
-        getInputsInfo(),
+        inputsInfo,
         getName(),
         getVersion(),
         this->getOptionalInputNames(),
@@ -1188,6 +1580,9 @@ Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
         timer.stop(INFER);
         double inferTime = timer.elapsed<std::chrono::microseconds>(INFER);
         OBSERVE_IF_ENABLED(this->getMetricReporter().inferenceTime, inferTime);
+        if (this->autoTuner) {
+            this->autoTuner->recordInferenceTime(inferTime);
+        }
     } catch (const ov::Exception& e) {
         Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
         SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
@@ -1196,6 +1591,158 @@ Status ModelInstance::performInference(ov::InferRequest& inferRequest) {
     return StatusCode::OK;
 }
 
+Status ModelInstance::performHedgedInference(ov::InferRequest& inferRequest, HedgeStreamGuard& hedgeGuard) {
+    OVMS_PROFILE_FUNCTION();
+    const auto hedgeDelay = this->hedgingPolicy->getHedgeDelay();
+    if (!hedgeDelay.has_value()) {
+        // not enough inference times collected yet
+        Timer<1> timer;
+        timer.start(0);
+        auto status = performInference(inferRequest);
+        timer.stop(0);
+        if (status.ok()) {
+            this->hedgingPolicy->recordInferenceTime(timer.elapsed<std::chrono::microseconds>(0));
+        }
+        return status;
+    }
+    enum : int {
+        PRIMARY,
+        HEDGE,
+        REQUESTS_COUNT
+    };
+    struct HedgingState {
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool finished[REQUESTS_COUNT] = {false, false};
+        std::exception_ptr errors[REQUESTS_COUNT];
+        int winner = -1;
+    };
+    auto state = std::make_shared<HedgingState>();
+    auto createCallback = [state](int index) {
+        return [state, index](std::exception_ptr error) {
+            std::unique_lock<std::mutex> lock(state->mtx);
+            state->finished[index] = true;
+            state->errors[index] = error;
+            if (!error && state->winner < 0) {
+                state->winner = index;
+            }
+            state->cv.notify_all();
+        };
+    };
+    auto resetCallback = [](ov::InferRequest& request) {
+        request.set_callback([](std::exception_ptr) {});
+    };
+    bool hedgeStarted = false;
+    const auto start = std::chrono::high_resolution_clock::now();
+    try {
+        inferRequest.set_callback(createCallback(PRIMARY));
+        OV_LOGGER("ov::InferRequest: {}, inferRequest.start_async()", reinterpret_cast<void*>(&inferRequest));
+        inferRequest.start_async();
+    } catch (const ov::Exception& e) {
+        resetCallback(inferRequest);
+        Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+        return status;
+    }
+    std::unique_lock<std::mutex> lock(state->mtx);
+    bool primaryFinished = state->cv.wait_for(lock, hedgeDelay.value(), [&state]() { return state->finished[PRIMARY]; });
+    lock.unlock();
+    // budget is checked before taking idle infer request so it is not held when hedge is not allowed
+    if (!primaryFinished && this->hedgingPolicy->tryAcquireHedge()) {
+        if (hedgeGuard.tryAcquire()) {
+            ov::InferRequest& hedgeRequest = hedgeGuard.getInferRequest();
+            try {
+                for (const auto& input : this->compiledModel->inputs()) {
+                    hedgeRequest.set_tensor(input, inferRequest.get_tensor(input));
+                }
+                hedgeRequest.set_callback(createCallback(HEDGE));
+                OV_LOGGER("ov::InferRequest: {}, hedgeRequest.start_async()", reinterpret_cast<void*>(&hedgeRequest));
+                hedgeRequest.start_async();
+                hedgeStarted = true;
+                SPDLOG_DEBUG("Hedging inference in model {}, version {} after {} us", getName(), getVersion(), hedgeDelay.value().count());
+            } catch (const ov::Exception& e) {
+                SPDLOG_DEBUG("Could not start hedged inference in model {}, version {}: {}", getName(), getVersion(), e.what());
+                resetCallback(hedgeRequest);
+            }
+            if (!hedgeStarted) {
+                hedgeGuard.release();
+            }
+        }
+        if (!hedgeStarted) {
+            this->hedgingPolicy->releaseHedge();
+        }
+    }
+    lock.lock();
+    state->cv.wait(lock, [&state, hedgeStarted]() {
+        return state->winner >= 0 || (state->finished[PRIMARY] && (!hedgeStarted || state->finished[HEDGE]));
+    });
+    const int winner = state->winner;
+    const auto inferTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start).count();
+    lock.unlock();
+    if (hedgeStarted) {
+        ov::InferRequest& loser = (winner == HEDGE) ? inferRequest : hedgeGuard.getInferRequest();
+        try {
+            loser.cancel();
+        } catch (const ov::Exception& e) {
+            SPDLOG_DEBUG("Cancelling hedged inference in model {}, version {} failed: {}", getName(), getVersion(), e.what());
+        }
+        // infer request cannot be reused until its callback is called
+        lock.lock();
+        state->cv.wait(lock, [&state]() { return state->finished[PRIMARY] && state->finished[HEDGE]; });
+        lock.unlock();
+        resetCallback(hedgeGuard.getInferRequest());
+    }
+    resetCallback(inferRequest);
+    if (winner < 0) {
+        try {
+            std::rethrow_exception(state->errors[PRIMARY]);
+        } catch (const ov::Exception& e) {
+            Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+            SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+            return status;
+        } catch (...) {
+            Status status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+            SPDLOG_ERROR("Async caught an exception {}", status.string());
+            return status;
+        }
+    }
+    if (winner == HEDGE) {
+        hedgeGuard.setCompleted();
+        SPDLOG_DEBUG("Hedged inference finished first in model {}, version {}", getName(), getVersion());
+    }
+    OBSERVE_IF_ENABLED(this->getMetricReporter().inferenceTime, inferTime);
+    if (this->autoTuner) {
+        this->autoTuner->recordInferenceTime(inferTime);
+    }
+    this->hedgingPolicy->recordInferenceTime(inferTime);
+    return StatusCode::OK;
+}
+
+static std::optional<ResponseCacheKey> getResponseCacheKey(const tensorflow::serving::PredictRequest& request) {
+    return computeResponseCacheKey(request);
+}
+static std::optional<ResponseCacheKey> getResponseCacheKey(const KFSRequest& request) {
+    return computeResponseCacheKey(request);
+}
+static std::optional<ResponseCacheKey> getResponseCacheKey(const InferenceRequest& request) {
+    // C-API responses hold buffers owned by the caller and are not cached
+    return std::nullopt;
+}
+
+template <typename ResponseType>
+static bool findCachedResponse(ResponseCache& cache, const ResponseCacheKey& key, ResponseType* response) {
+    return cache.find(key, response);
+}
+static bool findCachedResponse(ResponseCache& cache, const ResponseCacheKey& key, InferenceResponse* response) {
+    return false;
+}
+
+template <typename ResponseType>
+static void insertCachedResponse(ResponseCache& cache, ResponseCacheKey key, const ResponseType& response) {
+    cache.insert(std::move(key), std::make_shared<const ResponseType>(response));
+}
+static void insertCachedResponse(ResponseCache& cache, ResponseCacheKey key, const InferenceResponse& response) {}
+
 template <typename RequestType, typename ResponseType>
 Status ModelInstance::infer(const RequestType* requestProto,
     ResponseType* responseProto,
@@ -1218,6 +1765,23 @@ Status ModelInstance::infer(const RequestType* requestProto,
     }
     if (!status.ok())
         return status;
+
+    std::optional<ResponseCacheKey> responseCacheKey;
+    if (this->responseCache) {
+        responseCacheKey = getResponseCacheKey(*requestProto);
+    }
+    if (responseCacheKey.has_value()) {
+        timer.start(PREDICTION);
+        const bool cacheHit = findCachedResponse(*this->responseCache, responseCacheKey.value(), responseProto);
+        timer.stop(PREDICTION);
+        if (cacheHit) {
+            // time of serving from cache is reported as inference time, so latency metrics include hits
+            OBSERVE_IF_ENABLED(this->getMetricReporter().inferenceTime, timer.elapsed<microseconds>(PREDICTION));
+            SPDLOG_DEBUG("Response cache hit in model {}, version {}", getName(), getVersion());
+            return StatusCode::OK;
+        }
+    }
+
     status = requestProcessor->prepare();
     if (!status.ok())
         return status;
@@ -1231,6 +1795,9 @@ Status ModelInstance::infer(const RequestType* requestProto,
     timer.stop(GET_INFER_REQUEST);
     double getInferRequestTime = timer.elapsed<microseconds>(GET_INFER_REQUEST);
     OBSERVE_IF_ENABLED(this->getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    if (this->autoTuner) {
+        this->autoTuner->recordWaitTime(getInferRequestTime);
+    }
     SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, getInferRequestTime / 1000);
 
@@ -1245,7 +1812,7 @@ Status ModelInstance::infer(const RequestType* requestProto,
     timer.start(DESERIALIZE);
     InputSink<ov::InferRequest&> inputSink(inferRequest);
     bool isPipeline = false;
-    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline);
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator>(*requestProto, getInputsInfo(), inputSink, isPipeline, getTensorAllocator());
     timer.stop(DESERIALIZE);
     if (!status.ok())
         return status;
@@ -1253,7 +1820,12 @@ Status ModelInstance::infer(const RequestType* requestProto,
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
 
     timer.start(PREDICTION);
-    status = performInference(inferRequest);
+    HedgeStreamGuard hedgeGuard(getInferRequestsQueue(), this->getMetricReporter());
+    if (this->hedgingPolicy) {
+        status = performHedgedInference(inferRequest, hedgeGuard);
+    } else {
+        status = performInference(inferRequest);
+    }
     timer.stop(PREDICTION);
     if (!status.ok())
         return status;
@@ -1261,16 +1833,20 @@ Status ModelInstance::infer(const RequestType* requestProto,
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
 
     timer.start(SERIALIZE);
-    OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+    ov::InferRequest& completedRequest = hedgeGuard.getCompletedRequest(inferRequest);
+    OutputGetter<ov::InferRequest&> outputGetter(completedRequest);
     status = serializePredictResponse(outputGetter, getName(), getVersion(), getOutputsInfo(), responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
     timer.stop(SERIALIZE);
     if (!status.ok())
         return status;
     SPDLOG_DEBUG("Serialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         getName(), getVersion(), executingInferId, timer.elapsed<microseconds>(SERIALIZE) / 1000);
+    if (responseCacheKey.has_value()) {
+        insertCachedResponse(*this->responseCache, std::move(responseCacheKey.value()), *responseProto);
+    }
 
     timer.start(POSTPROCESS);
-    status = requestProcessor->postInferenceProcessing(responseProto, inferRequest);
+    status = requestProcessor->postInferenceProcessing(responseProto, completedRequest);
     timer.stop(POSTPROCESS);
     if (!status.ok())
         return status;
@@ -15,10 +15,12 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
 #include <condition_variable>
 #include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <sstream>
 #include <string>
@@ -28,12 +30,18 @@
 #include <openvino/openvino.hpp>
 
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "model_auto_tuner.hpp"
+#include "model_hedging.hpp"
+#include "model_metadata_cache.hpp"
 #include "model_metric_reporter.hpp"
 #include "modelchangesubscription.hpp"
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "modelversionstatus.hpp"
 #include "ovinferrequestsqueue.hpp"
+#include "response_cache.hpp"
+#include "tensor_descriptor.hpp"
+#include "tensor_memory_pool.hpp"
 #include "tensorinfo.hpp"
 #include "tfs_frontend/tfs_utils.hpp"
 
@@ -44,6 +52,7 @@ class InferenceRequest;
 class InferenceResponse;
 class PipelineDefinition;
 class Status;
+struct HedgeStreamGuard;
 template <typename T1, typename T2>
 struct RequestProcessor;
 
@@ -61,6 +70,9 @@ public:
 
     bool isBatchSizeRequested() const { return batchSize.has_value(); }
     bool isShapeRequested(const std::string& name) const { return shapes.count(name) && shapes.at(name).size() > 0; }
+    bool isAnyShapeRequested() const {
+        return std::any_of(shapes.begin(), shapes.end(), [](const auto& shape) { return shape.second.size() > 0; });
+    }
 
     int getBatchSize() const { return batchSize.value_or(1); }
     const shape_t& getShape(const std::string& name) const { return shapes.at(name); }
@@ -211,6 +223,40 @@ protected:
          */
     Status prepareInferenceRequestsQueue(const ModelConfig& config);
 
+    /**
+         * @brief Creates response cache if enabled in config
+         */
+    void prepareResponseCache(const ModelConfig& config);
+
+    /**
+         * @brief Runs inference on every request from inferenceRequestsQueue if warm-up is enabled in config.
+         * Skipped for reloads triggered by request with auto batch size or shape, as that request waits for reload to finish.
+         */
+    void warmUpModel(const ModelConfig& config, const DynamicModelParameter& parameter);
+
+    /**
+         * @brief Creates auto-tuner if enabled in config
+         */
+    void prepareAutoTuner(const ModelConfig& config);
+
+    /**
+         * @brief Creates hedging policy if enabled in config
+         */
+    void prepareHedgingPolicy(const ModelConfig& config);
+
+    /**
+         * @brief Compiles model and creates infer requests queue with tuned settings, called without holding loading lock
+         */
+    Status prepareAutoTuneSettings(const ModelConfig& config, const std::shared_ptr<ov::Model>& model, const tensor_map_t& inputsInfo,
+        const AutoTuneSettings& previous, const AutoTuneSettings& next,
+        std::shared_ptr<ov::CompiledModel>& tunedCompiledModel, std::unique_ptr<OVInferRequestsQueue>& tunedInferRequestsQueue);
+
+    /**
+         * @brief Replaces compiled model and infer requests queue with ones using tuned settings, requires loading lock
+         */
+    void applyAutoTuneSettings(const AutoTuneSettings& previous, const AutoTuneSettings& next,
+        std::shared_ptr<ov::CompiledModel> tunedCompiledModel, std::unique_ptr<OVInferRequestsQueue> tunedInferRequestsQueue);
+
     /**
          * @brief Fetch model file paths
          *
@@ -234,6 +280,14 @@ protected:
          */
     Status loadOVModelUsingCustomLoader();
 
+    /**
+         * @brief Internal method for loading tensors info of model compiled outside of OVMS and imported by custom loader
+         *
+         * @param config
+         * @return Status
+         */
+    Status loadImportedTensors(const ModelConfig& config);
+
     template <typename RequestType>
     const Status validate(const RequestType* request);
 
@@ -248,6 +302,11 @@ private:
          */
     tensor_map_t inputsInfo;
 
+    /**
+         * @brief Flat descriptors of inputsInfo used by request validation, rebuilt with inputsInfo
+         */
+    TensorDescriptorTable inputsDescriptors;
+
     /**
          * @brief Holds the information about outputs and it's parameters
          */
@@ -258,6 +317,37 @@ private:
          */
     std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
 
+    /**
+         * @brief Cache of inference results for repeated inputs, nullptr when disabled
+         */
+    std::unique_ptr<ResponseCache> responseCache;
+
+    /**
+         * @brief Metadata responses prepared when model is loaded, nullptr when not loaded
+         */
+    std::unique_ptr<const ModelMetadataCache> metadataCache;
+
+    /**
+         * @brief Pool of buffers for tensors created during request deserialization
+         */
+    std::shared_ptr<TensorMemoryPool> tensorMemoryPool;
+
+    /**
+         * @brief Tunes nireq and streams to observed traffic, nullptr when disabled
+         */
+    std::unique_ptr<ModelAutoTuner> autoTuner;
+
+    /**
+         * @brief Decides when inference is duplicated on idle infer request, nullptr when disabled
+         */
+    std::unique_ptr<HedgingPolicy> hedgingPolicy;
+
+    /**
+         * @brief Settings selected by auto-tuner, override values from model config until next config change
+         */
+    std::optional<uint32_t> tunedNireq;
+    std::optional<uint32_t> tunedStreams;
+
     /**
          * @brief Holds current usage count in predict requests
          * 
@@ -342,6 +432,13 @@ public:
         ++predictRequestsHandlesCount;
     }
 
+    /**
+         * @brief Gets number of requests currently holding the instance
+         */
+    uint64_t getPredictRequestsHandlesCount() const {
+        return predictRequestsHandlesCount;
+    }
+
     /**
          * @brief sets the flag in model instance indicating change in custom loader configuration.
 	 */
@@ -485,6 +582,57 @@ public:
         return *inferRequestsQueue;
     }
 
+    /**
+         * @brief Get response cache
+         *
+         * @return ResponseCache or nullptr when response cache is disabled
+         */
+    ResponseCache* getResponseCache() {
+        return responseCache.get();
+    }
+
+    /**
+         * @brief Get metadata responses prepared on model load
+         *
+         * @return ModelMetadataCache or nullptr when model is not loaded
+         */
+    const ModelMetadataCache* getMetadataCache() const {
+        return metadataCache.get();
+    }
+
+    /**
+         * @brief Get auto-tuner
+         *
+         * @return ModelAutoTuner or nullptr when auto-tuning is disabled
+         */
+    ModelAutoTuner* getAutoTuner() {
+        return autoTuner.get();
+    }
+
+    /**
+         * @brief Get hedging policy
+         *
+         * @return HedgingPolicy or nullptr when hedging is disabled
+         */
+    HedgingPolicy* getHedgingPolicy() {
+        return hedgingPolicy.get();
+    }
+
+    /**
+         * @brief Evaluates traffic statistics and applies new nireq and streams if auto-tuner proposes them.
+         * Called periodically by model manager.
+         */
+    void autoTune();
+
+    /**
+         * @brief Get allocator for tensors created out of requests to this model instance
+         *
+         * @return ov::Allocator backed by model instance tensor memory pool
+         */
+    ov::Allocator getTensorAllocator() {
+        return tensorMemoryPool->getAllocator();
+    }
+
     /**
          * @brief Combines plugin config from user with default config calculated at runtime
          *
@@ -569,6 +717,12 @@ public:
 
     Status performInference(ov::InferRequest& inferRequest);
 
+    /**
+         * @brief Runs inference and duplicates it on idle infer request if it exceeds hedging threshold.
+         * Request which finished first is marked in hedgeGuard, the other one is cancelled.
+         */
+    Status performHedgedInference(ov::InferRequest& inferRequest, HedgeStreamGuard& hedgeGuard);
+
     template <typename RequestType, typename ResponseType>
     Status infer(const RequestType* requestProto,
         ResponseType* responseProto,
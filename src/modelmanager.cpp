@@ -35,6 +35,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include "allocator_stats.hpp"
 #include "azurefilesystem.hpp"
 #include "cleaner_utils.hpp"
 #include "config.hpp"
@@ -64,10 +65,12 @@
 #include "s3filesystem.hpp"
 #include "schema.hpp"
 #include "stringutils.hpp"
+#include "traffic_capture.hpp"
 
 namespace ovms {
 
 static constexpr uint16_t MAX_CONFIG_JSON_READ_RETRY_COUNT = 3;
+static constexpr uint32_t AUTO_TUNER_CHECK_INTERVAL_MILLISECONDS = 1000;
 const std::string DEFAULT_MODEL_CACHE_DIRECTORY = "/opt/cache";
 
 ModelManager::ModelManager(const std::string& modelCacheDirectory, MetricRegistry* registry, PythonBackend* pythonBackend) :
@@ -138,7 +141,9 @@ void ModelManager::logPluginConfiguration() {
 
 ModelManager::~ModelManager() {
     join();
+    std::unique_lock modelsLock(modelsMtx);
     models.clear();
+    updateModelsSnapshot();
 }
 
 Status ModelManager::start(const Config& config) {
@@ -150,6 +155,15 @@ Status ModelManager::start(const Config& config) {
         resourcesCleanupIntervalSec = 1;
     }
     Status status;
+    if (!config.trafficCapturePath().empty()) {
+        trafficRecorder = std::make_unique<TrafficRecorder>(config.trafficCapturePath(), config.trafficCaptureRatio());
+        status = trafficRecorder->start();
+        if (!status.ok()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Couldn't start traffic capture to file: {}", config.trafficCapturePath());
+            trafficRecorder.reset();
+            return status;
+        }
+    }
     bool startFromConfigFile = (config.configPath() != "");
     if (startFromConfigFile) {
         status = startFromFile(config.configPath());
@@ -183,6 +197,15 @@ void ModelManager::startCleaner() {
     }
 }
 
+void ModelManager::startAutoTuner() {
+    if (!autoTunerStarted) {
+        std::future<void> exitSignal = autoTunerExitTrigger.get_future();
+        std::thread t(std::thread(&ModelManager::autoTunerRoutine, this, std::move(exitSignal)));
+        autoTunerStarted = true;
+        autoTunerThread = std::move(t);
+    }
+}
+
 Status ModelManager::startFromConfig() {
     auto& config = ovms::Config::instance();
 
@@ -222,6 +245,7 @@ Status ModelManager::startFromConfig() {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Couldn't load metrics settings");
         return status;
     }
+    this->allocatorMetricReporter = std::make_unique<AllocatorMetricReporter>(&this->metricConfig, this->metricRegistry);
 
     ModelConfig& modelConfig = it->second;
 
@@ -595,6 +619,48 @@ Status ModelManager::loadPipelinesConfig(rapidjson::Document& configJson) {
     return firstErrorStatus;
 }
 
+Status ModelManager::loadModelRoutersConfig(rapidjson::Document& configJson) {
+    std::map<std::string, std::shared_ptr<ModelRouter>> routersInConfigFile;
+    Status firstErrorStatus = StatusCode::OK;
+    const auto itrp = configJson.FindMember("model_router_config_list");
+    if (itrp != configJson.MemberEnd() && itrp->value.IsArray()) {
+        for (const auto& routerConfig : itrp->value.GetArray()) {
+            std::shared_ptr<ModelRouter> router;
+            auto status = ModelRouter::parseNode(routerConfig, router);
+            if (!status.ok()) {
+                IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
+                continue;
+            }
+            const auto& routerName = router->getName();
+            bool occupied = modelExists(routerName) || pipelineFactory.definitionExists(routerName) || routersInConfigFile.count(routerName);
+#if (MEDIAPIPE_DISABLE == 0)
+            occupied = occupied || mediapipeFactory.definitionExists(routerName);
+#endif
+            if (occupied) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Model router name: {} is already occupied", routerName);
+                IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(StatusCode::MODEL_ROUTER_NAME_OCCUPIED);
+                continue;
+            }
+            for (const auto& variant : router->getVariants()) {
+                if (!modelExists(variant.modelName)) {
+                    SPDLOG_LOGGER_WARN(modelmanager_logger, "Model router: {} refers to missing model: {}", routerName, variant.modelName);
+                }
+            }
+            SPDLOG_LOGGER_INFO(modelmanager_logger, "Loaded model router: {} with {} variants", routerName, router->getVariants().size());
+            routersInConfigFile.emplace(routerName, std::move(router));
+        }
+    }
+    modelRouters.publish(std::make_unique<const std::map<std::string, std::shared_ptr<ModelRouter>>>(std::move(routersInConfigFile)));
+    return firstErrorStatus;
+}
+
+const std::shared_ptr<ModelRouter> ModelManager::findModelRouterByName(const std::string& name) const {
+    RcuReadGuard guard;
+    const auto& routers = modelRouters.read();
+    auto it = routers.find(name);
+    return it != routers.end() ? it->second : nullptr;
+}
+
 Status ModelManager::createCustomLoader(CustomLoaderConfig& loaderConfig) {
     auto& customloaders = ovms::CustomLoaders::instance();
     std::string loaderName = loaderConfig.getLoaderName();
@@ -611,15 +677,24 @@ Status ModelManager::createCustomLoader(CustomLoaderConfig& loaderConfig) {
             return StatusCode::CUSTOM_LOADER_LIBRARY_INVALID;
         }
 
-        // load the symbols
-        createCustomLoader_t* customObj = (createCustomLoader_t*)dlsym(handleCL, "createCustomLoader");
-        const char* dlsym_error = dlerror();
-        if (dlsym_error || (customObj == nullptr)) {
-            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Cannot load symbol create:  {} ", dlsym_error);
-            return StatusCode::CUSTOM_LOADER_LIBRARY_LOAD_FAILED;
+        // load the symbols, loaders implementing interface v2 provide separate factory
+        std::shared_ptr<CustomLoaderInterface> customLoaderIfPtr;
+        std::shared_ptr<CustomLoaderInterfaceV2> customLoaderV2IfPtr;
+        dlerror();
+        createCustomLoaderV2_t* customObjV2 = (createCustomLoaderV2_t*)dlsym(handleCL, "createCustomLoaderV2");
+        if ((dlerror() == nullptr) && (customObjV2 != nullptr)) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Loader {} implements custom loader interface v2", loaderName);
+            customLoaderV2IfPtr.reset(customObjV2());
+            customLoaderIfPtr = customLoaderV2IfPtr;
+        } else {
+            createCustomLoader_t* customObj = (createCustomLoader_t*)dlsym(handleCL, "createCustomLoader");
+            const char* dlsym_error = dlerror();
+            if (dlsym_error || (customObj == nullptr)) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "Cannot load symbol create:  {} ", dlsym_error);
+                return StatusCode::CUSTOM_LOADER_LIBRARY_LOAD_FAILED;
+            }
+            customLoaderIfPtr.reset(customObj());
         }
-
-        std::shared_ptr<CustomLoaderInterface> customLoaderIfPtr{customObj()};
         try {
             customLoaderIfPtr->loaderInit(loaderConfig.getLoaderConfigFile());
         } catch (std::exception& e) {
@@ -629,7 +704,11 @@ Status ModelManager::createCustomLoader(CustomLoaderConfig& loaderConfig) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Cannot create or initialize the custom loader");
             return StatusCode::CUSTOM_LOADER_INIT_FAILED;
         }
-        customloaders.add(loaderName, customLoaderIfPtr, handleCL);
+        if (customLoaderV2IfPtr) {
+            customloaders.addV2(loaderName, customLoaderV2IfPtr, handleCL);
+        } else {
+            customloaders.add(loaderName, customLoaderIfPtr, handleCL);
+        }
     } else {
         // Loader is already in the existing loaders. Move it to new loaders.
         // Reload of customloader is not supported yet
@@ -928,6 +1007,7 @@ Status ModelManager::loadConfig(const std::string& jsonFilename) {
         }
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reading metric config only once per server start.");
         this->metricConfigLoadedOnce = true;
+        this->allocatorMetricReporter = std::make_unique<AllocatorMetricReporter>(&this->metricConfig, this->metricRegistry);
     } else {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Reading metric from config json file skipped. Settings already loaded.");
     }
@@ -974,6 +1054,10 @@ Status ModelManager::loadConfig(const std::string& jsonFilename) {
         IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
     }
 #endif
+    status = loadModelRoutersConfig(configJson);
+    if (!status.ok()) {
+        IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
+    }
     status = tryReloadGatedModelConfigs(gatedModelConfigs);
     if (!status.ok()) {
         IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
@@ -1100,6 +1184,30 @@ void ModelManager::cleanerRoutine(uint32_t resourcesCleanupIntervalSec, uint32_t
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Stopped cleaner thread");
 }
 
+void ModelManager::autoTunerRoutine(std::future<void> autoTunerExitSignal) {
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Started auto-tuner thread");
+    // each model version closes evaluation windows in its own interval
+    while (autoTunerExitSignal.wait_for(std::chrono::milliseconds(AUTO_TUNER_CHECK_INTERVAL_MILLISECONDS)) == std::future_status::timeout) {
+        std::vector<std::shared_ptr<Model>> modelsToTune;
+        {
+            std::shared_lock modelsLock(modelsMtx);
+            modelsToTune.reserve(models.size());
+            for (const auto& [name, model] : models) {
+                modelsToTune.push_back(model);
+            }
+        }
+        for (const auto& model : modelsToTune) {
+            for (const auto& [version, instance] : model->getModelVersionsMapCopy()) {
+                auto modelInstance = model->getModelInstanceByVersion(version);
+                if (modelInstance) {
+                    modelInstance->autoTune();
+                }
+            }
+        }
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Stopped auto-tuner thread");
+}
+
 void cleanerRoutine(uint32_t resourcesCleanupInterval, FunctorResourcesCleaner& functorResourcesCleaner, uint32_t sequenceCleanerInterval, FunctorSequenceCleaner& functorSequenceCleaner, std::future<void>& cleanerExitSignal) {
     uint32_t currentResourcesWaitTime = resourcesCleanupInterval;
     uint32_t currentSequenceWaitTime = sequenceCleanerInterval;
@@ -1158,6 +1266,11 @@ void ModelManager::join() {
         }
     }
 
+    // auto-tuner may be started by config reload in watcher thread, so it is stopped after watcher
+    if (autoTunerStarted) {
+        autoTunerExitTrigger.set_value();
+    }
+
     if (cleanerStarted) {
         if (cleanerThread.joinable()) {
             cleanerThread.join();
@@ -1165,6 +1278,14 @@ void ModelManager::join() {
             SPDLOG_INFO("Shutdown cleaner thread");
         }
     }
+
+    if (autoTunerStarted) {
+        if (autoTunerThread.joinable()) {
+            autoTunerThread.join();
+            autoTunerStarted = false;
+            SPDLOG_INFO("Shutdown auto-tuner thread");
+        }
+    }
 }
 
 void ModelManager::getVersionsToChange(
@@ -1272,10 +1393,15 @@ std::shared_ptr<ovms::Model> ModelManager::getModelIfExistCreateElse(const std::
     auto modelIt = models.find(modelName);
     if (models.end() == modelIt) {
         models.insert({modelName, modelFactory(modelName, isStateful)});
+        updateModelsSnapshot();
     }
     return models[modelName];
 }
 
+void ModelManager::updateModelsSnapshot() {
+    modelsSnapshot.publish(std::make_unique<const std::map<std::string, std::shared_ptr<Model>>>(models));
+}
+
 std::shared_ptr<FileSystem> ModelManager::getFilesystem(const std::string& basePath) {
     if (basePath.rfind(FileSystem::S3_URL_PREFIX, 0) == 0) {
         Aws::SDKOptions options;
@@ -1413,6 +1539,11 @@ Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
         return StatusCode::REQUESTED_MODEL_TYPE_CHANGE;
     }
 
+    if (config.getAutoTuneConfig().has_value()) {
+        // started on first model requiring it, servers without auto_tune do not run the thread
+        startAutoTuner();
+    }
+
     auto model = getModelIfExistCreateElse(config.getName(), config.isStateful());
     if (model->isAnyVersionSubscribed()) {
         if (config.isDynamicParameterEnabled()) {
@@ -1525,9 +1656,10 @@ Status ModelManager::reloadModelWithVersions(ModelConfig& config) {
 }
 
 const std::shared_ptr<Model> ModelManager::findModelByName(const std::string& name) const {
-    std::shared_lock lock(modelsMtx);
-    auto it = models.find(name);
-    return it != models.end() ? it->second : nullptr;
+    RcuReadGuard guard;
+    const auto& snapshot = modelsSnapshot.read();
+    auto it = snapshot.find(name);
+    return it != snapshot.end() ? it->second : nullptr;
 }
 
 Status ModelManager::getModelInstance(const std::string& modelName,
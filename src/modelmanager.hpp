@@ -38,6 +38,8 @@
 #endif
 #include "metric_config.hpp"
 #include "model.hpp"
+#include "model_router.hpp"
+#include "rcu_snapshot.hpp"
 #include "status.hpp"
 
 namespace ovms {
@@ -45,6 +47,7 @@ namespace ovms {
 const uint32_t DEFAULT_WAIT_FOR_MODEL_LOADED_TIMEOUT_MS = 10000;
 extern const std::string DEFAULT_MODEL_CACHE_DIRECTORY;
 
+class AllocatorMetricReporter;
 class Config;
 class CNLIMWrapper;
 class CustomLoaderConfig;
@@ -56,6 +59,7 @@ class MediapipeGraphExecutor;
 struct FunctorSequenceCleaner;
 struct FunctorResourcesCleaner;
 class PythonBackend;
+class TrafficRecorder;
 /**
  * @brief Model manager is managing the list of model topologies enabled for serving and their versions.
  */
@@ -78,12 +82,26 @@ protected:
      * 
      */
     std::map<std::string, std::shared_ptr<Model>> models;
+
+    /**
+     * @brief Copy of models collection read by request path lookups without locking, published on every change of models
+     */
+    RcuSnapshot<std::map<std::string, std::shared_ptr<Model>>> modelsSnapshot;
+
+    /**
+     * @brief Publishes models collection to request path lookups, requires modelsMtx to be held
+     */
+    void updateModelsSnapshot();
     std::unique_ptr<ov::Core> ieCore;
 
     PipelineFactory pipelineFactory;
 #if (MEDIAPIPE_DISABLE == 0)
     MediapipeFactory mediapipeFactory;
 #endif
+    /**
+     * @brief Model routers read by request path lookups without locking, replaced as a whole on config reload
+     */
+    RcuSnapshot<std::map<std::string, std::shared_ptr<ModelRouter>>> modelRouters;
     std::unique_ptr<CustomNodeLibraryManager> customNodeLibraryManager;
     std::vector<std::shared_ptr<CNLIMWrapper>> resources = {};
     GlobalSequencesViewer globalSequencesViewer;
@@ -92,6 +110,7 @@ protected:
 private:
     bool watcherStarted = false;
     bool cleanerStarted = false;
+    bool autoTunerStarted = false;
 
     ModelManager(const ModelManager&) = delete;
 
@@ -111,6 +130,7 @@ private:
     Status tryReloadGatedModelConfigs(std::vector<ModelConfig>& gatedModelConfigs);
     Status loadCustomNodeLibrariesConfig(rapidjson::Document& configJson);
     Status loadPipelinesConfig(rapidjson::Document& configJson);
+    Status loadModelRoutersConfig(rapidjson::Document& configJson);
     Status loadCustomLoadersConfig(rapidjson::Document& configJson);
 
     /**
@@ -128,6 +148,11 @@ private:
      */
     void cleanerRoutine(uint32_t resourcesCleanupIntervalSec, uint32_t sequenceCleanerIntervalMinutes, std::future<void> cleanerExitSignal);
 
+    /**
+     * @brief Auto-tuner thread evaluating nireq and streams of model versions with auto_tune enabled
+     */
+    void autoTunerRoutine(std::future<void> autoTunerExitSignal);
+
     /**
      * @brief Mutex for blocking concurrent add & remove of resources
      */
@@ -148,6 +173,11 @@ private:
      */
     std::thread cleanerThread;
 
+    /**
+     * @brief A thread object used for auto-tuning model versions
+     */
+    std::thread autoTunerThread;
+
     /**
          * @brief Metrics config
          */
@@ -158,6 +188,16 @@ private:
          */
     bool metricConfigLoadedOnce = false;
 
+    /**
+         * @brief Reporter of memory allocator statistics, created once metrics config is loaded
+         */
+    std::unique_ptr<AllocatorMetricReporter> allocatorMetricReporter;
+
+    /**
+     * @brief Recorder of sampled inference requests, created when traffic capture is enabled
+     */
+    std::unique_ptr<TrafficRecorder> trafficRecorder;
+
     /**
      * @brief An exit trigger to notify watcher thread to exit
      */
@@ -168,6 +208,11 @@ private:
      */
     std::promise<void> cleanerExitTrigger;
 
+    /**
+     * @brief An exit trigger to notify auto-tuner thread to exit
+     */
+    std::promise<void> autoTunerExitTrigger;
+
     /**
      * @brief A current configurations of models
      * 
@@ -304,6 +349,11 @@ public:
      */
     void startCleaner();
 
+    /**
+     * @brief Starts auto-tuning of model versions as new thread, called when first model with auto_tune is loaded
+     */
+    void startAutoTuner();
+
     const PipelineFactory& getPipelineFactory() const {
         return pipelineFactory;
     }
@@ -316,6 +366,15 @@ public:
 
     const CustomNodeLibraryManager& getCustomNodeLibraryManager() const;
 
+    /**
+     * @brief Get the traffic recorder
+     *
+     * @return pointer to TrafficRecorder or nullptr if traffic capture is disabled
+     */
+    TrafficRecorder* getTrafficRecorder() const {
+        return trafficRecorder.get();
+    }
+
     /**
      * @brief Finds model with specific name
      *
@@ -330,6 +389,13 @@ public:
         std::shared_ptr<ovms::ModelInstance>& modelInstance,
         std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const;
 
+    /**
+     * @brief Finds model router with specific name
+     *
+     * @return pointer to ModelRouter or nullptr if not found
+     */
+    const std::shared_ptr<ModelRouter> findModelRouterByName(const std::string& name) const;
+
     const bool modelExists(const std::string& name) const {
         if (findModelByName(name) == nullptr)
             return false;
@@ -503,6 +569,8 @@ public:
     void cleanupResources();
 
     MetricRegistry* getMetricRegistry() const { return this->metricRegistry; }
+
+    AllocatorMetricReporter* getAllocatorMetricReporter() const { return this->allocatorMetricReporter.get(); }
 };
 
 void cleanerRoutine(uint32_t resourcesCleanupInterval, FunctorResourcesCleaner& functorResourcesCleaner, uint32_t sequenceCleanerInterval, FunctorSequenceCleaner& functorSequenceCleaner, std::future<void>& cleanerExitSignal);
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "modelversionstatus.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <unordered_map>
@@ -69,6 +70,14 @@ const std::string& ModelVersionStatus::getErrorMsg() const {
     return ModelVersionStatusErrorCodeToString(this->errorCode);
 }
 
+std::chrono::microseconds ModelVersionStatus::getWarmupTime() const {
+    return this->warmupTime;
+}
+
+void ModelVersionStatus::setWarmupTime(std::chrono::microseconds warmupTime) {
+    this->warmupTime = warmupTime;
+}
+
 bool ModelVersionStatus::willEndUnloaded() const {
     return ovms::ModelVersionState::UNLOADING <= this->state;
 }
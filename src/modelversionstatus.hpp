@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <unordered_map>
@@ -67,6 +68,7 @@ class ModelVersionStatus {
     model_version_t version;
     ModelVersionState state;
     ModelVersionStatusErrorCode errorCode;
+    std::chrono::microseconds warmupTime{0};
 
 public:
     ModelVersionStatus() = delete;
@@ -81,6 +83,12 @@ public:
 
     const std::string& getErrorMsg() const;
 
+    /**
+     * @brief Duration of the warm-up executed before version became available, 0 when warm-up was not performed.
+     */
+    std::chrono::microseconds getWarmupTime() const;
+    void setWarmupTime(std::chrono::microseconds warmupTime);
+
     /**
      * @brief Check if current state is state that is either transforming to END or already in that state.
      *
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Compares non maximum suppression used by custom nodes with the legacy east_ocr implementation.
+// Usage: nms_benchmark [iterations]
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "custom_nodes/common/nms.hpp"
+#include "custom_nodes/east_ocr/nms.hpp"
+#include "opencv2/opencv.hpp"
+
+namespace {
+using ovms::custom_nodes_common::Boxes;
+using ovms::custom_nodes_common::NmsParameters;
+
+struct Candidates {
+    std::vector<cv::Rect> rects;
+    std::vector<float> scores;
+    std::vector<int> metadata;
+    Boxes boxes;
+};
+
+// Clustered candidates similar to dense detector output: many boxes around each object.
+Candidates generateCandidates(size_t count, int imageSize) {
+    std::mt19937 generator(count);
+    std::uniform_int_distribution<int> center(0, imageSize);
+    std::uniform_int_distribution<int> jitter(-8, 8);
+    std::uniform_int_distribution<int> size(16, 64);
+    std::uniform_real_distribution<float> score(0.f, 1.f);
+    Candidates candidates;
+    const size_t boxesPerObject = 16;
+    int cx = 0, cy = 0, w = 0, h = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i % boxesPerObject == 0) {
+            cx = center(generator);
+            cy = center(generator);
+            w = size(generator);
+            h = size(generator);
+        }
+        cv::Rect rect(cx + jitter(generator), cy + jitter(generator), w + jitter(generator), h + jitter(generator));
+        float rectScore = score(generator);
+        candidates.rects.emplace_back(rect);
+        candidates.scores.emplace_back(rectScore);
+        candidates.metadata.emplace_back(static_cast<int>(i));
+        candidates.boxes.push_back(rect.x, rect.y, rect.x + rect.width, rect.y + rect.height, rectScore);
+    }
+    return candidates;
+}
+
+template <typename Func>
+double measureMicroseconds(size_t iterations, Func func) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(end - start).count() / iterations;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20;
+    if (iterations == 0) {
+        std::cerr << "Usage: " << argv[0] << " [iterations]" << std::endl;
+        return 1;
+    }
+    const float iouThreshold = 0.3f;
+    std::cout << std::setw(10) << "boxes" << std::setw(16) << "legacy [us]" << std::setw(16) << "shared [us]"
+              << std::setw(16) << "grid [us]" << std::setw(10) << "kept" << std::endl;
+    for (size_t count : {100, 1000, 5000, 20000}) {
+        Candidates candidates = generateCandidates(count, 1920);
+
+        std::vector<cv::Rect> resRects;
+        std::vector<float> resScores;
+        std::vector<int> resMetadata;
+        double legacy = measureMicroseconds(iterations, [&]() {
+            nms2(candidates.rects, candidates.scores, candidates.metadata, resRects, resScores, resMetadata, iouThreshold);
+        });
+
+        NmsParameters parameters;
+        parameters.iouThreshold = iouThreshold;
+        parameters.gridBucketingMinBoxes = 0;
+        std::vector<size_t> kept;
+        double shared = measureMicroseconds(iterations, [&]() {
+            kept = ovms::custom_nodes_common::nms(candidates.boxes, parameters);
+        });
+        parameters.gridBucketingMinBoxes = 1;
+        double grid = measureMicroseconds(iterations, [&]() {
+            kept = ovms::custom_nodes_common::nms(candidates.boxes, parameters);
+        });
+        if (kept.size() != resRects.size()) {
+            std::cerr << "Results differ for " << count << " boxes: " << kept.size() << " vs " << resRects.size() << std::endl;
+            return 1;
+        }
+        std::cout << std::setw(10) << count << std::setw(16) << std::fixed << std::setprecision(1) << legacy
+                  << std::setw(16) << shared << std::setw(16) << grid << std::setw(10) << kept.size() << std::endl;
+    }
+    return 0;
+}
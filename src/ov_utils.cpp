@@ -37,9 +37,9 @@ ov::Tensor createTensorWithNoDataOwnership(ov::element::Type_t precision, const
     return tensor;
 }
 
-Status createSharedTensor(ov::Tensor& destinationTensor, ov::element::Type_t precision, const ov::Shape& shape) {
-    OV_LOGGER("ov::Tensor(precision, shape)");
-    destinationTensor = ov::Tensor(precision, shape);
+Status createSharedTensor(ov::Tensor& destinationTensor, ov::element::Type_t precision, const ov::Shape& shape, const ov::Allocator& allocator) {
+    OV_LOGGER("ov::Tensor(precision, shape, allocator)");
+    destinationTensor = ov::Tensor(precision, shape, allocator);
     return StatusCode::OK;
 }
 
@@ -33,7 +33,7 @@ typedef struct OVMS_ServableMetadata_ OVMS_ServableMetadata;
 typedef struct OVMS_Metadata_ OVMS_Metadata;
 
 #define OVMS_API_VERSION_MAJOR 1
-#define OVMS_API_VERSION_MINOR 0
+#define OVMS_API_VERSION_MINOR 1
 
 // Function to retrieve OVMS API version.
 //
@@ -443,6 +443,30 @@ OVMS_Status* OVMS_InferenceRequestAddInput(OVMS_InferenceRequest* request, const
 // \return OVMS_Status object in case of failure
 OVMS_Status* OVMS_InferenceRequestInputSetData(OVMS_InferenceRequest* request, const char* inputName, const void* data, size_t byteSize, OVMS_BufferType bufferType, uint32_t deviceId);
 
+// Callback notifying the application that the server no longer uses input data buffer.
+//
+// \param data The data pointer passed when setting the input data
+// \param userData The user data pointer passed when setting the input data
+typedef void (*OVMS_InputBufferReleaseFn)(const void* data, void* userData);
+
+// Set the data of the input buffer without copying it and transfer the responsibility for its lifetime to the server.
+// The buffer must not be modified nor freed until releaseFn is called. releaseFn is called exactly once, when the inference
+// using the buffer finished (successfully or not), or when the data is removed from the request, the input is removed
+// or the request is deleted before inference. The callback is called on the thread performing that operation, before
+// the operation returns. After release the input has no data set and new data has to be set before next inference.
+// If the function returns error releaseFn is not called and the caller remains responsible for the buffer.
+//
+// \param request The request object
+// \param inputName The name of the input with data to be set
+// \param data The data of the input
+// \param byteSize The byte size of the data
+// \param bufferType The buffer type of the data
+// \param deviceId The device id of the data memory buffer
+// \param releaseFn The callback to be called when the server does not use the data anymore
+// \param userData The pointer passed to releaseFn
+// \return OVMS_Status object in case of failure
+OVMS_Status* OVMS_InferenceRequestInputSetDataWithRelease(OVMS_InferenceRequest* request, const char* inputName, const void* data, size_t byteSize, OVMS_BufferType bufferType, uint32_t deviceId, OVMS_InputBufferReleaseFn releaseFn, void* userData);
+
 // Remove the data of the input.
 //
 // \param request The request object
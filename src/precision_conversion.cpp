@@ -0,0 +1,498 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "precision_conversion.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace ovms {
+
+namespace {
+enum class SimdLevel {
+    SCALAR,
+    AVX2,
+    AVX512
+};
+
+SimdLevel detectSimdLevel() {
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::AVX2;
+    }
+#endif
+    return SimdLevel::SCALAR;
+}
+
+SimdLevel getSimdLevel() {
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+#if defined(__x86_64__)
+bool hasF16C() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("f16c") != 0;
+    }();
+    return supported;
+}
+#endif
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bitsToFloat(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+float halfToFloat(uint16_t half) {
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1F;
+    uint32_t mantissa = half & 0x3FF;
+    if (exponent == 0x1F) {
+        return bitsToFloat(sign | 0x7F800000 | (mantissa << 13));
+    }
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            return bitsToFloat(sign);
+        }
+        // subnormal half is normal in FP32
+        exponent = 127 - 15 + 1;
+        while ((mantissa & 0x400) == 0) {
+            mantissa <<= 1;
+            --exponent;
+        }
+        return bitsToFloat(sign | (exponent << 23) | ((mantissa & 0x3FF) << 13));
+    }
+    return bitsToFloat(sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+}
+
+uint16_t floatToHalf(float value) {
+    const uint32_t bits = floatBits(value);
+    const uint32_t sign = (bits >> 16) & 0x8000;
+    const uint32_t magnitude = bits & 0x7FFFFFFF;
+    if (magnitude >= 0x7F800000) {
+        // keep NaN quiet and non zero after dropping low mantissa bits
+        const uint32_t nanPayload = (magnitude > 0x7F800000) ? (0x200 | ((magnitude >> 13) & 0x3FF)) : 0;
+        return static_cast<uint16_t>(sign | 0x7C00 | nanPayload);
+    }
+    if (magnitude >= 0x477FF000) {
+        // 65520 and above rounds to infinity
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+    if (magnitude < 0x38800000) {
+        // below smallest normal half
+        if (magnitude < 0x33000000) {
+            return static_cast<uint16_t>(sign);
+        }
+        const uint32_t exponent = magnitude >> 23;
+        const uint32_t mantissa = (magnitude & 0x7FFFFF) | 0x800000;
+        const uint32_t shift = 126 - exponent;
+        uint32_t result = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (result & 1))) {
+            ++result;
+        }
+        return static_cast<uint16_t>(sign | result);
+    }
+    uint32_t result = (magnitude - 0x38000000) >> 13;
+    const uint32_t remainder = magnitude & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1))) {
+        ++result;
+    }
+    return static_cast<uint16_t>(sign | result);
+}
+
+uint16_t floatToBfloat16(float value) {
+    const uint32_t bits = floatBits(value);
+    if ((bits & 0x7FFFFFFF) > 0x7F800000) {
+        return static_cast<uint16_t>((bits >> 16) | 0x40);
+    }
+    return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+void fp16ToFp32Scalar(const uint16_t* src, float* dst, size_t from, size_t count) {
+    for (size_t i = from; i < count; ++i) {
+        dst[i] = halfToFloat(src[i]);
+    }
+}
+
+void fp32ToFp16Scalar(const float* src, uint16_t* dst, size_t from, size_t count) {
+    for (size_t i = from; i < count; ++i) {
+        dst[i] = floatToHalf(src[i]);
+    }
+}
+
+void bf16ToFp32Scalar(const uint16_t* src, float* dst, size_t from, size_t count) {
+    for (size_t i = from; i < count; ++i) {
+        dst[i] = bitsToFloat(static_cast<uint32_t>(src[i]) << 16);
+    }
+}
+
+void fp32ToBf16Scalar(const float* src, uint16_t* dst, size_t from, size_t count) {
+    for (size_t i = from; i < count; ++i) {
+        dst[i] = floatToBfloat16(src[i]);
+    }
+}
+
+template <typename SrcType, typename DstType>
+void convertScalar(const SrcType* src, DstType* dst, size_t from, size_t count) {
+    for (size_t i = from; i < count; ++i) {
+        dst[i] = static_cast<DstType>(src[i]);
+    }
+}
+
+#if defined(__x86_64__)
+#pragma GCC diagnostic push
+// AVX-512 conversion intrinsics use intentionally undefined passthrough operand
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+// Narrowing kernels keep the lowest bytes of each 32 bit element
+__attribute__((target("avx512f"))) size_t narrowInt32ToInt8Avx512(const int32_t* src, int8_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i v = _mm512_loadu_si512(reinterpret_cast<const void*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtepi32_epi8(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t narrowInt32ToInt16Avx512(const int32_t* src, int16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512i v = _mm512_loadu_si512(reinterpret_cast<const void*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtepi32_epi16(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t narrowInt32ToInt8Avx2(const int32_t* src, int8_t* dst, size_t count) {
+    const __m256i lowBytes = _mm256_setr_epi8(
+        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m256i gatherLanes = _mm256_setr_epi32(0, 4, 1, 1, 1, 1, 1, 1);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, lowBytes), gatherLanes);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t narrowInt32ToInt16Avx2(const int32_t* src, int16_t* dst, size_t count) {
+    const __m256i lowWords = _mm256_setr_epi8(
+        0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        v = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, lowWords), 0b00001000);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_castsi256_si128(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t widenInt8ToInt32Avx512(const int8_t* src, int32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm512_storeu_si512(reinterpret_cast<void*>(dst + i), _mm512_cvtepi8_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t widenInt16ToInt32Avx512(const int16_t* src, int32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_si512(reinterpret_cast<void*>(dst + i), _mm512_cvtepi16_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t widenUint8ToUint32Avx512(const uint8_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm512_storeu_si512(reinterpret_cast<void*>(dst + i), _mm512_cvtepu8_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t widenUint16ToUint32Avx512(const uint16_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_si512(reinterpret_cast<void*>(dst + i), _mm512_cvtepu16_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t widenInt8ToInt32Avx2(const int8_t* src, int32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepi8_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t widenInt16ToInt32Avx2(const int16_t* src, int32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepi16_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t widenUint8ToUint32Avx2(const uint8_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu8_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t widenUint16ToUint32Avx2(const uint16_t* src, uint32_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvtepu16_epi32(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t fp16ToFp32Avx512(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t fp32ToFp16Avx512(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512 v = _mm512_loadu_ps(src + i);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+
+__attribute__((target("avx2,f16c"))) size_t fp16ToFp32Avx2(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(v));
+    }
+    return i;
+}
+
+__attribute__((target("avx2,f16c"))) size_t fp32ToFp16Avx2(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 v = _mm256_loadu_ps(src + i);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f"))) size_t bf16ToFp32Avx512(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_si512(reinterpret_cast<void*>(dst + i), _mm512_slli_epi32(_mm512_cvtepu16_epi32(v), 16));
+    }
+    return i;
+}
+
+// Rounds to nearest even by adding 0x7FFF plus lowest kept bit, NaN is quieted instead
+__attribute__((target("avx512f"))) size_t fp32ToBf16Avx512(const float* src, uint16_t* dst, size_t count) {
+    const __m512i one = _mm512_set1_epi32(1);
+    const __m512i roundingBias = _mm512_set1_epi32(0x7FFF);
+    const __m512i quietNan = _mm512_set1_epi32(0x00400000);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m512 v = _mm512_loadu_ps(src + i);
+        __m512i bits = _mm512_castps_si512(v);
+        __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+        __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(roundingBias, lsb));
+        __mmask16 isNan = _mm512_cmp_ps_mask(v, v, _CMP_UNORD_Q);
+        rounded = _mm512_mask_blend_epi32(isNan, rounded, _mm512_or_si512(bits, quietNan));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) size_t bf16ToFp32Avx2(const uint16_t* src, float* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_slli_epi32(_mm256_cvtepu16_epi32(v), 16));
+    }
+    return i;
+}
+
+__attribute__((target("avx2"))) __m256i roundToBf16Avx2(__m256 v) {
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256i roundingBias = _mm256_set1_epi32(0x7FFF);
+    const __m256i quietNan = _mm256_set1_epi32(0x00400000);
+    __m256i bits = _mm256_castps_si256(v);
+    __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+    __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(roundingBias, lsb));
+    __m256i isNan = _mm256_castps_si256(_mm256_cmp_ps(v, v, _CMP_UNORD_Q));
+    rounded = _mm256_blendv_epi8(rounded, _mm256_or_si256(bits, quietNan), isNan);
+    return _mm256_srli_epi32(rounded, 16);
+}
+
+__attribute__((target("avx2"))) size_t fp32ToBf16Avx2(const float* src, uint16_t* dst, size_t count) {
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i low = roundToBf16Avx2(_mm256_loadu_ps(src + i));
+        __m256i high = roundToBf16Avx2(_mm256_loadu_ps(src + i + 8));
+        // packus interleaves 128 bit lanes, permute restores element order
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(low, high), 0b11011000);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+    }
+    return i;
+}
+#pragma GCC diagnostic pop
+
+#define DISPATCH_SIMD(AVX512_KERNEL, AVX2_KERNEL)   \
+    size_t converted = 0;                           \
+    switch (getSimdLevel()) {                       \
+    case SimdLevel::AVX512:                         \
+        converted = AVX512_KERNEL(src, dst, count); \
+        break;                                      \
+    case SimdLevel::AVX2:                           \
+        converted = AVX2_KERNEL(src, dst, count);   \
+        break;                                      \
+    case SimdLevel::SCALAR:                         \
+        break;                                      \
+    }                                               \
+    convertScalar(src, dst, converted, count);
+
+#define DISPATCH_HALF_SIMD(AVX512_KERNEL, AVX2_KERNEL, SCALAR_KERNEL) \
+    size_t converted = 0;                                             \
+    switch (getSimdLevel()) {                                         \
+    case SimdLevel::AVX512:                                           \
+        converted = AVX512_KERNEL(src, dst, count);                   \
+        break;                                                        \
+    case SimdLevel::AVX2:                                             \
+        if (hasF16C()) {                                              \
+            converted = AVX2_KERNEL(src, dst, count);                 \
+        }                                                             \
+        break;                                                        \
+    case SimdLevel::SCALAR:                                           \
+        break;                                                        \
+    }                                                                 \
+    SCALAR_KERNEL(src, dst, converted, count);
+
+#define DISPATCH_BFLOAT_SIMD(AVX512_KERNEL, AVX2_KERNEL, SCALAR_KERNEL) \
+    size_t converted = 0;                                               \
+    switch (getSimdLevel()) {                                           \
+    case SimdLevel::AVX512:                                             \
+        converted = AVX512_KERNEL(src, dst, count);                     \
+        break;                                                          \
+    case SimdLevel::AVX2:                                               \
+        converted = AVX2_KERNEL(src, dst, count);                       \
+        break;                                                          \
+    case SimdLevel::SCALAR:                                             \
+        break;                                                          \
+    }                                                                   \
+    SCALAR_KERNEL(src, dst, converted, count);
+#else
+#define DISPATCH_SIMD(AVX512_KERNEL, AVX2_KERNEL) \
+    convertScalar(src, dst, 0, count);
+#define DISPATCH_HALF_SIMD(AVX512_KERNEL, AVX2_KERNEL, SCALAR_KERNEL) \
+    SCALAR_KERNEL(src, dst, 0, count);
+#define DISPATCH_BFLOAT_SIMD(AVX512_KERNEL, AVX2_KERNEL, SCALAR_KERNEL) \
+    SCALAR_KERNEL(src, dst, 0, count);
+#endif
+}  // namespace
+
+template <>
+void convertContents<int32_t, int8_t>(const int32_t* src, int8_t* dst, size_t count) {
+    DISPATCH_SIMD(narrowInt32ToInt8Avx512, narrowInt32ToInt8Avx2)
+}
+
+template <>
+void convertContents<int32_t, int16_t>(const int32_t* src, int16_t* dst, size_t count) {
+    DISPATCH_SIMD(narrowInt32ToInt16Avx512, narrowInt32ToInt16Avx2)
+}
+
+template <>
+void convertContents<uint32_t, uint8_t>(const uint32_t* src, uint8_t* dst, size_t count) {
+    // truncation does not depend on signedness
+    convertContents<int32_t, int8_t>(reinterpret_cast<const int32_t*>(src), reinterpret_cast<int8_t*>(dst), count);
+}
+
+template <>
+void convertContents<uint32_t, uint16_t>(const uint32_t* src, uint16_t* dst, size_t count) {
+    convertContents<int32_t, int16_t>(reinterpret_cast<const int32_t*>(src), reinterpret_cast<int16_t*>(dst), count);
+}
+
+template <>
+void convertContents<int8_t, int32_t>(const int8_t* src, int32_t* dst, size_t count) {
+    DISPATCH_SIMD(widenInt8ToInt32Avx512, widenInt8ToInt32Avx2)
+}
+
+template <>
+void convertContents<int16_t, int32_t>(const int16_t* src, int32_t* dst, size_t count) {
+    DISPATCH_SIMD(widenInt16ToInt32Avx512, widenInt16ToInt32Avx2)
+}
+
+template <>
+void convertContents<uint8_t, uint32_t>(const uint8_t* src, uint32_t* dst, size_t count) {
+    DISPATCH_SIMD(widenUint8ToUint32Avx512, widenUint8ToUint32Avx2)
+}
+
+template <>
+void convertContents<uint16_t, uint32_t>(const uint16_t* src, uint32_t* dst, size_t count) {
+    DISPATCH_SIMD(widenUint16ToUint32Avx512, widenUint16ToUint32Avx2)
+}
+
+void convertFp16ToFp32(const uint16_t* src, float* dst, size_t count) {
+    DISPATCH_HALF_SIMD(fp16ToFp32Avx512, fp16ToFp32Avx2, fp16ToFp32Scalar)
+}
+
+void convertFp32ToFp16(const float* src, uint16_t* dst, size_t count) {
+    DISPATCH_HALF_SIMD(fp32ToFp16Avx512, fp32ToFp16Avx2, fp32ToFp16Scalar)
+}
+
+void convertBf16ToFp32(const uint16_t* src, float* dst, size_t count) {
+    DISPATCH_BFLOAT_SIMD(bf16ToFp32Avx512, bf16ToFp32Avx2, bf16ToFp32Scalar)
+}
+
+void convertFp32ToBf16(const float* src, uint16_t* dst, size_t count) {
+    DISPATCH_BFLOAT_SIMD(fp32ToBf16Avx512, fp32ToBf16Avx2, fp32ToBf16Scalar)
+}
+
+}  // namespace ovms
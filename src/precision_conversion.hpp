@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace ovms {
+
+/**
+ * @brief Converts count elements from src to dst.
+ * Elements of equal width are copied with memcpy, narrowing keeps the lowest bytes of
+ * each element and widening extends sign according to source type.
+ * Int8/int16/uint8/uint16 <-> int32/uint32 conversions use AVX2/AVX-512 kernels
+ * when supported by the CPU and a scalar loop otherwise.
+ */
+template <typename SrcType, typename DstType>
+void convertContents(const SrcType* src, DstType* dst, size_t count) {
+    if constexpr (sizeof(SrcType) == sizeof(DstType)) {
+        std::memcpy(dst, src, count * sizeof(SrcType));
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            dst[i] = static_cast<DstType>(src[i]);
+        }
+    }
+}
+
+template <>
+void convertContents<int32_t, int8_t>(const int32_t* src, int8_t* dst, size_t count);
+template <>
+void convertContents<int32_t, int16_t>(const int32_t* src, int16_t* dst, size_t count);
+template <>
+void convertContents<uint32_t, uint8_t>(const uint32_t* src, uint8_t* dst, size_t count);
+template <>
+void convertContents<uint32_t, uint16_t>(const uint32_t* src, uint16_t* dst, size_t count);
+template <>
+void convertContents<int8_t, int32_t>(const int8_t* src, int32_t* dst, size_t count);
+template <>
+void convertContents<int16_t, int32_t>(const int16_t* src, int32_t* dst, size_t count);
+template <>
+void convertContents<uint8_t, uint32_t>(const uint8_t* src, uint32_t* dst, size_t count);
+template <>
+void convertContents<uint16_t, uint32_t>(const uint16_t* src, uint32_t* dst, size_t count);
+
+/**
+ * @brief Half precision (IEEE 754 binary16) and bfloat16 <-> FP32 conversions used for
+ * compact wire precisions. Narrowing rounds to nearest even, NaN stays NaN and values
+ * out of FP16 range become infinity. F16C/AVX2/AVX-512 kernels are used when supported.
+ */
+void convertFp16ToFp32(const uint16_t* src, float* dst, size_t count);
+void convertFp32ToFp16(const float* src, uint16_t* dst, size_t count);
+void convertBf16ToFp32(const uint16_t* src, float* dst, size_t count);
+void convertFp32ToBf16(const float* src, uint16_t* dst, size_t count);
+
+}  // namespace ovms
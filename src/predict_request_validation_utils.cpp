@@ -95,12 +95,11 @@ const signed_shape_t& RequestShapeInfo<InferenceTensor, signed_shape_t>::getShap
 template <typename RequestType, typename InputTensorType, typename InputIterator, typename ShapeType>
 class RequestValidator {
     const RequestType& request;
-    const tensor_map_t& inputsInfo;
+    const TensorDescriptorTable& inputs;
     const std::string& servableName;
     const model_version_t servableVersion;
     const std::set<std::string>& optionalAllowedInputNames;
     const Mode batchingMode;
-    const shapes_info_map_t& shapeInfo;
 
     InputIterator it;
 
@@ -113,16 +112,15 @@ class RequestValidator {
 
 public:
     RequestValidator(
-        const RequestType& request, const tensor_map_t& inputsInfo,
+        const RequestType& request, const TensorDescriptorTable& inputs,
         const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames,
-        const Mode batchingMode, const shapes_info_map_t& shapeInfo) :
+        const Mode batchingMode) :
         request(request),
-        inputsInfo(inputsInfo),
+        inputs(inputs),
         servableName(servableName),
         servableVersion(servableVersion),
         optionalAllowedInputNames(optionalAllowedInputNames),
-        batchingMode(batchingMode),
-        shapeInfo(shapeInfo) {}
+        batchingMode(batchingMode) {}
 
     Status validateInferenceTensorBufferType(const InferenceTensor& it) const;
     Status validateNumberOfInputs() const;
@@ -131,9 +129,9 @@ public:
     Status validateNumberOfBinaryInputShapeDimensions(const InputTensorType& proto) const;
     Status checkBatchSizeMismatch(const InputTensorType& proto, const std::optional<Dimension>& servableBatchSize, const std::optional<size_t>& batchSizeIndex, Status& finalStatus, Mode batchingMode, Mode shapeMode) const;
     Status checkBinaryBatchSizeMismatch(const InputTensorType& proto, const std::optional<Dimension>& servableBatchSize, Status& finalStatus, Mode batchingMode, Mode shapeMode, int32_t inputBatchSize) const;
-    Status checkShapeMismatch(const InputTensorType& proto, const ovms::TensorInfo& inputInfo, const std::optional<size_t>& batchSizeIndex, Status& finalStatus, Mode batchingMode, Mode shapeMode) const;
-    Status validateTensorContent(const InputTensorType& proto, ovms::Precision expectedPrecision, size_t bufferId) const;
-    Status validateNumberOfShapeDimensions(const ovms::TensorInfo& inputInfo, const InputTensorType& proto) const;
+    Status checkShapeMismatch(const InputTensorType& proto, const TensorDescriptor& input, Status& finalStatus, Mode batchingMode) const;
+    Status validateTensorContent(const InputTensorType& proto, const TensorDescriptor& input, size_t bufferId, bool shapeMatchesModel) const;
+    Status validateNumberOfShapeDimensions(const TensorDescriptor& input, const InputTensorType& proto) const;
     Status validateRawInputContentsFormatAndShape(const ovms::TensorInfo& inputInfo, const RequestType& request, const size_t& bufferId, Status& finalStatus, Mode batchingMode, Mode shapeMode) const;
     Status validatePrecision(const ovms::TensorInfo& inputInfo, const InputTensorType& proto) const;
     Status checkStringShapeMismatch(const InputTensorType& proto, const ovms::TensorInfo& inputInfo, Status& finalStatus, Mode batchingMode, Mode shapeMode, int32_t inputBatchSize, size_t inputWidth) const;
@@ -169,7 +167,7 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
 
 template <>
 Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateNumberOfInputs() const {
-    size_t expectedNumberOfInputs = inputsInfo.size();
+    size_t expectedNumberOfInputs = inputs.size();
 
     if (optionalAllowedInputNames.size() > 0) {
         auto it = request.inputs().begin();
@@ -218,7 +216,7 @@ const InferenceTensor& RequestValidator<ovms::InferenceRequest, InferenceTensor,
 
 template <>
 Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateNumberOfInputs() const {
-    size_t expectedNumberOfInputs = inputsInfo.size();
+    size_t expectedNumberOfInputs = inputs.size();
     for (auto& optionalAllowedInputName : optionalAllowedInputNames) {
         if (request.inputs().count(optionalAllowedInputName))
             expectedNumberOfInputs++;
@@ -234,7 +232,7 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 }
 template <>
 Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateNumberOfInputs() const {
-    size_t expectedNumberOfInputs = inputsInfo.size();
+    size_t expectedNumberOfInputs = inputs.size();
     if (request.getInputsSize() > 0 && expectedNumberOfInputs == static_cast<size_t>(request.getInputsSize())) {
         return StatusCode::OK;
     }
@@ -501,8 +499,9 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
 }
 
 template <typename RequestType, typename InputTensorType, typename IteratorType, typename ShapeType>
-Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::checkShapeMismatch(const InputTensorType& proto, const ovms::TensorInfo& inputInfo, const std::optional<size_t>& batchSizeIndex, Status& finalStatus, Mode batchingMode, Mode shapeMode) const {
-    const auto& shape = inputInfo.getShape();
+Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::checkShapeMismatch(const InputTensorType& proto, const TensorDescriptor& input, Status& finalStatus, Mode batchingMode) const {
+    const auto& shape = input.shape;
+    const auto& batchSizeIndex = input.batchIndex;
     bool mismatch = false;
     RequestShapeInfo<InputTensorType, ShapeType> rsi(proto);
     if (batchingMode == AUTO) {  // Skip batch dimension
@@ -511,20 +510,20 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
             return StatusCode::INTERNAL_ERROR;
         }
         for (size_t i = 0; i < batchSizeIndex.value(); i++) {
-            if (!shape[i].match(static_cast<dimension_value_t>(rsi.getDim(i)))) {
+            if (!shape.match(i, static_cast<dimension_value_t>(rsi.getDim(i)))) {
                 mismatch = true;
                 break;
             }
         }
         for (size_t i = batchSizeIndex.value() + 1; i < rsi.getShapeSize(); i++) {
-            if (!shape[i].match(static_cast<dimension_value_t>(rsi.getDim(i)))) {
+            if (!shape.match(i, static_cast<dimension_value_t>(rsi.getDim(i)))) {
                 mismatch = true;
                 break;
             }
         }
     } else {  // Do not skip batch dimension
         for (size_t i = 0; i < rsi.getShapeSize(); i++) {
-            if (!shape[i].match(static_cast<dimension_value_t>(rsi.getDim(i)))) {
+            if (!shape.match(i, static_cast<dimension_value_t>(rsi.getDim(i)))) {
                 mismatch = true;
                 break;
             }
@@ -533,12 +532,12 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
     if (!mismatch) {
         return StatusCode::OK;
     }
-    if (shapeMode == AUTO) {
+    if (input.shapeMode == AUTO) {
         finalStatus = StatusCode::RESHAPE_REQUIRED;
         return StatusCode::OK;
     } else {
         std::stringstream ss;
-        ss << "Expected: " << inputInfo.getShape().toString()
+        ss << "Expected: " << input.info->getShape().toString()
            << "; Actual: " << tensorShapeToString(rsi.getShape())
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -649,7 +648,7 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
 }
 
 template <>
-Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateTensorContent(const TFSInputTensorType& proto, ovms::Precision expectedPrecision, size_t bufferId) const {
+Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateTensorContent(const TFSInputTensorType& proto, const TensorDescriptor& input, size_t bufferId, bool shapeMatchesModel) const {
     /*
     int8        data in request.tensor_content
     uint8       data in request.tensor_content
@@ -668,8 +667,12 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 */
 
     size_t expectedValueCount = 1;
-    for (int i = 0; i < proto.tensor_shape().dim_size(); i++) {
-        expectedValueCount *= proto.tensor_shape().dim(i).size();
+    if (shapeMatchesModel) {
+        expectedValueCount = input.staticElementCount;
+    } else {
+        for (int i = 0; i < proto.tensor_shape().dim_size(); i++) {
+            expectedValueCount *= proto.tensor_shape().dim(i).size();
+        }
     }
 
     // Network expects tensor content size or value count
@@ -692,7 +695,7 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
             return Status(StatusCode::INVALID_VALUE_COUNT, details);
         }
     } else {
-        size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
+        size_t expectedContentSize = expectedValueCount * input.elementSize;
         if (expectedContentSize != proto.tensor_content().size()) {
             std::stringstream ss;
             ss << "Expected: " << expectedContentSize << " bytes; Actual: " << proto.tensor_content().size() << " bytes; input name: " << getCurrentlyValidatedInputName();
@@ -751,13 +754,19 @@ static size_t getElementsCount(const KFSTensorInputProto& proto, ovms::Precision
 }
 
 template <>
-Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateTensorContent(const KFSTensorInputProto& proto, ovms::Precision expectedPrecision, size_t bufferId) const {
+Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateTensorContent(const KFSTensorInputProto& proto, const TensorDescriptor& input, size_t bufferId, bool shapeMatchesModel) const {
     size_t expectedValueCount = 1;
-    for (int i = 0; i < proto.shape().size(); i++) {
-        expectedValueCount *= proto.shape()[i];
+    if (shapeMatchesModel) {
+        expectedValueCount = input.staticElementCount;
+    } else {
+        for (int i = 0; i < proto.shape().size(); i++) {
+            expectedValueCount *= proto.shape()[i];
+        }
     }
     if (request.raw_input_contents().size()) {
-        size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
+        // datatype differs from model precision only for configured compact wire precision
+        size_t elementSize = (proto.datatype() == ovmsPrecisionToKFSPrecision(input.precision)) ? input.elementSize : ov::element::Type(ovmsPrecisionToIE2Precision(input.info->getWirePrecision())).size();
+        size_t expectedContentSize = expectedValueCount * elementSize;
         if (expectedContentSize != request.raw_input_contents()[bufferId].size()) {
             std::stringstream ss;
             ss << "Expected: " << expectedContentSize << " bytes; Actual: " << request.raw_input_contents()[bufferId].size() << " bytes; input name: " << getCurrentlyValidatedInputName();
@@ -768,7 +777,7 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
     } else {  // buffers placed in InputTensor content
         // here we should check that the elements count is equal since for some precisions there is padding
         // we need to decide first which exact datatype_contents we extract that information from
-        size_t elementsCount = getElementsCount(proto, expectedPrecision);
+        size_t elementsCount = getElementsCount(proto, input.precision);
         if (expectedValueCount != elementsCount) {
             std::stringstream ss;
             ss << "Expected: " << expectedValueCount << " values; Actual: " << elementsCount << " values; input name: " << getCurrentlyValidatedInputName();
@@ -780,7 +789,7 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
     return StatusCode::OK;
 }
 template <>
-Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateTensorContent(const InferenceTensor& tensor, ovms::Precision expectedPrecision, size_t bufferId) const {
+Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateTensorContent(const InferenceTensor& tensor, const TensorDescriptor& input, size_t bufferId, bool shapeMatchesModel) const {
     const Buffer* buffer = tensor.getBuffer();
     if (nullptr == buffer) {
         std::stringstream ss;
@@ -791,11 +800,14 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
         SPDLOG_DEBUG(details);
         return Status(StatusCode::INVALID_CONTENT_SIZE, details);
     }
-    size_t expectedValueCount = 1;
-    for (size_t i = 0; i < tensor.getShape().size(); i++) {
-        expectedValueCount *= tensor.getShape()[i];
+    size_t expectedContentSize = input.staticByteSize;
+    if (!shapeMatchesModel) {
+        size_t expectedValueCount = 1;
+        for (size_t i = 0; i < tensor.getShape().size(); i++) {
+            expectedValueCount *= tensor.getShape()[i];
+        }
+        expectedContentSize = expectedValueCount * input.elementSize;
     }
-    size_t expectedContentSize = expectedValueCount * ov::element::Type(ovmsPrecisionToIE2Precision(expectedPrecision)).size();
     if (expectedContentSize != buffer->getByteSize()) {
         std::stringstream ss;
         ss << "Expected: " << expectedContentSize << " bytes; Actual: " << buffer->getByteSize() << " bytes; input name: " << getCurrentlyValidatedInputName();
@@ -808,13 +820,13 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
 }
 
 template <>
-Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateNumberOfShapeDimensions(const ovms::TensorInfo& inputInfo, const TFSInputTensorType& proto) const {
+Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>::validateNumberOfShapeDimensions(const TensorDescriptor& input, const TFSInputTensorType& proto) const {
     // Network and request must have the same number of shape dimensions
-    const auto& shape = inputInfo.getShape();
+    const auto& shape = input.shape;
     if (proto.tensor_shape().dim_size() < 0 ||
         shape.size() != static_cast<size_t>(proto.tensor_shape().dim_size())) {
         std::stringstream ss;
-        ss << "Expected: " << shape.toString()
+        ss << "Expected: " << input.info->getShape().toString()
            << "; Actual: " << tensorShapeToString(proto.tensor_shape())
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -825,13 +837,13 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 }
 
 template <>
-Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateNumberOfShapeDimensions(const ovms::TensorInfo& inputInfo, const KFSTensorInputProto& proto) const {
+Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validateNumberOfShapeDimensions(const TensorDescriptor& input, const KFSTensorInputProto& proto) const {
     // Network and request must have the same number of shape dimensions
-    const auto& shape = inputInfo.getShape();
+    const auto& shape = input.shape;
     if (proto.shape().size() < 0 ||
         shape.size() != static_cast<size_t>(proto.shape().size())) {
         std::stringstream ss;
-        ss << "Expected: " << shape.toString()
+        ss << "Expected: " << input.info->getShape().toString()
            << "; Actual: " << tensorShapeToString(proto.shape())
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -841,13 +853,13 @@ Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorT
     return StatusCode::OK;
 }
 template <>
-Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateNumberOfShapeDimensions(const ovms::TensorInfo& inputInfo, const InferenceTensor& tensor) const {
+Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>::validateNumberOfShapeDimensions(const TensorDescriptor& input, const InferenceTensor& tensor) const {
     // Network and request must have the same number of shape dimensions
-    const auto& shape = inputInfo.getShape();
+    const auto& shape = input.shape;
     if (tensor.getShape().size() < 0 ||
         shape.size() != static_cast<size_t>(tensor.getShape().size())) {
         std::stringstream ss;
-        ss << "Expected: " << shape.toString()
+        ss << "Expected: " << input.info->getShape().toString()
            << "; Actual: " << tensorShapeToString(tensor.getShape())
            << "; input name: " << getCurrentlyValidatedInputName();
         const std::string details = ss.str();
@@ -872,6 +884,12 @@ Status RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIterat
 }
 template <>
 Status RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>::validatePrecision(const ovms::TensorInfo& inputInfo, const KFSTensorInputProto& proto) const {
+    // compact wire precision is accepted only with raw input contents
+    if ((inputInfo.getWirePrecision() != ovms::Precision::UNDEFINED) &&
+        (request.raw_input_contents().size() > 0) &&
+        (proto.datatype() == wirePrecisionToKFSPrecision(inputInfo.getWirePrecision()))) {
+        return StatusCode::OK;
+    }
     if (proto.datatype() != ovmsPrecisionToKFSPrecision(inputInfo.getPrecision())) {
         std::stringstream ss;
         ss << "Expected: " << inputInfo.getPrecisionAsString()
@@ -897,20 +915,6 @@ Status RequestValidator<ovms::InferenceRequest, InferenceTensor, const Inference
     return StatusCode::OK;
 }
 
-static Mode getShapeMode(const shapes_info_map_t& shapeInfo, const std::string& name) {
-    if (shapeInfo.size() == 0) {
-        return Mode::FIXED;
-    }
-    auto it = shapeInfo.find(name);
-    if (it == shapeInfo.end()) {
-        it = shapeInfo.find(ANONYMOUS_INPUT_NAME);
-    }
-    if (it == shapeInfo.end()) {
-        return Mode::FIXED;
-    }
-    return it->second.shapeMode;
-}
-
 static bool dataInRawInputContents(const ovms::InferenceRequest& request) {
     return false;
 }
@@ -954,7 +958,9 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
     RETURN_IF_ERR(validateRequestCoherency());
 
     size_t bufferId = 0;
-    for (const auto& [name, inputInfo] : inputsInfo) {
+    for (const TensorDescriptor& input : inputs) {
+        const std::string& name = *input.name;
+        const TensorInfo* inputInfo = input.info;
         RETURN_IF_ERR(validateAndGetInput(request, name, it, bufferId));
 
         const auto& proto = getInputFromIt(it);
@@ -962,17 +968,17 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
         RETURN_IF_ERR(checkIfShapeValuesNegative(proto));
 
         // Batch and mode retrieval for given input
-        auto batchIndex = inputInfo->getLayout().getBatchIndex();
-        if (batchIndex.has_value() && batchIndex.value() >= inputInfo->getShape().size()) {
+        const auto& batchIndex = input.batchIndex;
+        if (batchIndex.has_value() && batchIndex.value() >= input.shape.size()) {
             SPDLOG_DEBUG("[servable name: {} version: {}] Batch index out of shape range for input: {} layout: {} shape: {}",
                 servableName, servableVersion, name, inputInfo->getLayout(), inputInfo->getShape().toString());
             return StatusCode::INTERNAL_ERROR;
         }
 
-        Mode shapeMode = getShapeMode(shapeInfo, name);
+        Mode shapeMode = input.shapeMode;
 
         if (requiresPreProcessing(proto)) {
-            const auto processingHint = inputInfo->getPreProcessingHint();
+            const auto processingHint = input.preProcessingHint;
             int32_t inputBatchSize = 0;
             size_t inputWidth = 0;
             if (dataInRawInputContents(request)) {
@@ -992,14 +998,14 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
                     servableName, servableVersion, name);
                 RETURN_IF_ERR(validateNumberOfBinaryInputShapeDimensions(proto));
                 RETURN_IF_ERR(validateAgainstMax2DStringArraySize(inputBatchSize, inputWidth));
-                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, inputInfo->getBatchSize(), finalStatus, batchingMode, shapeMode, inputBatchSize));  // 2 dimensions assumed
+                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, input.batchSize, finalStatus, batchingMode, shapeMode, inputBatchSize));  // 2 dimensions assumed
                 RETURN_IF_ERR(checkStringShapeMismatch(proto, *inputInfo, finalStatus, batchingMode, shapeMode, inputBatchSize, inputWidth));
                 continue;
             } else if (processingHint == TensorInfo::ProcessingHint::IMAGE) {
                 SPDLOG_DEBUG("[servable name: {} version: {}] Validating request containing binary image input: name: {}",
                     servableName, servableVersion, name);
                 RETURN_IF_ERR(validateNumberOfBinaryInputShapeDimensions(proto));
-                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, inputInfo->getBatchSize(), finalStatus, batchingMode, shapeMode, inputBatchSize));  // 4/5 dimensions assumed
+                RETURN_IF_ERR(checkBinaryBatchSizeMismatch(proto, input.batchSize, finalStatus, batchingMode, shapeMode, inputBatchSize));  // 4/5 dimensions assumed
                 continue;
             } else {
                 SPDLOG_DEBUG("Request input: {} requires conversion but endpoint specifies no processing hint. Number of dimensions: {}; precision: {}; demultiplexer: {}",
@@ -1010,30 +1016,46 @@ Status RequestValidator<RequestType, InputTensorType, IteratorType, ShapeType>::
 
         // Data Array Proto
         RETURN_IF_ERR(validatePrecision(*inputInfo, proto));
-        RETURN_IF_ERR(validateNumberOfShapeDimensions(*inputInfo, proto));
-        RETURN_IF_ERR(checkBatchSizeMismatch(proto, inputInfo->getBatchSize(), batchIndex, finalStatus, batchingMode, shapeMode));
-        RETURN_IF_ERR(checkShapeMismatch(proto, *inputInfo, batchIndex, finalStatus, batchingMode, shapeMode));
-        RETURN_IF_ERR(validateTensorContent(proto, inputInfo->getPrecision(), bufferId));
+        RETURN_IF_ERR(validateNumberOfShapeDimensions(input, proto));
+        Status shapeStatus = StatusCode::OK;
+        RETURN_IF_ERR(checkBatchSizeMismatch(proto, input.batchSize, batchIndex, shapeStatus, batchingMode, shapeMode));
+        RETURN_IF_ERR(checkShapeMismatch(proto, input, shapeStatus, batchingMode));
+        if (!shapeStatus.ok()) {
+            finalStatus = shapeStatus;
+        }
+        // request shape equal to static model shape, expected size is known upfront
+        const bool shapeMatchesModel = input.isStatic && shapeStatus.ok();
+        RETURN_IF_ERR(validateTensorContent(proto, input, bufferId, shapeMatchesModel));
     }
     return finalStatus;
 }
 
 template <>
-Status validate(const TFSRequestType& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+Status validate(const TFSRequestType& request, const TensorDescriptorTable& inputs, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return RequestValidator<TFSRequestType, TFSInputTensorType, TFSInputTensorIteratorType, TFSShapeType>(request, inputs, servableName, servableVersion, optionalAllowedInputNames, batchingMode).validate();
 }
 
 template <>
-Status validate(const KFSRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+Status validate(const KFSRequest& request, const TensorDescriptorTable& inputs, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return RequestValidator<KFSRequest, KFSTensorInputProto, KFSInputTensorIteratorType, KFSShapeType>(request, inputs, servableName, servableVersion, optionalAllowedInputNames, batchingMode).validate();
 }
 
 template <>
-Status validate(const InferenceRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+Status validate(const InferenceRequest& request, const TensorDescriptorTable& inputs, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode) {
     OVMS_PROFILE_FUNCTION();
-    return RequestValidator<InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>(request, inputsInfo, servableName, servableVersion, optionalAllowedInputNames, batchingMode, shapeInfo).validate();
+    return RequestValidator<InferenceRequest, InferenceTensor, const InferenceTensor*, signed_shape_t>(request, inputs, servableName, servableVersion, optionalAllowedInputNames, batchingMode).validate();
 }
+
+template <typename RequestType>
+Status validate(const RequestType& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo) {
+    const TensorDescriptorTable inputs(inputsInfo, shapeInfo);
+    return validate(request, inputs, servableName, servableVersion, optionalAllowedInputNames, batchingMode);
+}
+
+template Status validate(const TFSRequestType& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo);
+template Status validate(const KFSRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo);
+template Status validate(const InferenceRequest& request, const tensor_map_t& inputsInfo, const std::string& servableName, const model_version_t servableVersion, const std::set<std::string>& optionalAllowedInputNames, const Mode batchingMode, const shapes_info_map_t& shapeInfo);
 }  // namespace request_validation_utils
 }  // namespace ovms
@@ -24,6 +24,7 @@
 
 #include "modelversion.hpp"
 #include "shape.hpp"
+#include "tensor_descriptor.hpp"
 #include "tensorinfo.hpp"
 
 namespace ovms {
@@ -40,6 +41,19 @@ Status validate(
     const Mode batchingMode = Mode::FIXED,
     const shapes_info_map_t& shapeInfo = shapes_info_map_t());
 
+/**
+ * @brief Validates request against tensor descriptors precomputed at servable load,
+ * shape mode of each input is taken from its descriptor.
+ */
+template <typename RequestType>
+Status validate(
+    const RequestType& request,
+    const TensorDescriptorTable& inputs,
+    const std::string& servableName,
+    const model_version_t servableVersion,
+    const std::set<std::string>& optionalAllowedInputNames = {},
+    const Mode batchingMode = Mode::FIXED);
+
 // This function is expected to be called with already validated shape that does not contain negative dimensions
 template <typename T>
 static bool computeExpectedBufferSizeReturnFalseIfOverflow(const std::vector<T>& shape, const size_t& itemsize, size_t& expectedBufferSize) {
@@ -41,6 +41,7 @@
 #include "server.hpp"
 #include "status.hpp"
 #include "timer.hpp"
+#include "traffic_capture.hpp"
 
 using grpc::ServerContext;
 
@@ -74,6 +75,9 @@ Status PredictionServiceImpl::getModelInstance(const PredictRequest* request,
     std::shared_ptr<ovms::ModelInstance>& modelInstance,
     std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) {
     OVMS_PROFILE_FUNCTION();
+    if (auto router = this->modelManager.findModelRouterByName(request->model_spec().name())) {
+        return router->route(this->modelManager, getRequestShapes(request), modelInstance, modelInstanceUnloadGuardPtr);
+    }
     return this->modelManager.getModelInstance(request->model_spec().name(), request->model_spec().version().value(), modelInstance, modelInstanceUnloadGuardPtr);
 }
 
@@ -100,6 +104,9 @@ grpc::Status ovms::PredictionServiceImpl::Predict(
     std::unique_ptr<ovms::Pipeline> pipelinePtr;
 
     std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    if (auto* trafficRecorder = this->modelManager.getTrafficRecorder()) {
+        trafficRecorder->capture(TrafficApi::TFS, request->model_spec().name(), *request);
+    }
     auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
 
     if (status == StatusCode::MODEL_NAME_MISSING) {
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "rcu_snapshot.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace ovms {
+namespace {
+// returns slot for reuse when thread exits
+struct ThreadSlotHolder {
+    RcuDomain::ReaderSlot* slot = nullptr;
+    ~ThreadSlotHolder() {
+        if (slot != nullptr) {
+            slot->inUse.store(false);
+        }
+    }
+};
+}  // namespace
+
+RcuDomain& RcuDomain::instance() {
+    // never destroyed, snapshots owned by static objects are still published during their destruction
+    static RcuDomain* domain = new RcuDomain();
+    return *domain;
+}
+
+RcuDomain::ReaderSlot& RcuDomain::getThreadSlot() {
+    thread_local ThreadSlotHolder holder;
+    if (holder.slot == nullptr) {
+        holder.slot = acquireSlot();
+    }
+    return *holder.slot;
+}
+
+RcuDomain::ReaderSlot* RcuDomain::acquireSlot() {
+    std::lock_guard<std::mutex> lock(slotsMtx);
+    for (auto& slot : slots) {
+        if (!slot->inUse.load()) {
+            slot->inUse.store(true);
+            return slot.get();
+        }
+    }
+    slots.emplace_back(std::make_unique<ReaderSlot>());
+    slots.back()->inUse.store(true);
+    return slots.back().get();
+}
+
+uint64_t RcuDomain::getOldestReaderEpoch() {
+    std::lock_guard<std::mutex> lock(slotsMtx);
+    uint64_t oldest = std::numeric_limits<uint64_t>::max();
+    for (const auto& slot : slots) {
+        const uint64_t epoch = slot->epoch.load();
+        if (epoch != 0) {
+            oldest = std::min(oldest, epoch);
+        }
+    }
+    return oldest;
+}
+}  // namespace ovms
@@ -0,0 +1,135 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ovms {
+/**
+ * @brief Epoch based reclamation of objects replaced in RcuSnapshot.
+ * Each reader thread announces epoch in its own cache line, so read side does not write memory shared with other threads.
+ */
+class RcuDomain {
+public:
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{0};
+        std::atomic<bool> inUse{false};
+        // accessed only by the owning thread
+        uint32_t nesting = 0;
+    };
+
+    static RcuDomain& instance();
+
+    ReaderSlot& getThreadSlot();
+
+    uint64_t getEpoch() const {
+        return globalEpoch.load();
+    }
+
+    uint64_t advanceEpoch() {
+        return globalEpoch.fetch_add(1) + 1;
+    }
+
+    /**
+     * @brief Lowest epoch announced by readers currently inside read side section, UINT64_MAX if there are none
+     */
+    uint64_t getOldestReaderEpoch();
+
+private:
+    RcuDomain() = default;
+    ReaderSlot* acquireSlot();
+
+    std::atomic<uint64_t> globalEpoch{1};
+    std::mutex slotsMtx;
+    std::vector<std::unique_ptr<ReaderSlot>> slots;
+};
+
+/**
+ * @brief Marks read side section. Objects obtained from RcuSnapshot::read() stay valid until guard is destroyed.
+ * Guards can be nested.
+ */
+class RcuReadGuard {
+    RcuDomain::ReaderSlot& slot;
+
+public:
+    RcuReadGuard() :
+        slot(RcuDomain::instance().getThreadSlot()) {
+        if (slot.nesting++ == 0) {
+            slot.epoch.store(RcuDomain::instance().getEpoch());
+        }
+    }
+    ~RcuReadGuard() {
+        if (--slot.nesting == 0) {
+            slot.epoch.store(0, std::memory_order_release);
+        }
+    }
+    RcuReadGuard(const RcuReadGuard&) = delete;
+    RcuReadGuard& operator=(const RcuReadGuard&) = delete;
+};
+
+/**
+ * @brief Immutable snapshot of T replaced as a whole by writers. Readers only load a pointer,
+ * replaced snapshots are released once no reader which could have seen them is inside read side section.
+ */
+template <typename T>
+class RcuSnapshot {
+    std::atomic<const T*> current;
+    std::mutex writeMtx;
+    std::vector<std::pair<uint64_t, std::unique_ptr<const T>>> retired;
+
+    void reclaim() {
+        const uint64_t oldestReaderEpoch = RcuDomain::instance().getOldestReaderEpoch();
+        auto it = retired.begin();
+        while (it != retired.end()) {
+            if (it->first <= oldestReaderEpoch) {
+                it = retired.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+public:
+    RcuSnapshot() :
+        current(new T()) {}
+    ~RcuSnapshot() {
+        delete current.load();
+    }
+    RcuSnapshot(const RcuSnapshot&) = delete;
+    RcuSnapshot& operator=(const RcuSnapshot&) = delete;
+
+    /**
+     * @brief Requires RcuReadGuard in scope for as long as returned object is used
+     */
+    const T& read() const {
+        return *current.load();
+    }
+
+    void publish(std::unique_ptr<const T> next) {
+        std::lock_guard<std::mutex> lock(writeMtx);
+        const T* previous = current.exchange(next.release());
+        // readers which announced epoch after the advance can only see the new snapshot
+        const uint64_t retiredEpoch = RcuDomain::instance().advanceEpoch();
+        retired.emplace_back(retiredEpoch, std::unique_ptr<const T>(previous));
+        reclaim();
+    }
+};
+}  // namespace ovms
@@ -0,0 +1,345 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "response_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "metric.hpp"
+#include "tfs_frontend/tfs_utils.hpp"
+
+namespace ovms {
+
+namespace {
+constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+constexpr uint64_t TFS_KEY_SEED = 1;
+constexpr uint64_t KFS_KEY_SEED = 2;
+constexpr uint64_t TENSOR_KEY_SEED = 3;
+
+inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t read64(const uint8_t* data) {
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t read32(const uint8_t* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint64_t round64(uint64_t accumulator, uint64_t input) {
+    accumulator += input * PRIME64_2;
+    accumulator = rotateLeft(accumulator, 31);
+    return accumulator * PRIME64_1;
+}
+
+inline uint64_t mergeRound64(uint64_t accumulator, uint64_t value) {
+    accumulator ^= round64(0, value);
+    return accumulator * PRIME64_1 + PRIME64_4;
+}
+
+// Chains hashes of consecutive fields, length is part of the seed so field boundaries matter.
+// Fields are also appended with their lengths to canonical key bytes.
+class KeyBuilder {
+public:
+    explicit KeyBuilder(uint64_t seed) :
+        state(seed) {
+        appendLength(seed);
+    }
+    void add(const void* data, size_t length) {
+        state = xxHash64(data, length, state ^ (length * PRIME64_3));
+        appendLength(length);
+        bytes.append(static_cast<const char*>(data), length);
+    }
+    void add(const std::string& value) {
+        add(value.data(), value.size());
+    }
+    void add(uint64_t value) {
+        add(&value, sizeof(value));
+    }
+    ResponseCacheKey release() {
+        return ResponseCacheKey{state, std::move(bytes)};
+    }
+
+private:
+    void appendLength(uint64_t length) {
+        bytes.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+
+    uint64_t state;
+    std::string bytes;
+};
+
+template <typename MapType>
+std::vector<typename MapType::const_iterator> sortedByName(const MapType& map) {
+    std::vector<typename MapType::const_iterator> sorted;
+    sorted.reserve(map.size());
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        sorted.push_back(it);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) { return lhs->first < rhs->first; });
+    return sorted;
+}
+
+// Parameters may change the result (e.g. sequence control, binary outputs) so they are part of the key
+template <typename ParametersMapType>
+void addParameters(KeyBuilder& builder, const ParametersMapType& parameters) {
+    builder.add(static_cast<uint64_t>(parameters.size()));
+    for (const auto& it : sortedByName(parameters)) {
+        builder.add(it->first);
+        builder.add(it->second.SerializeAsString());
+    }
+}
+
+// Every entry holds list node and index node in addition to the response itself
+constexpr size_t ENTRY_OVERHEAD_BYTES = 128;
+}  // namespace
+
+uint64_t xxHash64(const void* data, size_t length, uint64_t seed) {
+    const uint8_t* pos = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = pos + length;
+    uint64_t hash;
+    if (length >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+        uint64_t v2 = seed + PRIME64_2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - PRIME64_1;
+        do {
+            v1 = round64(v1, read64(pos));
+            v2 = round64(v2, read64(pos + 8));
+            v3 = round64(v3, read64(pos + 16));
+            v4 = round64(v4, read64(pos + 24));
+            pos += 32;
+        } while (pos <= limit);
+        hash = rotateLeft(v1, 1) + rotateLeft(v2, 7) + rotateLeft(v3, 12) + rotateLeft(v4, 18);
+        hash = mergeRound64(hash, v1);
+        hash = mergeRound64(hash, v2);
+        hash = mergeRound64(hash, v3);
+        hash = mergeRound64(hash, v4);
+    } else {
+        hash = seed + PRIME64_5;
+    }
+    hash += static_cast<uint64_t>(length);
+    for (; pos + 8 <= end; pos += 8) {
+        hash ^= round64(0, read64(pos));
+        hash = rotateLeft(hash, 27) * PRIME64_1 + PRIME64_4;
+    }
+    if (pos + 4 <= end) {
+        hash ^= static_cast<uint64_t>(read32(pos)) * PRIME64_1;
+        hash = rotateLeft(hash, 23) * PRIME64_2 + PRIME64_3;
+        pos += 4;
+    }
+    for (; pos < end; ++pos) {
+        hash ^= (*pos) * PRIME64_5;
+        hash = rotateLeft(hash, 11) * PRIME64_1;
+    }
+    hash ^= hash >> 33;
+    hash *= PRIME64_2;
+    hash ^= hash >> 29;
+    hash *= PRIME64_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+bool operator==(const ResponseCacheKey& lhs, const ResponseCacheKey& rhs) {
+    return lhs.hash == rhs.hash && lhs.bytes == rhs.bytes;
+}
+
+bool operator!=(const ResponseCacheKey& lhs, const ResponseCacheKey& rhs) {
+    return !(lhs == rhs);
+}
+
+ResponseCacheKey computeResponseCacheKey(const tensorflow::serving::PredictRequest& request) {
+    KeyBuilder builder(TFS_KEY_SEED);
+    // protobuf map iteration order is unspecified
+    for (const auto& it : sortedByName(request.inputs())) {
+        const auto& [name, proto] = *it;
+        builder.add(name);
+        builder.add(static_cast<uint64_t>(proto.dtype()));
+        builder.add(static_cast<uint64_t>(proto.tensor_shape().dim_size()));
+        for (const auto& dim : proto.tensor_shape().dim()) {
+            builder.add(static_cast<uint64_t>(dim.size()));
+        }
+        if (proto.tensor_content().size() > 0) {
+            builder.add(proto.tensor_content());
+        } else {
+            // typed fields, eg. string_val for binary inputs
+            builder.add(proto.SerializeAsString());
+        }
+    }
+    for (const auto& outputName : request.output_filter()) {
+        builder.add(outputName);
+    }
+    return builder.release();
+}
+
+ResponseCacheKey computeResponseCacheKey(const inference::ModelInferRequest& request) {
+    KeyBuilder builder(KFS_KEY_SEED);
+    addParameters(builder, request.parameters());
+    for (int i = 0; i < request.inputs_size(); ++i) {
+        const auto& input = request.inputs(i);
+        builder.add(input.name());
+        builder.add(input.datatype());
+        builder.add(input.shape().data(), input.shape().size() * sizeof(int64_t));
+        addParameters(builder, input.parameters());
+        if (i < request.raw_input_contents_size()) {
+            builder.add(request.raw_input_contents(i));
+        } else {
+            builder.add(input.contents().SerializeAsString());
+        }
+    }
+    for (const auto& output : request.outputs()) {
+        builder.add(output.name());
+        addParameters(builder, output.parameters());
+    }
+    return builder.release();
+}
+
+ResponseCacheKey computeResponseCacheKey(const TensorMap& inputs, const std::set<std::string>& requestedOutputs) {
+    KeyBuilder builder(TENSOR_KEY_SEED);
+    for (const auto& it : sortedByName(inputs)) {
+        const auto& [name, tensor] = *it;
+        builder.add(name);
+        builder.add(tensor.get_element_type().get_type_name());
+        const auto& shape = tensor.get_shape();
+        builder.add(shape.data(), shape.size() * sizeof(size_t));
+        builder.add(tensor.data(), tensor.get_byte_size());
+    }
+    for (const auto& outputName : requestedOutputs) {
+        builder.add(outputName);
+    }
+    return builder.release();
+}
+
+ResponseCache::ResponseCache(size_t capacityBytes, std::chrono::milliseconds timeToLive,
+    MetricCounter* hits, MetricCounter* misses, MetricCounter* evictions) :
+    capacityBytes(capacityBytes),
+    timeToLive(timeToLive),
+    hits(hits),
+    misses(misses),
+    evictions(evictions) {}
+
+std::shared_ptr<const CachedResponse> ResponseCache::find(const ResponseCacheKey& key) {
+    std::shared_ptr<const CachedResponse> response;
+    bool expired = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key.hash);
+        if (it != index.end() && it->second->key.bytes == key.bytes) {
+            if (it->second->expiration <= clock_t::now()) {
+                erase(it->second);
+                expired = true;
+            } else {
+                entries.splice(entries.begin(), entries, it->second);
+                response = it->second->response;
+            }
+        }
+    }
+    if (expired) {
+        INCREMENT_IF_ENABLED(evictions);
+    }
+    if (response) {
+        INCREMENT_IF_ENABLED(hits);
+    } else {
+        INCREMENT_IF_ENABLED(misses);
+    }
+    return response;
+}
+
+void ResponseCache::insert(ResponseCacheKey key, std::shared_ptr<const google::protobuf::Message> message) {
+    const size_t byteSize = message->ByteSizeLong() + ENTRY_OVERHEAD_BYTES;
+    auto response = std::make_shared<CachedResponse>();
+    response->message = std::move(message);
+    insert(std::move(key), std::move(response), byteSize);
+}
+
+void ResponseCache::insert(ResponseCacheKey key, TensorMap tensors) {
+    size_t byteSize = ENTRY_OVERHEAD_BYTES;
+    for (const auto& [name, tensor] : tensors) {
+        byteSize += name.size() + tensor.get_byte_size();
+    }
+    auto response = std::make_shared<CachedResponse>();
+    response->tensors = std::move(tensors);
+    insert(std::move(key), std::move(response), byteSize);
+}
+
+void ResponseCache::insert(ResponseCacheKey key, std::shared_ptr<const CachedResponse> response, size_t byteSize) {
+    // key bytes are kept with the entry
+    byteSize += key.bytes.size();
+    if (byteSize > capacityBytes) {
+        return;
+    }
+    const auto expiration = timeToLive.count() > 0 ? clock_t::now() + timeToLive : clock_t::time_point::max();
+    size_t evictedCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        // entry with colliding hash is replaced
+        auto existing = index.find(key.hash);
+        if (existing != index.end()) {
+            erase(existing->second);
+        }
+        while (!entries.empty() && (sizeInBytes + byteSize > capacityBytes)) {
+            erase(std::prev(entries.end()));
+            ++evictedCount;
+        }
+        const uint64_t hash = key.hash;
+        entries.push_front(Entry{std::move(key), std::move(response), byteSize, expiration});
+        index[hash] = entries.begin();
+        sizeInBytes += byteSize;
+    }
+    if (evictions && evictedCount) {
+        evictions->increment(evictedCount);
+    }
+}
+
+void ResponseCache::erase(std::list<Entry>::iterator it) {
+    sizeInBytes -= it->byteSize;
+    index.erase(it->key.hash);
+    entries.erase(it);
+}
+
+void ResponseCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    sizeInBytes = 0;
+}
+
+size_t ResponseCache::getSizeInBytes() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return sizeInBytes;
+}
+
+size_t ResponseCache::getEntriesCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+}  // namespace ovms
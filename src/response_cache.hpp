@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include <google/protobuf/message.h>
+#include <openvino/openvino.hpp>
+
+#include "dags/tensormap.hpp"
+
+namespace tensorflow::serving {
+class PredictRequest;
+}
+namespace inference {
+class ModelInferRequest;
+}
+
+namespace ovms {
+class MetricCounter;
+
+/**
+ * @brief 64 bit xxHash (XXH64) of byte range.
+ */
+uint64_t xxHash64(const void* data, size_t length, uint64_t seed = 0);
+
+/**
+ * @brief Hash selects cache entry, canonical bytes of the key are compared on lookup
+ * so requests with colliding hashes never get each other's responses.
+ */
+struct ResponseCacheKey {
+    uint64_t hash = 0;
+    std::string bytes;
+};
+
+bool operator==(const ResponseCacheKey& lhs, const ResponseCacheKey& rhs);
+bool operator!=(const ResponseCacheKey& lhs, const ResponseCacheKey& rhs);
+
+/**
+ * @brief Computes cache key out of request inputs content, shapes and datatypes.
+ * Keys of different frontends never match each other.
+ */
+ResponseCacheKey computeResponseCacheKey(const tensorflow::serving::PredictRequest& request);
+ResponseCacheKey computeResponseCacheKey(const inference::ModelInferRequest& request);
+ResponseCacheKey computeResponseCacheKey(const TensorMap& inputs, const std::set<std::string>& requestedOutputs);
+
+struct CachedResponse {
+    std::shared_ptr<const google::protobuf::Message> message;
+    TensorMap tensors;
+};
+
+/**
+ * @brief Memory bounded LRU cache of inference results with time to live.
+ * Used by model instance to skip inference for repeated inputs.
+ */
+class ResponseCache {
+public:
+    ResponseCache(size_t capacityBytes, std::chrono::milliseconds timeToLive,
+        MetricCounter* hits = nullptr, MetricCounter* misses = nullptr, MetricCounter* evictions = nullptr);
+
+    std::shared_ptr<const CachedResponse> find(const ResponseCacheKey& key);
+
+    template <typename ResponseType>
+    bool find(const ResponseCacheKey& key, ResponseType* response) {
+        auto cached = find(key);
+        if (!cached) {
+            return false;
+        }
+        auto* message = dynamic_cast<const ResponseType*>(cached->message.get());
+        if (message == nullptr) {
+            return false;
+        }
+        response->CopyFrom(*message);
+        return true;
+    }
+
+    void insert(ResponseCacheKey key, std::shared_ptr<const google::protobuf::Message> message);
+    void insert(ResponseCacheKey key, TensorMap tensors);
+
+    void clear();
+
+    size_t getSizeInBytes() const;
+    size_t getEntriesCount() const;
+
+private:
+    using clock_t = std::chrono::steady_clock;
+    struct Entry {
+        ResponseCacheKey key;
+        std::shared_ptr<const CachedResponse> response;
+        size_t byteSize;
+        clock_t::time_point expiration;
+    };
+
+    void insert(ResponseCacheKey key, std::shared_ptr<const CachedResponse> response, size_t byteSize);
+    void erase(std::list<Entry>::iterator it);
+
+    const size_t capacityBytes;
+    const std::chrono::milliseconds timeToLive;
+    MetricCounter* hits;
+    MetricCounter* misses;
+    MetricCounter* evictions;
+
+    mutable std::mutex mutex;
+    // most recently used entries are kept at front
+    std::list<Entry> entries;
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+    size_t sizeInBytes = 0;
+};
+}  // namespace ovms
@@ -20,6 +20,7 @@
 
 #include <rapidjson/error/en.h>
 
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "precision.hpp"
 #include "rest_utils.hpp"
 #include "status.hpp"
@@ -715,7 +716,7 @@ Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
         return parseData(dataItr->value, *input);
     } else {
         auto binary_data_size_parameter = input->parameters().find("binary_data_size");
-        if (binary_data_size_parameter != input->parameters().end()) {
+        if (binary_data_size_parameter != input->parameters().end() || usesSharedMemory(input->parameters())) {
             return StatusCode::OK;
         }
         return binaryDataSizeCanBeCalculated(*input, onlyOneInput);
@@ -30,6 +30,7 @@
 #pragma GCC diagnostic ignored "-Wunused-but-set-variable"
 #include "tensorflow_serving/util/json_tensor.h"
 #pragma GCC diagnostic pop
+#include "kfs_frontend/kfs_shared_memory.hpp"
 #include "kfs_frontend/kfs_utils.hpp"
 #include "precision.hpp"
 #include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
@@ -349,7 +350,9 @@ static Status parseOutputs(const ::KFSResponse& response_proto, rapidjson::Prett
         }
         size_t expectedElementsNumber = dataTypeSize > 0 ? expectedContentSize / dataTypeSize : 0;
 
-        if (!seekDataInValField && (tensor.datatype() != "BYTES" && response_proto.raw_output_contents(tensor_it).size() != expectedContentSize))
+        // data of outputs placed in shared memory is not serialized
+        const bool sharedMemoryOutput = usesSharedMemory(tensor.parameters());
+        if (!seekDataInValField && !sharedMemoryOutput && (tensor.datatype() != "BYTES" && response_proto.raw_output_contents(tensor_it).size() != expectedContentSize))
             return StatusCode::REST_SERIALIZE_TENSOR_CONTENT_INVALID_SIZE;
         writer.StartObject();
         writer.Key("name");
@@ -362,6 +365,15 @@ static Status parseOutputs(const ::KFSResponse& response_proto, rapidjson::Prett
         writer.EndArray();
         writer.Key("datatype");
         writer.String(tensor.datatype().c_str());
+        if (sharedMemoryOutput) {
+            auto status = parseOutputParameters(tensor, writer, 0);
+            if (!status.ok()) {
+                return status;
+            }
+            // such outputs have no entry in raw_output_contents
+            writer.EndObject();
+            continue;
+        }
         bool binaryOutput = ((binaryOutputsNames.find(tensor.name().c_str()) != binaryOutputsNames.end()));
         if (!binaryOutput) {
             writer.Key("data");
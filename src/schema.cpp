@@ -53,6 +53,10 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 				"layout": {
 		"$ref": "#/definitions/layout_shape_def"
 				},
+				"wire_precision": {
+					"type": "object",
+					"additionalProperties": {"type": "string"}
+				},
 				"nireq": {
 					"type": "integer",
 					"minimum": 0
@@ -84,6 +88,75 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 					"type": "integer",
 					"minimum": 0
 				},
+				"response_cache": {
+					"type": "object",
+					"required": ["max_size_mb"],
+					"properties": {
+						"max_size_mb": {
+							"type": "integer",
+							"minimum": 1
+						},
+						"ttl_seconds": {
+							"type": "integer",
+							"minimum": 0
+						}
+					},
+					"additionalProperties": false
+				},
+				"auto_tune": {
+					"type": "object",
+					"required": ["max_nireq"],
+					"properties": {
+						"min_nireq": {
+							"type": "integer",
+							"minimum": 1
+						},
+						"max_nireq": {
+							"type": "integer",
+							"minimum": 1,
+							"maximum": 100000
+						},
+						"max_streams": {
+							"type": "integer",
+							"minimum": 1
+						},
+						"interval_seconds": {
+							"type": "integer",
+							"minimum": 1
+						}
+					},
+					"additionalProperties": false
+				},
+				"hedging": {
+					"type": "object",
+					"properties": {
+						"latency_percentile": {
+							"type": "number",
+							"minimum": 50,
+							"maximum": 99.99
+						},
+						"max_extra_load": {
+							"type": "number",
+							"minimum": 0.001,
+							"maximum": 1
+						}
+					},
+					"additionalProperties": false
+				},
+				"warmup": {
+					"type": "object",
+					"properties": {
+						"iterations": {
+							"type": "integer",
+							"minimum": 1
+						},
+						"inputs": {
+							"type": "string",
+							"enum": ["random", "files"]
+						}
+					},
+					"additionalProperties": false
+				},
 				"custom_loader_options": {
 					"type": "object",
 												"required": ["loader_name"],
@@ -346,6 +419,45 @@ const std::string MODELS_CONFIG_SCHEMA = R"({
 				}
 			},
 			"additionalProperties": false
+		},
+		"model_router_variant": {
+			"type": "object",
+			"required": ["model_name"],
+			"properties": {
+				"model_name": {
+					"type": "string"
+				},
+				"model_version": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"max_batch_size": {
+					"type": "integer",
+					"minimum": 1
+				},
+				"max_in_flight_requests": {
+					"type": "integer",
+					"minimum": 1
+				}
+			},
+			"additionalProperties": false
+		},
+		"model_router_config": {
+			"type": "object",
+			"required": ["name", "variants"],
+			"properties": {
+				"name": {
+					"type": "string"
+				},
+				"variants": {
+					"type": "array",
+					"minItems": 1,
+					"items": {
+						"$ref": "#/definitions/model_router_variant"
+					}
+				}
+			},
+			"additionalProperties": false
 		}
 	},
 	"type": "object",
@@ -383,6 +495,12 @@ const std::string MODELS_CONFIG_SCHEMA = R"({
 				"$ref": "#/definitions/custom_node_library_config"
 			}
 		},
+		"model_router_config_list": {
+			"type": "array",
+			"items": {
+				"$ref": "#/definitions/model_router_config"
+			}
+		},
 		"monitoring": {
 			"type": "object",
 			"required": ["metrics"],
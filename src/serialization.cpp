@@ -15,16 +15,25 @@
 //*****************************************************************************
 #include "serialization.hpp"
 
+#include <cstring>
+#include <vector>
+
 #include "kfs_frontend/kfs_utils.hpp"
 #include "logging.hpp"
 #include "ov_utils.hpp"
 #include "precision.hpp"
+#include "precision_conversion.hpp"
 #include "status.hpp"
 #include "tensor_conversion.hpp"
 #include "tfs_frontend/tfs_utils.hpp"
 
 namespace ovms {
 
+static bool isStringOutput(const TensorInfo& servableOutput) {
+    return servableOutput.getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8 ||
+           servableOutput.getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_1D_U8;
+}
+
 static Status serializePrecision(
     tensorflow::TensorProto& responseOutput,
     const std::shared_ptr<const TensorInfo>& servableOutput,
@@ -76,7 +85,7 @@ static Status serializePrecision(
             tensor.get_element_type().get_type_name());
         return StatusCode::INTERNAL_ERROR;
     }
-    if (servableOutput->getPrecision() == ovms::Precision::U8 && servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
+    if (servableOutput->getPrecision() == ovms::Precision::U8 && isStringOutput(*servableOutput)) {
         responseOutput.set_datatype("BYTES");
         return StatusCode::OK;
     }
@@ -150,6 +159,16 @@ static Status serializeShape(
         responseOutput.add_shape(tensor.get_shape()[0]);
         return StatusCode::OK;
     }
+    if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_1D_U8) {
+        if (tensor.get_byte_size() < sizeof(uint32_t)) {
+            SPDLOG_ERROR("Failed to serialize tensor: {}. String tensor does not contain batch size", servableOutput->getName());
+            return StatusCode::INTERNAL_ERROR;
+        }
+        uint32_t batchSize = 0;
+        std::memcpy(&batchSize, tensor.data(), sizeof(uint32_t));
+        responseOutput.add_shape(batchSize);
+        return StatusCode::OK;
+    }
     for (size_t i = 0; i < effectiveNetworkOutputShape.size(); ++i) {
         dimension_value_t dim = actualTensorShape[i];
         if (!effectiveNetworkOutputShape[i].match(dim)) {
@@ -171,6 +190,21 @@ static void serializeContent(std::string* content, ov::Tensor& tensor) {
     }
 }
 
+static void serializeContentInWirePrecision(std::string* content, ov::Tensor& tensor, Precision wirePrecision) {
+    OVMS_PROFILE_FUNCTION();
+    // Content can be already filled in model precision in gather exit node handler.
+    const float* source = content->empty() ? reinterpret_cast<const float*>(tensor.data()) : reinterpret_cast<const float*>(content->data());
+    const size_t count = content->empty() ? tensor.get_size() : content->size() / sizeof(float);
+    std::string converted(count * sizeof(uint16_t), '\0');
+    uint16_t* destination = reinterpret_cast<uint16_t*>(converted.data());
+    if (wirePrecision == Precision::BF16) {
+        convertFp32ToBf16(source, destination, count);
+    } else {
+        convertFp32ToFp16(source, destination, count);
+    }
+    *content = std::move(converted);
+}
+
 static void serializeStringContent(std::string* content, ov::Tensor& tensor) {
     OVMS_PROFILE_FUNCTION();
     // We only fill if the content is not already filled.
@@ -181,16 +215,52 @@ static void serializeStringContent(std::string* content, ov::Tensor& tensor) {
 
     size_t batchSize = tensor.get_shape()[0];
     size_t maxStringLen = tensor.get_shape()[1];
+    content->reserve(batchSize * sizeof(uint32_t) + tensor.get_byte_size());
     for (size_t i = 0; i < batchSize; i++) {
         uint32_t strLen = strnlen((char*)tensor.data() + i * maxStringLen, maxStringLen);
         content->append(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
         content->append((char*)tensor.data() + i * maxStringLen, strLen);
     }
 }
-#define SERIALIZE_BY_DATATYPE(contents, datatype)                                  \
-    for (size_t i = 0; i < tensor.get_byte_size(); i += sizeof(datatype)) {        \
-        auto value = responseOutput.mutable_contents()->contents()->Add();         \
-        *value = (*(reinterpret_cast<const datatype*>((char*)tensor.data() + i))); \
+
+static Status serializeRaggedStringContent(std::string* content, ov::Tensor& tensor) {
+    OVMS_PROFILE_FUNCTION();
+    if (!content->empty()) {
+        return StatusCode::OK;
+    }
+    // string lengths are known from offsets, no need to scan for terminating zeros
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(tensor.data());
+    uint32_t batchSize = 0;
+    std::memcpy(&batchSize, data, sizeof(uint32_t));
+    const size_t metadataLength = sizeof(uint32_t) * (static_cast<size_t>(batchSize) + 2);
+    if (metadataLength > tensor.get_byte_size()) {
+        SPDLOG_ERROR("String tensor of size: {} cannot hold offsets for batch: {}", tensor.get_byte_size(), batchSize);
+        return StatusCode::INTERNAL_ERROR;
+    }
+    std::vector<uint32_t> offsets(batchSize + 1);
+    std::memcpy(offsets.data(), data + sizeof(uint32_t), offsets.size() * sizeof(uint32_t));
+    const char* strings = reinterpret_cast<const char*>(data + metadataLength);
+    const size_t stringsLength = tensor.get_byte_size() - metadataLength;
+    content->reserve(batchSize * sizeof(uint32_t) + stringsLength);
+    for (uint32_t i = 0; i < batchSize; i++) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > stringsLength) {
+            SPDLOG_ERROR("String tensor offsets out of range: [{}, {}) for strings length: {}", offsets[i], offsets[i + 1], stringsLength);
+            content->clear();
+            return StatusCode::INTERNAL_ERROR;
+        }
+        uint32_t strLen = offsets[i + 1] - offsets[i];
+        content->append(reinterpret_cast<const char*>(&strLen), sizeof(strLen));
+        content->append(strings + offsets[i], strLen);
+    }
+    return StatusCode::OK;
+}
+#define SERIALIZE_BY_DATATYPE(contents, datatype)                                              \
+    {                                                                                          \
+        auto* repeatedField = responseOutput.mutable_contents()->contents();                   \
+        const size_t count = tensor.get_byte_size() / sizeof(datatype);                        \
+        repeatedField->Resize(repeatedField->size() + count, 0);                               \
+        auto* destination = repeatedField->mutable_data() + (repeatedField->size() - count);   \
+        convertContents(reinterpret_cast<const datatype*>(tensor.data()), destination, count); \
     }
 
 static void serializeContent(::inference::ModelInferResponse::InferOutputTensor& responseOutput, ov::Tensor& tensor) {
@@ -228,6 +298,9 @@ Status serializeTensorToTensorProto(
     if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
         return convertOVTensor2DToStringResponse(tensor, responseOutput);
     }
+    if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_1D_U8) {
+        return convertOVTensor1DToStringResponse(tensor, responseOutput);
+    }
     auto status = serializePrecision(responseOutput, servableOutput, tensor);
     if (!status.ok()) {
         return status;
@@ -256,6 +329,11 @@ Status serializeTensorToTensorProtoRaw(
     }
     if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
         serializeStringContent(rawOutputContents, tensor);
+    } else if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_1D_U8) {
+        return serializeRaggedStringContent(rawOutputContents, tensor);
+    } else if (servableOutput->getWirePrecision() != Precision::UNDEFINED) {
+        responseOutput.set_datatype(wirePrecisionToKFSPrecision(servableOutput->getWirePrecision()));
+        serializeContentInWirePrecision(rawOutputContents, tensor, servableOutput->getWirePrecision());
     } else {
         serializeContent(rawOutputContents, tensor);
     }
@@ -270,6 +348,9 @@ Status serializeTensorToTensorProto(
     if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_2D_U8) {
         return convertOVTensor2DToStringResponse(tensor, responseOutput);
     }
+    if (servableOutput->getPostProcessingHint() == TensorInfo::ProcessingHint::STRING_1D_U8) {
+        return convertOVTensor1DToStringResponse(tensor, responseOutput);
+    }
     auto status = serializePrecision(responseOutput, servableOutput, tensor);
     if (!status.ok()) {
         return status;
@@ -51,6 +51,7 @@
 #include "profilermodule.hpp"
 #include "servablemanagermodule.hpp"
 #include "stringutils.hpp"
+#include "systeminfo.hpp"
 #include "version.hpp"
 
 #if (PYTHON_DISABLE == 0)
@@ -81,6 +82,7 @@ static void logConfig(const Config& config) {
     std::string project_version(PROJECT_VERSION);
     SPDLOG_INFO(project_name + " " + project_version);
     SPDLOG_INFO("OpenVINO backend {}", OPENVINO_NAME);
+    SPDLOG_INFO("CPU topology - {}", getCpuTopology().toString());
     SPDLOG_DEBUG("CLI parameters passed to ovms server");
     if (config.configPath().empty()) {
         SPDLOG_DEBUG("model_path: {}", config.modelPath());
@@ -105,12 +107,22 @@ static void logConfig(const Config& config) {
     SPDLOG_DEBUG("gRPC bind address: {}", config.grpcBindAddress());
     SPDLOG_DEBUG("REST bind address: {}", config.restBindAddress());
     SPDLOG_DEBUG("REST workers: {}", config.restWorkers());
+    SPDLOG_DEBUG("REST reactors: {}", config.restReactors());
     SPDLOG_DEBUG("gRPC workers: {}", config.grpcWorkers());
     SPDLOG_DEBUG("gRPC channel arguments: {}", config.grpcChannelArguments());
+    SPDLOG_DEBUG("gRPC compression: {}", config.grpcCompression());
+    SPDLOG_DEBUG("max stream graphs: {}", config.maxStreamGraphs());
+    SPDLOG_DEBUG("stream resume grace period seconds: {}", config.streamResumeGracePeriodSeconds());
+    SPDLOG_DEBUG("system shared memory enable: {}", config.systemSharedMemoryEnabled());
+    SPDLOG_DEBUG("system shared memory key prefix: {}", config.systemSharedMemoryKeyPrefix());
     SPDLOG_DEBUG("log level: {}", config.logLevel());
     SPDLOG_DEBUG("log path: {}", config.logPath());
+    SPDLOG_DEBUG("log async: {}", config.logAsync());
     SPDLOG_DEBUG("file system poll wait seconds: {}", config.filesystemPollWaitSeconds());
     SPDLOG_DEBUG("sequence cleaner poll wait minutes: {}", config.sequenceCleanerPollWaitMinutes());
+    SPDLOG_DEBUG("tensor memory pool size mb: {}", config.tensorMemoryPoolSizeMb());
+    SPDLOG_DEBUG("traffic capture path: {}", config.trafficCapturePath());
+    SPDLOG_DEBUG("traffic capture ratio: {}", config.trafficCaptureRatio());
 }
 
 static void onInterrupt(int status) {
@@ -306,6 +318,13 @@ public:
     }
 };
 
+class LoggerShutdownGuard {
+public:
+    ~LoggerShutdownGuard() {
+        shutdown_logger();
+    }
+};
+
 void Server::shutdownModules() {
     // we want very precise order of modules shutdown
     // first we should stop incoming new requests
@@ -338,6 +357,8 @@ int Server::start(int argc, char** argv) {
     ModelsSettingsImpl modelsSettings;
     parser.parse(argc, argv);
     parser.prepare(&serverSettings, &modelsSettings);
+    // destroyed after modules are shut down, so that their messages are written out
+    LoggerShutdownGuard loggerShutdownGuard;
     Status ret = start(&serverSettings, &modelsSettings);
     ModulesShutdownGuard shutdownGuard(*this);
     if (!ret.ok()) {
@@ -369,7 +390,7 @@ Status Server::start(ServerSettingsImpl* serverSettings, ModelsSettingsImpl* mod
         auto& config = ovms::Config::instance();
         if (!config.parse(serverSettings, modelsSettings))
             return StatusCode::OPTIONS_USAGE_ERROR;
-        configure_logger(config.logLevel(), config.logPath());
+        configure_logger(config.logLevel(), config.logPath(), config.logAsync());
         logConfig(config);
         return this->startModules(config, withPython);
     } catch (std::exception& e) {
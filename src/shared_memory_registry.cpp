@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "shared_memory_registry.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "logging.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+SharedMemoryRegion::SharedMemoryRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize, void* mapping, size_t mappingSize, char* base) :
+    name(name),
+    key(key),
+    offset(offset),
+    byteSize(byteSize),
+    mapping(mapping),
+    mappingSize(mappingSize),
+    base(base) {}
+
+SharedMemoryRegion::~SharedMemoryRegion() {
+    if (munmap(mapping, mappingSize) != 0) {
+        SPDLOG_WARN("Unmapping shared memory region: {} failed: {}", name, std::strerror(errno));
+    }
+}
+
+Status SharedMemoryRegion::getBuffer(size_t offset, size_t byteSize, char** buffer) const {
+    if (offset > this->byteSize || byteSize > this->byteSize - offset) {
+        std::stringstream ss;
+        ss << "Region: " << name << " size: " << this->byteSize << "; requested offset: " << offset << " byte size: " << byteSize;
+        return Status(StatusCode::SHM_OUT_OF_BOUNDS, ss.str());
+    }
+    *buffer = base + offset;
+    return StatusCode::OK;
+}
+
+static std::string stripLeadingSlashes(const std::string& key) {
+    auto position = key.find_first_not_of('/');
+    return position == std::string::npos ? std::string() : key.substr(position);
+}
+
+void SharedMemoryRegistry::configure(bool enabled, const std::string& keyPrefix) {
+    std::unique_lock lock(mtx);
+    this->enabled = enabled;
+    this->keyPrefix = stripLeadingSlashes(keyPrefix);
+}
+
+Status SharedMemoryRegistry::registerRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize) {
+    if (name.empty() || key.empty() || byteSize == 0) {
+        return Status(StatusCode::INVALID_SHM_PARAMETERS, "region name, key and non zero byte size are required");
+    }
+    {
+        std::shared_lock lock(mtx);
+        if (!enabled) {
+            return StatusCode::SHM_DISABLED;
+        }
+        const std::string objectName = stripLeadingSlashes(key);
+        if (objectName.empty() || keyPrefix.empty() || objectName.rfind(keyPrefix, 0) != 0 || objectName.find('/') != std::string::npos) {
+            SPDLOG_DEBUG("Rejected registration of shared memory object: {} not matching allowed prefix: {}", key, keyPrefix);
+            return Status(StatusCode::SHM_KEY_NOT_ALLOWED, key);
+        }
+    }
+    {
+        std::shared_lock lock(mtx);
+        if (regions.count(name)) {
+            return Status(StatusCode::SHM_REGION_ALREADY_REGISTERED, name);
+        }
+    }
+    int fd = shm_open(key.c_str(), O_RDWR, 0);
+    if (fd == -1) {
+        SPDLOG_DEBUG("Opening shared memory object: {} failed: {}", key, std::strerror(errno));
+        return Status(StatusCode::SHM_REGION_MAPPING_FAILED, "unable to open shared memory object: " + key);
+    }
+    struct stat objectStat;
+    if (fstat(fd, &objectStat) != 0 || offset > static_cast<size_t>(objectStat.st_size) || byteSize > static_cast<size_t>(objectStat.st_size) - offset) {
+        close(fd);
+        return Status(StatusCode::SHM_REGION_MAPPING_FAILED, "region exceeds size of shared memory object: " + key);
+    }
+    // mmap offset has to be page aligned
+    const size_t pageSize = sysconf(_SC_PAGESIZE);
+    const size_t mappingOffset = offset - offset % pageSize;
+    const size_t mappingSize = byteSize + offset - mappingOffset;
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, mappingOffset);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        SPDLOG_DEBUG("Mapping shared memory object: {} failed: {}", key, std::strerror(errno));
+        return Status(StatusCode::SHM_REGION_MAPPING_FAILED, "unable to map shared memory object: " + key);
+    }
+    auto region = std::make_shared<const SharedMemoryRegion>(name, key, offset, byteSize, mapping, mappingSize, static_cast<char*>(mapping) + (offset - mappingOffset));
+    std::unique_lock lock(mtx);
+    if (!regions.emplace(name, std::move(region)).second) {
+        return Status(StatusCode::SHM_REGION_ALREADY_REGISTERED, name);
+    }
+    SPDLOG_INFO("Registered shared memory region: {}; key: {}; offset: {}; byte size: {}", name, key, offset, byteSize);
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegistry::unregisterRegion(const std::string& name) {
+    std::unique_lock lock(mtx);
+    if (name.empty()) {
+        regions.clear();
+        SPDLOG_INFO("Unregistered all shared memory regions");
+        return StatusCode::OK;
+    }
+    if (regions.erase(name) == 0) {
+        return Status(StatusCode::SHM_REGION_MISSING, name);
+    }
+    SPDLOG_INFO("Unregistered shared memory region: {}", name);
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegistry::getRegion(const std::string& name, std::shared_ptr<const SharedMemoryRegion>& region) const {
+    std::shared_lock lock(mtx);
+    auto it = regions.find(name);
+    if (it == regions.end()) {
+        return Status(StatusCode::SHM_REGION_MISSING, name);
+    }
+    region = it->second;
+    return StatusCode::OK;
+}
+
+Status SharedMemoryRegistry::getRegions(const std::string& name, std::vector<std::shared_ptr<const SharedMemoryRegion>>& result) const {
+    result.clear();
+    if (!name.empty()) {
+        std::shared_ptr<const SharedMemoryRegion> region;
+        auto status = getRegion(name, region);
+        if (status.ok()) {
+            result.push_back(std::move(region));
+        }
+        return status;
+    }
+    std::shared_lock lock(mtx);
+    for (const auto& [regionName, region] : regions) {
+        result.push_back(region);
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
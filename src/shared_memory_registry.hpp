@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief System shared memory (POSIX shm) segment part mapped into server address space.
+ * Mapping is released when the last reference is dropped, so region stays valid
+ * for inferences which started before it was unregistered.
+ */
+class SharedMemoryRegion {
+    const std::string name;
+    const std::string key;
+    const size_t offset;
+    const size_t byteSize;
+    void* mapping;
+    size_t mappingSize;
+    char* base;
+
+public:
+    SharedMemoryRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize, void* mapping, size_t mappingSize, char* base);
+    ~SharedMemoryRegion();
+    SharedMemoryRegion(const SharedMemoryRegion&) = delete;
+    SharedMemoryRegion& operator=(const SharedMemoryRegion&) = delete;
+
+    const std::string& getName() const { return name; }
+    const std::string& getKey() const { return key; }
+    size_t getOffset() const { return offset; }
+    size_t getByteSize() const { return byteSize; }
+
+    /**
+     * @brief Returns pointer to byteSize bytes starting at offset relative to the region start.
+     */
+    Status getBuffer(size_t offset, size_t byteSize, char** buffer) const;
+};
+
+class SharedMemoryRegistry {
+    mutable std::shared_mutex mtx;
+    std::map<std::string, std::shared_ptr<const SharedMemoryRegion>> regions;
+    bool enabled = false;
+    std::string keyPrefix;
+
+public:
+    /**
+     * @brief Registration is rejected unless enabled, only shared memory objects with key starting with keyPrefix can be mapped.
+     * Leading slashes of keys are ignored, the same as in shm_open.
+     */
+    void configure(bool enabled, const std::string& keyPrefix);
+
+    /**
+     * @brief Maps byteSize bytes of shared memory object key starting at offset and registers it as region name.
+     */
+    Status registerRegion(const std::string& name, const std::string& key, size_t offset, size_t byteSize);
+
+    /**
+     * @brief Unregisters region name or all regions when name is empty.
+     */
+    Status unregisterRegion(const std::string& name);
+
+    Status getRegion(const std::string& name, std::shared_ptr<const SharedMemoryRegion>& region) const;
+
+    /**
+     * @brief Returns region name or all regions when name is empty.
+     */
+    Status getRegions(const std::string& name, std::vector<std::shared_ptr<const SharedMemoryRegion>>& result) const;
+};
+}  // namespace ovms
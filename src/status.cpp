@@ -24,6 +24,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::PATH_INVALID, "The provided base path is invalid or doesn't exists"},
     {StatusCode::FILE_INVALID, "File not found or cannot open"},
     {StatusCode::CONFIG_FILE_INVALID, "Configuration file not found or cannot open"},
+    {StatusCode::TRAFFIC_LOG_CORRUPTED, "Traffic log file is malformed or truncated"},
     {StatusCode::FILESYSTEM_ERROR, "Error during filesystem operation"},
     {StatusCode::NOT_IMPLEMENTED, "Functionality not implemented"},
     {StatusCode::NO_MODEL_VERSION_AVAILABLE, "Not a single model version directory has valid numeric name"},
@@ -38,6 +39,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::MODEL_VERSION_POLICY_WRONG_FORMAT, "Model version policy is in wrong format"},
     {StatusCode::MODEL_VERSION_POLICY_UNSUPPORTED_KEY, "Model version policy contains unsupported key"},
     {StatusCode::GRPC_CHANNEL_ARG_WRONG_FORMAT, "Grpc channel arguments passed in wrong format"},
+    {StatusCode::GRPC_COMPRESSION_WRONG_FORMAT, "Grpc compression passed in wrong format. Supported algorithms: none, deflate, gzip"},
     {StatusCode::CONFIG_FILE_TIMESTAMP_READING_FAILED, "Error during config file timestamp reading"},
     {StatusCode::RESHAPE_ERROR, "Model could not be reshaped with requested shape"},
     {StatusCode::RESHAPE_REQUIRED, "Model needs to be reloaded with new shape"},
@@ -74,6 +76,11 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::INVALID_BATCH_DIMENSION, "Invalid batch dimension in shape"},
     {StatusCode::LAYOUT_INCOMPATIBLE_WITH_SHAPE, "Layout incompatible with given shape"},
     {StatusCode::MODEL_WITH_SCALAR_AUTO_UNSUPPORTED, "Batching set to AUTO but model contains scalar tensor"},
+    {StatusCode::WIRE_PRECISION_WRONG_FORMAT, "The provided wire precision is in wrong format. Supported values: FP16, BF16"},
+    {StatusCode::WIRE_PRECISION_UNSUPPORTED, "Wire precision can be configured only for FP32 tensors"},
+    {StatusCode::RESPONSE_CACHE_WITH_STATEFUL_MODEL, "Response cache cannot be used with stateful model"},
+    {StatusCode::AUTO_TUNE_WRONG_BOUNDS, "Auto-tune min_nireq cannot be greater than max_nireq"},
+    {StatusCode::HEDGING_WITH_STATEFUL_MODEL, "Hedging cannot be used with stateful model"},
     {StatusCode::ALLOW_CACHE_WITH_CUSTOM_LOADER, "allow_cache is set to true with custom loader usage"},
     {StatusCode::UNKNOWN_ERROR, "Unknown error"},
 
@@ -105,6 +112,15 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::INVALID_VALUE_COUNT, "Invalid number of values in tensor proto container"},
     {StatusCode::INVALID_CONTENT_SIZE, "Invalid content size of tensor proto"},
     {StatusCode::INVALID_MESSAGE_STRUCTURE, "Passing buffers both in ModelInferRequest::InferInputTensor::contents and in ModelInferRequest::raw_input_contents is not allowed"},
+    {StatusCode::INVALID_CHUNKED_REQUEST, "Invalid chunk of streamed inference request"},
+    {StatusCode::CHUNKED_REQUEST_INCOMPLETE, "Stream closed before final chunk of inference request was received"},
+    {StatusCode::SHM_REGION_ALREADY_REGISTERED, "Shared memory region with that name is already registered"},
+    {StatusCode::SHM_REGION_MISSING, "Shared memory region with that name is not registered"},
+    {StatusCode::SHM_REGION_MAPPING_FAILED, "Unable to map shared memory object"},
+    {StatusCode::INVALID_SHM_PARAMETERS, "Invalid shared memory parameters of tensor"},
+    {StatusCode::SHM_OUT_OF_BOUNDS, "Tensor data does not fit in shared memory region"},
+    {StatusCode::SHM_DISABLED, "System shared memory is not enabled in the server"},
+    {StatusCode::SHM_KEY_NOT_ALLOWED, "Shared memory object key is not allowed"},
     {StatusCode::UNSUPPORTED_LAYOUT, "Received binary image input but resource not configured to accept NHWC layout"},
 
     // Deserialization
@@ -215,6 +231,12 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::MEDIAPIPE_UNINITIALIZED_STREAM_CLOSURE, "Client disconnected during reading first streaming request"},
     {StatusCode::MEDIAPIPE_INCORRECT_SERVABLE_NAME, "Subsequent request with incorrect servable name"},
     {StatusCode::MEDIAPIPE_INCORRECT_SERVABLE_VERSION, "Subsequent request with incorrect servable version"},
+    {StatusCode::MEDIAPIPE_MAX_STREAMS_REACHED, "Max number of live streaming graphs reached"},
+    {StatusCode::MEDIAPIPE_STREAM_ALREADY_ATTACHED, "Stream with given id is already in progress"},
+
+    // Model router
+    {StatusCode::MODEL_ROUTER_NAME_OCCUPIED, "Given model router name is already occupied"},
+    {StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT, "None of model router variants accepts request inputs"},
 
     // Python Nodes
     {StatusCode::PYTHON_NODE_NAME_ALREADY_EXISTS, "The Python Node name is already present in nodes list"},
@@ -265,6 +287,7 @@ const std::unordered_map<const StatusCode, const std::string> Status::statusMess
     {StatusCode::CUSTOM_LOADER_NOT_PRESENT, "The custom loader is not present in loaders list"},
     {StatusCode::CUSTOM_LOADER_INIT_FAILED, "Custom Loader LoadInit failed"},
     {StatusCode::CUSTOM_LOADER_ERROR, "Custom Loader Generic / Unknown Error"},
+    {StatusCode::IMPORTED_MODEL_RESHAPE_NOT_SUPPORTED, "Model imported from compiled blob does not support batch size, shape and layout parameters"},
 
     // Custom Node
     {StatusCode::NODE_LIBRARY_ALREADY_LOADED, "Custom node library is already loaded"},
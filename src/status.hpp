@@ -331,6 +331,47 @@ enum class StatusCode {
     SERVER_ALREADY_STARTING,
     MODULE_ALREADY_INSERTED,
 
+    // System shared memory
+    SHM_REGION_ALREADY_REGISTERED, /*!< Shared memory region with that name is already registered */
+    SHM_REGION_MISSING,            /*!< Shared memory region with that name is not registered */
+    SHM_REGION_MAPPING_FAILED,     /*!< Shared memory object could not be opened or mapped */
+    INVALID_SHM_PARAMETERS,        /*!< Invalid shared memory parameters of tensor */
+    SHM_OUT_OF_BOUNDS,             /*!< Tensor data does not fit in shared memory region */
+    SHM_DISABLED,                  /*!< System shared memory is not enabled in the server */
+    SHM_KEY_NOT_ALLOWED,           /*!< Shared memory object key does not match allowed prefix */
+
+    // Traffic capture
+    TRAFFIC_LOG_CORRUPTED, /*!< Traffic log file is malformed or truncated */
+
+    // Mediapipe streams
+    MEDIAPIPE_MAX_STREAMS_REACHED,
+    MEDIAPIPE_STREAM_ALREADY_ATTACHED,
+
+    // Model router
+    MODEL_ROUTER_NAME_OCCUPIED,
+    MODEL_ROUTER_NO_MATCHING_VARIANT,
+
+    // Wire precision
+    WIRE_PRECISION_WRONG_FORMAT,
+    WIRE_PRECISION_UNSUPPORTED, /*!< Wire precision configured for tensor which is not FP32 */
+
+    // Imported models
+    IMPORTED_MODEL_RESHAPE_NOT_SUPPORTED,
+
+    // Response cache
+    RESPONSE_CACHE_WITH_STATEFUL_MODEL,
+
+    // Auto-tuning
+    AUTO_TUNE_WRONG_BOUNDS, /*!< Auto-tune minimum nireq above maximum */
+
+    // gRPC compression and chunked streaming
+    GRPC_COMPRESSION_WRONG_FORMAT, /*!< The provided gRPC compression param is in wrong format */
+    INVALID_CHUNKED_REQUEST,       /*!< Chunks of streamed request do not match its first chunk */
+    CHUNKED_REQUEST_INCOMPLETE,    /*!< Stream closed before final chunk of request */
+
+    // Hedging
+    HEDGING_WITH_STATEFUL_MODEL,
+
     STATUS_CODE_END
 };
 
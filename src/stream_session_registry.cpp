@@ -0,0 +1,175 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "stream_session_registry.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+StreamSessionRegistry::StreamSessionRegistry(uint32_t maxLiveSessions, std::chrono::milliseconds gracePeriod) :
+    maxLiveSessions(maxLiveSessions),
+    gracePeriod(gracePeriod) {}
+
+StreamSessionRegistry::~StreamSessionRegistry() {
+    stopCleaner();
+    closeAll();
+}
+
+Status StreamSessionRegistry::admit() {
+    std::shared_ptr<StreamSession> evicted;
+    std::string evictedId;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        if (maxLiveSessions == 0 || liveSessions < maxLiveSessions) {
+            ++liveSessions;
+            return StatusCode::OK;
+        }
+        auto oldest = entries.end();
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (!it->second.attached && (oldest == entries.end() || it->second.parkedAt < oldest->second.parkedAt)) {
+                oldest = it;
+            }
+        }
+        if (oldest == entries.end()) {
+            return StatusCode::MEDIAPIPE_MAX_STREAMS_REACHED;
+        }
+        // new session takes over the slot of evicted one
+        evictedId = oldest->first;
+        evicted = std::move(oldest->second.session);
+        entries.erase(oldest);
+    }
+    SPDLOG_DEBUG("Closing parked stream session: {} to admit new stream", evictedId);
+    evicted->close();
+    return StatusCode::OK;
+}
+
+void StreamSessionRegistry::release() {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (liveSessions > 0) {
+        --liveSessions;
+    }
+}
+
+Status StreamSessionRegistry::resume(const std::string& id, std::shared_ptr<StreamSession>& session) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto [it, inserted] = entries.try_emplace(id);
+    if (inserted) {
+        session.reset();
+        return StatusCode::OK;
+    }
+    if (it->second.attached) {
+        SPDLOG_DEBUG("Stream session: {} is already attached to other stream", id);
+        return StatusCode::MEDIAPIPE_STREAM_ALREADY_ATTACHED;
+    }
+    it->second.attached = true;
+    session = it->second.session;
+    SPDLOG_DEBUG("Resuming stream session: {}", id);
+    return StatusCode::OK;
+}
+
+void StreamSessionRegistry::attach(const std::string& id, std::shared_ptr<StreamSession> session) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto& entry = entries[id];
+    entry.session = std::move(session);
+    entry.attached = true;
+}
+
+void StreamSessionRegistry::detach(const std::string& id, clock::time_point now) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto it = entries.find(id);
+    if (it == entries.end()) {
+        return;
+    }
+    if (!it->second.session) {
+        entries.erase(it);
+        return;
+    }
+    it->second.attached = false;
+    it->second.parkedAt = now;
+    SPDLOG_DEBUG("Parked stream session: {}", id);
+}
+
+void StreamSessionRegistry::remove(const std::string& id) {
+    std::unique_lock<std::mutex> lock(mtx);
+    entries.erase(id);
+}
+
+size_t StreamSessionRegistry::closeExpired(clock::time_point now) {
+    std::vector<std::shared_ptr<StreamSession>> expired;
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        for (auto it = entries.begin(); it != entries.end();) {
+            if (!it->second.attached && now - it->second.parkedAt >= gracePeriod) {
+                SPDLOG_DEBUG("Stream session: {} was not resumed within grace period, closing", it->first);
+                expired.emplace_back(std::move(it->second.session));
+                it = entries.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        liveSessions -= std::min(liveSessions, expired.size());
+    }
+    // closing waits for graphs to finish, mutex is released so streams are not blocked
+    for (auto& session : expired) {
+        session->close();
+    }
+    return expired.size();
+}
+
+void StreamSessionRegistry::closeAll() {
+    closeExpired(clock::time_point::max());
+}
+
+void StreamSessionRegistry::startCleaner() {
+    if (!isResumeEnabled() || cleanerThread.joinable()) {
+        return;
+    }
+    const auto interval = std::min<std::chrono::milliseconds>(gracePeriod, std::chrono::seconds(1));
+    cleanerThread = std::thread([this, interval, exitSignal = cleanerExitTrigger.get_future()]() {
+        SPDLOG_DEBUG("Started stream sessions cleaner thread");
+        while (exitSignal.wait_for(interval) == std::future_status::timeout) {
+            closeExpired();
+        }
+        SPDLOG_DEBUG("Stopped stream sessions cleaner thread");
+    });
+}
+
+void StreamSessionRegistry::stopCleaner() {
+    if (!cleanerThread.joinable()) {
+        return;
+    }
+    cleanerExitTrigger.set_value();
+    cleanerThread.join();
+}
+
+size_t StreamSessionRegistry::getLiveSessionsCount() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return liveSessions;
+}
+
+size_t StreamSessionRegistry::getParkedSessionsCount() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    size_t parked = 0;
+    for (const auto& [id, entry] : entries) {
+        parked += entry.attached ? 0 : 1;
+    }
+    return parked;
+}
+}  // namespace ovms
@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "status.hpp"
+
+namespace ovms {
+
+/**
+ * @brief State of streaming request processing which may outlive single client connection.
+ */
+class StreamSession {
+public:
+    virtual ~StreamSession() = default;
+    /**
+     * @brief Releases session resources. Called once, after session is no longer attached to any stream.
+     */
+    virtual void close() = 0;
+};
+
+/**
+ * @brief Admission control and resumable sessions of streaming requests.
+ *
+ * Each live streaming graph takes one slot, either while serving a stream or while parked
+ * waiting for the client to reconnect. When no slot is free, the least recently parked session
+ * is closed to make room; if every live session is serving a stream, new streams are rejected.
+ *
+ * Sessions are identified by client provided stream id. When stream with id ends, its session
+ * is parked for grace period and the next stream with the same id continues on it.
+ */
+class StreamSessionRegistry {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @param maxLiveSessions 0 - no limit
+     * @param gracePeriod 0 - sessions are not resumable
+     */
+    StreamSessionRegistry(uint32_t maxLiveSessions, std::chrono::milliseconds gracePeriod);
+    ~StreamSessionRegistry();
+
+    bool isResumeEnabled() const { return gracePeriod.count() > 0; }
+
+    /**
+     * @brief Reserves slot for new session.
+     *
+     * @return MEDIAPIPE_MAX_STREAMS_REACHED when all slots are taken by attached sessions
+     */
+    Status admit();
+    /**
+     * @brief Releases slot of session closed outside of the registry.
+     */
+    void release();
+
+    /**
+     * @brief Attaches parked session with given id to the calling stream.
+     *
+     * When there is no such session, session is set to nullptr and the id is reserved
+     * for new session which has to be registered with attach() or dropped with remove().
+     *
+     * @return MEDIAPIPE_STREAM_ALREADY_ATTACHED when other stream uses the id
+     */
+    Status resume(const std::string& id, std::shared_ptr<StreamSession>& session);
+    void attach(const std::string& id, std::shared_ptr<StreamSession> session);
+    /**
+     * @brief Parks session after its stream ended, session is closed if not resumed within grace period.
+     */
+    void detach(const std::string& id, clock::time_point now = clock::now());
+    /**
+     * @brief Forgets the id. Session slot has to be released by caller.
+     */
+    void remove(const std::string& id);
+
+    /**
+     * @brief Closes parked sessions with grace period elapsed.
+     *
+     * @return number of closed sessions
+     */
+    size_t closeExpired(clock::time_point now = clock::now());
+    void closeAll();
+
+    /**
+     * @brief Starts thread closing expired sessions. No-op when sessions are not resumable.
+     */
+    void startCleaner();
+    void stopCleaner();
+
+    size_t getLiveSessionsCount() const;
+    size_t getParkedSessionsCount() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<StreamSession> session;
+        bool attached = true;
+        clock::time_point parkedAt;
+    };
+
+    const uint32_t maxLiveSessions;
+    const std::chrono::milliseconds gracePeriod;
+
+    mutable std::mutex mtx;
+    std::unordered_map<std::string, Entry> entries;
+    size_t liveSessions = 0;
+
+    std::thread cleanerThread;
+    std::promise<void> cleanerExitTrigger;
+};
+}  // namespace ovms
@@ -15,19 +15,212 @@
 //*****************************************************************************
 #include "systeminfo.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <openvino/core/parallel.hpp>
+#include <sched.h>
 
 #include "logging.hpp"
 #include "status.hpp"
+#include "stringutils.hpp"
 
 namespace ovms {
+static std::optional<std::string> readFirstLine(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return std::nullopt;
+    }
+    std::string line;
+    if (!std::getline(file, line)) {
+        return std::nullopt;
+    }
+    return line;
+}
+
+std::optional<double> parseCgroupV2CpuMax(const std::string& content) {
+    std::istringstream stream(content);
+    std::string quota;
+    std::string period;
+    stream >> quota >> period;
+    if (quota.empty() || quota == "max") {
+        return std::nullopt;
+    }
+    auto quotaUs = stou32(quota);
+    // period is optional in cpu.max, kernel default is 100ms
+    auto periodUs = period.empty() ? std::optional<uint32_t>(100000) : stou32(period);
+    if (!quotaUs || !periodUs || quotaUs.value() == 0 || periodUs.value() == 0) {
+        return std::nullopt;
+    }
+    return static_cast<double>(quotaUs.value()) / periodUs.value();
+}
+
+std::optional<double> parseCgroupV1CpuQuota(const std::string& quota, const std::string& period) {
+    auto quotaUs = stoi64(quota);
+    auto periodUs = stoi64(period);
+    if (!quotaUs || !periodUs || quotaUs.value() <= 0 || periodUs.value() <= 0) {
+        return std::nullopt;
+    }
+    return static_cast<double>(quotaUs.value()) / periodUs.value();
+}
+
+std::optional<uint16_t> countKernelList(const std::string& list) {
+    std::string trimmed = list;
+    erase_spaces(trimmed);
+    if (trimmed.empty()) {
+        return std::nullopt;
+    }
+    uint32_t count = 0;
+    for (const auto& range : tokenize(trimmed, ',')) {
+        auto bounds = tokenize(range, '-');
+        if (bounds.size() == 1) {
+            if (!stou32(bounds[0])) {
+                return std::nullopt;
+            }
+            ++count;
+        } else if (bounds.size() == 2) {
+            auto first = stou32(bounds[0]);
+            auto last = stou32(bounds[1]);
+            if (!first || !last || last.value() < first.value()) {
+                return std::nullopt;
+            }
+            count += last.value() - first.value() + 1;
+        } else {
+            return std::nullopt;
+        }
+    }
+    return static_cast<uint16_t>(std::min<uint32_t>(count, std::numeric_limits<uint16_t>::max()));
+}
+
+// Returns path of the process cgroup relative to controller mount for given cgroup version, eg. "/kubepods/pod1"
+static std::string getOwnCgroupPath(const std::string& procSelfCgroup, bool v2) {
+    std::ifstream file(procSelfCgroup);
+    std::string line;
+    while (std::getline(file, line)) {
+        // format: hierarchy-ID:controller-list:cgroup-path
+        auto firstColon = line.find(':');
+        auto secondColon = line.find(':', firstColon + 1);
+        if (firstColon == std::string::npos || secondColon == std::string::npos) {
+            continue;
+        }
+        std::string controllers = line.substr(firstColon + 1, secondColon - firstColon - 1);
+        if (v2 && controllers.empty()) {
+            return line.substr(secondColon + 1);
+        }
+        if (!v2) {
+            auto list = tokenize(controllers, ',');
+            if (std::find(list.begin(), list.end(), "cpu") != list.end()) {
+                return line.substr(secondColon + 1);
+            }
+        }
+    }
+    return "/";
+}
+
+// Quota may be set on any level of cgroup hierarchy, the most restrictive one applies.
+// With cgroup namespaces the process path does not exist under the mount point and only the root is checked.
+template <typename ReadQuota>
+static std::optional<double> findLowestQuota(const std::filesystem::path& mountPoint, const std::string& cgroupPath, ReadQuota readQuota) {
+    std::optional<double> lowest;
+    std::filesystem::path relative = std::filesystem::path(cgroupPath).relative_path();
+    while (true) {
+        auto quota = readQuota(mountPoint / relative);
+        if (quota && (!lowest || quota.value() < lowest.value())) {
+            lowest = quota;
+        }
+        if (relative.empty()) {
+            break;
+        }
+        relative = relative.parent_path();
+    }
+    return lowest;
+}
+
+static std::optional<double> readCgroupQuota(const std::string& cgroupRoot, const std::string& procSelfCgroup) {
+    const std::filesystem::path root(cgroupRoot);
+    std::error_code ec;
+    if (std::filesystem::exists(root / "cgroup.controllers", ec)) {
+        return findLowestQuota(root, getOwnCgroupPath(procSelfCgroup, true), [](const std::filesystem::path& dir) -> std::optional<double> {
+            auto content = readFirstLine(dir / "cpu.max");
+            return content ? parseCgroupV2CpuMax(content.value()) : std::nullopt;
+        });
+    }
+    for (const char* controllerDir : {"cpu,cpuacct", "cpu"}) {
+        if (!std::filesystem::exists(root / controllerDir, ec)) {
+            continue;
+        }
+        return findLowestQuota(root / controllerDir, getOwnCgroupPath(procSelfCgroup, false), [](const std::filesystem::path& dir) -> std::optional<double> {
+            auto quota = readFirstLine(dir / "cpu.cfs_quota_us");
+            auto period = readFirstLine(dir / "cpu.cfs_period_us");
+            return (quota && period) ? parseCgroupV1CpuQuota(quota.value(), period.value()) : std::nullopt;
+        });
+    }
+    return std::nullopt;
+}
+
+static std::optional<uint16_t> getAffinityCoreCount(uint16_t hostCores) {
+    // cpu_set_t is limited to CPU_SETSIZE cores, dynamic set handles larger machines
+    const int setSize = std::max<int>(hostCores, CPU_SETSIZE);
+    cpu_set_t* set = CPU_ALLOC(setSize);
+    if (set == nullptr) {
+        return std::nullopt;
+    }
+    const size_t setBytes = CPU_ALLOC_SIZE(setSize);
+    CPU_ZERO_S(setBytes, set);
+    std::optional<uint16_t> result;
+    if (sched_getaffinity(0, setBytes, set) == 0) {
+        result = static_cast<uint16_t>(CPU_COUNT_S(setBytes, set));
+    }
+    CPU_FREE(set);
+    return result;
+}
+
+std::string CpuTopology::toString() const {
+    std::stringstream ss;
+    ss << "available cores: " << availableCores
+       << "; host cores: " << hostCores
+       << "; affinity cores: " << affinityCores
+       << "; cgroup quota: ";
+    if (cgroupQuota) {
+        ss << cgroupQuota.value();
+    } else {
+        ss << "unlimited";
+    }
+    ss << "; NUMA nodes: " << numaNodes;
+    return ss.str();
+}
+
+CpuTopology detectCpuTopology(const std::string& cgroupRoot, const std::string& procSelfCgroup, const std::string& numaNodesOnline) {
+    CpuTopology topology;
+    topology.hostCores = std::max<uint16_t>(1, std::min<unsigned>(std::thread::hardware_concurrency(), std::numeric_limits<uint16_t>::max()));
+    topology.affinityCores = std::max<uint16_t>(1, getAffinityCoreCount(topology.hostCores).value_or(topology.hostCores));
+    topology.cgroupQuota = readCgroupQuota(cgroupRoot, procSelfCgroup);
+    auto numaList = readFirstLine(numaNodesOnline);
+    if (numaList) {
+        topology.numaNodes = std::max<uint16_t>(1, countKernelList(numaList.value()).value_or(1));
+    }
+    topology.availableCores = topology.affinityCores;
+    if (topology.cgroupQuota) {
+        // fractional quota still allows to use part of another core
+        auto quotaCores = static_cast<uint16_t>(std::ceil(topology.cgroupQuota.value()));
+        topology.availableCores = std::max<uint16_t>(1, std::min(topology.availableCores, quotaCores));
+    }
+    return topology;
+}
+
+const CpuTopology& getCpuTopology() {
+    static const CpuTopology topology = detectCpuTopology();
+    return topology;
+}
+
 uint16_t getCoreCount() {
-    // return parallel_get_num_threads();
-    return std::thread::hardware_concurrency();
+    return getCpuTopology().availableCores;
 }
 }  // namespace ovms
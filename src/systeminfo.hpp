@@ -16,9 +16,58 @@
 #pragma once
 #include <stdint.h>
 
+#include <optional>
+#include <string>
+
 namespace ovms {
 /**
- * @brief Get cpu core count on system. This can be limited by the container environment. In case of failure reading system constraints it will return total number of available cores. If it won't work the function will return 1
+ * @brief CPU resources visible to the process. Cores reported by the host are narrowed down by
+ * sched affinity (which also reflects cpuset constraints) and by cgroup v1/v2 CPU bandwidth quota.
+ */
+struct CpuTopology {
+    uint16_t hostCores = 1;
+    uint16_t affinityCores = 1;
+    std::optional<double> cgroupQuota;
+    uint16_t numaNodes = 1;
+    uint16_t availableCores = 1;
+
+    bool isQuotaLimited() const { return availableCores < affinityCores; }
+    std::string toString() const;
+};
+
+/**
+ * @brief Parse content of cgroup v2 cpu.max file, eg. "400000 100000"
+ * @return number of CPUs allowed by quota, std::nullopt if unlimited or malformed
+ */
+std::optional<double> parseCgroupV2CpuMax(const std::string& content);
+
+/**
+ * @brief Parse content of cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us files
+ * @return number of CPUs allowed by quota, std::nullopt if unlimited (-1) or malformed
+ */
+std::optional<double> parseCgroupV1CpuQuota(const std::string& quota, const std::string& period);
+
+/**
+ * @brief Count CPUs or NUMA nodes in kernel list format, eg. "0-3,8,10-11"
+ * @return number of entries, std::nullopt if malformed
+ */
+std::optional<uint16_t> countKernelList(const std::string& list);
+
+/**
+ * @brief Detect CPU topology using cgroup filesystem mounted at cgroupRoot, process cgroup membership file and NUMA nodes list.
+ * Paths are parameters only for testing purposes.
+ */
+CpuTopology detectCpuTopology(const std::string& cgroupRoot = "/sys/fs/cgroup",
+    const std::string& procSelfCgroup = "/proc/self/cgroup",
+    const std::string& numaNodesOnline = "/sys/devices/system/node/online");
+
+/**
+ * @brief CPU topology detected once on first use
+ */
+const CpuTopology& getCpuTopology();
+
+/**
+ * @brief Get cpu core count on system. This is limited by sched affinity, cpusets and cgroup CPU quota of the container environment. In case of failure reading system constraints it will return total number of available cores. If it won't work the function will return 1
  * @return uint16_t Available number of cores in the system
  */
 uint16_t getCoreCount();
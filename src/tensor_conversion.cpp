@@ -444,11 +444,11 @@ static shape_t getShapeFromImages(const std::vector<cv::Mat>& images, const std:
     return dims;
 }
 
-static ov::Tensor createTensorFromMats(const std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo) {
+static ov::Tensor createTensorFromMats(const std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo, const ov::Allocator& allocator) {
     OVMS_PROFILE_FUNCTION();
     ov::Shape shape = getShapeFromImages(images, tensorInfo);
     ov::element::Type precision = tensorInfo->getOvPrecision();
-    ov::Tensor tensor(precision, shape);
+    ov::Tensor tensor(precision, shape, allocator);
     char* ptr = (char*)tensor.data();
     for (cv::Mat image : images) {
         memcpy(ptr, (char*)image.data, image.total() * image.elemSize());
@@ -457,7 +457,7 @@ static ov::Tensor createTensorFromMats(const std::vector<cv::Mat>& images, const
     return tensor;
 }
 
-static ov::Tensor convertMatsToTensor(std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo) {
+static ov::Tensor convertMatsToTensor(std::vector<cv::Mat>& images, const std::shared_ptr<const TensorInfo>& tensorInfo, const ov::Allocator& allocator) {
     OVMS_PROFILE_FUNCTION();
     switch (tensorInfo->getPrecision()) {
     case ovms::Precision::FP32:
@@ -468,7 +468,7 @@ static ov::Tensor convertMatsToTensor(std::vector<cv::Mat>& images, const std::s
     case ovms::Precision::FP16:
     case ovms::Precision::U16:
     case ovms::Precision::I16:
-        return createTensorFromMats(images, tensorInfo);
+        return createTensorFromMats(images, tensorInfo, allocator);
     case ovms::Precision::MIXED:
     case ovms::Precision::Q78:
     case ovms::Precision::BIN:
@@ -480,7 +480,7 @@ static ov::Tensor convertMatsToTensor(std::vector<cv::Mat>& images, const std::s
 }
 
 template <typename TensorType>
-static Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer) {
+static Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer, const ov::Allocator& allocator) {
     OVMS_PROFILE_FUNCTION();
     auto status = validateTensor(tensorInfo, src, buffer);
     if (status != StatusCode::OK) {
@@ -493,7 +493,7 @@ static Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& s
         SPDLOG_DEBUG("Input native file format conversion failed");
         return status;
     }
-    tensor = convertMatsToTensor(images, tensorInfo);
+    tensor = convertMatsToTensor(images, tensorInfo, allocator);
     if (!tensor) {
         SPDLOG_DEBUG("Input native file format conversion failed");
         return StatusCode::IMAGE_PARSING_FAILED;
@@ -501,11 +501,19 @@ static Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& s
     return StatusCode::OK;
 }
 
-static Status convertStringRequestFromBufferToOVTensor2D(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer) {
+// tail of each row is cleared at once, strings shorter than the longest one are mostly padding
+static void copyPaddedString(unsigned char* row, const char* string, size_t stringLength, size_t width) {
+    if (stringLength > 0) {
+        std::memcpy(row, string, stringLength);
+    }
+    std::memset(row + stringLength, 0, width - stringLength);
+}
+
+static Status convertStringRequestFromBufferToOVTensor2D(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator) {
     return StatusCode::NOT_IMPLEMENTED;
 }
 
-static Status convertStringRequestFromBufferToOVTensor2D(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer) {
+static Status convertStringRequestFromBufferToOVTensor2D(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator) {
     size_t batchSize = 0;
     size_t offset = 0;
     size_t maxStringLength = 0;
@@ -521,15 +529,11 @@ static Status convertStringRequestFromBufferToOVTensor2D(const ::KFSRequest::Inf
     }
     size_t width = maxStringLength + 1;
     offset = 0;
-    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{batchSize, width});
+    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{batchSize, width}, allocator);
     for (size_t i = 0; i < batchSize; i++) {
         uint64_t inputSize = *(reinterpret_cast<const uint32_t*>(buffer->data() + offset));
         offset += sizeof(uint32_t);
-        auto data = tensor.data<unsigned char>() + i * width;
-        std::memcpy(data, reinterpret_cast<const unsigned char*>(buffer->data() + offset), inputSize);
-        for (size_t j = inputSize; j < width; j++) {
-            data[j] = 0;
-        }
+        copyPaddedString(tensor.data<unsigned char>() + i * width, buffer->data() + offset, inputSize, width);
         offset += inputSize;
     }
     return StatusCode::OK;
@@ -539,10 +543,11 @@ template <typename TensorType>
 Status convertStringRequestToOVTensor2D(
     const TensorType& src,
     ov::Tensor& tensor,
-    const std::string* buffer) {
+    const std::string* buffer,
+    const ov::Allocator& allocator) {
     OVMS_PROFILE_FUNCTION();
     if (buffer != nullptr) {
-        return convertStringRequestFromBufferToOVTensor2D(src, tensor, buffer);
+        return convertStringRequestFromBufferToOVTensor2D(src, tensor, buffer, allocator);
     }
     int batchSize = getBinaryInputsSize(src);
     size_t maxStringLength = 0;
@@ -550,24 +555,20 @@ Status convertStringRequestToOVTensor2D(
         maxStringLength = std::max(maxStringLength, getBinaryInput(src, i).size());
     }
     size_t width = maxStringLength + 1;
-    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{static_cast<size_t>(batchSize), width});
+    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{static_cast<size_t>(batchSize), width}, allocator);
+    unsigned char* data = tensor.data<unsigned char>();
     for (int i = 0; i < batchSize; i++) {
-        std::memcpy(
-            tensor.data<unsigned char>() + i * width,
-            reinterpret_cast<const unsigned char*>(getBinaryInput(src, i).c_str()),
-            getBinaryInput(src, i).size());
-        for (size_t j = getBinaryInput(src, i).size(); j < width; j++) {
-            tensor.data<unsigned char>()[i * width + j] = 0;
-        }
+        const std::string& input = getBinaryInput(src, i);
+        copyPaddedString(data + i * width, input.data(), input.size(), width);
     }
     return StatusCode::OK;
 }
 
-static Status convertStringRequestFromBufferToOVTensor1D(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer) {
+static Status convertStringRequestFromBufferToOVTensor1D(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator) {
     return StatusCode::NOT_IMPLEMENTED;
 }
 
-static Status convertStringRequestFromBufferToOVTensor1D(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer) {
+static Status convertStringRequestFromBufferToOVTensor1D(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator) {
     std::vector<uint32_t> stringSizes;
     uint32_t totalStringsLength = 0;
     while (totalStringsLength + stringSizes.size() * sizeof(uint32_t) + sizeof(uint32_t) <= buffer->size()) {
@@ -582,7 +583,7 @@ static Status convertStringRequestFromBufferToOVTensor1D(const ::KFSRequest::Inf
     }
     size_t metadataLength = sizeof(uint32_t) * (batchSize + 2);
     size_t width = totalStringsLength + metadataLength;
-    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{width});
+    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{width}, allocator);
     uint32_t* data = reinterpret_cast<uint32_t*>(tensor.data<uint8_t>());
     data[0] = static_cast<uint32_t>(batchSize);
     data[1] = 0;  // first string start offset
@@ -597,9 +598,9 @@ static Status convertStringRequestFromBufferToOVTensor1D(const ::KFSRequest::Inf
 }
 
 template <typename TensorType>
-Status convertStringRequestToOVTensor1D(const TensorType& src, ov::Tensor& tensor, const std::string* buffer) {
+Status convertStringRequestToOVTensor1D(const TensorType& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator) {
     if (buffer != nullptr) {
-        return convertStringRequestFromBufferToOVTensor1D(src, tensor, buffer);
+        return convertStringRequestFromBufferToOVTensor1D(src, tensor, buffer, allocator);
     }
     int batchSize = getBinaryInputsSize(src);
     size_t totalStringsLength = 0;
@@ -612,7 +613,7 @@ Status convertStringRequestToOVTensor1D(const TensorType& src, ov::Tensor& tenso
     // - end offsets for each batch of string (uint32_t) x batchSize
     size_t metadataLength = sizeof(uint32_t) * (batchSize + 2);
     size_t width = totalStringsLength + metadataLength;
-    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{static_cast<size_t>(width)});
+    tensor = ov::Tensor(ov::element::Type_t::u8, ov::Shape{static_cast<size_t>(width)}, allocator);
     uint32_t* data = reinterpret_cast<uint32_t*>(tensor.data<uint8_t>());
     data[0] = static_cast<uint32_t>(batchSize);
     data[1] = 0;  // first string start offset
@@ -651,16 +652,57 @@ Status convertOVTensor2DToStringResponse(const ov::Tensor& tensor, TensorType& d
     return StatusCode::OK;
 }
 
-template Status convertNativeFileFormatRequestTensorToOVTensor<tensorflow::TensorProto>(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer);
-template Status convertNativeFileFormatRequestTensorToOVTensor<::KFSRequest::InferInputTensor>(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer);
+template <typename TensorType>
+Status convertOVTensor1DToStringResponse(const ov::Tensor& tensor, TensorType& dst) {
+    if (tensor.get_shape().size() != 1) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    if (tensor.get_element_type() != ov::element::Type_t::u8) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const size_t byteSize = tensor.get_byte_size();
+    if (byteSize < 2 * sizeof(uint32_t)) {
+        SPDLOG_DEBUG("String tensor too small to contain batch size and offsets: {}", byteSize);
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const unsigned char* data = tensor.data<unsigned char>();
+    uint32_t batchSize = 0;
+    std::memcpy(&batchSize, data, sizeof(uint32_t));
+    const size_t metadataLength = sizeof(uint32_t) * (static_cast<size_t>(batchSize) + 2);
+    if (metadataLength > byteSize) {
+        SPDLOG_DEBUG("String tensor of size: {} cannot hold offsets for batch: {}", byteSize, batchSize);
+        return StatusCode::INTERNAL_ERROR;
+    }
+    // offsets are not guaranteed to be aligned in output tensor memory
+    std::vector<uint32_t> offsets(batchSize + 1);
+    std::memcpy(offsets.data(), data + sizeof(uint32_t), offsets.size() * sizeof(uint32_t));
+    const char* strings = reinterpret_cast<const char*>(data + metadataLength);
+    const size_t stringsLength = byteSize - metadataLength;
+    setBatchSize(dst, batchSize);
+    setStringPrecision(dst);
+    for (uint32_t i = 0; i < batchSize; i++) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > stringsLength) {
+            SPDLOG_DEBUG("String tensor offsets out of range: [{}, {}) for strings length: {}", offsets[i], offsets[i + 1], stringsLength);
+            return StatusCode::INTERNAL_ERROR;
+        }
+        createOrGetString(dst, i).assign(strings + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return StatusCode::OK;
+}
+
+template Status convertNativeFileFormatRequestTensorToOVTensor<tensorflow::TensorProto>(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer, const ov::Allocator& allocator);
+template Status convertNativeFileFormatRequestTensorToOVTensor<::KFSRequest::InferInputTensor>(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer, const ov::Allocator& allocator);
 
-template Status convertStringRequestToOVTensor2D<tensorflow::TensorProto>(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer);
-template Status convertStringRequestToOVTensor2D<::KFSRequest::InferInputTensor>(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer);
+template Status convertStringRequestToOVTensor2D<tensorflow::TensorProto>(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator);
+template Status convertStringRequestToOVTensor2D<::KFSRequest::InferInputTensor>(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator);
 
-template Status convertStringRequestToOVTensor1D<tensorflow::TensorProto>(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer);
-template Status convertStringRequestToOVTensor1D<::KFSRequest::InferInputTensor>(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer);
+template Status convertStringRequestToOVTensor1D<tensorflow::TensorProto>(const tensorflow::TensorProto& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator);
+template Status convertStringRequestToOVTensor1D<::KFSRequest::InferInputTensor>(const ::KFSRequest::InferInputTensor& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator);
 
 template Status convertOVTensor2DToStringResponse<tensorflow::TensorProto>(const ov::Tensor& tensor, tensorflow::TensorProto& dst);
 template Status convertOVTensor2DToStringResponse<::KFSResponse::InferOutputTensor>(const ov::Tensor& tensor, ::KFSResponse::InferOutputTensor& dst);
 
+template Status convertOVTensor1DToStringResponse<tensorflow::TensorProto>(const ov::Tensor& tensor, tensorflow::TensorProto& dst);
+template Status convertOVTensor1DToStringResponse<::KFSResponse::InferOutputTensor>(const ov::Tensor& tensor, ::KFSResponse::InferOutputTensor& dst);
+
 }  // namespace ovms
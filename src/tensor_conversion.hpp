@@ -23,15 +23,20 @@
 namespace ovms {
 class Status;
 template <typename TensorType>
-Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer);
+Status convertNativeFileFormatRequestTensorToOVTensor(const TensorType& src, ov::Tensor& tensor, const std::shared_ptr<const TensorInfo>& tensorInfo, const std::string* buffer, const ov::Allocator& allocator = ov::Allocator());
 
 template <typename TensorType>
-Status convertStringRequestToOVTensor2D(const TensorType& src, ov::Tensor& tensor, const std::string* buffer);
+Status convertStringRequestToOVTensor2D(const TensorType& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator = ov::Allocator());
 
 template <typename TensorType>
-Status convertStringRequestToOVTensor1D(const TensorType& src, ov::Tensor& tensor, const std::string* buffer);
+Status convertStringRequestToOVTensor1D(const TensorType& src, ov::Tensor& tensor, const std::string* buffer, const ov::Allocator& allocator = ov::Allocator());
 
 template <typename TensorType>
 Status convertOVTensor2DToStringResponse(const ov::Tensor& tensor, TensorType& dst);
 
+// reads strings from 1D U8 tensor in the same layout as produced by convertStringRequestToOVTensor1D:
+// batch size, first string start offset, end offset of each string, concatenated strings
+template <typename TensorType>
+Status convertOVTensor1DToStringResponse(const ov::Tensor& tensor, TensorType& dst);
+
 }  // namespace ovms
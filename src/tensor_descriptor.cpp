@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tensor_descriptor.hpp"
+
+#include <algorithm>
+
+#include <openvino/openvino.hpp>
+
+#include "modelconfig.hpp"
+
+namespace ovms {
+
+SmallShape::SmallShape(const Shape& shape) :
+    rank(shape.size()) {
+    if (rank > MAX_INLINE_RANK) {
+        heapDimensions.resize(rank);
+    }
+    DimensionRange* dims = rank <= MAX_INLINE_RANK ? inlineDimensions.data() : heapDimensions.data();
+    for (size_t i = 0; i < rank; ++i) {
+        dims[i].minimum = shape[i].getMinValue();
+        dims[i].maximum = shape[i].getMaxValue();
+    }
+}
+
+static Mode getShapeMode(const shapes_info_map_t& shapeInfo, const std::string& name) {
+    auto it = shapeInfo.find(name);
+    if (it == shapeInfo.end()) {
+        it = shapeInfo.find(ANONYMOUS_INPUT_NAME);
+    }
+    if (it == shapeInfo.end()) {
+        return Mode::FIXED;
+    }
+    return it->second.shapeMode;
+}
+
+TensorDescriptorTable::TensorDescriptorTable(const tensor_map_t& tensors, const shapes_info_map_t& shapeInfo) :
+    source(&tensors) {
+    descriptors.resize(tensors.size());
+    size_t i = 0;
+    for (const auto& [name, info] : tensors) {
+        TensorDescriptor& descriptor = descriptors[i++];
+        descriptor.name = &name;
+        descriptor.info = info.get();
+        descriptor.precision = info->getPrecision();
+        descriptor.elementSize = ov::element::Type(ovmsPrecisionToIE2Precision(descriptor.precision)).size();
+        descriptor.batchIndex = info->getLayout().getBatchIndex();
+        descriptor.batchSize = info->getBatchSize();
+        descriptor.shapeMode = getShapeMode(shapeInfo, name);
+        descriptor.preProcessingHint = info->getPreProcessingHint();
+        descriptor.shape = SmallShape(info->getShape());
+        descriptor.isStatic = info->getShape().isStatic();
+        if (descriptor.isStatic) {
+            descriptor.staticElementCount = 1;
+            for (const auto& dim : info->getShape()) {
+                descriptor.staticElementCount *= dim.getStaticValue();
+            }
+            descriptor.staticByteSize = descriptor.staticElementCount * descriptor.elementSize;
+        }
+    }
+}
+
+const TensorDescriptor* TensorDescriptorTable::find(const std::string& name) const {
+    auto it = std::lower_bound(descriptors.begin(), descriptors.end(), name,
+        [](const TensorDescriptor& descriptor, const std::string& name) { return *descriptor.name < name; });
+    if (it == descriptors.end() || *it->name != name) {
+        return nullptr;
+    }
+    return &(*it);
+}
+
+}  // namespace ovms
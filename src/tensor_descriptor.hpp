@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "precision.hpp"
+#include "shape.hpp"
+#include "tensorinfo.hpp"
+
+namespace ovms {
+
+/**
+ * @brief Shape stored as min/max pairs, inline up to MAX_INLINE_RANK dimensions.
+ */
+class SmallShape {
+public:
+    static constexpr size_t MAX_INLINE_RANK = 8;
+
+    SmallShape() = default;
+    explicit SmallShape(const Shape& shape);
+
+    size_t size() const { return rank; }
+
+    dimension_value_t getMinValue(size_t i) const { return data()[i].minimum; }
+    dimension_value_t getMaxValue(size_t i) const { return data()[i].maximum; }
+
+    // Same rules as Dimension::match
+    bool match(size_t i, dimension_value_t value) const {
+        const DimensionRange& dim = data()[i];
+        if (value < DYNAMIC_DIMENSION) {
+            return false;
+        }
+        if (dim.minimum == DYNAMIC_DIMENSION && dim.maximum == DYNAMIC_DIMENSION) {
+            return true;
+        }
+        return dim.minimum <= value && value <= dim.maximum;
+    }
+
+private:
+    struct DimensionRange {
+        dimension_value_t minimum = DYNAMIC_DIMENSION;
+        dimension_value_t maximum = DYNAMIC_DIMENSION;
+    };
+
+    const DimensionRange* data() const { return rank <= MAX_INLINE_RANK ? inlineDimensions.data() : heapDimensions.data(); }
+
+    size_t rank = 0;
+    std::array<DimensionRange, MAX_INLINE_RANK> inlineDimensions;
+    // used only for shapes with more than MAX_INLINE_RANK dimensions
+    std::vector<DimensionRange> heapDimensions;
+};
+
+/**
+ * @brief Flat copy of TensorInfo fields used during request validation, computed once per model load.
+ */
+struct alignas(64) TensorDescriptor {
+    const std::string* name = nullptr;
+    const TensorInfo* info = nullptr;
+    Precision precision = Precision::UNDEFINED;
+    size_t elementSize = 0;
+    std::optional<size_t> batchIndex;
+    std::optional<Dimension> batchSize;
+    Mode shapeMode = FIXED;
+    TensorInfo::ProcessingHint preProcessingHint = TensorInfo::ProcessingHint::NO_PROCESSING;
+    bool isStatic = false;
+    // valid only for static shapes
+    size_t staticElementCount = 0;
+    size_t staticByteSize = 0;
+    SmallShape shape;
+};
+
+/**
+ * @brief Descriptors of all tensors of a servable, in tensor_map_t order.
+ *
+ * Points to names and TensorInfo objects owned by the tensor_map_t it was built from,
+ * so it has to be rebuilt whenever that map changes.
+ */
+class TensorDescriptorTable {
+public:
+    TensorDescriptorTable() = default;
+    explicit TensorDescriptorTable(const tensor_map_t& tensors, const shapes_info_map_t& shapeInfo = shapes_info_map_t());
+
+    size_t size() const { return descriptors.size(); }
+    std::vector<TensorDescriptor>::const_iterator begin() const { return descriptors.begin(); }
+    std::vector<TensorDescriptor>::const_iterator end() const { return descriptors.end(); }
+
+    const TensorDescriptor* find(const std::string& name) const;
+
+    /**
+     * @brief Checks if table was built from given tensor map
+     */
+    bool describes(const tensor_map_t& tensors) const { return source == &tensors; }
+
+private:
+    const tensor_map_t* source = nullptr;
+    std::vector<TensorDescriptor> descriptors;
+};
+
+}  // namespace ovms
@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "tensor_memory_pool.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+#include "config.hpp"
+#include "logging.hpp"
+
+namespace ovms {
+
+static void* allocateAligned(size_t bytes, size_t alignment) {
+    // aligned_alloc requires size to be multiple of alignment
+    size_t size = (std::max<size_t>(bytes, 1) + alignment - 1) / alignment * alignment;
+    void* ptr = std::aligned_alloc(alignment, size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+TensorMemoryPool::TensorMemoryPool(const std::string& name, size_t maxCachedBytes) :
+    name(name),
+    maxCachedBytes(maxCachedBytes) {}
+
+TensorMemoryPool::~TensorMemoryPool() {
+    clear();
+}
+
+size_t TensorMemoryPool::getConfiguredMaxCachedBytes() {
+    return size_t(Config::instance().tensorMemoryPoolSizeMb()) * 1024 * 1024;
+}
+
+size_t TensorMemoryPool::getSizeClass(size_t bytes) {
+    if (bytes <= 4) {
+        return bytes;
+    }
+    size_t power = size_t(1) << (63 - __builtin_clzll(bytes - 1));
+    size_t step = power / 4;
+    return (bytes + step - 1) / step * step;
+}
+
+bool TensorMemoryPool::isPooled(size_t bytes, size_t alignment) const {
+    return maxCachedBytes > 0 && bytes >= MIN_POOLED_BYTES && bytes <= MAX_POOLED_BYTES && alignment <= ALIGNMENT;
+}
+
+void* TensorMemoryPool::allocate(size_t bytes, size_t alignment) {
+    if (!isPooled(bytes, alignment)) {
+        return allocateAligned(bytes, std::max(alignment, ALIGNMENT));
+    }
+    const size_t sizeClass = getSizeClass(bytes);
+    {
+        std::unique_lock lock(mtx);
+        auto it = freeLists.find(sizeClass);
+        if (it != freeLists.end() && !it->second.empty()) {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            cachedBytes -= sizeClass;
+            ++hits;
+            return ptr;
+        }
+    }
+    ++misses;
+    return allocateAligned(sizeClass, ALIGNMENT);
+}
+
+void TensorMemoryPool::deallocate(void* handle, size_t bytes, size_t alignment) {
+    if (handle == nullptr) {
+        return;
+    }
+    if (!isPooled(bytes, alignment)) {
+        std::free(handle);
+        return;
+    }
+    const size_t sizeClass = getSizeClass(bytes);
+    {
+        std::unique_lock lock(mtx);
+        if (cachedBytes + sizeClass <= maxCachedBytes) {
+            freeLists[sizeClass].push_back(handle);
+            cachedBytes += sizeClass;
+            return;
+        }
+    }
+    std::free(handle);
+}
+
+void TensorMemoryPool::clear() {
+    std::unordered_map<size_t, std::vector<void*>> released;
+    {
+        std::unique_lock lock(mtx);
+        released.swap(freeLists);
+        cachedBytes = 0;
+    }
+    size_t releasedBuffers = 0;
+    for (auto& [sizeClass, buffers] : released) {
+        for (void* ptr : buffers) {
+            std::free(ptr);
+        }
+        releasedBuffers += buffers.size();
+    }
+    if (releasedBuffers > 0) {
+        SPDLOG_DEBUG("Released: {} cached buffers of tensor memory pool: {}; hits: {}; misses: {}", releasedBuffers, name, hits.load(), misses.load());
+    }
+}
+
+size_t TensorMemoryPool::getCachedBytes() const {
+    std::unique_lock lock(mtx);
+    return cachedBytes;
+}
+
+ov::Allocator TensorMemoryPool::getAllocator() {
+    return ov::Allocator(TensorMemoryPoolAllocator(shared_from_this()));
+}
+
+TensorMemoryPoolAllocator::TensorMemoryPoolAllocator(std::shared_ptr<TensorMemoryPool> pool) :
+    pool(std::move(pool)) {}
+
+void* TensorMemoryPoolAllocator::allocate(const size_t bytes, const size_t alignment) {
+    return pool->allocate(bytes, alignment);
+}
+
+void TensorMemoryPoolAllocator::deallocate(void* handle, const size_t bytes, size_t alignment) {
+    pool->deallocate(handle, bytes, alignment);
+}
+
+bool TensorMemoryPoolAllocator::is_equal(const TensorMemoryPoolAllocator& other) const {
+    return pool == other.pool;
+}
+}  // namespace ovms
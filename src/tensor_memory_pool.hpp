@@ -0,0 +1,107 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+namespace ovms {
+
+/**
+ * @brief Size class based pool of aligned buffers backing tensors created by the server.
+ *
+ * Buffers released by tensors are kept in free lists of their size class and reused by
+ * subsequent requests instead of being returned to the system allocator. This avoids
+ * malloc/free and page fault churn for large tensors. Small and very large allocations
+ * bypass the pool. Amount of memory kept in free lists is bounded by maxCachedBytes.
+ */
+class TensorMemoryPool : public std::enable_shared_from_this<TensorMemoryPool> {
+public:
+    static constexpr size_t ALIGNMENT = 64;
+    static constexpr size_t MIN_POOLED_BYTES = 16 * 1024;
+    static constexpr size_t MAX_POOLED_BYTES = size_t(1) << 30;
+    static constexpr size_t DEFAULT_MAX_CACHED_BYTES = 256 * 1024 * 1024;
+
+    /**
+     * @param maxCachedBytes limit of memory kept in free lists, 0 disables pooling
+     */
+    TensorMemoryPool(const std::string& name, size_t maxCachedBytes = DEFAULT_MAX_CACHED_BYTES);
+
+    /**
+     * @brief Limit of memory kept in free lists configured with tensor_memory_pool_size_mb server parameter
+     */
+    static size_t getConfiguredMaxCachedBytes();
+    ~TensorMemoryPool();
+    TensorMemoryPool(const TensorMemoryPool&) = delete;
+    TensorMemoryPool& operator=(const TensorMemoryPool&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment);
+    void deallocate(void* handle, size_t bytes, size_t alignment);
+
+    /**
+     * @brief Returns allocator for ov::Tensor. Tensors keep the pool alive, so buffers
+     * can outlive the owner of the pool e.g. model instance being unloaded.
+     */
+    ov::Allocator getAllocator();
+
+    /**
+     * @brief Releases all buffers kept in free lists to the system allocator.
+     */
+    void clear();
+
+    size_t getCachedBytes() const;
+    size_t getHits() const { return hits; }
+    size_t getMisses() const { return misses; }
+    const std::string& getName() const { return name; }
+
+    /**
+     * @brief Rounds size to the size class. There are 4 size classes per power of two,
+     * which limits memory wasted for rounding to 25%.
+     */
+    static size_t getSizeClass(size_t bytes);
+
+private:
+    bool isPooled(size_t bytes, size_t alignment) const;
+
+    const std::string name;
+    const size_t maxCachedBytes;
+    mutable std::mutex mtx;
+    std::unordered_map<size_t, std::vector<void*>> freeLists;
+    size_t cachedBytes = 0;
+    std::atomic<size_t> hits = 0;
+    std::atomic<size_t> misses = 0;
+};
+
+/**
+ * @brief ov::Allocator compatible wrapper of TensorMemoryPool.
+ */
+class TensorMemoryPoolAllocator {
+    std::shared_ptr<TensorMemoryPool> pool;
+
+public:
+    TensorMemoryPoolAllocator(std::shared_ptr<TensorMemoryPool> pool);
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t));
+    void deallocate(void* handle, const size_t bytes, size_t alignment = alignof(max_align_t));
+    bool is_equal(const TensorMemoryPoolAllocator& other) const;
+};
+}  // namespace ovms
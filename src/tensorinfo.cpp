@@ -28,6 +28,8 @@
 namespace ovms {
 
 const std::string STRING_SERIALIZATION_HINT_NAME_SUFFIX = "_string";
+// 1D U8 outputs named with plain _string suffix keep being serialized as raw bytes
+const std::string RAGGED_STRING_SERIALIZATION_HINT_NAME_SUFFIX = "_ragged_string";
 
 // in case we change behaviour for this constructor we may need to write additional tests for TensorInfo intersection / DAGs
 TensorInfo::TensorInfo(const std::string& name,
@@ -82,6 +84,8 @@ void TensorInfo::createProcessingHints() {
     // Post
     if (this->precision == ovms::Precision::U8 && this->shape.size() == 2 && endsWith(this->getMappedName(), STRING_SERIALIZATION_HINT_NAME_SUFFIX)) {
         this->postProcessingHint = TensorInfo::ProcessingHint::STRING_2D_U8;
+    } else if (this->precision == ovms::Precision::U8 && this->shape.size() == 1 && this->shape.at(0).isDynamic() && !this->influencedByDemultiplexer && endsWith(this->getMappedName(), RAGGED_STRING_SERIALIZATION_HINT_NAME_SUFFIX)) {
+        this->postProcessingHint = TensorInfo::ProcessingHint::STRING_1D_U8;
     } else {
         this->postProcessingHint = TensorInfo::ProcessingHint::NO_PROCESSING;
     }
@@ -162,6 +166,16 @@ std::shared_ptr<const TensorInfo> TensorInfo::createCopyWithNewMappedName(const
     return copy;
 }
 
+std::shared_ptr<const TensorInfo> TensorInfo::createCopyWithWirePrecision(const Precision& wirePrecision) const {
+    auto copy = std::make_shared<TensorInfo>(*this);
+    copy->wirePrecision = wirePrecision;
+    return copy;
+}
+
+Precision TensorInfo::getWirePrecision() const {
+    return this->wirePrecision;
+}
+
 std::shared_ptr<const TensorInfo> TensorInfo::createCopyWithDemultiplexerDimensionPrefix(const Dimension& dim) const {
     auto copy = std::make_shared<TensorInfo>(*this);
     copy->influencedByDemultiplexer = true;
@@ -248,6 +262,9 @@ std::string TensorInfo::asString() const {
         << "shape: " << getShape().toString() << "; "
         << "precision: " << getPrecisionAsString() << "; "
         << "layout: " << getStringFromLayout(getLayout());
+    if (wirePrecision != Precision::UNDEFINED) {
+        ss << "; wire_precision: " << getPrecisionAsString(wirePrecision);
+    }
     return ss.str();
 }
 }  // namespace ovms
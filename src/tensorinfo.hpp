@@ -179,6 +179,13 @@ public:
 
     std::shared_ptr<const TensorInfo> createCopyWithNewShape(const Shape& shape) const;
     std::shared_ptr<const TensorInfo> createCopyWithNewMappedName(const std::string& mappedName) const;
+    std::shared_ptr<const TensorInfo> createCopyWithWirePrecision(const Precision& wirePrecision) const;
+
+    /**
+         * @brief Gets compact precision used for this tensor in KServe requests/responses
+         * instead of model precision. Precision::UNDEFINED when not configured.
+         */
+    Precision getWirePrecision() const;
 
     std::shared_ptr<const TensorInfo> createCopyWithDemultiplexerDimensionPrefix(const Dimension& dim) const;
     std::shared_ptr<const TensorInfo> createIntersection(const TensorInfo& other) const;
@@ -214,6 +221,8 @@ protected:
          */
     Layout layout;
 
+    Precision wirePrecision = Precision::UNDEFINED;
+
     /**
          * @brief Information if influenced by demultiplexer
          */
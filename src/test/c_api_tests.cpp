@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -32,6 +33,7 @@
 #include "../ovms.h"
 #include "../servablemanagermodule.hpp"
 #include "../server.hpp"
+#include "../systeminfo.hpp"
 #include "../version.hpp"
 #include "c_api_test_utils.hpp"
 #include "mockmodelinstancechangingstates.hpp"
@@ -299,7 +301,7 @@ TEST(CAPIServerMetadata, Basic) {
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_SerializeMetadataToString(metadata, nullptr, &size), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_SerializeMetadataToString(metadata, &json, nullptr), StatusCode::NONEXISTENT_PTR);
     ASSERT_CAPI_STATUS_NULL(OVMS_SerializeMetadataToString(metadata, &json, &size));
-    ASSERT_EQ(std::string(json), std::string("{\"name\":\"" + std::string(PROJECT_NAME) + "\",\"version\":\"" + std::string(PROJECT_VERSION) + "\",\"ov_version\":\"" + std::string(OPENVINO_NAME) + "\"}"));
+    ASSERT_EQ(std::string(json).rfind(std::string("{\"name\":\"" + std::string(PROJECT_NAME) + "\",\"version\":\"" + std::string(PROJECT_VERSION) + "\",\"ov_version\":\"" + std::string(OPENVINO_NAME) + "\",\"cpu_topology\":{"), 0), 0);
     ASSERT_EQ(size, std::strlen(json));
     OVMS_StringFree(json);
     const char* pointer = "/name";
@@ -326,6 +328,12 @@ TEST(CAPIServerMetadata, Basic) {
     ASSERT_EQ(size, std::strlen(value));
     OVMS_StringFree(value);
 
+    pointer = "/cpu_topology/available_cores";
+    ASSERT_CAPI_STATUS_NULL(OVMS_MetadataFieldByPointer(metadata, pointer, &value, &size));
+    ASSERT_EQ(std::string(value), std::to_string(ovms::getCoreCount()));
+    ASSERT_EQ(size, std::strlen(value));
+    OVMS_StringFree(value);
+
     pointer = "/dummy";
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_MetadataFieldByPointer(metadata, pointer, &value, &size), StatusCode::JSON_SERIALIZATION_ERROR);
 
@@ -367,6 +375,63 @@ TEST(CAPIInferenceRequest, Basic) {
     ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputRemoveData(reinterpret_cast<OVMS_InferenceRequest*>(r), nullptr), StatusCode::NONEXISTENT_PTR);
     delete r;
 }
+
+namespace {
+struct ReleasedInputBuffers {
+    std::vector<const void*> buffers;
+};
+void releaseInputBuffer(const void* data, void* userData) {
+    reinterpret_cast<ReleasedInputBuffers*>(userData)->buffers.push_back(data);
+}
+}  // namespace
+
+TEST(CAPIInferenceRequest, InputBufferReleaseCallback) {
+    std::array<float, DUMMY_MODEL_INPUT_SIZE> data{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::array<float, DUMMY_MODEL_INPUT_SIZE> data2{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ReleasedInputBuffers released;
+    InferenceRequest* cppRequest = new InferenceRequest("dummy", 1);
+    OVMS_InferenceRequest* request = reinterpret_cast<OVMS_InferenceRequest*>(cppRequest);
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestAddInput(request, DUMMY_MODEL_INPUT_NAME, OVMS_DATATYPE_FP32, DUMMY_MODEL_SHAPE.data(), DUMMY_MODEL_SHAPE.size()));
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputSetDataWithRelease(nullptr, DUMMY_MODEL_INPUT_NAME, data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputSetDataWithRelease(request, nullptr, data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, nullptr, sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, nullptr, &released), StatusCode::NONEXISTENT_PTR);
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputSetDataWithRelease(request, "NONEXISTENT_TENSOR", data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released), StatusCode::NONEXISTENT_TENSOR_FOR_SET_BUFFER);
+    EXPECT_TRUE(released.buffers.empty());
+
+    // removing data returns buffer
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+    // failed set does not take ownership of second buffer
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data2.data(), sizeof(float) * data2.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released), StatusCode::DOUBLE_BUFFER_SET);
+    EXPECT_TRUE(released.buffers.empty());
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputRemoveData(request, DUMMY_MODEL_INPUT_NAME));
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data())}));
+
+    // removing input returns buffer
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data2.data(), sizeof(float) * data2.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestRemoveInput(request, DUMMY_MODEL_INPUT_NAME));
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data()), reinterpret_cast<const void*>(data2.data())}));
+
+    // only buffers with release callback are returned after inference
+    released.buffers.clear();
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestAddInput(request, "INPUT_WITH_RELEASE", OVMS_DATATYPE_FP32, DUMMY_MODEL_SHAPE.data(), DUMMY_MODEL_SHAPE.size()));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestAddInput(request, "INPUT_WITHOUT_RELEASE", OVMS_DATATYPE_FP32, DUMMY_MODEL_SHAPE.data(), DUMMY_MODEL_SHAPE.size()));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, "INPUT_WITH_RELEASE", data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetData(request, "INPUT_WITHOUT_RELEASE", data2.data(), sizeof(float) * data2.size(), OVMS_BUFFERTYPE_CPU, 0));
+    cppRequest->releaseInputBuffersWithCallback();
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data())}));
+    const InferenceTensor* tensor{nullptr};
+    ASSERT_EQ(cppRequest->getInput("INPUT_WITH_RELEASE", &tensor), StatusCode::OK);
+    EXPECT_EQ(tensor->getBuffer(), nullptr);
+    ASSERT_EQ(cppRequest->getInput("INPUT_WITHOUT_RELEASE", &tensor), StatusCode::OK);
+    ASSERT_NE(tensor->getBuffer(), nullptr);
+    EXPECT_EQ(tensor->getBuffer()->data(), data2.data());
+
+    // deleting request returns buffer which was never used
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, "INPUT_WITH_RELEASE", data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+    OVMS_InferenceRequestDelete(request);
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data()), reinterpret_cast<const void*>(data.data())}));
+}
 TEST(CAPIInferenceResponse, Basic) {
     InferenceResponse* r = new InferenceResponse("dummy", 1);
     int64_t a[1] = {1};
@@ -730,6 +795,70 @@ TEST_F(CAPIInference, ReuseInputRemoveAndAddData) {
     OVMS_ServerDelete(cserver);
 }
 
+TEST_F(CAPIInference, InputSetDataWithReleaseReturnsBuffersAfterInference) {
+    std::string port = "9000";
+    randomizePort(port);
+    OVMS_ServerSettings* serverSettings = nullptr;
+    OVMS_ModelsSettings* modelsSettings = nullptr;
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsNew(&serverSettings));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ModelsSettingsNew(&modelsSettings));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerSettingsSetGrpcPort(serverSettings, std::stoi(port)));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ModelsSettingsSetConfigPath(modelsSettings, "/ovms/src/test/c_api/config_standard_dummy.json"));
+    OVMS_Server* cserver = nullptr;
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerNew(&cserver));
+    ASSERT_CAPI_STATUS_NULL(OVMS_ServerStartFromConfigurationFile(cserver, serverSettings, modelsSettings));
+
+    OVMS_InferenceRequest* request{nullptr};
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestNew(&request, cserver, "dummy", 1));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestAddInput(request, DUMMY_MODEL_INPUT_NAME, OVMS_DATATYPE_FP32, DUMMY_MODEL_SHAPE.data(), DUMMY_MODEL_SHAPE.size()));
+    std::array<float, DUMMY_MODEL_INPUT_SIZE> data{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ReleasedInputBuffers released;
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+
+    OVMS_InferenceResponse* response = nullptr;
+    ASSERT_CAPI_STATUS_NULL(OVMS_Inference(cserver, request, &response));
+    // buffer is returned before inference call returns, response does not refer to it
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data())}));
+    std::fill(data.begin(), data.end(), 0);
+    const void* voutputData = nullptr;
+    size_t bytesize = 42;
+    OVMS_DataType datatype = (OVMS_DataType)199;
+    const int64_t* shape{nullptr};
+    size_t dimCount = 42;
+    OVMS_BufferType bufferType = (OVMS_BufferType)199;
+    uint32_t deviceId = 42;
+    const char* outputName{nullptr};
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceResponseOutput(response, 0, &outputName, &datatype, &shape, &dimCount, &voutputData, &bytesize, &bufferType, &deviceId));
+    ASSERT_EQ(bytesize, sizeof(float) * DUMMY_MODEL_INPUT_SIZE);
+    const float* outputData = reinterpret_cast<const float*>(voutputData);
+    for (size_t i = 0; i < DUMMY_MODEL_INPUT_SIZE; ++i) {
+        EXPECT_EQ(static_cast<float>(i + 1), outputData[i]) << "Different at:" << i << " place.";
+    }
+    OVMS_InferenceResponseDelete(response);
+
+    // released input has no data, request can be reused after setting data again
+    response = nullptr;
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_InferenceRequestInputRemoveData(request, DUMMY_MODEL_INPUT_NAME), StatusCode::NONEXISTENT_BUFFER_FOR_REMOVAL);
+    std::array<float, DUMMY_MODEL_INPUT_SIZE> data2{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data2.data(), sizeof(float) * data2.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+    ASSERT_CAPI_STATUS_NULL(OVMS_Inference(cserver, request, &response));
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data()), reinterpret_cast<const void*>(data2.data())}));
+    OVMS_InferenceResponseDelete(response);
+    OVMS_InferenceRequestDelete(request);
+
+    // buffer is returned when inference fails as well
+    response = nullptr;
+    released.buffers.clear();
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestNew(&request, cserver, "NONEXISTENT_MODEL", 1));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestAddInput(request, DUMMY_MODEL_INPUT_NAME, OVMS_DATATYPE_FP32, DUMMY_MODEL_SHAPE.data(), DUMMY_MODEL_SHAPE.size()));
+    ASSERT_CAPI_STATUS_NULL(OVMS_InferenceRequestInputSetDataWithRelease(request, DUMMY_MODEL_INPUT_NAME, data.data(), sizeof(float) * data.size(), OVMS_BUFFERTYPE_CPU, 0, releaseInputBuffer, &released));
+    ASSERT_CAPI_STATUS_NOT_NULL_EXPECT_CODE(OVMS_Inference(cserver, request, &response), StatusCode::PIPELINE_DEFINITION_NAME_MISSING);
+    ASSERT_THAT(released.buffers, ElementsAreArray({reinterpret_cast<const void*>(data.data())}));
+    OVMS_InferenceRequestDelete(request);
+    EXPECT_EQ(released.buffers.size(), 1);
+    OVMS_ServerDelete(cserver);
+}
+
 TEST_F(CAPIInference, ReuseRequestRemoveAndAddInput) {
     std::string port = "9000";
     randomizePort(port);
@@ -1245,6 +1374,7 @@ public:
         MockModel(const std::string& name, std::shared_ptr<ModelInstance> instance) :
             Model(name, false /*stateful*/, nullptr) {
             modelVersions.insert({instance->getVersion(), instance});
+            updateVersionsSnapshot();
         }
     };
     class MockModelManager : public ModelManager {
@@ -1255,6 +1385,7 @@ public:
             CAPIState::modelInstance = std::make_shared<MockModelInstanceChangingStates>(servableName, 1, ieCore);
             std::shared_ptr<MockModel> model = std::make_shared<MockModel>(servableName, modelInstance);
             models[servableName] = model;
+            updateModelsSnapshot();
         }
     };
     class MockGrpcServerModule : public Module {
@@ -18,7 +18,9 @@
 #include <filesystem>
 #include <fstream>
 #include <future>
+#include <iterator>
 #include <memory>
+#include <sstream>
 #include <thread>
 
 #include <gmock/gmock.h>
@@ -26,6 +28,8 @@
 #include <openvino/openvino.hpp>
 #include <stdlib.h>
 
+#include "../customloaderinterface.hpp"
+#include "../customloaders.hpp"
 #include "../executingstreamidguard.hpp"
 #include "../get_model_metadata_impl.hpp"
 #include "../localfilesystem.hpp"
@@ -1389,4 +1393,92 @@ TEST_F(TestCustomLoader, CustomLoaderLoadBlackListedModel) {
     EXPECT_EQ(json_output2, expected_json_available);
 }
 
+namespace {
+// loader implementing interface v2, hands over buffers read once from dummy model files
+class BuffersOnlyCustomLoader : public ovms::CustomLoaderInterfaceV2 {
+public:
+    std::vector<uint8_t> blob;
+    std::weak_ptr<const void> lastWeightsOwner;
+
+    ovms::CustomLoaderStatus loaderInit(const std::string& loaderConfigFile) override {
+        return ovms::CustomLoaderStatus::OK;
+    }
+    ovms::CustomLoaderStatus loadModelBuffers(const std::string& modelName, const std::string& basePath, const int version, const std::string& loaderOptions,
+        ovms::CustomLoaderBuffer& modelBuffer, ovms::CustomLoaderBuffer& weights) override {
+        if (!blob.empty()) {
+            modelBuffer = ovms::CustomLoaderBuffer(blob.data(), blob.size(), nullptr);
+            return ovms::CustomLoaderStatus::MODEL_TYPE_BLOB;
+        }
+        modelBuffer = ovms::CustomLoaderBuffer(readFile(basePath + "/1/dummy.xml"));
+        weights = ovms::CustomLoaderBuffer(readFile(basePath + "/1/dummy.bin"));
+        lastWeightsOwner = weights.owner;
+        return ovms::CustomLoaderStatus::MODEL_TYPE_IR;
+    }
+    ovms::CustomLoaderStatus unloadModel(const std::string& modelName, const int version) override {
+        return ovms::CustomLoaderStatus::OK;
+    }
+    ovms::CustomLoaderStatus retireModel(const std::string& modelName) override {
+        return ovms::CustomLoaderStatus::OK;
+    }
+    ovms::CustomLoaderStatus loaderDeInit() override {
+        return ovms::CustomLoaderStatus::OK;
+    }
+
+private:
+    static std::shared_ptr<const std::vector<uint8_t>> readFile(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::make_shared<const std::vector<uint8_t>>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+};
+
+class TestCustomLoaderBuffers : public ::testing::Test {
+public:
+    const std::string loaderName = "buffers-only-loader";
+    std::shared_ptr<BuffersOnlyCustomLoader> loader = std::make_shared<BuffersOnlyCustomLoader>();
+    ov::Core ieCore;
+    ovms::ModelConfig config = DUMMY_MODEL_CONFIG;
+
+    void SetUp() override {
+        auto& customLoaders = ovms::CustomLoaders::instance();
+        ASSERT_EQ(customLoaders.addV2(loaderName, loader, nullptr), ovms::StatusCode::OK);
+        customLoaders.finalize();
+        config.addCustomLoaderOption("loader_name", loaderName);
+    }
+    void TearDown() override {
+        ovms::CustomLoaders::instance().remove(loaderName);
+    }
+};
+}  // namespace
+
+TEST_F(TestCustomLoaderBuffers, WeightsUsedWithoutCopyUntilModelRetired) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ovms::ModelVersionState::AVAILABLE);
+    EXPECT_EQ(modelInstance.getInputsInfo().count(DUMMY_MODEL_INPUT_NAME), 1);
+    // weights are referenced by the model
+    EXPECT_FALSE(loader->lastWeightsOwner.expired());
+    modelInstance.retireModel();
+    EXPECT_TRUE(loader->lastWeightsOwner.expired());
+}
+
+TEST_F(TestCustomLoaderBuffers, CompiledBlobImported) {
+    std::stringstream exported;
+    ieCore.compile_model(config.getBasePath() + "/1/dummy.xml", "CPU").export_model(exported);
+    const std::string exportedBlob = exported.str();
+    loader->blob.assign(exportedBlob.begin(), exportedBlob.end());
+
+    config.setBatchSize(std::nullopt);
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ovms::ModelVersionState::AVAILABLE);
+    ASSERT_EQ(modelInstance.getInputsInfo().count(DUMMY_MODEL_INPUT_NAME), 1);
+    EXPECT_EQ(modelInstance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), ovms::Shape({1, 10}));
+    EXPECT_EQ(modelInstance.getOutputsInfo().count(DUMMY_MODEL_OUTPUT_NAME), 1);
+
+    // compiled blob cannot be reshaped
+    ovms::ModelInstance reshapedInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    config.setBatchSize(ovms::Dimension(2));
+    EXPECT_EQ(reshapedInstance.loadModel(config), ovms::StatusCode::IMPORTED_MODEL_RESHAPE_NOT_SUPPORTED);
+}
+
 #pragma GCC diagnostic pop
@@ -0,0 +1,177 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../custom_nodes/common/nms.hpp"
+#include "../custom_nodes/east_ocr/nms.hpp"
+#include "opencv2/opencv.hpp"
+
+using namespace ovms;
+using custom_nodes_common::Boxes;
+using custom_nodes_common::NmsParameters;
+
+static std::vector<size_t> legacyNms(const std::vector<cv::Rect>& rects, const std::vector<float>& scores, const NmsParameters& parameters) {
+    std::vector<size_t> indices(rects.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        indices[i] = i;
+    }
+    std::vector<cv::Rect> resRects;
+    std::vector<float> resScores;
+    std::vector<size_t> resIndices;
+    nms2(rects, scores, indices, resRects, resScores, resIndices, parameters.iouThreshold, parameters.minNeighbors, parameters.minScoresSum);
+    return resIndices;
+}
+
+TEST(CustomNodeNms, EmptyInput) {
+    Boxes boxes;
+    EXPECT_TRUE(custom_nodes_common::nms(boxes, NmsParameters()).empty());
+}
+
+TEST(CustomNodeNms, SuppressesOverlappingBoxes) {
+    Boxes boxes;
+    boxes.push_back(0, 0, 10, 10, 0.5f);
+    boxes.push_back(1, 1, 11, 11, 0.9f);
+    boxes.push_back(50, 50, 60, 60, 0.7f);
+    EXPECT_THAT(custom_nodes_common::nms(boxes, NmsParameters()), ::testing::ElementsAre(1, 2));
+}
+
+TEST(CustomNodeNms, MaxOutputBoxes) {
+    Boxes boxes;
+    for (int i = 0; i < 10; ++i) {
+        boxes.push_back(i * 20, 0, i * 20 + 10, 10, 0.1f * i);
+    }
+    NmsParameters parameters;
+    parameters.maxOutputBoxes = 3;
+    EXPECT_THAT(custom_nodes_common::nms(boxes, parameters), ::testing::ElementsAre(9, 8, 7));
+}
+
+class CustomNodeNmsLegacyComparison : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(CustomNodeNmsLegacyComparison, SameResultsAsLegacyNms) {
+    const size_t boxesCount = GetParam();
+    std::mt19937 generator(boxesCount);
+    std::uniform_int_distribution<int> position(0, 400);
+    std::uniform_int_distribution<int> size(1, 60);
+    // coarse scores to exercise ties
+    std::uniform_int_distribution<int> score(0, 20);
+
+    std::vector<cv::Rect> rects;
+    std::vector<float> scores;
+    Boxes boxes;
+    for (size_t i = 0; i < boxesCount; ++i) {
+        cv::Rect rect(position(generator), position(generator), size(generator), size(generator));
+        float rectScore = score(generator) / 20.f;
+        rects.emplace_back(rect);
+        scores.emplace_back(rectScore);
+        boxes.push_back(rect.x, rect.y, rect.x + rect.width, rect.y + rect.height, rectScore);
+    }
+    for (float iouThreshold : {0.f, 0.3f, 0.5f}) {
+        for (int minNeighbors : {0, 1}) {
+            for (size_t gridBucketingMinBoxes : {0, 1}) {
+                NmsParameters parameters;
+                parameters.iouThreshold = iouThreshold;
+                parameters.minNeighbors = minNeighbors;
+                parameters.minScoresSum = minNeighbors ? 0.5f : 0.f;
+                parameters.gridBucketingMinBoxes = gridBucketingMinBoxes;
+                EXPECT_EQ(custom_nodes_common::nms(boxes, parameters), legacyNms(rects, scores, parameters))
+                    << "iouThreshold: " << iouThreshold << " minNeighbors: " << minNeighbors << " grid: " << gridBucketingMinBoxes;
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Test,
+    CustomNodeNmsLegacyComparison,
+    ::testing::Values(1, 2, 7, 8, 9, 33, 300, 1111));
+
+TEST(CustomNodeNmsDecode, DetectionOutput) {
+    std::vector<float> detections{
+        0, 1, 0.9f, 0.1f, 0.2f, 0.5f, 0.6f,
+        0, 2, 0.8f, 0.0f, 0.0f, 0.1f, 0.1f,
+        0, 1, 0.2f, 0.0f, 0.0f, 0.1f, 0.1f,
+        1, 1, 0.9f, 0.0f, 0.0f, 0.1f, 0.1f,
+        // corners given in reverse order are normalized
+        0, 1, 0.7f, 0.5f, 0.6f, 0.1f, 0.2f};
+    Boxes boxes;
+    auto indices = custom_nodes_common::decodeDetectionOutput(detections.data(), 5, 7, 100, 200, 0.5f, -1, boxes);
+    EXPECT_THAT(indices, ::testing::ElementsAre(0, 1, 4));
+    ASSERT_EQ(boxes.size(), 3);
+    EXPECT_EQ(boxes.x1[0], 10);
+    EXPECT_EQ(boxes.y1[0], 40);
+    EXPECT_EQ(boxes.x2[0], 50);
+    EXPECT_EQ(boxes.y2[0], 120);
+    EXPECT_EQ(boxes.scores[0], 0.9f);
+    EXPECT_EQ(boxes.x1[2], 10);
+    EXPECT_EQ(boxes.y1[2], 40);
+    EXPECT_EQ(boxes.x2[2], 50);
+    EXPECT_EQ(boxes.y2[2], 120);
+
+    boxes.clear();
+    indices = custom_nodes_common::decodeDetectionOutput(detections.data(), 5, 7, 100, 200, 0.5f, 2, boxes);
+    EXPECT_THAT(indices, ::testing::ElementsAre(1));
+    EXPECT_EQ(boxes.size(), 1);
+}
+
+TEST(CustomNodeNmsDecode, CornerBoxes) {
+    std::vector<float> data{
+        1, 2, 3, 4, 0.9f,
+        5, 6, 7, 8, 0.1f,
+        9, 10, 11, 12, 0.6f};
+    Boxes boxes;
+    auto indices = custom_nodes_common::decodeCornerBoxes(data.data(), 3, 5, 0.5f, boxes);
+    EXPECT_THAT(indices, ::testing::ElementsAre(0, 2));
+    ASSERT_EQ(boxes.size(), 2);
+    EXPECT_EQ(boxes.x1[1], 9);
+    EXPECT_EQ(boxes.y1[1], 10);
+    EXPECT_EQ(boxes.x2[1], 11);
+    EXPECT_EQ(boxes.y2[1], 12);
+    EXPECT_EQ(boxes.scores[1], 0.6f);
+}
+
+TEST(CustomNodeNmsDecode, EastBoxes) {
+    const int rows = 2, cols = 2;
+    std::vector<float> scores{0.1f, 0.9f, 0.2f, 0.3f};
+    std::vector<float> geometry(rows * cols * 5, 0.f);
+    // cell (y=0, x=1): distances to top, right, bottom, left edges and angle 0
+    float* cell = geometry.data() + 1 * 5;
+    cell[0] = 2;
+    cell[1] = 3;
+    cell[2] = 4;
+    cell[3] = 1;
+    custom_nodes_common::EastDecodeParameters parameters;
+    parameters.confidenceThreshold = 0.5f;
+    parameters.imageWidth = cols * 4;
+    parameters.imageHeight = rows * 4;
+    Boxes boxes;
+    custom_nodes_common::RotatedBoxes rotatedBoxes;
+    ASSERT_TRUE(custom_nodes_common::decodeEastBoxes(scores.data(), geometry.data(), rows, cols, parameters, boxes, rotatedBoxes));
+    ASSERT_EQ(boxes.size(), 1);
+    EXPECT_EQ(boxes.x1[0], 3);
+    EXPECT_EQ(boxes.y1[0], 0);
+    EXPECT_EQ(boxes.x2[0], 7);
+    EXPECT_EQ(boxes.y2[0], 4);
+    EXPECT_EQ(boxes.scores[0], 0.9f);
+    ASSERT_EQ(rotatedBoxes.angles.size(), 1);
+    EXPECT_EQ(rotatedBoxes.angles[0], 0.f);
+    EXPECT_EQ(rotatedBoxes.widths[0], 4.f);
+    EXPECT_EQ(rotatedBoxes.heights[0], 6.f);
+}
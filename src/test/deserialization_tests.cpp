@@ -223,14 +223,16 @@ public:
     static MockTensorProtoDeserializatorThrowingInferenceEngine* mock;
     static ov::Tensor deserializeTensorProto(
         const tensorflow::TensorProto& requestInput,
-        const std::shared_ptr<const ovms::TensorInfo>& tensorInfo) {
+        const std::shared_ptr<const ovms::TensorInfo>& tensorInfo,
+        const ov::Allocator& allocator) {
         return mock->deserializeTensorProto(requestInput, tensorInfo);
     }
 
     static ov::Tensor deserializeTensorProto(
         const ::KFSRequest::InferInputTensor& requestInput,
         const std::shared_ptr<const TensorInfo>& tensorInfo,
-        const std::string* buffer) {
+        const std::string* buffer,
+        const ov::Allocator& allocator) {
         return mock->deserializeTensorProto(requestInput, tensorInfo, buffer);
     }
 };
@@ -458,6 +460,25 @@ TEST_F(KserveGRPCPredict, ShouldReturnValidTensor) {
     }
 }
 
+TEST_F(KserveGRPCPredict, ShouldConvertWirePrecisionToModelPrecision) {
+    for (auto [wirePrecision, encodedOne] : std::vector<std::pair<ovms::Precision, uint16_t>>{{ovms::Precision::FP16, 0x3C00}, {ovms::Precision::BF16, 0x3F80}}) {
+        SetUpTensorProto(TensorInfo::getPrecisionAsString(wirePrecision), true);
+        std::string wireBuffer;
+        for (int i = 0; i < DUMMY_MODEL_INPUT_SIZE; i++) {
+            wireBuffer.append(reinterpret_cast<const char*>(&encodedOne), sizeof(encodedOne));
+        }
+        auto tensorInfo = tensorMap[tensorName]->createCopyWithWirePrecision(wirePrecision);
+        ov::Tensor tensor = deserializeTensorProto<ConcreteTensorProtoDeserializator>(tensorProto, tensorInfo, &wireBuffer);
+
+        ASSERT_EQ(tensor.get_element_type(), ov::element::Type_t::f32);
+        ASSERT_EQ(tensor.get_shape(), ov::Shape({1, DUMMY_MODEL_INPUT_SIZE}));
+        float_t* data = (float_t*)tensor.data();
+        for (int i = 0; i < DUMMY_MODEL_INPUT_SIZE; i++) {
+            ASSERT_EQ(data[i], 1);
+        }
+    }
+}
+
 class KserveGRPCPredictRequest : public KserveGRPCPredict {
 public:
     void SetUp() {
@@ -26,6 +26,7 @@
 #include "../dags/exit_node.hpp"
 #include "../dags/nodestreamidguard.hpp"
 #include "../dags/pipeline.hpp"
+#include "../dags/pipeline_execution_plan.hpp"
 #include "../dags/pipeline_factory.hpp"
 #include "../dags/pipelinedefinition.hpp"
 #include "../kfs_frontend/kfs_utils.hpp"
@@ -2381,6 +2382,62 @@ TEST_F(EnsembleFlowTest, PipelineDefinitionComplexGrapgWithCycleValidation) {
     ASSERT_EQ(pipelineDefinition.validateForCycles(), StatusCode::PIPELINE_CYCLE_FOUND);
 }
 
+TEST_F(EnsembleFlowTest, PipelineExecutionPlanIsTopologicallyOrdered) {
+    // Node infos intentionally listed in reverse order of execution
+    std::vector<NodeInfo> info{
+        {NodeKind::EXIT, EXIT_NODE_NAME},
+        {NodeKind::DL, "dummy_node2", "dummy"},
+        {NodeKind::DL, "dummy_node1", "dummy"},
+        {NodeKind::ENTRY, ENTRY_NODE_NAME},
+    };
+
+    pipeline_connections_t connections;
+    connections["dummy_node1"] = {
+        {ENTRY_NODE_NAME, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}}}};
+    connections["dummy_node2"] = {
+        {"dummy_node1", {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_INPUT_NAME}}}};
+    connections[EXIT_NODE_NAME] = {
+        {"dummy_node2", {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}}}};
+
+    std::shared_ptr<const PipelineExecutionPlan> plan;
+    ASSERT_EQ(PipelineExecutionPlan::compile("my_new_pipeline", info, connections, {}, {}, {}, plan), StatusCode::OK);
+    ASSERT_NE(plan, nullptr);
+    const auto& nodeInfos = plan->getNodeInfos();
+    ASSERT_EQ(nodeInfos.size(), 4);
+    EXPECT_EQ(nodeInfos[0].nodeName, ENTRY_NODE_NAME);
+    EXPECT_EQ(nodeInfos[1].nodeName, "dummy_node1");
+    EXPECT_EQ(nodeInfos[2].nodeName, "dummy_node2");
+    EXPECT_EQ(nodeInfos[3].nodeName, EXIT_NODE_NAME);
+    ASSERT_EQ(plan->getConnections().size(), 3);
+    for (const auto& connection : plan->getConnections()) {
+        EXPECT_LT(connection.dependencyIndex, connection.dependantIndex);
+        ASSERT_NE(connection.aliases, nullptr);
+        EXPECT_EQ(connection.aliases->size(), 1);
+    }
+}
+
+TEST_F(EnsembleFlowTest, PipelineExecutionPlanRejectsCycle) {
+    std::vector<NodeInfo> info{
+        {NodeKind::ENTRY, ENTRY_NODE_NAME},
+        {NodeKind::DL, "dummy_node1", "dummy"},
+        {NodeKind::DL, "dummy_node2", "dummy"},
+        {NodeKind::EXIT, EXIT_NODE_NAME},
+    };
+
+    pipeline_connections_t connections;
+    connections["dummy_node1"] = {
+        {ENTRY_NODE_NAME, {{customPipelineInputName, DUMMY_MODEL_INPUT_NAME}}},
+        {"dummy_node2", {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_INPUT_NAME}}}};
+    connections["dummy_node2"] = {
+        {"dummy_node1", {{DUMMY_MODEL_OUTPUT_NAME, DUMMY_MODEL_INPUT_NAME}}}};
+    connections[EXIT_NODE_NAME] = {
+        {"dummy_node2", {{DUMMY_MODEL_OUTPUT_NAME, customPipelineOutputName}}}};
+
+    std::shared_ptr<const PipelineExecutionPlan> plan;
+    EXPECT_EQ(PipelineExecutionPlan::compile("my_new_pipeline", info, connections, {}, {}, {}, plan), StatusCode::PIPELINE_CYCLE_FOUND);
+    EXPECT_EQ(plan, nullptr);
+}
+
 TEST_F(EnsembleFlowTest, PipelineDefinitionContainingCycleValidation) {
     ConstructorEnabledModelManager managerWithDummyModel;
     managerWithDummyModel.reloadModelWithVersions(config);
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../grpc_compression.hpp"
+
+using namespace ovms;
+
+TEST(GrpcCompressionPolicy, EmptyPolicy) {
+    GrpcCompressionPolicy policy;
+    ASSERT_EQ(GrpcCompressionPolicy::parse("", policy), StatusCode::OK);
+    EXPECT_TRUE(policy.empty());
+    EXPECT_FALSE(policy.getAlgorithm("/inference.GRPCInferenceService/ModelInfer").has_value());
+}
+
+TEST(GrpcCompressionPolicy, DefaultAlgorithm) {
+    GrpcCompressionPolicy policy;
+    ASSERT_EQ(GrpcCompressionPolicy::parse("gzip", policy), StatusCode::OK);
+    EXPECT_FALSE(policy.empty());
+    EXPECT_EQ(policy.getAlgorithm("/inference.GRPCInferenceService/ModelInfer"), GRPC_COMPRESS_GZIP);
+    EXPECT_EQ(policy.getAlgorithm("/tensorflow.serving.PredictionService/Predict"), GRPC_COMPRESS_GZIP);
+}
+
+TEST(GrpcCompressionPolicy, PerMethodAlgorithms) {
+    GrpcCompressionPolicy policy;
+    ASSERT_EQ(GrpcCompressionPolicy::parse("deflate, ModelInfer=gzip,ServerLive = none", policy), StatusCode::OK);
+    EXPECT_EQ(policy.getAlgorithm("/inference.GRPCInferenceService/ModelInfer"), GRPC_COMPRESS_GZIP);
+    EXPECT_EQ(policy.getAlgorithm("ModelInfer"), GRPC_COMPRESS_GZIP);
+    EXPECT_EQ(policy.getAlgorithm("/inference.GRPCInferenceService/ServerLive"), GRPC_COMPRESS_NONE);
+    EXPECT_EQ(policy.getAlgorithm("/inference.GRPCInferenceService/ModelMetadata"), GRPC_COMPRESS_DEFLATE);
+}
+
+TEST(GrpcCompressionPolicy, OnlyMethodAlgorithms) {
+    GrpcCompressionPolicy policy;
+    ASSERT_EQ(GrpcCompressionPolicy::parse("Predict=deflate", policy), StatusCode::OK);
+    EXPECT_EQ(policy.getAlgorithm("/tensorflow.serving.PredictionService/Predict"), GRPC_COMPRESS_DEFLATE);
+    EXPECT_FALSE(policy.getAlgorithm("/inference.GRPCInferenceService/ModelInfer").has_value());
+}
+
+TEST(GrpcCompressionPolicy, WrongFormat) {
+    for (const std::string wrongPolicy : {"lz4", "gzip,deflate", "ModelInfer=gzip,ModelInfer=none", "=gzip", "ModelInfer=", "ModelInfer=gzip=deflate", "GZIP"}) {
+        GrpcCompressionPolicy policy;
+        EXPECT_EQ(GrpcCompressionPolicy::parse(wrongPolicy, policy), StatusCode::GRPC_COMPRESSION_WRONG_FORMAT) << wrongPolicy;
+        EXPECT_TRUE(policy.empty()) << wrongPolicy;
+    }
+}
@@ -17,6 +17,7 @@
 
 #include "../config.hpp"
 #include "../http_rest_api_handler.hpp"
+#include "../http_server.hpp"
 #include "../localfilesystem.hpp"
 #include "../logging.hpp"
 #include "../modelmanager.hpp"
@@ -990,6 +991,30 @@ TEST_F(ConfigReload, StartWith1DummyPipelineThenReloadToAddPipeline) {
     EXPECT_EQ(status, ovms::StatusCode::OK_RELOADED);
 }
 
+class RestServerBind : public ConfigApi {};
+
+TEST_F(RestServerBind, PortCannotBeBoundTwice) {
+    TestHelper1 t(*this, configWith1Dummy);
+    ovms::Server& ovmsServer = ovms::Server::instance();
+    std::string port = "9000";
+    randomizePort(port);
+    auto first = ovms::createAndStartHttpServer("0.0.0.0", std::stoi(port), 2, 1, ovmsServer);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(ovms::createAndStartHttpServer("0.0.0.0", std::stoi(port), 2, 1, ovmsServer), nullptr);
+    // listeners with SO_REUSEPORT cannot join port bound without it
+    EXPECT_EQ(ovms::createAndStartHttpServer("0.0.0.0", std::stoi(port), 4, 2, ovmsServer), nullptr);
+    first->terminate();
+    first->waitForTermination();
+
+    auto reactors = ovms::createAndStartHttpServer("0.0.0.0", std::stoi(port), 4, 2, ovmsServer);
+    ASSERT_NE(reactors, nullptr);
+    EXPECT_EQ(reactors->getReactorsCount(), 2);
+    // single listener without SO_REUSEPORT cannot join reactors
+    EXPECT_EQ(ovms::createAndStartHttpServer("0.0.0.0", std::stoi(port), 2, 1, ovmsServer), nullptr);
+    reactors->terminate();
+    reactors->waitForTermination();
+}
+
 class ConfigStatus : public ConfigApi {};
 
 TEST_F(ConfigStatus, configWithPipelines) {
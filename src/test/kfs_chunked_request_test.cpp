@@ -0,0 +1,205 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../kfs_frontend/kfs_chunked_request.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+class KFSChunkedRequestTest : public ::testing::Test {
+protected:
+    KFSRequest firstChunk;
+    ChunkedRequestAssembler assembler;
+
+    void SetUp() override {
+        firstChunk.set_model_name("dummy");
+        firstChunk.set_id("1");
+        (*firstChunk.mutable_parameters())[CHUNKED_REQUEST_PARAMETER_NAME].set_bool_param(true);
+        for (const std::string name : {"a", "b"}) {
+            auto* input = firstChunk.add_inputs();
+            input->set_name(name);
+            input->set_datatype("UINT8");
+            input->add_shape(1);
+            input->add_shape(6);
+        }
+        firstChunk.add_raw_input_contents()->assign("abc");
+        firstChunk.add_raw_input_contents()->assign("ABCD");
+    }
+
+    static KFSRequest createChunk(const std::vector<std::string>& contents, bool finalChunk) {
+        KFSRequest chunk;
+        for (const auto& content : contents) {
+            chunk.add_raw_input_contents()->assign(content);
+        }
+        if (finalChunk) {
+            (*chunk.mutable_parameters())[FINAL_CHUNK_PARAMETER_NAME].set_bool_param(true);
+        }
+        return chunk;
+    }
+};
+
+TEST_F(KFSChunkedRequestTest, AssembleRequest) {
+    ASSERT_TRUE(isChunkedRequest(firstChunk));
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    EXPECT_TRUE(assembler.isStarted());
+    EXPECT_FALSE(assembler.isComplete());
+    auto chunk = createChunk({"de", ""}, false);
+    ASSERT_EQ(assembler.addChunk(chunk), StatusCode::OK);
+    chunk = createChunk({"f", "EF"}, true);
+    ASSERT_EQ(assembler.addChunk(chunk), StatusCode::OK);
+    ASSERT_TRUE(assembler.isComplete());
+    const KFSRequest& request = assembler.getRequest();
+    EXPECT_EQ(request.model_name(), "dummy");
+    EXPECT_EQ(request.id(), "1");
+    ASSERT_EQ(request.inputs_size(), 2);
+    ASSERT_EQ(request.raw_input_contents_size(), 2);
+    EXPECT_EQ(request.raw_input_contents(0), "abcdef");
+    EXPECT_EQ(request.raw_input_contents(1), "ABCDEF");
+    EXPECT_EQ(request.parameters().count(CHUNKED_REQUEST_PARAMETER_NAME), 0);
+    EXPECT_EQ(request.parameters().count(FINAL_CHUNK_PARAMETER_NAME), 0);
+    EXPECT_EQ(assembler.getResponseChunkSize(), DEFAULT_RESPONSE_CHUNK_SIZE);
+
+    assembler.reset();
+    EXPECT_FALSE(assembler.isStarted());
+    EXPECT_FALSE(assembler.isComplete());
+}
+
+TEST_F(KFSChunkedRequestTest, SingleChunkRequest) {
+    (*firstChunk.mutable_parameters())[FINAL_CHUNK_PARAMETER_NAME].set_bool_param(true);
+    (*firstChunk.mutable_parameters())[RESPONSE_CHUNK_SIZE_PARAMETER_NAME].set_int64_param(10);
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    ASSERT_TRUE(assembler.isComplete());
+    EXPECT_EQ(assembler.getRequest().raw_input_contents(0), "abc");
+    EXPECT_EQ(assembler.getResponseChunkSize(), 10);
+    EXPECT_EQ(assembler.getRequest().parameters().count(RESPONSE_CHUNK_SIZE_PARAMETER_NAME), 0);
+}
+
+TEST_F(KFSChunkedRequestTest, FirstChunkWithoutContents) {
+    firstChunk.clear_raw_input_contents();
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    auto chunk = createChunk({"abcdef", "ABCDEF"}, true);
+    ASSERT_EQ(assembler.addChunk(chunk), StatusCode::OK);
+    EXPECT_EQ(assembler.getRequest().raw_input_contents(1), "ABCDEF");
+}
+
+TEST_F(KFSChunkedRequestTest, FirstChunkWithoutChunkedParameter) {
+    firstChunk.mutable_parameters()->erase(CHUNKED_REQUEST_PARAMETER_NAME);
+    EXPECT_EQ(assembler.addChunk(firstChunk), StatusCode::INVALID_CHUNKED_REQUEST);
+}
+
+TEST_F(KFSChunkedRequestTest, WrongResponseChunkSize) {
+    (*firstChunk.mutable_parameters())[RESPONSE_CHUNK_SIZE_PARAMETER_NAME].set_int64_param(0);
+    EXPECT_EQ(assembler.addChunk(firstChunk), StatusCode::INVALID_CHUNKED_REQUEST);
+}
+
+TEST_F(KFSChunkedRequestTest, WrongContentsCount) {
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    auto chunk = createChunk({"def"}, true);
+    EXPECT_EQ(assembler.addChunk(chunk), StatusCode::INVALID_CHUNKED_REQUEST);
+}
+
+TEST_F(KFSChunkedRequestTest, InputsInFollowingChunk) {
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    auto chunk = createChunk({"def", "EF"}, true);
+    chunk.add_inputs()->set_name("a");
+    EXPECT_EQ(assembler.addChunk(chunk), StatusCode::INVALID_CHUNKED_REQUEST);
+}
+
+TEST_F(KFSChunkedRequestTest, DifferentIdInFollowingChunk) {
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    auto chunk = createChunk({"def", "EF"}, true);
+    chunk.set_id("2");
+    EXPECT_EQ(assembler.addChunk(chunk), StatusCode::INVALID_CHUNKED_REQUEST);
+}
+
+TEST_F(KFSChunkedRequestTest, MoreDataThanShapeAllows) {
+    ASSERT_EQ(assembler.addChunk(firstChunk), StatusCode::OK);
+    auto chunk = createChunk({"defg", "EF"}, true);
+    EXPECT_EQ(assembler.addChunk(chunk), StatusCode::INVALID_CHUNKED_REQUEST);
+}
+
+static KFSResponse createResponse() {
+    KFSResponse response;
+    response.set_model_name("dummy");
+    response.set_id("1");
+    for (const std::string name : {"a", "b", "c"}) {
+        auto* output = response.add_outputs();
+        output->set_name(name);
+        output->set_datatype("UINT8");
+    }
+    response.add_raw_output_contents()->assign("0123456789");
+    response.add_raw_output_contents();
+    response.add_raw_output_contents()->assign("abcde");
+    return response;
+}
+
+TEST(KFSChunkedResponseTest, SplitIntoChunks) {
+    KFSResponse response = createResponse();
+    std::vector<::inference::ModelStreamInferResponse> messages;
+    ASSERT_TRUE(writeResponseInChunks(response, 4, [&messages](const ::inference::ModelStreamInferResponse& message) {
+        messages.push_back(message);
+        return true;
+    }));
+    ASSERT_EQ(messages.size(), 4);
+    EXPECT_EQ(messages[0].infer_response().model_name(), "dummy");
+    EXPECT_EQ(messages[0].infer_response().outputs_size(), 3);
+    std::vector<std::string> assembled(3);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        const auto& chunk = messages[i].infer_response();
+        EXPECT_EQ(chunk.id(), "1");
+        if (i > 0) {
+            EXPECT_EQ(chunk.outputs_size(), 0);
+        }
+        ASSERT_EQ(chunk.raw_output_contents_size(), 3);
+        size_t chunkSize = 0;
+        for (int j = 0; j < 3; ++j) {
+            assembled[j] += chunk.raw_output_contents(j);
+            chunkSize += chunk.raw_output_contents(j).size();
+        }
+        EXPECT_LE(chunkSize, 4);
+        ASSERT_EQ(chunk.parameters().count(FINAL_CHUNK_PARAMETER_NAME), 1);
+        EXPECT_EQ(chunk.parameters().at(FINAL_CHUNK_PARAMETER_NAME).bool_param(), i == messages.size() - 1);
+    }
+    EXPECT_THAT(assembled, ::testing::ElementsAre("0123456789", "", "abcde"));
+}
+
+TEST(KFSChunkedResponseTest, SingleChunk) {
+    KFSResponse response = createResponse();
+    std::vector<::inference::ModelStreamInferResponse> messages;
+    ASSERT_TRUE(writeResponseInChunks(response, DEFAULT_RESPONSE_CHUNK_SIZE, [&messages](const ::inference::ModelStreamInferResponse& message) {
+        messages.push_back(message);
+        return true;
+    }));
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0].infer_response().raw_output_contents(0), "0123456789");
+    EXPECT_EQ(messages[0].infer_response().raw_output_contents(2), "abcde");
+    EXPECT_TRUE(messages[0].infer_response().parameters().at(FINAL_CHUNK_PARAMETER_NAME).bool_param());
+}
+
+TEST(KFSChunkedResponseTest, StopOnWriteFailure) {
+    KFSResponse response = createResponse();
+    size_t writes = 0;
+    EXPECT_FALSE(writeResponseInChunks(response, 4, [&writes](const ::inference::ModelStreamInferResponse& message) {
+        ++writes;
+        return false;
+    }));
+    EXPECT_EQ(writes, 1);
+}
@@ -44,9 +44,11 @@ class ModelMetadataResponseBuild : public ::testing::Test {
         MockModel(const std::string& name, std::shared_ptr<ModelInstance> instance) :
             Model(name, false /*stateful*/, nullptr) {
             modelVersions.insert({instance->getVersion(), instance});
+            updateVersionsSnapshot();
         }
         void addOneVersion(model_version_t version, std::shared_ptr<ModelInstance> instance) {
             modelVersions.emplace(version, instance);
+            updateVersionsSnapshot();
         }
     };
 
@@ -222,6 +224,19 @@ TEST_F(ModelMetadataResponseBuild, SingleInputSingleOutputValidResponse) {
     EXPECT_TRUE(isShapeTheSame(output.shape(), {1, 2000}));
 }
 
+TEST(ModelMetadataTensorConvert, WirePrecisionIsReported) {
+    auto info = std::make_shared<ovms::TensorInfo>("output", ovms::Precision::FP32, ovms::shape_t{1, 10});
+    KFSModelMetadataResponse::TensorMetadata metadata;
+    ovms::KFSInferenceServiceImpl::convert({"output", info}, &metadata);
+    EXPECT_EQ(metadata.datatype(), "FP32");
+    for (auto [wirePrecision, expectedDatatype] : std::vector<std::pair<ovms::Precision, std::string>>{{ovms::Precision::FP16, "FP16"}, {ovms::Precision::BF16, "BF16"}}) {
+        metadata.Clear();
+        ovms::KFSInferenceServiceImpl::convert({"output", info->createCopyWithWirePrecision(wirePrecision)}, &metadata);
+        EXPECT_EQ(metadata.datatype(), expectedDatatype);
+        EXPECT_TRUE(isShapeTheSame(metadata.shape(), {1, 10}));
+    }
+}
+
 TEST_F(ModelMetadataResponseBuild, DoubleInputDoubleOutputValidResponse) {
     tensor_desc_map_t inputs = tensor_desc_map_t({{"FirstInput", {ovms::Precision::FP32, {1, 3, 224, 224}}},
         {"SecondInput", {ovms::Precision::U8, {1, 700, 5}}}});
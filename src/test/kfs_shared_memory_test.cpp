@@ -0,0 +1,296 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../capi_frontend/buffer.hpp"
+#include "../capi_frontend/inferencerequest.hpp"
+#include "../capi_frontend/inferenceresponse.hpp"
+#include "../kfs_frontend/kfs_shared_memory.hpp"
+#include "../shared_memory_registry.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+class SharedMemoryTest : public ::testing::Test {
+protected:
+    static constexpr size_t OBJECT_SIZE = 3 * 4096;
+    std::string key;
+    char* object = nullptr;
+    SharedMemoryRegistry registry;
+
+    void SetUp() override {
+        registry.configure(true, "ovms_shm_test_");
+        key = "/ovms_shm_test_" + std::to_string(getpid());
+        int fd = shm_open(key.c_str(), O_CREAT | O_RDWR | O_EXCL, 0600);
+        ASSERT_NE(fd, -1);
+        ASSERT_EQ(ftruncate(fd, OBJECT_SIZE), 0);
+        void* mapping = mmap(nullptr, OBJECT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        ASSERT_NE(mapping, MAP_FAILED);
+        object = static_cast<char*>(mapping);
+        for (size_t i = 0; i < OBJECT_SIZE; ++i) {
+            object[i] = static_cast<char>(i % 251);
+        }
+    }
+
+    void TearDown() override {
+        if (object) {
+            munmap(object, OBJECT_SIZE);
+        }
+        shm_unlink(key.c_str());
+    }
+
+    static void setSharedMemoryParameters(::google::protobuf::Map<std::string, ::inference::InferParameter>& parameters, const std::string& region, int64_t offset, int64_t byteSize) {
+        parameters[SHARED_MEMORY_REGION_PARAMETER_NAME].set_string_param(region);
+        parameters[SHARED_MEMORY_OFFSET_PARAMETER_NAME].set_int64_param(offset);
+        parameters[SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME].set_int64_param(byteSize);
+    }
+};
+
+TEST_F(SharedMemoryTest, RegisterAndUnregister) {
+    ASSERT_EQ(registry.registerRegion("input", key, 5000, 100), StatusCode::OK);
+    EXPECT_EQ(registry.registerRegion("input", key, 0, 100), StatusCode::SHM_REGION_ALREADY_REGISTERED);
+    ASSERT_EQ(registry.registerRegion("output", key, 0, OBJECT_SIZE), StatusCode::OK);
+
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> regions;
+    ASSERT_EQ(registry.getRegions("", regions), StatusCode::OK);
+    ASSERT_EQ(regions.size(), 2);
+    ASSERT_EQ(registry.getRegions("input", regions), StatusCode::OK);
+    ASSERT_EQ(regions.size(), 1);
+    EXPECT_EQ(regions[0]->getKey(), key);
+    EXPECT_EQ(regions[0]->getOffset(), 5000);
+    EXPECT_EQ(regions[0]->getByteSize(), 100);
+
+    // region not page aligned is mapped at requested offset
+    char* buffer = nullptr;
+    ASSERT_EQ(regions[0]->getBuffer(10, 90, &buffer), StatusCode::OK);
+    EXPECT_EQ(std::memcmp(buffer, object + 5010, 90), 0);
+    EXPECT_EQ(regions[0]->getBuffer(10, 91, &buffer), StatusCode::SHM_OUT_OF_BOUNDS);
+    EXPECT_EQ(regions[0]->getBuffer(101, 0, &buffer), StatusCode::SHM_OUT_OF_BOUNDS);
+
+    ASSERT_EQ(registry.unregisterRegion("input"), StatusCode::OK);
+    EXPECT_EQ(registry.unregisterRegion("input"), StatusCode::SHM_REGION_MISSING);
+    EXPECT_EQ(registry.getRegions("input", regions), StatusCode::SHM_REGION_MISSING);
+    ASSERT_EQ(registry.unregisterRegion(""), StatusCode::OK);
+    ASSERT_EQ(registry.getRegions("", regions), StatusCode::OK);
+    EXPECT_EQ(regions.size(), 0);
+}
+
+TEST_F(SharedMemoryTest, RegionStaysMappedAfterUnregister) {
+    ASSERT_EQ(registry.registerRegion("input", key, 0, 16), StatusCode::OK);
+    std::shared_ptr<const SharedMemoryRegion> region;
+    ASSERT_EQ(registry.getRegion("input", region), StatusCode::OK);
+    ASSERT_EQ(registry.unregisterRegion("input"), StatusCode::OK);
+    char* buffer = nullptr;
+    ASSERT_EQ(region->getBuffer(0, 16, &buffer), StatusCode::OK);
+    EXPECT_EQ(std::memcmp(buffer, object, 16), 0);
+}
+
+TEST_F(SharedMemoryTest, RegisterInvalidRegion) {
+    EXPECT_EQ(registry.registerRegion("input", "/ovms_shm_test_nonexistent", 0, 16), StatusCode::SHM_REGION_MAPPING_FAILED);
+    EXPECT_EQ(registry.registerRegion("input", key, OBJECT_SIZE - 8, 16), StatusCode::SHM_REGION_MAPPING_FAILED);
+    EXPECT_EQ(registry.registerRegion("input", key, 0, 0), StatusCode::INVALID_SHM_PARAMETERS);
+    EXPECT_EQ(registry.registerRegion("", key, 0, 16), StatusCode::INVALID_SHM_PARAMETERS);
+}
+
+TEST_F(SharedMemoryTest, RegisterWhenDisabled) {
+    SharedMemoryRegistry disabledRegistry;
+    EXPECT_EQ(disabledRegistry.registerRegion("input", key, 0, 16), StatusCode::SHM_DISABLED);
+    disabledRegistry.configure(false, "ovms_shm_test_");
+    EXPECT_EQ(disabledRegistry.registerRegion("input", key, 0, 16), StatusCode::SHM_DISABLED);
+    std::vector<std::shared_ptr<const SharedMemoryRegion>> regions;
+    ASSERT_EQ(disabledRegistry.getRegions("", regions), StatusCode::OK);
+    EXPECT_EQ(regions.size(), 0);
+}
+
+TEST_F(SharedMemoryTest, RegisterKeyNotMatchingPrefix) {
+    registry.configure(true, "/other_prefix_");
+    EXPECT_EQ(registry.registerRegion("input", key, 0, 16), StatusCode::SHM_KEY_NOT_ALLOWED);
+    registry.configure(true, "ovms_shm_test_");
+    EXPECT_EQ(registry.registerRegion("input", "/ovms_shm_test_/../" + key, 0, 16), StatusCode::SHM_KEY_NOT_ALLOWED);
+    EXPECT_EQ(registry.registerRegion("input", "/", 0, 16), StatusCode::SHM_KEY_NOT_ALLOWED);
+    // leading slashes are ignored the same as in shm_open
+    EXPECT_EQ(registry.registerRegion("input", key.substr(1), 0, 16), StatusCode::OK);
+}
+
+TEST_F(SharedMemoryTest, RequestUsesSharedMemory) {
+    KFSRequest request;
+    request.add_inputs()->set_name("a");
+    request.add_outputs()->set_name("b");
+    EXPECT_FALSE(requestUsesSharedMemory(request));
+    setSharedMemoryParameters(*request.mutable_outputs(0)->mutable_parameters(), "output", 0, 16);
+    EXPECT_TRUE(requestUsesSharedMemory(request));
+}
+
+TEST_F(SharedMemoryTest, BindInputsWithoutCopy) {
+    ASSERT_EQ(registry.registerRegion("input", key, 4096, 4096), StatusCode::OK);
+    KFSRequest request;
+    request.set_model_name("dummy");
+    for (const std::string name : {"a", "b", "c"}) {
+        auto* input = request.add_inputs();
+        input->set_name(name);
+        input->set_datatype("FP32");
+        input->add_shape(1);
+        input->add_shape(4);
+    }
+    setSharedMemoryParameters(*request.mutable_inputs(0)->mutable_parameters(), "input", 16, 16);
+    setSharedMemoryParameters(*request.mutable_inputs(2)->mutable_parameters(), "input", 32, 16);
+    request.add_raw_input_contents()->assign(16, 'x');
+
+    SharedMemoryRequest sharedMemoryRequest;
+    InferenceRequest inferenceRequest("dummy", 1);
+    ASSERT_EQ(sharedMemoryRequest.prepare(request, registry, inferenceRequest), StatusCode::OK);
+    ASSERT_EQ(inferenceRequest.getInputsSize(), 3);
+    // buffers point to the server mapping of the region
+    std::shared_ptr<const SharedMemoryRegion> region;
+    ASSERT_EQ(registry.getRegion("input", region), StatusCode::OK);
+    char* regionStart = nullptr;
+    ASSERT_EQ(region->getBuffer(0, 4096, &regionStart), StatusCode::OK);
+    const InferenceTensor* tensor = nullptr;
+    ASSERT_EQ(inferenceRequest.getInput("a", &tensor), StatusCode::OK);
+    EXPECT_EQ(tensor->getDataType(), OVMS_DATATYPE_FP32);
+    EXPECT_THAT(tensor->getShape(), ::testing::ElementsAre(1, 4));
+    EXPECT_EQ(tensor->getBuffer()->data(), regionStart + 16);
+    EXPECT_EQ(std::memcmp(tensor->getBuffer()->data(), object + 4096 + 16, 16), 0);
+    EXPECT_EQ(tensor->getBuffer()->getByteSize(), 16);
+    ASSERT_EQ(inferenceRequest.getInput("b", &tensor), StatusCode::OK);
+    EXPECT_EQ(tensor->getBuffer()->data(), request.raw_input_contents(0).data());
+    ASSERT_EQ(inferenceRequest.getInput("c", &tensor), StatusCode::OK);
+    EXPECT_EQ(tensor->getBuffer()->data(), regionStart + 32);
+}
+
+TEST_F(SharedMemoryTest, InvalidInputParameters) {
+    ASSERT_EQ(registry.registerRegion("input", key, 0, 64), StatusCode::OK);
+    KFSRequest request;
+    auto* input = request.add_inputs();
+    input->set_name("a");
+    input->set_datatype("FP32");
+    input->add_shape(4);
+
+    auto prepare = [this, &request]() {
+        SharedMemoryRequest sharedMemoryRequest;
+        InferenceRequest inferenceRequest("dummy", 1);
+        return sharedMemoryRequest.prepare(request, registry, inferenceRequest);
+    };
+    auto& parameters = *input->mutable_parameters();
+    setSharedMemoryParameters(parameters, "missing", 0, 16);
+    EXPECT_EQ(prepare(), StatusCode::SHM_REGION_MISSING);
+    setSharedMemoryParameters(parameters, "input", 56, 16);
+    EXPECT_EQ(prepare(), StatusCode::SHM_OUT_OF_BOUNDS);
+    setSharedMemoryParameters(parameters, "input", -1, 16);
+    EXPECT_EQ(prepare(), StatusCode::INVALID_SHM_PARAMETERS);
+    setSharedMemoryParameters(parameters, "input", 0, 16);
+    parameters.erase(SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME);
+    EXPECT_EQ(prepare(), StatusCode::INVALID_SHM_PARAMETERS);
+    parameters[SHARED_MEMORY_REGION_PARAMETER_NAME].set_int64_param(1);
+    EXPECT_EQ(prepare(), StatusCode::INVALID_SHM_PARAMETERS);
+
+    // input outside of shared memory has to be in raw_input_contents
+    setSharedMemoryParameters(parameters, "input", 0, 16);
+    auto* other = request.add_inputs();
+    other->set_name("b");
+    other->set_datatype("FP32");
+    other->add_shape(1);
+    other->mutable_contents()->add_fp32_contents(1.0);
+    EXPECT_EQ(prepare(), StatusCode::INVALID_MESSAGE_STRUCTURE);
+}
+
+TEST_F(SharedMemoryTest, WriteOutputsToSharedMemory) {
+    ASSERT_EQ(registry.registerRegion("output", key, 8192, 4096), StatusCode::OK);
+    KFSRequest request;
+    auto* input = request.add_inputs();
+    input->set_name("in");
+    input->set_datatype("UINT8");
+    input->add_shape(2);
+    request.add_raw_input_contents()->assign("ab");
+    auto* output = request.add_outputs();
+    output->set_name("a");
+    setSharedMemoryParameters(*output->mutable_parameters(), "output", 100, 64);
+
+    SharedMemoryRequest sharedMemoryRequest;
+    InferenceRequest inferenceRequest("dummy", 1);
+    ASSERT_EQ(sharedMemoryRequest.prepare(request, registry, inferenceRequest), StatusCode::OK);
+
+    InferenceResponse inferenceResponse("dummy", 3);
+    const std::vector<int64_t> shape{2, 2};
+    const std::vector<float> data{1, 2, 3, 4};
+    for (const std::string name : {"a", "b"}) {
+        ASSERT_EQ(inferenceResponse.addOutput(name, OVMS_DATATYPE_FP32, shape.data(), shape.size()), StatusCode::OK);
+    }
+    for (uint32_t i = 0; i < 2; ++i) {
+        const std::string* name = nullptr;
+        InferenceTensor* tensor = nullptr;
+        ASSERT_EQ(inferenceResponse.getOutput(i, &name, &tensor), StatusCode::OK);
+        ASSERT_EQ(tensor->setBuffer(data.data(), data.size() * sizeof(float), OVMS_BUFFERTYPE_CPU, std::nullopt, true), StatusCode::OK);
+    }
+
+    KFSResponse response;
+    ASSERT_EQ(sharedMemoryRequest.serializeResponse(inferenceResponse, response), StatusCode::OK);
+    EXPECT_EQ(response.model_name(), "dummy");
+    EXPECT_EQ(response.model_version(), "3");
+    ASSERT_EQ(response.outputs_size(), 2);
+    // output placed in shared memory has no entry in raw_output_contents
+    ASSERT_EQ(response.raw_output_contents_size(), 1);
+    for (int i = 0; i < 2; ++i) {
+        const auto& responseOutput = response.outputs(i);
+        EXPECT_EQ(responseOutput.datatype(), "FP32");
+        EXPECT_THAT(responseOutput.shape(), ::testing::ElementsAre(2, 2));
+        if (responseOutput.name() == "a") {
+            EXPECT_EQ(std::memcmp(object + 8192 + 100, data.data(), 16), 0);
+            EXPECT_EQ(responseOutput.parameters().at(SHARED_MEMORY_REGION_PARAMETER_NAME).string_param(), "output");
+            EXPECT_EQ(responseOutput.parameters().at(SHARED_MEMORY_OFFSET_PARAMETER_NAME).int64_param(), 100);
+            EXPECT_EQ(responseOutput.parameters().at(SHARED_MEMORY_BYTE_SIZE_PARAMETER_NAME).int64_param(), 16);
+        } else {
+            EXPECT_EQ(response.raw_output_contents(0), std::string(reinterpret_cast<const char*>(data.data()), 16));
+            EXPECT_EQ(responseOutput.parameters_size(), 0);
+        }
+    }
+}
+
+TEST_F(SharedMemoryTest, OutputExceedsSharedMemoryByteSize) {
+    ASSERT_EQ(registry.registerRegion("output", key, 0, 4096), StatusCode::OK);
+    KFSRequest request;
+    auto* output = request.add_outputs();
+    output->set_name("a");
+    setSharedMemoryParameters(*output->mutable_parameters(), "output", 0, 8);
+    SharedMemoryRequest sharedMemoryRequest;
+    InferenceRequest inferenceRequest("dummy", 1);
+    ASSERT_EQ(sharedMemoryRequest.prepare(request, registry, inferenceRequest), StatusCode::OK);
+
+    InferenceResponse inferenceResponse("dummy", 1);
+    const std::vector<int64_t> shape{4};
+    const std::vector<float> data{1, 2, 3, 4};
+    ASSERT_EQ(inferenceResponse.addOutput("a", OVMS_DATATYPE_FP32, shape.data(), shape.size()), StatusCode::OK);
+    const std::string* name = nullptr;
+    InferenceTensor* tensor = nullptr;
+    ASSERT_EQ(inferenceResponse.getOutput(0, &name, &tensor), StatusCode::OK);
+    ASSERT_EQ(tensor->setBuffer(data.data(), data.size() * sizeof(float), OVMS_BUFFERTYPE_CPU, std::nullopt, true), StatusCode::OK);
+    KFSResponse response;
+    EXPECT_EQ(sharedMemoryRequest.serializeResponse(inferenceResponse, response), StatusCode::SHM_OUT_OF_BOUNDS);
+
+    InferenceResponse emptyResponse("dummy", 1);
+    response.Clear();
+    EXPECT_EQ(sharedMemoryRequest.serializeResponse(emptyResponse, response), StatusCode::INVALID_MISSING_OUTPUT);
+}
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+#include <spdlog/sinks/ostream_sink.h>
+
+#include "../logging.hpp"
+
+using namespace ovms;
+using namespace std::chrono_literals;
+
+TEST(LogRateLimiter, OneMessagePerInterval) {
+    LogRateLimiter limiter(1000ms);
+    const auto start = std::chrono::steady_clock::now();
+    uint64_t suppressed = 0;
+    EXPECT_TRUE(limiter.allow(suppressed, start));
+    EXPECT_EQ(suppressed, 0);
+    EXPECT_FALSE(limiter.allow(suppressed, start + 1ms));
+    EXPECT_FALSE(limiter.allow(suppressed, start + 999ms));
+    EXPECT_TRUE(limiter.allow(suppressed, start + 1000ms));
+    EXPECT_EQ(suppressed, 2);
+    EXPECT_FALSE(limiter.allow(suppressed, start + 1500ms));
+    EXPECT_TRUE(limiter.allow(suppressed, start + 5000ms));
+    EXPECT_EQ(suppressed, 1);
+}
+
+TEST(LogRateLimiter, RepeatedMessagesAreSuppressed) {
+    std::ostringstream output;
+    auto logger = std::make_shared<spdlog::logger>("rate_limited", std::make_shared<spdlog::sinks::ostream_sink_mt>(output));
+    logger->set_pattern("%v");
+    logger->set_level(spdlog::level::warn);
+    for (int i = 0; i < 100; ++i) {
+        OVMS_LOG_RATE_LIMITED(logger, spdlog::level::warn, "request: {} failed", i);
+        OVMS_LOG_RATE_LIMITED(logger, spdlog::level::info, "request: {} info", i);
+    }
+    EXPECT_EQ(output.str(), "request: 0 failed\n");
+}
+
+TEST(LogRateLimiter, SeparateLimitersDoNotSuppressEachOther) {
+    std::ostringstream output;
+    auto logger = std::make_shared<spdlog::logger>("rate_limited", std::make_shared<spdlog::sinks::ostream_sink_mt>(output));
+    logger->set_pattern("%v");
+    logger->set_level(spdlog::level::warn);
+    LogRateLimiter firstPipelineLimiter(LOG_RATE_LIMIT_INTERVAL);
+    LogRateLimiter secondPipelineLimiter(LOG_RATE_LIMIT_INTERVAL);
+    for (const auto* pipelineName : {"first", "first", "second", "second"}) {
+        auto& limiter = (std::string(pipelineName) == "first") ? firstPipelineLimiter : secondPipelineLimiter;
+        OVMS_LOG_WITH_RATE_LIMITER(limiter, logger, spdlog::level::warn, "pipeline: {} failed", pipelineName);
+    }
+    EXPECT_EQ(output.str(), "pipeline: first failed\npipeline: second failed\n");
+}
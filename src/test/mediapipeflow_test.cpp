@@ -26,6 +26,7 @@
 #include <gtest/gtest.h>
 #include <openvino/openvino.hpp>
 #include <openvino/runtime/tensor.hpp>
+#include <rapidjson/document.h>
 #include <sys/stat.h>
 
 #pragma GCC diagnostic push
@@ -168,6 +169,24 @@ TEST_F(MediapipeFlowKfsTest, Infer) {
     // Checking that KFSPASS calculator copies requestData1 to the reponse so that we expect requestData1 on output
     checkAddResponse("out", requestData1, requestData2, request, response, 1, 1, modelName);
 }
+
+TEST_F(MediapipeFlowKfsTest, RestModelMetadata) {
+    HttpRestApiHandler handler(server, 0);
+    HttpRequestComponents components;
+    components.model_name = "mediapipeDummyKFS";
+    std::string request, response;
+    ASSERT_EQ(handler.processModelMetadataKFSRequest(components, response, request), ovms::StatusCode::OK);
+    rapidjson::Document doc;
+    doc.Parse(response.c_str());
+    ASSERT_FALSE(doc.HasParseError()) << response;
+    EXPECT_EQ(std::string(doc["name"].GetString()), "mediapipeDummyKFS");
+    ASSERT_EQ(doc["versions"].Size(), 1);
+    EXPECT_EQ(std::string(doc["versions"][0].GetString()), "1");
+    ASSERT_EQ(doc["inputs"].Size(), 1);
+    EXPECT_EQ(std::string(doc["inputs"][0]["name"].GetString()), "in");
+    ASSERT_EQ(doc["outputs"].Size(), 1);
+    EXPECT_EQ(std::string(doc["outputs"][0]["name"].GetString()), "out");
+}
 #if (PYTHON_DISABLE == 0)
 TEST_F(MediapipePyTensorOvTensorConverterTest, Infer) {
     const ovms::Module* grpcModule = server.getModule(ovms::GRPC_SERVER_MODULE_NAME);
@@ -1560,6 +1579,7 @@ public:
         join();
         spdlog::info("Destructor of modelmanager(Enabled one). Models #:{}", models.size());
         models.clear();
+        updateModelsSnapshot();
         spdlog::info("Destructor of modelmanager(Enabled one). Models #:{}", models.size());
     }
 };
@@ -22,9 +22,12 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "../allocator_stats.hpp"
 #include "../metric.hpp"
+#include "../metric_config.hpp"
 #include "../metric_family.hpp"
 #include "../metric_registry.hpp"
+#include "../status.hpp"
 
 using namespace ovms;
 
@@ -969,3 +972,52 @@ TEST(MetricsManyOps, MultipleThreads) {
         }
     }
 }
+
+TEST(AllocatorMetrics, StatsAreReported) {
+    std::vector<std::unique_ptr<char[]>> buffers;
+    for (int i = 0; i < 16; i++) {
+        buffers.emplace_back(std::make_unique<char[]>(1024 * 1024));
+        buffers.back()[0] = 1;
+    }
+    AllocatorStats stats;
+    ASSERT_TRUE(getAllocatorStats(stats));
+    EXPECT_GE(stats.allocated, 16 * 1024 * 1024);
+    EXPECT_GE(stats.resident, stats.allocated);
+    EXPECT_GE(stats.getFragmentationRatio(), 0.0);
+    EXPECT_LT(stats.getFragmentationRatio(), 1.0);
+}
+
+TEST(AllocatorMetrics, FragmentationRatio) {
+    AllocatorStats stats;
+    EXPECT_EQ(stats.getFragmentationRatio(), 0.0);
+    stats.allocated = 750;
+    stats.resident = 1000;
+    EXPECT_DOUBLE_EQ(stats.getFragmentationRatio(), 0.25);
+}
+
+TEST(AllocatorMetrics, ReporterUpdatesEnabledGauges) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    ASSERT_EQ(metricConfig.loadFromCLIString(true, METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES + "," + METRIC_NAME_ALLOCATOR_FRAGMENTATION), StatusCode::OK);
+    AllocatorMetricReporter reporter(&metricConfig, &registry);
+    ASSERT_NE(reporter.allocatedBytes, nullptr);
+    ASSERT_NE(reporter.fragmentationRatio, nullptr);
+    EXPECT_EQ(reporter.activeBytes, nullptr);
+    EXPECT_EQ(reporter.residentBytes, nullptr);
+    const std::string label = std::string{"{allocator=\""} + getAllocatorName() + "\"}";
+    EXPECT_THAT(registry.collect(), HasSubstr(METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES + label + " 0\n"));
+    reporter.update();
+    auto content = registry.collect();
+    EXPECT_THAT(content, Not(HasSubstr(METRIC_NAME_ALLOCATOR_ALLOCATED_BYTES + label + " 0\n")));
+    EXPECT_THAT(content, HasSubstr(METRIC_NAME_ALLOCATOR_FRAGMENTATION + label));
+    EXPECT_THAT(content, Not(HasSubstr(METRIC_NAME_ALLOCATOR_RESIDENT_BYTES)));
+}
+
+TEST(AllocatorMetrics, ReporterWithMetricsDisabled) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    AllocatorMetricReporter reporter(&metricConfig, &registry);
+    EXPECT_EQ(reporter.allocatedBytes, nullptr);
+    reporter.update();
+    EXPECT_EQ(registry.collect().size(), 0);
+}
@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <optional>
+
+#include <gtest/gtest.h>
+
+#include "../model_auto_tuner.hpp"
+
+using namespace ovms;
+using namespace std::chrono_literals;
+
+class ModelAutoTunerTest : public ::testing::Test {
+protected:
+    AutoTuneConfig config;
+    ModelAutoTuner::clock::time_point now = ModelAutoTuner::clock::now();
+
+    void SetUp() override {
+        config.minNireq = 1;
+        config.maxNireq = 8;
+        config.maxStreams = 4;
+        config.intervalSeconds = 10;
+    }
+
+    void record(ModelAutoTuner& tuner, uint64_t requests, double waitTimeUs, double inferenceTimeUs) {
+        for (uint64_t i = 0; i < requests; ++i) {
+            tuner.recordWaitTime(waitTimeUs);
+            tuner.recordInferenceTime(inferenceTimeUs);
+        }
+    }
+
+    std::optional<AutoTuneSettings> nextWindow(ModelAutoTuner& tuner) {
+        now += std::chrono::seconds(config.intervalSeconds);
+        return tuner.evaluate(now);
+    }
+};
+
+TEST_F(ModelAutoTunerTest, NoDecisionBeforeIntervalPasses) {
+    ModelAutoTuner tuner(config, {2, 2}, now);
+    record(tuner, 1000, 5000, 1000);
+    EXPECT_FALSE(tuner.evaluate(now + 5s).has_value());
+    EXPECT_TRUE(tuner.evaluate(now + 10s).has_value());
+}
+
+TEST_F(ModelAutoTunerTest, NoDecisionWithoutTraffic) {
+    ModelAutoTuner tuner(config, {2, 2}, now);
+    record(tuner, ModelAutoTuner::MIN_WINDOW_REQUESTS - 1, 5000, 1000);
+    EXPECT_FALSE(nextWindow(tuner).has_value());
+}
+
+TEST_F(ModelAutoTunerTest, SaturatedModelGetsMoreInferRequests) {
+    ModelAutoTuner tuner(config, {2, 2}, now);
+    record(tuner, 1000, 5000, 1000);
+    auto settings = nextWindow(tuner);
+    ASSERT_TRUE(settings.has_value());
+    EXPECT_EQ(settings.value(), AutoTuneSettings({3, 2}));
+
+    // trial improved throughput and is kept
+    record(tuner, 1200, 4000, 1000);
+    EXPECT_FALSE(nextWindow(tuner).has_value());
+    EXPECT_EQ(tuner.getSettings(), AutoTuneSettings({3, 2}));
+}
+
+TEST_F(ModelAutoTunerTest, TrialWithoutImprovementIsReverted) {
+    ModelAutoTuner tuner(config, {2, 2}, now);
+    record(tuner, 1000, 5000, 1000);
+    ASSERT_EQ(nextWindow(tuner).value(), AutoTuneSettings({3, 2}));
+    record(tuner, 1000, 4500, 1500);
+    auto settings = nextWindow(tuner);
+    ASSERT_TRUE(settings.has_value());
+    EXPECT_EQ(settings.value(), AutoTuneSettings({2, 2}));
+
+    // no trials during cooldown
+    for (uint32_t i = 0; i < ModelAutoTuner::COOLDOWN_WINDOWS; ++i) {
+        record(tuner, 1000, 5000, 1000);
+        EXPECT_FALSE(nextWindow(tuner).has_value());
+    }
+    // more infer requests did not help, more streams are tried
+    record(tuner, 1000, 5000, 1000);
+    settings = nextWindow(tuner);
+    ASSERT_TRUE(settings.has_value());
+    EXPECT_EQ(settings.value(), AutoTuneSettings({3, 3}));
+}
+
+TEST_F(ModelAutoTunerTest, SettingsStayWithinBounds) {
+    config.maxNireq = 4;
+    config.maxStreams = 0;
+    ModelAutoTuner tuner(config, {4, 2}, now);
+    record(tuner, 1000, 5000, 1000);
+    EXPECT_FALSE(nextWindow(tuner).has_value());
+    EXPECT_EQ(tuner.getSettings(), AutoTuneSettings({4, 2}));
+}
+
+TEST_F(ModelAutoTunerTest, IdleInferRequestsAreReleased) {
+    ModelAutoTuner tuner(config, {8, 2}, now);
+    // 100 requests of 10ms in 10s window - 0.1 infer request busy on average
+    record(tuner, 100, 0, 10000);
+    auto settings = nextWindow(tuner);
+    ASSERT_TRUE(settings.has_value());
+    EXPECT_EQ(settings.value(), AutoTuneSettings({4, 2}));
+    record(tuner, 100, 0, 10000);
+    EXPECT_EQ(nextWindow(tuner).value(), AutoTuneSettings({2, 2}));
+    record(tuner, 100, 0, 10000);
+    EXPECT_EQ(nextWindow(tuner).value(), AutoTuneSettings({1, 2}));
+    record(tuner, 100, 0, 10000);
+    EXPECT_FALSE(nextWindow(tuner).has_value());
+}
+
+TEST_F(ModelAutoTunerTest, RejectedSettingsAreRestored) {
+    ModelAutoTuner tuner(config, {2, 2}, now);
+    record(tuner, 1000, 5000, 1000);
+    ASSERT_EQ(nextWindow(tuner).value(), AutoTuneSettings({3, 2}));
+    tuner.rejectSettings({2, 2});
+    EXPECT_EQ(tuner.getSettings(), AutoTuneSettings({2, 2}));
+    record(tuner, 1000, 5000, 1000);
+    EXPECT_FALSE(nextWindow(tuner).has_value());
+}
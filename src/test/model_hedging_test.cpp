@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+#include "../model_hedging.hpp"
+
+using namespace ovms;
+
+TEST(ModelHedgingTest, NoHedgeDelayBeforeMinSamples) {
+    HedgingPolicy policy(HedgingConfig{});
+    for (size_t i = 0; i < HedgingPolicy::MIN_SAMPLES - 1; ++i) {
+        policy.recordInferenceTime(1000);
+    }
+    EXPECT_FALSE(policy.getHedgeDelay().has_value());
+    policy.recordInferenceTime(1000);
+    ASSERT_TRUE(policy.getHedgeDelay().has_value());
+    EXPECT_EQ(policy.getHedgeDelay().value(), std::chrono::microseconds(1000));
+}
+
+TEST(ModelHedgingTest, HedgeDelayFollowsPercentile) {
+    HedgingConfig config;
+    config.latencyPercentile = 90;
+    HedgingPolicy policy(config);
+    for (size_t i = 1; i <= HedgingPolicy::MIN_SAMPLES; ++i) {
+        policy.recordInferenceTime(i * 10);
+    }
+    ASSERT_TRUE(policy.getHedgeDelay().has_value());
+    EXPECT_EQ(policy.getHedgeDelay().value(), std::chrono::microseconds(900));
+}
+
+TEST(ModelHedgingTest, HedgeDelayUpdatesWithNewSamples) {
+    HedgingPolicy policy(HedgingConfig{});
+    for (size_t i = 0; i < HedgingPolicy::MIN_SAMPLES; ++i) {
+        policy.recordInferenceTime(1000);
+    }
+    EXPECT_EQ(policy.getHedgeDelay().value(), std::chrono::microseconds(1000));
+    for (size_t i = 0; i < HedgingPolicy::LATENCY_WINDOW; ++i) {
+        policy.recordInferenceTime(5000);
+    }
+    EXPECT_EQ(policy.getHedgeDelay().value(), std::chrono::microseconds(5000));
+}
+
+TEST(ModelHedgingTest, HedgesLimitedByExtraLoad) {
+    HedgingConfig config;
+    config.maxExtraLoad = 0.25;
+    HedgingPolicy policy(config);
+    EXPECT_FALSE(policy.tryAcquireHedge());
+    for (int i = 0; i < 8; ++i) {
+        policy.recordInferenceTime(1000);
+    }
+    EXPECT_TRUE(policy.tryAcquireHedge());
+    EXPECT_TRUE(policy.tryAcquireHedge());
+    EXPECT_FALSE(policy.tryAcquireHedge());
+}
+
+TEST(ModelHedgingTest, ReleasedHedgeReturnsToBudget) {
+    HedgingConfig config;
+    config.maxExtraLoad = 0.125;
+    HedgingPolicy policy(config);
+    for (int i = 0; i < 8; ++i) {
+        policy.recordInferenceTime(1000);
+    }
+    EXPECT_TRUE(policy.tryAcquireHedge());
+    EXPECT_FALSE(policy.tryAcquireHedge());
+    policy.releaseHedge();
+    EXPECT_TRUE(policy.tryAcquireHedge());
+}
+
+TEST(ModelHedgingTest, HedgeBudgetIsCapped) {
+    HedgingConfig config;
+    config.maxExtraLoad = 1;
+    HedgingPolicy policy(config);
+    for (int i = 0; i < 1000; ++i) {
+        policy.recordInferenceTime(1000);
+    }
+    for (int i = 0; i < HedgingPolicy::MAX_TOKENS; ++i) {
+        EXPECT_TRUE(policy.tryAcquireHedge());
+    }
+    EXPECT_FALSE(policy.tryAcquireHedge());
+}
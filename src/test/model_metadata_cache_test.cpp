@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../get_model_metadata_impl.hpp"
+#include "../model_metadata_cache.hpp"
+#include "../status.hpp"
+#include "../tensorinfo.hpp"
+
+using namespace ovms;
+
+class ModelMetadataCacheTest : public ::testing::Test {
+protected:
+    const std::string modelName = "dummy";
+    const model_version_t version = 3;
+    tensor_map_t inputs;
+    tensor_map_t outputs;
+
+    void SetUp() override {
+        inputs["b"] = std::make_shared<TensorInfo>("b", Precision::FP32, shape_t{1, 10});
+        inputs["a"] = std::make_shared<TensorInfo>("a", Precision::U8, Shape{Dimension::any(), 3});
+        inputs["scalar"] = std::make_shared<TensorInfo>("scalar", Precision::I64, shape_t{});
+        outputs["out"] = std::make_shared<TensorInfo>("out", Precision::FP32, shape_t{1, 10});
+    }
+};
+
+TEST_F(ModelMetadataCacheTest, TfsResponseAndJsonMatchSerializedProto) {
+    ModelMetadataCache cache(modelName, version, inputs, outputs);
+    const auto& response = cache.getTfsResponse();
+    EXPECT_EQ(response.model_spec().name(), modelName);
+    EXPECT_EQ(response.model_spec().version().value(), version);
+    tensorflow::serving::SignatureDefMap def;
+    ASSERT_TRUE(response.metadata().at("signature_def").UnpackTo(&def));
+    EXPECT_EQ(def.signature_def().at("serving_default").inputs_size(), 3);
+    EXPECT_EQ(def.signature_def().at("serving_default").outputs_size(), 1);
+
+    std::string expectedJson;
+    ASSERT_EQ(GetModelMetadataImpl::serializeResponse2Json(&response, &expectedJson), StatusCode::OK);
+    EXPECT_EQ(cache.getTfsJson(), expectedJson);
+}
+
+TEST_F(ModelMetadataCacheTest, KfsResponseContainsReadyVersions) {
+    ModelMetadataCache cache(modelName, version, inputs, outputs);
+    KFSModelMetadataResponse response;
+    response.set_name("stale");
+    cache.buildKfsResponse({1, 3}, &response);
+    EXPECT_EQ(response.name(), modelName);
+    EXPECT_EQ(response.platform(), "OpenVINO");
+    ASSERT_EQ(response.versions_size(), 2);
+    EXPECT_EQ(response.versions(0), "1");
+    EXPECT_EQ(response.versions(1), "3");
+    EXPECT_EQ(response.inputs_size(), 3);
+    EXPECT_EQ(response.outputs_size(), 1);
+}
+
+TEST_F(ModelMetadataCacheTest, KfsJsonMatchesSerializedProto) {
+    ModelMetadataCache cache(modelName, version, inputs, outputs);
+    for (const model_versions_t& versions : {model_versions_t{}, model_versions_t{3}, model_versions_t{1, 2, 3}}) {
+        KFSModelMetadataResponse response;
+        cache.buildKfsResponse(versions, &response);
+        std::string expectedJson;
+        ASSERT_EQ(serializeKfsModelMetadataToJson(response, expectedJson), StatusCode::OK);
+        std::string json = "content to be overwritten";
+        ASSERT_TRUE(cache.writeKfsJson(versions, json));
+        EXPECT_EQ(json, expectedJson);
+    }
+}
+
+TEST_F(ModelMetadataCacheTest, KfsJsonHasNumericShapes) {
+    ModelMetadataCache cache(modelName, version, inputs, outputs);
+    std::string json;
+    ASSERT_TRUE(cache.writeKfsJson({3}, json));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"versions\":[\"3\"]"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"shape\":[-1,3]"));
+    EXPECT_THAT(json, ::testing::HasSubstr("\"shape\":[]"));
+}
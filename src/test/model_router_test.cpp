@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../model_router.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "../status.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+static const char* modelRouterConfig = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy_small",
+                "base_path": "/ovms/src/test/dummy",
+                "shape": "(1,10)"
+            }
+        },
+        {
+            "config": {
+                "name": "dummy_large",
+                "base_path": "/ovms/src/test/dummy",
+                "shape": "(-1,10)"
+            }
+        }
+    ],
+    "model_router_config_list": [
+        {
+            "name": "dummy",
+            "variants": [
+                {"model_name": "dummy_small", "max_in_flight_requests": 1},
+                {"model_name": "dummy_large", "max_batch_size": 4}
+            ]
+        }
+    ]
+})";
+
+class ModelRouterTest : public TestWithTempDir {
+protected:
+    ConstructorEnabledModelManager manager;
+    std::shared_ptr<ModelRouter> router;
+
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        const std::string configFilePath = directoryPath + "/config.json";
+        createConfigFileWithContent(modelRouterConfig, configFilePath);
+        ASSERT_EQ(manager.loadConfig(configFilePath), StatusCode::OK);
+        router = manager.findModelRouterByName("dummy");
+        ASSERT_NE(router, nullptr);
+    }
+
+    std::string route(const request_shapes_t& shapes, Status expectedStatus = StatusCode::OK) {
+        std::shared_ptr<ModelInstance> instance;
+        std::unique_ptr<ModelInstanceUnloadGuard> guard;
+        EXPECT_EQ(router->route(manager, shapes, instance, guard), expectedStatus);
+        return instance ? instance->getName() : "";
+    }
+};
+
+TEST_F(ModelRouterTest, RouteByInputShape) {
+    EXPECT_EQ(route({{DUMMY_MODEL_INPUT_NAME, {1, 10}}}), "dummy_small");
+    EXPECT_EQ(route({{DUMMY_MODEL_INPUT_NAME, {3, 10}}}), "dummy_large");
+}
+
+TEST_F(ModelRouterTest, RejectWhenNoVariantAccepts) {
+    route({{DUMMY_MODEL_INPUT_NAME, {8, 10}}}, StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT);
+    route({{DUMMY_MODEL_INPUT_NAME, {1, 11}}}, StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT);
+    route({{"unknown", {1, 10}}}, StatusCode::MODEL_ROUTER_NO_MATCHING_VARIANT);
+}
+
+TEST_F(ModelRouterTest, ShiftTrafficWhenVariantOverloaded) {
+    std::shared_ptr<ModelInstance> busyInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> busyGuard;
+    ASSERT_EQ(manager.getModelInstance("dummy_small", 0, busyInstance, busyGuard), StatusCode::OK);
+    EXPECT_EQ(route({{DUMMY_MODEL_INPUT_NAME, {1, 10}}}), "dummy_large");
+    busyGuard.reset();
+    EXPECT_EQ(route({{DUMMY_MODEL_INPUT_NAME, {1, 10}}}), "dummy_small");
+}
+
+TEST_F(ModelRouterTest, NameOccupiedByModel) {
+    std::string config = modelRouterConfig;
+    const std::string routerName = "\"name\": \"dummy\",";
+    config.replace(config.find(routerName), routerName.size(), "\"name\": \"dummy_small\",");
+    const std::string configFilePath = directoryPath + "/config_occupied.json";
+    createConfigFileWithContent(config, configFilePath);
+    EXPECT_EQ(manager.loadConfig(configFilePath), StatusCode::MODEL_ROUTER_NAME_OCCUPIED);
+    EXPECT_EQ(manager.findModelRouterByName("dummy"), nullptr);
+}
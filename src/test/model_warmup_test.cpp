@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+
+#include "../model_warmup.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "../shape.hpp"
+#include "../tensorinfo.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+TEST(ModelWarmup, SingleShapeBucketForStaticInputs) {
+    tensor_map_t inputsInfo({{"a", std::make_shared<TensorInfo>("a", Precision::FP32, Shape{1, 10})},
+        {"b", std::make_shared<TensorInfo>("b", Precision::I32, Shape{2, 3})}});
+    auto buckets = createWarmupShapeBuckets(inputsInfo);
+    ASSERT_EQ(buckets.size(), 1);
+    EXPECT_EQ(buckets[0].at("a"), ov::Shape({1, 10}));
+    EXPECT_EQ(buckets[0].at("b"), ov::Shape({2, 3}));
+}
+
+TEST(ModelWarmup, LowerAndUpperBoundBucketsForDynamicInputs) {
+    tensor_map_t inputsInfo({{"a", std::make_shared<TensorInfo>("a", Precision::FP32, Shape{Dimension(1, 8), Dimension::any(), 10})},
+        {"b", std::make_shared<TensorInfo>("b", Precision::I32, Shape{2, 3})}});
+    auto buckets = createWarmupShapeBuckets(inputsInfo);
+    ASSERT_EQ(buckets.size(), 2);
+    EXPECT_EQ(buckets[0].at("a"), ov::Shape({1, 1, 10}));
+    EXPECT_EQ(buckets[1].at("a"), ov::Shape({8, 1, 10}));
+    EXPECT_EQ(buckets[0].at("b"), ov::Shape({2, 3}));
+    EXPECT_EQ(buckets[1].at("b"), ov::Shape({2, 3}));
+}
+
+TEST(ModelWarmup, RandomTensorValues) {
+    TensorInfo floatInfo("a", Precision::FP32, Shape{1, 100});
+    auto tensor = createWarmupTensor(floatInfo, ov::Shape{1, 100});
+    ASSERT_EQ(tensor.get_shape(), ov::Shape({1, 100}));
+    ASSERT_EQ(tensor.get_element_type(), ov::element::f32);
+    const float* floats = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        EXPECT_GE(floats[i], 0.0f);
+        EXPECT_LT(floats[i], 1.0f);
+    }
+    TensorInfo intInfo("b", Precision::I64, Shape{100});
+    tensor = createWarmupTensor(intInfo, ov::Shape{100});
+    const int64_t* ints = tensor.data<int64_t>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        EXPECT_TRUE(ints[i] == 0 || ints[i] == 1) << ints[i];
+    }
+}
+
+class ModelWarmupSamples : public TestWithTempDir {};
+
+TEST_F(ModelWarmupSamples, TensorReadFromSampleFile) {
+    std::vector<float> sample{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    const std::string samplePath = directoryPath + "/a.bin";
+    std::ofstream(samplePath, std::ios::binary).write(reinterpret_cast<const char*>(sample.data()), sample.size() * sizeof(float));
+    TensorInfo info("a", Precision::FP32, Shape{1, 10});
+    auto tensor = createWarmupTensor(info, ov::Shape{1, 10}, samplePath);
+    EXPECT_THAT(std::vector<float>(tensor.data<float>(), tensor.data<float>() + tensor.get_size()), ::testing::ElementsAreArray(sample));
+
+    // sample does not match shape, random data is used instead
+    tensor = createWarmupTensor(info, ov::Shape{2, 10}, samplePath);
+    ASSERT_EQ(tensor.get_shape(), ov::Shape({2, 10}));
+    EXPECT_LT(tensor.data<float>()[0], 1.0f);
+    tensor = createWarmupTensor(info, ov::Shape{1, 10}, directoryPath + "/missing.bin");
+    EXPECT_LT(tensor.data<float>()[0], 1.0f);
+}
+
+TEST_F(ModelWarmupSamples, ModelAvailableAfterWarmup) {
+    ov::Core ieCore;
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    auto config = DUMMY_MODEL_CONFIG;
+    config.setNireq(2);
+    config.setWarmupIterations(3);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ModelVersionState::AVAILABLE);
+    EXPECT_GT(modelInstance.getStatus().getWarmupTime().count(), 0);
+
+    config.setWarmupIterations(0);
+    ASSERT_EQ(modelInstance.reloadModel(config), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ModelVersionState::AVAILABLE);
+    EXPECT_EQ(modelInstance.getStatus().getWarmupTime().count(), 0);
+}
+
+TEST_F(ModelWarmupSamples, WarmupSkippedOnReloadForRequestBatchSize) {
+    ov::Core ieCore;
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    auto config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("auto");
+    config.setWarmupIterations(3);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    EXPECT_GT(modelInstance.getStatus().getWarmupTime().count(), 0);
+
+    std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+    ASSERT_EQ(modelInstance.reloadModel(Dimension(2), {}, unloadGuard), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ModelVersionState::AVAILABLE);
+    EXPECT_EQ(modelInstance.getStatus().getWarmupTime().count(), 0);
+}
+
+TEST_F(ModelWarmupSamples, ModelWarmedUpWithSampleFiles) {
+    ov::Core ieCore;
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    auto config = DUMMY_MODEL_CONFIG;
+    std::filesystem::copy(config.getBasePath() + "/1", directoryPath + "/1", std::filesystem::copy_options::recursive);
+    std::filesystem::create_directories(directoryPath + "/1/" + WARMUP_SAMPLES_DIRECTORY);
+    std::vector<float> sample(DUMMY_MODEL_INPUT_SIZE, 1.0f);
+    std::ofstream(directoryPath + "/1/" + WARMUP_SAMPLES_DIRECTORY + "/" + DUMMY_MODEL_INPUT_NAME + WARMUP_SAMPLE_FILE_EXTENSION, std::ios::binary)
+        .write(reinterpret_cast<const char*>(sample.data()), sample.size() * sizeof(float));
+    config.setBasePath(directoryPath);
+    config.setLocalPath(directoryPath);
+    config.setWarmupIterations(1);
+    config.setWarmupSampleFiles(true);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ModelVersionState::AVAILABLE);
+    EXPECT_GT(modelInstance.getStatus().getWarmupTime().count(), 0);
+}
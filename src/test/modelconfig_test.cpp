@@ -1057,6 +1057,318 @@ TEST(ModelConfig, ConfigParseNodeWithValidShapeFormatArray) {
     EXPECT_EQ(shapes["input"].shape, (ovms::Shape{1, 3, 600, 600}));
 }
 
+TEST(ModelConfig, ConfigParseNodeWithWirePrecision) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "wire_precision": {
+                        "input": "FP16",
+                        "output": "bf16"
+                        }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ovms::wire_precisions_map_t expected{{"input", ovms::Precision::FP16}, {"output", ovms::Precision::BF16}};
+    EXPECT_EQ(modelConfig.getWirePrecisions(), expected);
+
+    ovms::ModelConfig otherConfig = modelConfig;
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig.setWirePrecisions({{"input", ovms::Precision::FP16}});
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+}
+
+TEST(ModelConfig, ConfigParseNodeWithUnsupportedWirePrecision) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "wire_precision": {
+                        "input": "I8"
+                        }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    EXPECT_EQ(status, ovms::StatusCode::WIRE_PRECISION_WRONG_FORMAT);
+}
+
+TEST(ModelConfig, ConfigParseNodeWithResponseCache) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "response_cache": {
+                        "max_size_mb": 64,
+                        "ttl_seconds": 30
+                        }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(modelConfig.getResponseCacheSizeMb(), 64);
+    EXPECT_EQ(modelConfig.getResponseCacheTtlSeconds(), 30);
+
+    ovms::ModelConfig otherConfig = modelConfig;
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+    otherConfig.setResponseCacheTtlSeconds(0);
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+}
+
+TEST(ModelConfig, ConfigParseNodeWithWarmup) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "warmup": {
+                        "iterations": 5,
+                        "inputs": "files"
+                        }
+                }
+            },
+            {
+                "config": {
+                    "name": "beta",
+                    "base_path": "/tmp/models/dummy2",
+                    "warmup": {}
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 2);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(modelConfig.getWarmupIterations(), 5);
+    EXPECT_TRUE(modelConfig.isWarmupSampleFilesUsed());
+
+    ovms::ModelConfig defaultWarmupConfig;
+    status = defaultWarmupConfig.parseNode(configs[1]["config"]);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(defaultWarmupConfig.getWarmupIterations(), 1);
+    EXPECT_FALSE(defaultWarmupConfig.isWarmupSampleFilesUsed());
+
+    // warm-up is executed only when model is loaded, changing it does not require reload
+    ovms::ModelConfig otherConfig = modelConfig;
+    otherConfig.setWarmupIterations(0);
+    EXPECT_FALSE(modelConfig.isReloadRequired(otherConfig));
+}
+
+TEST(ModelConfig, ConfigParseNodeWithAutoTune) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "auto_tune": {
+                        "min_nireq": 2,
+                        "max_nireq": 16,
+                        "max_streams": 4,
+                        "interval_seconds": 10
+                        }
+                }
+            },
+            {
+                "config": {
+                    "name": "beta",
+                    "base_path": "/tmp/models/dummy2",
+                    "auto_tune": {
+                        "min_nireq": 8,
+                        "max_nireq": 4
+                        }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 2);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ASSERT_TRUE(modelConfig.getAutoTuneConfig().has_value());
+    EXPECT_EQ(modelConfig.getAutoTuneConfig()->minNireq, 2);
+    EXPECT_EQ(modelConfig.getAutoTuneConfig()->maxNireq, 16);
+    EXPECT_EQ(modelConfig.getAutoTuneConfig()->maxStreams, 4);
+    EXPECT_EQ(modelConfig.getAutoTuneConfig()->intervalSeconds, 10);
+
+    ovms::ModelConfig otherConfig = modelConfig;
+    otherConfig.setAutoTuneConfig(std::nullopt);
+    EXPECT_TRUE(modelConfig.isReloadRequired(otherConfig));
+
+    ovms::ModelConfig wrongBoundsConfig;
+    status = wrongBoundsConfig.parseNode(configs[1]["config"]);
+    EXPECT_EQ(status, ovms::StatusCode::AUTO_TUNE_WRONG_BOUNDS);
+}
+
+TEST(ModelConfig, ConfigParseNodeWithResponseCacheAndStateful) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "stateful": true,
+                    "response_cache": {
+                        "max_size_mb": 64
+                        }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    EXPECT_EQ(status, ovms::StatusCode::RESPONSE_CACHE_WITH_STATEFUL_MODEL);
+}
+
+TEST(ModelConfig, parseHedging) {
+    std::string config = R"#(
+    {
+    "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "hedging": {
+                        "latency_percentile": 95
+                        }
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    ASSERT_TRUE(modelConfig.getHedgingConfig().has_value());
+    EXPECT_EQ(modelConfig.getHedgingConfig()->latencyPercentile, 95);
+    EXPECT_EQ(modelConfig.getHedgingConfig()->maxExtraLoad, ovms::HedgingConfig{}.maxExtraLoad);
+}
+
+TEST(ModelConfig, hedgingNotAllowedWithStateful) {
+    std::string config = R"#(
+    {
+    "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "stateful": true,
+                    "hedging": {}
+                }
+            }
+        ]
+    }
+    )#";
+
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded, true);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    EXPECT_EQ(status, ovms::StatusCode::HEDGING_WITH_STATEFUL_MODEL);
+}
+
 static std::string config_low_latency_no_stateful = R"#(
     {
     "model_config_list": [
@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //*****************************************************************************
+#include <algorithm>
 #include <cstdio>
 #include <filesystem>
 #include <fstream>
@@ -21,9 +22,11 @@
 #include <gtest/gtest.h>
 #include <stdlib.h>
 
+#include "../executingstreamidguard.hpp"
 #include "../get_model_metadata_impl.hpp"
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
+#include "../ovinferrequestsqueue.hpp"
 #include "test_utils.hpp"
 
 using testing::Return;
@@ -570,6 +573,44 @@ TEST_F(TestLoadModel, SuccessfulLoad) {
     EXPECT_EQ(ovms::ModelVersionState::AVAILABLE, modelInstance.getStatus().getState());
 }
 
+TEST_F(TestLoadModel, HedgedInferenceReturnsCorrectResults) {
+    ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    auto config = DUMMY_MODEL_CONFIG;
+    config.setNireq(2);
+    config.setHedgingConfig(ovms::HedgingConfig{});
+    ASSERT_EQ(modelInstance.loadModel(config), ovms::StatusCode::OK);
+    auto* hedgingPolicy = modelInstance.getHedgingPolicy();
+    ASSERT_NE(hedgingPolicy, nullptr);
+    // 1us threshold makes hedge start before primary inference finishes
+    for (size_t i = 0; i < ovms::HedgingPolicy::MIN_SAMPLES; ++i) {
+        hedgingPolicy->recordInferenceTime(1);
+    }
+    ASSERT_TRUE(hedgingPolicy->getHedgeDelay().has_value());
+
+    auto& queue = modelInstance.getInferRequestsQueue();
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        ovms::ExecutingStreamIdGuard executingStreamIdGuard(queue, modelInstance.getMetricReporter());
+        ov::InferRequest& inferRequest = executingStreamIdGuard.getInferRequest();
+        ov::Tensor input(ov::element::f32, ov::Shape{1, DUMMY_MODEL_INPUT_SIZE});
+        std::fill_n(input.data<float>(), DUMMY_MODEL_INPUT_SIZE, static_cast<float>(iteration));
+        inferRequest.set_tensor(DUMMY_MODEL_INPUT_NAME, input);
+        ovms::HedgeStreamGuard hedgeGuard(queue, modelInstance.getMetricReporter());
+        ASSERT_EQ(modelInstance.performHedgedInference(inferRequest, hedgeGuard), ovms::StatusCode::OK);
+        ov::Tensor output = hedgeGuard.getCompletedRequest(inferRequest).get_tensor(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_EQ(output.get_size(), static_cast<size_t>(DUMMY_MODEL_INPUT_SIZE));
+        for (int i = 0; i < DUMMY_MODEL_INPUT_SIZE; ++i) {
+            EXPECT_EQ(output.data<float>()[i], iteration + 1) << "iteration: " << iteration << " index: " << i;
+        }
+    }
+    // both primary and hedge infer requests are returned to the queue
+    auto firstId = queue.tryToGetIdleStream();
+    auto secondId = queue.tryToGetIdleStream();
+    ASSERT_TRUE(firstId.has_value());
+    ASSERT_TRUE(secondId.has_value());
+    queue.returnStream(firstId.value());
+    queue.returnStream(secondId.value());
+}
+
 TEST_F(TestLoadModel, UnSuccessfulLoadWhenNireqTooHigh) {
     ovms::ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
     auto config = DUMMY_MODEL_CONFIG;
@@ -1118,7 +1159,11 @@ TEST(TensorMap, TestProcessingHintFromShape) {
         {"Output_U8_-1_-1_N?_string",
             std::make_shared<ovms::TensorInfo>("Output_U8_-1_-1_N?_string", ovms::Precision::U8, ovms::Shape{ovms::Dimension::any(), ovms::Dimension::any()})},
         {"Output_FP32_-1_-1_N?_string",
-            std::make_shared<ovms::TensorInfo>("Output_FP32_-1_-1_N?_string", ovms::Precision::FP32, ovms::Shape{ovms::Dimension::any(), ovms::Dimension::any()})}});
+            std::make_shared<ovms::TensorInfo>("Output_FP32_-1_-1_N?_string", ovms::Precision::FP32, ovms::Shape{ovms::Dimension::any(), ovms::Dimension::any()})},
+        {"Output_U8_-1_N_string",
+            std::make_shared<ovms::TensorInfo>("Output_U8_-1_N_string", ovms::Precision::U8, ovms::Shape{ovms::Dimension::any()})},
+        {"Output_U8_-1_N_ragged_string",
+            std::make_shared<ovms::TensorInfo>("Output_U8_-1_N_ragged_string", ovms::Precision::U8, ovms::Shape{ovms::Dimension::any()})}});
 
     EXPECT_EQ(servableInputs["Input_FP32_1_224_224_3_NHWC"]->getPreProcessingHint(), ovms::TensorInfo::ProcessingHint::IMAGE);
     EXPECT_EQ(servableInputs["Input_U8_1_3_NCHW"]->getPreProcessingHint(), ovms::TensorInfo::ProcessingHint::STRING_2D_U8);
@@ -1127,6 +1172,8 @@ TEST(TensorMap, TestProcessingHintFromShape) {
     EXPECT_EQ(servableOutputs["Output_U8_-1_-1_N?"]->getPostProcessingHint(), ovms::TensorInfo::ProcessingHint::NO_PROCESSING);           // due to no suffix
     EXPECT_EQ(servableOutputs["Output_U8_-1_-1_N?_string"]->getPostProcessingHint(), ovms::TensorInfo::ProcessingHint::STRING_2D_U8);     // due to suffix
     EXPECT_EQ(servableOutputs["Output_FP32_-1_-1_N?_string"]->getPostProcessingHint(), ovms::TensorInfo::ProcessingHint::NO_PROCESSING);  // no processing due to not being U8
+    EXPECT_EQ(servableOutputs["Output_U8_-1_N_string"]->getPostProcessingHint(), ovms::TensorInfo::ProcessingHint::NO_PROCESSING);        // 1D requires ragged suffix
+    EXPECT_EQ(servableOutputs["Output_U8_-1_N_ragged_string"]->getPostProcessingHint(), ovms::TensorInfo::ProcessingHint::STRING_1D_U8);  // ragged strings
 }
 
 TEST(TensorMap, TestProcessingHintFromShape_Demultiplexer) {
@@ -197,6 +197,24 @@ TEST_F(OvmsConfigDeathTest, restWorkersDefinedRestPortUndefined) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_workers is set but rest_port is not set");
 }
 
+TEST_F(OvmsConfigDeathTest, restReactorsTooLarge) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_port", "8080", "--rest_workers", "8", "--rest_reactors", "5"};
+    int arg_count = 9;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_reactors count should be from 1 to half of rest_workers");
+}
+
+TEST_F(OvmsConfigDeathTest, restReactorsZero) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_port", "8080", "--rest_reactors", "0"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_reactors count should be from 1 to half of rest_workers");
+}
+
+TEST_F(OvmsConfigDeathTest, restReactorsDefinedRestPortUndefined) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--port", "8080", "--rest_reactors", "2"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "rest_reactors is set but rest_port is not set");
+}
+
 TEST_F(OvmsConfigDeathTest, invalidRestBindAddress) {
     char* n_argv[] = {"ovms", "--config_path", "/path1", "--rest_port", "8081", "--port", "8080", "--rest_bind_address", "192.0.2"};
     int arg_count = 9;
@@ -209,6 +227,12 @@ TEST_F(OvmsConfigDeathTest, invalidGrpcBindAddress) {
     EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "grpc_bind_address has invalid format");
 }
 
+TEST_F(OvmsConfigDeathTest, invalidTrafficCaptureRatio) {
+    char* n_argv[] = {"ovms", "--config_path", "/path1", "--traffic_capture_path", "/tmp/traffic.log", "--traffic_capture_ratio", "1.5"};
+    int arg_count = 7;
+    EXPECT_EXIT(ovms::Config::instance().parse(arg_count, n_argv), ::testing::ExitedWithCode(EX_USAGE), "traffic_capture_ratio should be greater than 0");
+}
+
 TEST_F(OvmsConfigDeathTest, negativeMultiParams) {
     char* n_argv[] = {"ovms", "--config_path", "/path1", "--batch_size", "10"};
     int arg_count = 5;
@@ -320,19 +344,22 @@ TEST(OvmsConfigTest, positiveMulti) {
         "--grpc_bind_address", "1.1.1.1",
         "--rest_port", "45",
         "--rest_workers", "46",
+        "--rest_reactors", "4",
         "--rest_bind_address", "2.2.2.2",
         "--grpc_channel_arguments", "grpc_channel_args",
         "--file_system_poll_wait_seconds", "2",
         "--sequence_cleaner_poll_wait_minutes", "7",
         "--custom_node_resources_cleaner_interval_seconds", "8",
+        "--tensor_memory_pool_size_mb", "0",
         "--cpu_extension", "/ovms",
         "--cache_dir", "/tmp/model_cache",
         "--log_path", "/tmp/log_path",
         "--log_level", "ERROR",
+        "--log_async",
         "--grpc_max_threads", "100",
         "--grpc_memory_quota", "1000000",
         "--config_path", "/config.json"};
-    int arg_count = 35;
+    int arg_count = 40;
     ConstructorEnabledConfig config;
     config.parse(arg_count, n_argv);
 
@@ -341,15 +368,18 @@ TEST(OvmsConfigTest, positiveMulti) {
     EXPECT_EQ(config.grpcBindAddress(), "1.1.1.1");
     EXPECT_EQ(config.restPort(), 45);
     EXPECT_EQ(config.restWorkers(), 46);
+    EXPECT_EQ(config.restReactors(), 4);
     EXPECT_EQ(config.restBindAddress(), "2.2.2.2");
     EXPECT_EQ(config.grpcChannelArguments(), "grpc_channel_args");
     EXPECT_EQ(config.filesystemPollWaitSeconds(), 2);
     EXPECT_EQ(config.sequenceCleanerPollWaitMinutes(), 7);
     EXPECT_EQ(config.resourcesCleanerPollWaitSeconds(), 8);
+    EXPECT_EQ(config.tensorMemoryPoolSizeMb(), 0);
     EXPECT_EQ(config.cpuExtensionLibraryPath(), "/ovms");
     EXPECT_EQ(config.cacheDir(), "/tmp/model_cache");
     EXPECT_EQ(config.logPath(), "/tmp/log_path");
     EXPECT_EQ(config.logLevel(), "ERROR");
+    EXPECT_TRUE(config.logAsync());
     EXPECT_EQ(config.configPath(), "/config.json");
     EXPECT_EQ(config.grpcMaxThreads(), 100);
     EXPECT_EQ(config.grpcMemoryQuota(), (size_t)1000000);
@@ -423,11 +453,13 @@ TEST(OvmsConfigTest, positiveSingle) {
     EXPECT_EQ(config.grpcBindAddress(), "1.1.1.1");
     EXPECT_EQ(config.restPort(), 45);
     EXPECT_EQ(config.restWorkers(), 46);
+    EXPECT_EQ(config.restReactors(), 1);
     EXPECT_EQ(config.restBindAddress(), "2.2.2.2");
     EXPECT_EQ(config.grpcChannelArguments(), "grpc_channel_args");
     EXPECT_EQ(config.filesystemPollWaitSeconds(), 2);
     EXPECT_EQ(config.sequenceCleanerPollWaitMinutes(), 7);
     EXPECT_EQ(config.resourcesCleanerPollWaitSeconds(), 8);
+    EXPECT_EQ(config.tensorMemoryPoolSizeMb(), 256);
     EXPECT_EQ(config.cpuExtensionLibraryPath(), "/ovms");
     EXPECT_EQ(config.cacheDir(), "/tmp/model_cache");
     EXPECT_EQ(config.logPath(), "/tmp/log_path");
@@ -0,0 +1,157 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../precision_conversion.hpp"
+
+using namespace ovms;
+
+template <typename T>
+class PrecisionConversionTest : public ::testing::Test {};
+
+template <typename Src, typename Dst>
+struct ConversionPair {
+    using SrcType = Src;
+    using DstType = Dst;
+};
+
+using ConversionTypes = ::testing::Types<
+    ConversionPair<int32_t, int8_t>,
+    ConversionPair<int32_t, int16_t>,
+    ConversionPair<uint32_t, uint8_t>,
+    ConversionPair<uint32_t, uint16_t>,
+    ConversionPair<int8_t, int32_t>,
+    ConversionPair<int16_t, int32_t>,
+    ConversionPair<uint8_t, uint32_t>,
+    ConversionPair<uint16_t, uint32_t>,
+    ConversionPair<float, float>,
+    ConversionPair<int64_t, int64_t>>;
+
+TYPED_TEST_SUITE(PrecisionConversionTest, ConversionTypes);
+
+TYPED_TEST(PrecisionConversionTest, MatchesScalarConversionForAllTailSizes) {
+    using Src = typename TypeParam::SrcType;
+    using Dst = typename TypeParam::DstType;
+    // sizes cover empty input, SIMD remainder handling and multiple full vector iterations
+    for (size_t count = 0; count < 75; ++count) {
+        std::vector<Src> src(count);
+        for (size_t i = 0; i < count; ++i) {
+            src[i] = static_cast<Src>(i * 37 + (i % 2 ? std::numeric_limits<Src>::max() : std::numeric_limits<Src>::lowest()));
+        }
+        std::vector<Dst> expected(count);
+        for (size_t i = 0; i < count; ++i) {
+            expected[i] = static_cast<Dst>(src[i]);
+        }
+        std::vector<Dst> dst(count + 1, static_cast<Dst>(42));
+        convertContents<Src, Dst>(src.data(), dst.data(), count);
+        EXPECT_EQ(std::vector<Dst>(dst.begin(), dst.begin() + count), expected) << "count: " << count;
+        EXPECT_EQ(dst[count], static_cast<Dst>(42)) << "wrote past the end for count: " << count;
+    }
+}
+
+namespace {
+float fromBits(uint32_t bits) {
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+}  // namespace
+
+TEST(PrecisionConversionHalfTest, Fp32ToFp16RoundsToNearestEven) {
+    std::vector<float> src{0.0f, -0.0f, 1.0f, -2.0f, 65504.0f, 65519.0f, 65520.0f, 1e10f, -1e10f,
+        std::numeric_limits<float>::infinity(), 1.0f + 1.0f / 2048, 1.0f + 3.0f / 2048,
+        fromBits(0x33800000) /*2^-24 smallest subnormal*/, fromBits(0x33000000) /*2^-25 ties to zero*/,
+        fromBits(0x387FC000) /*largest subnormal*/, 0.1f, 3.14159f, -1e-3f};
+    std::vector<uint16_t> expected{0x0000, 0x8000, 0x3C00, 0xC000, 0x7BFF, 0x7BFF, 0x7C00, 0x7C00, 0xFC00,
+        0x7C00, 0x3C00, 0x3C02,
+        0x0001, 0x0000,
+        0x03FF, 0x2E66, 0x4248, 0x9419};
+    // repeat pattern so vector kernels and scalar tail both process every value
+    for (size_t repeat : {1, 5}) {
+        std::vector<float> input;
+        std::vector<uint16_t> expectedRepeated;
+        for (size_t r = 0; r < repeat; ++r) {
+            input.insert(input.end(), src.begin(), src.end());
+            expectedRepeated.insert(expectedRepeated.end(), expected.begin(), expected.end());
+        }
+        std::vector<uint16_t> dst(input.size());
+        convertFp32ToFp16(input.data(), dst.data(), input.size());
+        EXPECT_EQ(dst, expectedRepeated);
+    }
+    float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> nans(19, nan);
+    std::vector<uint16_t> dst(nans.size());
+    convertFp32ToFp16(nans.data(), dst.data(), nans.size());
+    for (auto value : dst) {
+        EXPECT_EQ(value & 0x7C00, 0x7C00);
+        EXPECT_NE(value & 0x3FF, 0);
+    }
+}
+
+TEST(PrecisionConversionHalfTest, Fp16RoundTripIsExactForAllHalfValues) {
+    std::vector<uint16_t> src(1 << 16);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<float> widened(src.size());
+    convertFp16ToFp32(src.data(), widened.data(), src.size());
+    std::vector<uint16_t> narrowed(src.size());
+    convertFp32ToFp16(widened.data(), narrowed.data(), widened.size());
+    for (size_t i = 0; i < src.size(); ++i) {
+        bool isNan = ((i & 0x7C00) == 0x7C00) && (i & 0x3FF);
+        if (isNan) {
+            EXPECT_TRUE(std::isnan(widened[i])) << i;
+            continue;
+        }
+        ASSERT_EQ(narrowed[i], src[i]) << "value: " << widened[i];
+    }
+    EXPECT_EQ(widened[0x3C00], 1.0f);
+    EXPECT_EQ(widened[0x0001], std::ldexp(1.0f, -24));
+    EXPECT_EQ(widened[0xFBFF], -65504.0f);
+}
+
+TEST(PrecisionConversionHalfTest, Bf16ConversionRoundsToNearestEvenAndKeepsNan) {
+    std::vector<float> src{1.0f, fromBits(0x3F808000) /*tie, rounds to even down*/, fromBits(0x3F818000) /*tie, rounds up*/,
+        fromBits(0x3F808001), -2.5f, std::numeric_limits<float>::infinity(), fromBits(0x7F7FFFFF) /*max rounds to inf*/,
+        std::numeric_limits<float>::quiet_NaN(), fromBits(0x7F800001) /*signaling NaN*/};
+    std::vector<uint16_t> expected{0x3F80, 0x3F80, 0x3F82, 0x3F81, 0xC020, 0x7F80, 0x7F80, 0x7FC0, 0x7FC0};
+    for (size_t repeat : {1, 4}) {
+        std::vector<float> input;
+        std::vector<uint16_t> expectedRepeated;
+        for (size_t r = 0; r < repeat; ++r) {
+            input.insert(input.end(), src.begin(), src.end());
+            expectedRepeated.insert(expectedRepeated.end(), expected.begin(), expected.end());
+        }
+        std::vector<uint16_t> dst(input.size() + 1, 42);
+        convertFp32ToBf16(input.data(), dst.data(), input.size());
+        EXPECT_EQ(std::vector<uint16_t>(dst.begin(), dst.end() - 1), expectedRepeated);
+        EXPECT_EQ(dst.back(), 42);
+        std::vector<float> widened(dst.size() - 1);
+        convertBf16ToFp32(dst.data(), widened.data(), widened.size());
+        for (size_t i = 0; i < widened.size(); ++i) {
+            uint32_t bits;
+            std::memcpy(&bits, &widened[i], sizeof(bits));
+            EXPECT_EQ(bits, static_cast<uint32_t>(dst[i]) << 16);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+//*****************************************************************************
+// Copyright 2024 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../rcu_snapshot.hpp"
+
+using namespace ovms;
+
+namespace {
+struct TrackedValue {
+    int value;
+    std::atomic<int>* destroyedCounter;
+    TrackedValue() :
+        value(0),
+        destroyedCounter(nullptr) {}
+    TrackedValue(int value, std::atomic<int>* destroyedCounter) :
+        value(value),
+        destroyedCounter(destroyedCounter) {}
+    ~TrackedValue() {
+        if (destroyedCounter) {
+            destroyedCounter->fetch_add(1);
+        }
+    }
+};
+}  // namespace
+
+TEST(RcuSnapshot, DefaultSnapshotIsEmpty) {
+    RcuSnapshot<std::map<std::string, int>> snapshot;
+    RcuReadGuard guard;
+    EXPECT_TRUE(snapshot.read().empty());
+}
+
+TEST(RcuSnapshot, ReadReturnsLastPublished) {
+    RcuSnapshot<std::map<std::string, int>> snapshot;
+    snapshot.publish(std::make_unique<std::map<std::string, int>>(std::map<std::string, int>{{"a", 1}}));
+    snapshot.publish(std::make_unique<std::map<std::string, int>>(std::map<std::string, int>{{"a", 1}, {"b", 2}}));
+    RcuReadGuard guard;
+    const auto& current = snapshot.read();
+    ASSERT_EQ(current.size(), 2);
+    EXPECT_EQ(current.at("b"), 2);
+}
+
+TEST(RcuSnapshot, NestedGuardsKeepReaderActiveUntilOutermostEnds) {
+    auto& domain = RcuDomain::instance();
+    {
+        RcuReadGuard outer;
+        const uint64_t announced = domain.getOldestReaderEpoch();
+        EXPECT_NE(announced, UINT64_MAX);
+        {
+            RcuReadGuard inner;
+            EXPECT_EQ(domain.getOldestReaderEpoch(), announced);
+        }
+        EXPECT_EQ(domain.getOldestReaderEpoch(), announced);
+    }
+    EXPECT_EQ(domain.getOldestReaderEpoch(), UINT64_MAX);
+}
+
+TEST(RcuSnapshot, ReplacedSnapshotIsReleasedAfterReaderLeaves) {
+    std::atomic<int> destroyed{0};
+    RcuSnapshot<TrackedValue> snapshot;
+    snapshot.publish(std::make_unique<TrackedValue>(1, &destroyed));
+
+    std::promise<void> readerEntered, writerDone, readerLeft;
+    std::thread reader([&]() {
+        RcuReadGuard guard;
+        const auto& seen = snapshot.read();
+        readerEntered.set_value();
+        writerDone.get_future().wait();
+        // object read before publish has to survive until guard is released
+        EXPECT_EQ(seen.value, 1);
+        EXPECT_EQ(destroyed.load(), 0);
+    });
+    readerEntered.get_future().wait();
+    snapshot.publish(std::make_unique<TrackedValue>(2, &destroyed));
+    EXPECT_EQ(destroyed.load(), 0);
+    writerDone.set_value();
+    reader.join();
+
+    // next publish reclaims snapshots no reader can reference anymore
+    snapshot.publish(std::make_unique<TrackedValue>(3, &destroyed));
+    EXPECT_EQ(destroyed.load(), 2);
+    RcuReadGuard guard;
+    EXPECT_EQ(snapshot.read().value, 3);
+}
+
+TEST(RcuSnapshot, ConcurrentReadersAlwaysSeeConsistentSnapshot) {
+    RcuSnapshot<std::vector<int>> snapshot;
+    snapshot.publish(std::make_unique<std::vector<int>>(16, 0));
+    std::atomic<bool> stop{false};
+    std::atomic<int> inconsistentReads{0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                RcuReadGuard guard;
+                const auto& current = snapshot.read();
+                for (auto value : current) {
+                    if (value != current.front()) {
+                        inconsistentReads.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (int generation = 1; generation < 2000; ++generation) {
+        snapshot.publish(std::make_unique<std::vector<int>>(16, generation));
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(inconsistentReads.load(), 0);
+    RcuReadGuard guard;
+    EXPECT_EQ(snapshot.read().front(), 1999);
+}
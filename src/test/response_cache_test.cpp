@@ -0,0 +1,231 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "tensorflow_serving/apis/prediction_service.grpc.pb.h"
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../response_cache.hpp"
+
+using namespace ovms;
+
+TEST(ResponseCacheHash, XxHash64KnownValues) {
+    EXPECT_EQ(xxHash64("", 0), 0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(xxHash64("a", 1), 0xD24EC4F1A98C6E5BULL);
+    EXPECT_EQ(xxHash64("abc", 3), 0x44BC2CF5AD770999ULL);
+    const std::string longInput = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(xxHash64(longInput.data(), longInput.size()), 0xFBCEA83C8A378BF1ULL);
+}
+
+class ResponseCacheKfsKeyTest : public ::testing::Test {
+protected:
+    KFSRequest request;
+    void SetUp() override {
+        auto* input = request.add_inputs();
+        input->set_name("b");
+        input->set_datatype("FP32");
+        input->add_shape(1);
+        input->add_shape(4);
+        std::vector<float> data{1.0, 2.0, 3.0, 4.0};
+        request.add_raw_input_contents()->assign(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    }
+};
+
+TEST_F(ResponseCacheKfsKeyTest, SameRequestSameKey) {
+    KFSRequest copy = request;
+    copy.set_id("different id does not matter");
+    EXPECT_EQ(computeResponseCacheKey(request), computeResponseCacheKey(copy));
+}
+
+TEST_F(ResponseCacheKfsKeyTest, DifferentContentDifferentKey) {
+    KFSRequest copy = request;
+    (*copy.mutable_raw_input_contents(0))[0] ^= 1;
+    EXPECT_NE(computeResponseCacheKey(request), computeResponseCacheKey(copy));
+}
+
+TEST_F(ResponseCacheKfsKeyTest, DifferentShapeDifferentKey) {
+    KFSRequest copy = request;
+    copy.mutable_inputs(0)->set_shape(0, 4);
+    copy.mutable_inputs(0)->set_shape(1, 1);
+    EXPECT_NE(computeResponseCacheKey(request), computeResponseCacheKey(copy));
+}
+
+TEST_F(ResponseCacheKfsKeyTest, KeyHoldsRequestContent) {
+    const auto key = computeResponseCacheKey(request);
+    EXPECT_NE(key.bytes.find(request.raw_input_contents(0)), std::string::npos);
+    KFSRequest copy = request;
+    (*copy.mutable_raw_input_contents(0))[0] ^= 1;
+    EXPECT_NE(computeResponseCacheKey(copy).bytes, key.bytes);
+}
+
+TEST_F(ResponseCacheKfsKeyTest, RequestedOutputsArePartOfKey) {
+    KFSRequest copy = request;
+    copy.add_outputs()->set_name("a");
+    EXPECT_NE(computeResponseCacheKey(request), computeResponseCacheKey(copy));
+}
+
+TEST_F(ResponseCacheKfsKeyTest, ParametersArePartOfKey) {
+    KFSRequest requestParameter = request;
+    (*requestParameter.mutable_parameters())["sequence_id"].set_int64_param(1);
+    EXPECT_NE(computeResponseCacheKey(request), computeResponseCacheKey(requestParameter));
+    KFSRequest otherValue = request;
+    (*otherValue.mutable_parameters())["sequence_id"].set_int64_param(2);
+    EXPECT_NE(computeResponseCacheKey(requestParameter), computeResponseCacheKey(otherValue));
+    KFSRequest inputParameter = request;
+    (*inputParameter.mutable_inputs(0)->mutable_parameters())["binary_data_size"].set_int64_param(16);
+    EXPECT_NE(computeResponseCacheKey(request), computeResponseCacheKey(inputParameter));
+    KFSRequest outputParameter = request;
+    outputParameter.add_outputs()->set_name("a");
+    KFSRequest binaryOutput = outputParameter;
+    (*binaryOutput.mutable_outputs(0)->mutable_parameters())["binary_data"].set_bool_param(true);
+    EXPECT_NE(computeResponseCacheKey(outputParameter), computeResponseCacheKey(binaryOutput));
+}
+
+TEST(ResponseCacheTfsKey, InputOrderDoesNotMatter) {
+    tensorflow::serving::PredictRequest first, second;
+    for (auto* request : {&first, &second}) {
+        for (const std::string name : {"a", "b"}) {
+            auto& proto = (*request->mutable_inputs())[name];
+            proto.set_dtype(tensorflow::DataType::DT_FLOAT);
+            proto.mutable_tensor_shape()->add_dim()->set_size(1);
+            float value = name == "a" ? 1.0f : 2.0f;
+            proto.mutable_tensor_content()->assign(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+    }
+    EXPECT_EQ(computeResponseCacheKey(first), computeResponseCacheKey(second));
+    float value = 3.0f;
+    (*second.mutable_inputs())["b"].mutable_tensor_content()->assign(reinterpret_cast<const char*>(&value), sizeof(value));
+    EXPECT_NE(computeResponseCacheKey(first), computeResponseCacheKey(second));
+}
+
+TEST(ResponseCacheTensorKey, RequestedOutputsArePartOfKey) {
+    std::vector<float> data{1.0, 2.0};
+    TensorMap inputs{{"in", ov::Tensor(ov::element::f32, ov::Shape{1, 2}, data.data())}};
+    EXPECT_EQ(computeResponseCacheKey(inputs, {"out"}), computeResponseCacheKey(inputs, {"out"}));
+    EXPECT_NE(computeResponseCacheKey(inputs, {"out"}), computeResponseCacheKey(inputs, {"out", "out2"}));
+    data[1] = 3.0;
+    TensorMap changedInputs{{"in", ov::Tensor(ov::element::f32, ov::Shape{1, 2}, data.data())}};
+    EXPECT_NE(computeResponseCacheKey(inputs, {"out"}), computeResponseCacheKey(changedInputs, {"out"}));
+}
+
+static ResponseCacheKey key(uint64_t hash) {
+    return ResponseCacheKey{hash, std::to_string(hash)};
+}
+
+static std::shared_ptr<KFSResponse> createResponse(size_t contentSize) {
+    auto response = std::make_shared<KFSResponse>();
+    response->set_model_name("dummy");
+    response->add_raw_output_contents()->assign(contentSize, 'x');
+    return response;
+}
+
+TEST(ResponseCache, FindReturnsInsertedResponse) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    KFSResponse response;
+    EXPECT_FALSE(cache.find(key(1), &response));
+    cache.insert(key(1), createResponse(100));
+    ASSERT_TRUE(cache.find(key(1), &response));
+    EXPECT_EQ(response.model_name(), "dummy");
+    EXPECT_EQ(response.raw_output_contents(0).size(), 100);
+    EXPECT_EQ(cache.getEntriesCount(), 1);
+}
+
+TEST(ResponseCache, FindWithDifferentResponseTypeMisses) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    cache.insert(key(1), createResponse(100));
+    tensorflow::serving::PredictResponse response;
+    EXPECT_FALSE(cache.find(key(1), &response));
+}
+
+TEST(ResponseCache, LeastRecentlyUsedEntriesAreEvicted) {
+    // room for two entries of 1000 bytes including bookkeeping overhead
+    ResponseCache cache(2600, std::chrono::milliseconds(0));
+    cache.insert(key(1), createResponse(1000));
+    cache.insert(key(2), createResponse(1000));
+    ASSERT_NE(cache.find(key(1)), nullptr);
+    cache.insert(key(3), createResponse(1000));
+    EXPECT_EQ(cache.getEntriesCount(), 2);
+    EXPECT_NE(cache.find(key(1)), nullptr);
+    EXPECT_EQ(cache.find(key(2)), nullptr);
+    EXPECT_NE(cache.find(key(3)), nullptr);
+    EXPECT_LE(cache.getSizeInBytes(), 2600);
+}
+
+TEST(ResponseCache, HashCollisionMisses) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    cache.insert(ResponseCacheKey{1, "first"}, createResponse(100));
+    KFSResponse response;
+    EXPECT_FALSE(cache.find(ResponseCacheKey{1, "second"}, &response));
+    EXPECT_TRUE(cache.find(ResponseCacheKey{1, "first"}, &response));
+    // colliding entry replaces previous one
+    cache.insert(ResponseCacheKey{1, "second"}, createResponse(200));
+    EXPECT_EQ(cache.getEntriesCount(), 1);
+    EXPECT_EQ(cache.find(ResponseCacheKey{1, "first"}), nullptr);
+    ASSERT_TRUE(cache.find(ResponseCacheKey{1, "second"}, &response));
+    EXPECT_EQ(response.raw_output_contents(0).size(), 200);
+}
+
+TEST(ResponseCache, EntryLargerThanCapacityIsNotCached) {
+    ResponseCache cache(1000, std::chrono::milliseconds(0));
+    cache.insert(key(1), createResponse(2000));
+    EXPECT_EQ(cache.getEntriesCount(), 0);
+    EXPECT_EQ(cache.getSizeInBytes(), 0);
+}
+
+TEST(ResponseCache, ReinsertReplacesEntry) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    cache.insert(key(1), createResponse(100));
+    cache.insert(key(1), createResponse(200));
+    EXPECT_EQ(cache.getEntriesCount(), 1);
+    KFSResponse response;
+    ASSERT_TRUE(cache.find(key(1), &response));
+    EXPECT_EQ(response.raw_output_contents(0).size(), 200);
+}
+
+TEST(ResponseCache, ExpiredEntriesAreNotReturned) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(50));
+    cache.insert(key(1), createResponse(100));
+    EXPECT_NE(cache.find(key(1)), nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(cache.find(key(1)), nullptr);
+    EXPECT_EQ(cache.getEntriesCount(), 0);
+}
+
+TEST(ResponseCache, CachesTensors) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    ov::Tensor tensor(ov::element::f32, ov::Shape{1, 10});
+    std::memset(tensor.data(), 0, tensor.get_byte_size());
+    cache.insert(key(1), TensorMap{{"out", tensor}});
+    auto cached = cache.find(key(1));
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(cached->tensors.count("out"), 1);
+    EXPECT_EQ(cached->tensors.at("out").get_shape(), ov::Shape({1, 10}));
+}
+
+TEST(ResponseCache, Clear) {
+    ResponseCache cache(1024 * 1024, std::chrono::milliseconds(0));
+    cache.insert(key(1), createResponse(100));
+    cache.clear();
+    EXPECT_EQ(cache.find(key(1)), nullptr);
+    EXPECT_EQ(cache.getSizeInBytes(), 0);
+}
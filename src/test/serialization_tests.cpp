@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <array>
+#include <cstring>
 #include <filesystem>
 #include <memory>
 #include <string>
@@ -345,6 +346,29 @@ TEST_F(KFServingGRPCPredict, ValidSerializationRaw) {
     EXPECT_EQ(response.raw_output_contents()[0].size(), 12);
 }
 
+TEST_F(KFServingGRPCPredict, ValidSerializationRawWithWirePrecision) {
+    std::vector<float> data{1.0f, -2.0f, 0.5f};
+    ov::Tensor tensor(ov::element::f32, shape_t{1, 3, 1, 1}, data.data());
+    for (auto [wirePrecision, expectedDatatype, expectedContent] : std::vector<std::tuple<ovms::Precision, std::string, std::vector<uint16_t>>>{
+             {ovms::Precision::FP16, "FP16", {0x3C00, 0xC000, 0x3800}},
+             {ovms::Precision::BF16, "BF16", {0x3F80, 0xC000, 0x3F00}}}) {
+        KFSResponse response;
+        ProtoGetter<::KFSResponse*, ::KFSResponse::InferOutputTensor&> protoGetter(&response);
+        auto& responseOutput = protoGetter.createOutput(tensorName);
+        auto* content = protoGetter.createContent(tensorName);
+        auto status = serializeTensorToTensorProtoRaw(responseOutput,
+            content,
+            tensorMap[tensorName]->createCopyWithWirePrecision(wirePrecision),
+            tensor);
+        ASSERT_EQ(status.getCode(), ovms::StatusCode::OK);
+        EXPECT_EQ(responseOutput.datatype(), expectedDatatype);
+        ASSERT_EQ(response.raw_output_contents()[0].size(), 6);
+        std::vector<uint16_t> actualContent(3);
+        std::memcpy(actualContent.data(), response.raw_output_contents()[0].data(), 6);
+        EXPECT_EQ(actualContent, expectedContent);
+    }
+}
+
 TEST_F(KFServingGRPCPredict, ValidSerialization) {
     ov::Tensor tensor(ov::element::f32, shape_t{1, 3, 1, 1});
     KFSResponse response;
@@ -789,6 +813,32 @@ TYPED_TEST(SerializeString, Valid_2D_U8_String) {
     assertStringResponse(this->response, {"String_123", "zebra", ""}, "out_string");
 }
 
+// Ragged layout: batch size, first string start offset, end offsets, strings without padding
+TYPED_TEST(SerializeString, Valid_1D_U8_String) {
+    std::vector<uint32_t> metadata = {3, 0, 10, 15, 15};
+    std::string strings = "String_123zebra";
+    std::vector<uint8_t> data(metadata.size() * sizeof(uint32_t) + strings.size());
+    std::memcpy(data.data(), metadata.data(), metadata.size() * sizeof(uint32_t));
+    std::memcpy(data.data() + metadata.size() * sizeof(uint32_t), strings.data(), strings.size());
+    ov::Tensor tensor(ov::element::u8, ov::Shape{data.size()}, data.data());
+    MockedTensorProvider provider(tensor);
+    OutputGetter<MockedTensorProvider&> outputGetter(provider);
+
+    ovms::tensor_map_t infos;
+    infos["out_ragged_string"] = std::make_shared<ovms::TensorInfo>("out", "out_ragged_string", ovms::Precision::U8, ovms::Shape{-1}, Layout{"N..."});
+
+    bool useSharedOutputContent = true;
+    ASSERT_EQ(serializePredictResponse(outputGetter,
+                  UNUSED_NAME,
+                  UNUSED_VERSION,
+                  infos,
+                  &this->response,
+                  getTensorInfoName,
+                  useSharedOutputContent),
+        ovms::StatusCode::OK);
+    assertStringResponse(this->response, {"String_123", "zebra", ""}, "out_ragged_string");
+}
+
 // Serialization to U8 due to missing suffix _string in mapping
 TYPED_TEST(SerializeString, Valid_2D_U8_NonString) {
     std::vector<uint8_t> data = {
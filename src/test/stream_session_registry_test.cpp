@@ -0,0 +1,134 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "../status.hpp"
+#include "../stream_session_registry.hpp"
+
+using namespace ovms;
+
+namespace {
+class MockStreamSession : public StreamSession {
+public:
+    MOCK_METHOD(void, close, (), (override));
+};
+}  // namespace
+
+class StreamSessionRegistryTest : public ::testing::Test {
+protected:
+    const std::chrono::milliseconds gracePeriod{1000};
+    StreamSessionRegistry::clock::time_point now = StreamSessionRegistry::clock::now();
+
+    // emulates new stream with given id
+    void openSession(StreamSessionRegistry& registry, const std::string& id, std::shared_ptr<StreamSession> session) {
+        std::shared_ptr<StreamSession> resumed;
+        ASSERT_EQ(registry.resume(id, resumed), StatusCode::OK);
+        ASSERT_EQ(resumed, nullptr);
+        ASSERT_EQ(registry.admit(), StatusCode::OK);
+        registry.attach(id, std::move(session));
+    }
+};
+
+TEST_F(StreamSessionRegistryTest, ResumeParkedSession) {
+    StreamSessionRegistry registry(0, gracePeriod);
+    auto session = std::make_shared<MockStreamSession>();
+    EXPECT_CALL(*session, close()).Times(0);
+    openSession(registry, "a", session);
+    registry.detach("a", now);
+    EXPECT_EQ(registry.getParkedSessionsCount(), 1);
+
+    std::shared_ptr<StreamSession> resumed;
+    ASSERT_EQ(registry.resume("a", resumed), StatusCode::OK);
+    EXPECT_EQ(resumed, session);
+    EXPECT_EQ(registry.getParkedSessionsCount(), 0);
+    EXPECT_EQ(registry.getLiveSessionsCount(), 1);
+    registry.remove("a");
+    registry.release();
+}
+
+TEST_F(StreamSessionRegistryTest, RejectSecondStreamWithTheSameId) {
+    StreamSessionRegistry registry(0, gracePeriod);
+    auto session = std::make_shared<MockStreamSession>();
+    openSession(registry, "a", session);
+    std::shared_ptr<StreamSession> resumed;
+    EXPECT_EQ(registry.resume("a", resumed), StatusCode::MEDIAPIPE_STREAM_ALREADY_ATTACHED);
+    registry.remove("a");
+    registry.release();
+}
+
+TEST_F(StreamSessionRegistryTest, CloseExpiredSessions) {
+    StreamSessionRegistry registry(0, gracePeriod);
+    auto expiring = std::make_shared<MockStreamSession>();
+    auto fresh = std::make_shared<MockStreamSession>();
+    EXPECT_CALL(*expiring, close()).Times(1);
+    EXPECT_CALL(*fresh, close()).Times(0);
+    openSession(registry, "a", expiring);
+    openSession(registry, "b", fresh);
+    registry.detach("a", now);
+    registry.detach("b", now + gracePeriod / 2);
+
+    EXPECT_EQ(registry.closeExpired(now + gracePeriod), 1);
+    EXPECT_EQ(registry.getLiveSessionsCount(), 1);
+    EXPECT_EQ(registry.getParkedSessionsCount(), 1);
+    testing::Mock::VerifyAndClearExpectations(fresh.get());
+    EXPECT_CALL(*fresh, close()).Times(1);
+}
+
+TEST_F(StreamSessionRegistryTest, RejectWhenAllSessionsAttached) {
+    StreamSessionRegistry registry(1, gracePeriod);
+    openSession(registry, "a", std::make_shared<MockStreamSession>());
+    EXPECT_EQ(registry.admit(), StatusCode::MEDIAPIPE_MAX_STREAMS_REACHED);
+    registry.remove("a");
+    registry.release();
+    EXPECT_EQ(registry.admit(), StatusCode::OK);
+    registry.release();
+}
+
+TEST_F(StreamSessionRegistryTest, EvictOldestParkedSessionWhenLimitReached) {
+    StreamSessionRegistry registry(2, gracePeriod);
+    auto oldest = std::make_shared<MockStreamSession>();
+    auto newer = std::make_shared<MockStreamSession>();
+    EXPECT_CALL(*oldest, close()).Times(1);
+    EXPECT_CALL(*newer, close()).Times(0);
+    openSession(registry, "a", oldest);
+    openSession(registry, "b", newer);
+    registry.detach("a", now);
+    registry.detach("b", now + gracePeriod / 2);
+
+    ASSERT_EQ(registry.admit(), StatusCode::OK);
+    EXPECT_EQ(registry.getLiveSessionsCount(), 2);
+    EXPECT_EQ(registry.getParkedSessionsCount(), 1);
+    std::shared_ptr<StreamSession> resumed;
+    ASSERT_EQ(registry.resume("a", resumed), StatusCode::OK);
+    EXPECT_EQ(resumed, nullptr);
+    registry.remove("a");
+    registry.release();
+    testing::Mock::VerifyAndClearExpectations(newer.get());
+    EXPECT_CALL(*newer, close()).Times(1);
+}
+
+TEST_F(StreamSessionRegistryTest, NoLimitByDefault) {
+    StreamSessionRegistry registry(0, std::chrono::milliseconds(0));
+    EXPECT_FALSE(registry.isResumeEnabled());
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(registry.admit(), StatusCode::OK);
+    }
+    EXPECT_EQ(registry.getLiveSessionsCount(), 100);
+}
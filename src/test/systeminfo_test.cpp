@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <filesystem>
+#include <fstream>
+#include <string>
 #include <thread>
 
 #include <gmock/gmock.h>
@@ -22,9 +25,16 @@
 
 #include "../status.hpp"
 #include "../systeminfo.hpp"
+#include "test_utils.hpp"
 
 using namespace testing;
+using ovms::countKernelList;
+using ovms::CpuTopology;
+using ovms::detectCpuTopology;
 using ovms::getCoreCount;
+using ovms::getCpuTopology;
+using ovms::parseCgroupV1CpuQuota;
+using ovms::parseCgroupV2CpuMax;
 using ovms::StatusCode;
 
 TEST(SystemInfo, getCoreCount) {
@@ -32,3 +42,96 @@ TEST(SystemInfo, getCoreCount) {
     EXPECT_GE(cpuCount, 1);
     EXPECT_LE(cpuCount, std::thread::hardware_concurrency());
 }
+
+TEST(SystemInfo, getCoreCountMatchesTopology) {
+    const CpuTopology& topology = getCpuTopology();
+    EXPECT_EQ(getCoreCount(), topology.availableCores);
+    EXPECT_LE(topology.availableCores, topology.affinityCores);
+    EXPECT_LE(topology.affinityCores, topology.hostCores);
+    EXPECT_GE(topology.numaNodes, 1);
+}
+
+TEST(SystemInfo, parseCgroupV2CpuMax) {
+    EXPECT_FALSE(parseCgroupV2CpuMax("max 100000").has_value());
+    EXPECT_FALSE(parseCgroupV2CpuMax("").has_value());
+    EXPECT_FALSE(parseCgroupV2CpuMax("abc 100000").has_value());
+    EXPECT_FALSE(parseCgroupV2CpuMax("100000 0").has_value());
+    EXPECT_DOUBLE_EQ(parseCgroupV2CpuMax("400000 100000").value(), 4.0);
+    EXPECT_DOUBLE_EQ(parseCgroupV2CpuMax("250000 100000").value(), 2.5);
+    EXPECT_DOUBLE_EQ(parseCgroupV2CpuMax("50000").value(), 0.5);
+}
+
+TEST(SystemInfo, parseCgroupV1CpuQuota) {
+    EXPECT_FALSE(parseCgroupV1CpuQuota("-1", "100000").has_value());
+    EXPECT_FALSE(parseCgroupV1CpuQuota("abc", "100000").has_value());
+    EXPECT_FALSE(parseCgroupV1CpuQuota("100000", "0").has_value());
+    EXPECT_DOUBLE_EQ(parseCgroupV1CpuQuota("200000", "100000").value(), 2.0);
+    EXPECT_DOUBLE_EQ(parseCgroupV1CpuQuota("150000", "100000").value(), 1.5);
+}
+
+TEST(SystemInfo, countKernelList) {
+    EXPECT_EQ(countKernelList("0").value(), 1);
+    EXPECT_EQ(countKernelList("0-1").value(), 2);
+    EXPECT_EQ(countKernelList("0-3,8,10-11").value(), 7);
+    EXPECT_FALSE(countKernelList("").has_value());
+    EXPECT_FALSE(countKernelList("3-1").has_value());
+    EXPECT_FALSE(countKernelList("a-b").has_value());
+    EXPECT_FALSE(countKernelList("0-1-2").has_value());
+}
+
+class CpuTopologyDetection : public TestWithTempDir {
+protected:
+    void writeFile(const std::string& relativePath, const std::string& content) {
+        std::filesystem::path path = std::filesystem::path(directoryPath) / relativePath;
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream file(path);
+        file << content;
+    }
+};
+
+TEST_F(CpuTopologyDetection, CgroupV2LowestQuotaInHierarchyApplies) {
+    writeFile("cgroup/cgroup.controllers", "cpuset cpu memory\n");
+    writeFile("cgroup/kubepods/cpu.max", "100000 100000\n");
+    writeFile("cgroup/kubepods/pod1/cpu.max", "max 100000\n");
+    writeFile("self_cgroup", "0::/kubepods/pod1\n");
+    writeFile("numa_online", "0-1\n");
+    auto topology = detectCpuTopology(directoryPath + "/cgroup", directoryPath + "/self_cgroup", directoryPath + "/numa_online");
+    ASSERT_TRUE(topology.cgroupQuota.has_value());
+    EXPECT_DOUBLE_EQ(topology.cgroupQuota.value(), 1.0);
+    EXPECT_EQ(topology.availableCores, 1);
+    EXPECT_EQ(topology.numaNodes, 2);
+}
+
+TEST_F(CpuTopologyDetection, CgroupV2WithNamespaceReadsRoot) {
+    writeFile("cgroup/cgroup.controllers", "cpu\n");
+    writeFile("cgroup/cpu.max", "50000 100000\n");
+    writeFile("self_cgroup", "0::/\n");
+    auto topology = detectCpuTopology(directoryPath + "/cgroup", directoryPath + "/self_cgroup", directoryPath + "/missing");
+    ASSERT_TRUE(topology.cgroupQuota.has_value());
+    EXPECT_DOUBLE_EQ(topology.cgroupQuota.value(), 0.5);
+    // fractional quota is rounded up
+    EXPECT_EQ(topology.availableCores, 1);
+    EXPECT_EQ(topology.numaNodes, 1);
+}
+
+TEST_F(CpuTopologyDetection, CgroupV1Quota) {
+    writeFile("cgroup/cpu,cpuacct/docker/cpu.cfs_quota_us", "-1\n");
+    writeFile("cgroup/cpu,cpuacct/docker/cpu.cfs_period_us", "100000\n");
+    writeFile("cgroup/cpu,cpuacct/cpu.cfs_quota_us", "100000\n");
+    writeFile("cgroup/cpu,cpuacct/cpu.cfs_period_us", "100000\n");
+    writeFile("self_cgroup", "12:memory:/docker\n4:cpu,cpuacct:/docker\n");
+    auto topology = detectCpuTopology(directoryPath + "/cgroup", directoryPath + "/self_cgroup", directoryPath + "/missing");
+    ASSERT_TRUE(topology.cgroupQuota.has_value());
+    EXPECT_DOUBLE_EQ(topology.cgroupQuota.value(), 1.0);
+    EXPECT_EQ(topology.availableCores, 1);
+}
+
+TEST_F(CpuTopologyDetection, NoCgroupLimitUsesAffinity) {
+    writeFile("cgroup/cgroup.controllers", "cpu\n");
+    writeFile("cgroup/cpu.max", "max 100000\n");
+    writeFile("self_cgroup", "0::/\n");
+    auto topology = detectCpuTopology(directoryPath + "/cgroup", directoryPath + "/self_cgroup", directoryPath + "/missing");
+    EXPECT_FALSE(topology.cgroupQuota.has_value());
+    EXPECT_FALSE(topology.isQuotaLimited());
+    EXPECT_EQ(topology.availableCores, topology.affinityCores);
+}
@@ -14,6 +14,7 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
 #include <fstream>
 
 #include <gmock/gmock.h>
@@ -853,4 +854,30 @@ TYPED_TEST(StringOutputsConversionTest, positive) {
     assertStringOutputProto(this->responseTensor, {"String_123", "", "zebra"});
 }
 
+TYPED_TEST(StringOutputsConversionTest, ragged_1d) {
+    std::vector<uint32_t> metadata = {3, 0, 10, 10, 15};
+    std::string strings = "String_123zebra";
+    std::vector<std::uint8_t> _1dTensorData(metadata.size() * sizeof(uint32_t) + strings.size());
+    std::memcpy(_1dTensorData.data(), metadata.data(), metadata.size() * sizeof(uint32_t));
+    std::memcpy(_1dTensorData.data() + metadata.size() * sizeof(uint32_t), strings.data(), strings.size());
+    ov::Tensor tensor(ov::element::u8, ov::Shape{_1dTensorData.size()}, _1dTensorData.data());
+    ASSERT_EQ(convertOVTensor1DToStringResponse(tensor, this->responseTensor), ovms::StatusCode::OK);
+    assertStringOutputProto(this->responseTensor, {"String_123", "", "zebra"});
+}
+
+TYPED_TEST(StringOutputsConversionTest, ragged_1d_offsets_out_of_range) {
+    std::vector<uint32_t> metadata = {2, 0, 10, 20};
+    std::string strings = "String_123zebra";
+    std::vector<std::uint8_t> _1dTensorData(metadata.size() * sizeof(uint32_t) + strings.size());
+    std::memcpy(_1dTensorData.data(), metadata.data(), metadata.size() * sizeof(uint32_t));
+    std::memcpy(_1dTensorData.data() + metadata.size() * sizeof(uint32_t), strings.data(), strings.size());
+    ov::Tensor tensor(ov::element::u8, ov::Shape{_1dTensorData.size()}, _1dTensorData.data());
+    EXPECT_EQ(convertOVTensor1DToStringResponse(tensor, this->responseTensor), ovms::StatusCode::INTERNAL_ERROR);
+
+    // batch size larger than tensor can hold offsets for
+    metadata = {1000, 0};
+    ov::Tensor smallTensor(ov::element::u8, ov::Shape{metadata.size() * sizeof(uint32_t)}, metadata.data());
+    EXPECT_EQ(convertOVTensor1DToStringResponse(smallTensor, this->responseTensor), ovms::StatusCode::INTERNAL_ERROR);
+}
+
 }  // namespace
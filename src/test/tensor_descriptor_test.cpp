@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "../modelconfig.hpp"
+#include "../tensor_descriptor.hpp"
+#include "../tensorinfo.hpp"
+
+using namespace ovms;
+
+TEST(SmallShape, MatchIsConsistentWithDimension) {
+    Shape shape{1, Dimension::any(), {10, 20}, 0};
+    SmallShape smallShape(shape);
+    ASSERT_EQ(smallShape.size(), shape.size());
+    for (dimension_value_t value : {-42, -1, 0, 1, 2, 10, 15, 20, 21}) {
+        for (size_t i = 0; i < shape.size(); ++i) {
+            EXPECT_EQ(smallShape.match(i, value), shape[i].match(value)) << "dimension: " << i << " value: " << value;
+        }
+    }
+}
+
+TEST(SmallShape, HighRankShape) {
+    Shape shape;
+    for (dimension_value_t i = 1; i <= 10; ++i) {
+        shape.add(Dimension(i));
+    }
+    SmallShape smallShape(shape);
+    ASSERT_EQ(smallShape.size(), 10);
+    for (size_t i = 0; i < 10; ++i) {
+        EXPECT_EQ(smallShape.getMinValue(i), static_cast<dimension_value_t>(i + 1));
+        EXPECT_TRUE(smallShape.match(i, i + 1));
+        EXPECT_FALSE(smallShape.match(i, i + 2));
+    }
+    SmallShape copy = smallShape;
+    EXPECT_EQ(copy.getMaxValue(9), 10);
+}
+
+TEST(TensorDescriptorTable, DescribesTensors) {
+    tensor_map_t tensors;
+    tensors["b"] = std::make_shared<const TensorInfo>("b", Precision::FP32, Shape{1, 3, 224, 224}, Layout{"NCHW"});
+    tensors["a"] = std::make_shared<const TensorInfo>("a", Precision::I64, Shape{Dimension::any(), 10}, Layout{"NC"});
+    shapes_info_map_t shapeInfo;
+    shapeInfo["a"] = ShapeInfo{AUTO, Shape{}};
+
+    TensorDescriptorTable table(tensors, shapeInfo);
+    EXPECT_TRUE(table.describes(tensors));
+    EXPECT_FALSE(table.describes(tensor_map_t()));
+    ASSERT_EQ(table.size(), 2);
+    EXPECT_EQ(table.find("c"), nullptr);
+
+    const TensorDescriptor* a = table.find("a");
+    ASSERT_NE(a, nullptr);
+    EXPECT_EQ(a, &(*table.begin()));
+    EXPECT_EQ(a->info, tensors["a"].get());
+    EXPECT_EQ(a->shapeMode, AUTO);
+    EXPECT_FALSE(a->isStatic);
+    EXPECT_EQ(a->elementSize, 8);
+    ASSERT_TRUE(a->batchIndex.has_value());
+    EXPECT_EQ(a->batchIndex.value(), 0);
+
+    const TensorDescriptor* b = table.find("b");
+    ASSERT_NE(b, nullptr);
+    EXPECT_EQ(b->shapeMode, FIXED);
+    EXPECT_TRUE(b->isStatic);
+    EXPECT_EQ(b->staticElementCount, 3 * 224 * 224);
+    EXPECT_EQ(b->staticByteSize, 3 * 224 * 224 * 4);
+    EXPECT_EQ(b->shape.size(), 4);
+}
+
+TEST(TensorDescriptorTable, AnonymousShapeMode) {
+    tensor_map_t tensors;
+    tensors["a"] = std::make_shared<const TensorInfo>("a", Precision::FP32, Shape{1, 10});
+    shapes_info_map_t shapeInfo;
+    shapeInfo[ANONYMOUS_INPUT_NAME] = ShapeInfo{AUTO, Shape{}};
+    TensorDescriptorTable table(tensors, shapeInfo);
+    ASSERT_NE(table.find("a"), nullptr);
+    EXPECT_EQ(table.find("a")->shapeMode, AUTO);
+}
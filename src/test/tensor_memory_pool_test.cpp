@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <openvino/openvino.hpp>
+
+#include "../tensor_memory_pool.hpp"
+
+using namespace ovms;
+
+TEST(TensorMemoryPool, SizeClasses) {
+    EXPECT_EQ(TensorMemoryPool::getSizeClass(4096), 4096);
+    EXPECT_EQ(TensorMemoryPool::getSizeClass(4097), 5120);
+    EXPECT_EQ(TensorMemoryPool::getSizeClass(5000), 5120);
+    EXPECT_EQ(TensorMemoryPool::getSizeClass(6144), 6144);
+    EXPECT_EQ(TensorMemoryPool::getSizeClass(7169), 8192);
+    EXPECT_EQ(TensorMemoryPool::getSizeClass(1000000), 1048576);
+    for (size_t bytes = 5; bytes < 100000; bytes += 37) {
+        size_t sizeClass = TensorMemoryPool::getSizeClass(bytes);
+        EXPECT_GE(sizeClass, bytes);
+        EXPECT_LE(sizeClass, bytes + bytes / 4 + 1);
+    }
+}
+
+TEST(TensorMemoryPool, ReusesReleasedBuffers) {
+    auto pool = std::make_shared<TensorMemoryPool>("test");
+    const size_t size = 100 * 1024;
+    void* first = pool->allocate(size, 16);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % TensorMemoryPool::ALIGNMENT, 0);
+    pool->deallocate(first, size, 16);
+    EXPECT_EQ(pool->getCachedBytes(), TensorMemoryPool::getSizeClass(size));
+    // different size within the same size class
+    void* second = pool->allocate(size + 100, 16);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(pool->getCachedBytes(), 0);
+    EXPECT_EQ(pool->getHits(), 1);
+    EXPECT_EQ(pool->getMisses(), 1);
+    pool->deallocate(second, size + 100, 16);
+}
+
+TEST(TensorMemoryPool, SmallAllocationsBypassPool) {
+    auto pool = std::make_shared<TensorMemoryPool>("test");
+    void* ptr = pool->allocate(64, 16);
+    ASSERT_NE(ptr, nullptr);
+    pool->deallocate(ptr, 64, 16);
+    EXPECT_EQ(pool->getCachedBytes(), 0);
+    EXPECT_EQ(pool->getHits(), 0);
+    EXPECT_EQ(pool->getMisses(), 0);
+}
+
+TEST(TensorMemoryPool, CachedBytesAreBounded) {
+    const size_t size = 64 * 1024;
+    auto pool = std::make_shared<TensorMemoryPool>("test", size);
+    void* first = pool->allocate(size, 16);
+    void* second = pool->allocate(size, 16);
+    pool->deallocate(first, size, 16);
+    pool->deallocate(second, size, 16);
+    EXPECT_EQ(pool->getCachedBytes(), size);
+    pool->clear();
+    EXPECT_EQ(pool->getCachedBytes(), 0);
+}
+
+TEST(TensorMemoryPool, ZeroLimitDisablesPool) {
+    const size_t size = 100 * 1024;
+    auto pool = std::make_shared<TensorMemoryPool>("test", 0);
+    void* ptr = pool->allocate(size, 16);
+    ASSERT_NE(ptr, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % TensorMemoryPool::ALIGNMENT, 0);
+    pool->deallocate(ptr, size, 16);
+    EXPECT_EQ(pool->getCachedBytes(), 0);
+    EXPECT_EQ(pool->getHits(), 0);
+    EXPECT_EQ(pool->getMisses(), 0);
+}
+
+TEST(TensorMemoryPool, TensorsReturnBuffersToPool) {
+    auto pool = std::make_shared<TensorMemoryPool>("test");
+    void* data = nullptr;
+    {
+        ov::Tensor tensor(ov::element::f32, ov::Shape{1, 3, 64, 64}, pool->getAllocator());
+        data = tensor.data();
+        std::memset(data, 0, tensor.get_byte_size());
+    }
+    EXPECT_EQ(pool->getCachedBytes(), TensorMemoryPool::getSizeClass(3 * 64 * 64 * sizeof(float)));
+    ov::Tensor tensor(ov::element::f32, ov::Shape{1, 3, 64, 64}, pool->getAllocator());
+    EXPECT_EQ(tensor.data(), data);
+    EXPECT_EQ(pool->getHits(), 1);
+}
+
+TEST(TensorMemoryPool, TensorsKeepPoolAlive) {
+    auto pool = std::make_shared<TensorMemoryPool>("test");
+    ov::Tensor tensor(ov::element::u8, ov::Shape{1024 * 1024}, pool->getAllocator());
+    std::weak_ptr<TensorMemoryPool> weakPool = pool;
+    pool.reset();
+    EXPECT_FALSE(weakPool.expired());
+    std::memset(tensor.data(), 1, tensor.get_byte_size());
+    tensor = ov::Tensor();
+    EXPECT_TRUE(weakPool.expired());
+}
@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../traffic_capture.hpp"
+#include "test_utils.hpp"
+
+using namespace ovms;
+
+class TrafficCaptureTest : public TestWithTempDir {
+protected:
+    std::string logPath;
+
+    void SetUp() override {
+        TestWithTempDir::SetUp();
+        logPath = directoryPath + "/traffic.log";
+    }
+};
+
+TEST_F(TrafficCaptureTest, WrittenRecordsAreReadBack) {
+    std::vector<TrafficRecord> written{
+        {TrafficApi::KFS, 0, "dummy", std::string("\x01\x00\x02", 3)},
+        {TrafficApi::TFS, 1500, "pipeline", ""},
+        {TrafficApi::KFS, 3000, "", "payload"}};
+    TrafficLogWriter writer;
+    ASSERT_EQ(writer.open(logPath), StatusCode::OK);
+    for (const auto& record : written) {
+        ASSERT_EQ(writer.write(record), StatusCode::OK);
+    }
+    writer.flush();
+
+    std::vector<TrafficRecord> read;
+    ASSERT_EQ(TrafficLogReader::readAll(logPath, read), StatusCode::OK);
+    ASSERT_EQ(read.size(), written.size());
+    for (size_t i = 0; i < written.size(); ++i) {
+        EXPECT_EQ(read[i].api, written[i].api);
+        EXPECT_EQ(read[i].arrivalOffsetUs, written[i].arrivalOffsetUs);
+        EXPECT_EQ(read[i].servableName, written[i].servableName);
+        EXPECT_EQ(read[i].payload, written[i].payload);
+    }
+}
+
+TEST_F(TrafficCaptureTest, TruncatedLogIsReported) {
+    TrafficLogWriter writer;
+    ASSERT_EQ(writer.open(logPath), StatusCode::OK);
+    ASSERT_EQ(writer.write({TrafficApi::KFS, 10, "dummy", "payload"}), StatusCode::OK);
+    writer.flush();
+    std::filesystem::resize_file(logPath, std::filesystem::file_size(logPath) - 1);
+    std::vector<TrafficRecord> records;
+    EXPECT_EQ(TrafficLogReader::readAll(logPath, records), StatusCode::TRAFFIC_LOG_CORRUPTED);
+}
+
+TEST_F(TrafficCaptureTest, OtherFilesAreRejected) {
+    std::ofstream(logPath) << "{\"model_config_list\": []}";
+    std::vector<TrafficRecord> records;
+    EXPECT_EQ(TrafficLogReader::readAll(logPath, records), StatusCode::TRAFFIC_LOG_CORRUPTED);
+    EXPECT_EQ(TrafficLogReader::readAll(directoryPath + "/missing.log", records), StatusCode::FILE_INVALID);
+}
+
+TEST_F(TrafficCaptureTest, EveryNthRequestOfEachServableIsSampled) {
+    TrafficRecorder recorder(logPath, 0.25);
+    ASSERT_EQ(recorder.getSamplingInterval(), 4);
+    std::vector<bool> sampledA, sampledB;
+    for (int i = 0; i < 8; ++i) {
+        sampledA.push_back(recorder.sample("a"));
+        if (i % 2 == 0) {
+            sampledB.push_back(recorder.sample("b"));
+        }
+    }
+    EXPECT_EQ(sampledA, std::vector<bool>({true, false, false, false, true, false, false, false}));
+    EXPECT_EQ(sampledB, std::vector<bool>({true, false, false, false}));
+    EXPECT_EQ(TrafficRecorder(logPath, 1.0).getSamplingInterval(), 1);
+}
+
+TEST_F(TrafficCaptureTest, ServablesAboveCounterLimitShareCounter) {
+    TrafficRecorder recorder(logPath, 0.5, TrafficRecorder::DEFAULT_MAX_QUEUED_RECORDS, 1);
+    std::vector<bool> sampled;
+    for (const std::string name : {"a", "b", "c", "a", "b", "c"}) {
+        sampled.push_back(recorder.sample(name));
+    }
+    // "a" has own counter, "b" and "c" are counted together
+    EXPECT_EQ(sampled, std::vector<bool>({true, true, false, false, true, false}));
+}
+
+TEST_F(TrafficCaptureTest, CapturedRequestsAreReplayable) {
+    {
+        TrafficRecorder recorder(logPath, 0.5);
+        ASSERT_EQ(recorder.start(), StatusCode::OK);
+        for (int i = 0; i < 4; ++i) {
+            KFSRequest request;
+            request.set_model_name("dummy");
+            request.set_id(std::to_string(i));
+            recorder.capture(TrafficApi::KFS, request.model_name(), request);
+        }
+        recorder.stop();
+        EXPECT_EQ(recorder.getCapturedCount(), 2);
+        EXPECT_EQ(recorder.getDroppedCount(), 0);
+    }
+    std::vector<TrafficRecord> records;
+    ASSERT_EQ(TrafficLogReader::readAll(logPath, records), StatusCode::OK);
+    ASSERT_EQ(records.size(), 2);
+    for (size_t i = 0; i < records.size(); ++i) {
+        EXPECT_EQ(records[i].api, TrafficApi::KFS);
+        EXPECT_EQ(records[i].servableName, "dummy");
+        KFSRequest request;
+        ASSERT_TRUE(request.ParseFromString(records[i].payload));
+        EXPECT_EQ(request.id(), std::to_string(i * 2));
+    }
+    EXPECT_LE(records[0].arrivalOffsetUs, records[1].arrivalOffsetUs);
+}
+
+TEST_F(TrafficCaptureTest, RequestsAreDroppedWhenQueueIsFull) {
+    TrafficRecorder recorder(logPath, 1.0, 0);
+    ASSERT_EQ(recorder.start(), StatusCode::OK);
+    KFSRequest request;
+    request.set_model_name("dummy");
+    recorder.capture(TrafficApi::KFS, request.model_name(), request);
+    recorder.stop();
+    EXPECT_EQ(recorder.getCapturedCount(), 0);
+    EXPECT_EQ(recorder.getDroppedCount(), 1);
+}
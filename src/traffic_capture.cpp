@@ -0,0 +1,262 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "traffic_capture.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include <google/protobuf/message.h>
+
+#include "logging.hpp"
+
+namespace ovms {
+
+const char TRAFFIC_LOG_MAGIC[8] = {'O', 'V', 'M', 'S', 'T', 'R', 'A', 'F'};
+
+// servable names and payloads above these sizes are considered corrupted log
+static const size_t MAX_SERVABLE_NAME_SIZE = std::numeric_limits<uint16_t>::max();
+static const size_t MAX_PAYLOAD_SIZE = std::numeric_limits<uint32_t>::max();
+
+template <typename T>
+static void writeValue(std::ofstream& file, T value) {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readValue(std::ifstream& file, T& value) {
+    return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+Status TrafficLogWriter::open(const std::string& path) {
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        SPDLOG_ERROR("Could not open traffic capture file: {}", path);
+        return StatusCode::FILE_INVALID;
+    }
+    file.write(TRAFFIC_LOG_MAGIC, sizeof(TRAFFIC_LOG_MAGIC));
+    writeValue(file, TRAFFIC_LOG_VERSION);
+    return file ? StatusCode::OK : StatusCode::FILE_INVALID;
+}
+
+Status TrafficLogWriter::write(const TrafficRecord& record) {
+    if (record.servableName.size() > MAX_SERVABLE_NAME_SIZE || record.payload.size() > MAX_PAYLOAD_SIZE) {
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    writeValue(file, static_cast<uint8_t>(record.api));
+    writeValue(file, record.arrivalOffsetUs);
+    writeValue(file, static_cast<uint16_t>(record.servableName.size()));
+    file.write(record.servableName.data(), record.servableName.size());
+    writeValue(file, static_cast<uint32_t>(record.payload.size()));
+    file.write(record.payload.data(), record.payload.size());
+    return file ? StatusCode::OK : StatusCode::FILE_INVALID;
+}
+
+void TrafficLogWriter::flush() {
+    file.flush();
+}
+
+Status TrafficLogReader::open(const std::string& path) {
+    file.open(path, std::ios::binary);
+    if (!file.is_open()) {
+        SPDLOG_ERROR("Could not open traffic log file: {}", path);
+        return StatusCode::FILE_INVALID;
+    }
+    char magic[sizeof(TRAFFIC_LOG_MAGIC)];
+    uint32_t version = 0;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, TRAFFIC_LOG_MAGIC, sizeof(magic)) != 0 || !readValue(file, version)) {
+        SPDLOG_ERROR("File: {} is not a traffic log", path);
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    if (version != TRAFFIC_LOG_VERSION) {
+        SPDLOG_ERROR("Traffic log: {} version: {} is not supported, expected: {}", path, version, TRAFFIC_LOG_VERSION);
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    return StatusCode::OK;
+}
+
+Status TrafficLogReader::read(TrafficRecord& record, bool& endOfLog) {
+    uint8_t api = 0;
+    endOfLog = false;
+    if (!readValue(file, api)) {
+        endOfLog = true;
+        return StatusCode::OK;
+    }
+    if (api != static_cast<uint8_t>(TrafficApi::KFS) && api != static_cast<uint8_t>(TrafficApi::TFS)) {
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    record.api = static_cast<TrafficApi>(api);
+    uint16_t nameSize = 0;
+    if (!readValue(file, record.arrivalOffsetUs) || !readValue(file, nameSize)) {
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    record.servableName.resize(nameSize);
+    if (!file.read(record.servableName.data(), nameSize)) {
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    uint32_t payloadSize = 0;
+    if (!readValue(file, payloadSize)) {
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    record.payload.resize(payloadSize);
+    if (!file.read(record.payload.data(), payloadSize)) {
+        return StatusCode::TRAFFIC_LOG_CORRUPTED;
+    }
+    return StatusCode::OK;
+}
+
+Status TrafficLogReader::readAll(const std::string& path, std::vector<TrafficRecord>& records) {
+    TrafficLogReader reader;
+    auto status = reader.open(path);
+    if (!status.ok()) {
+        return status;
+    }
+    while (true) {
+        TrafficRecord record;
+        bool endOfLog = false;
+        status = reader.read(record, endOfLog);
+        if (!status.ok()) {
+            SPDLOG_ERROR("Traffic log: {} is corrupted after record: {}", path, records.size());
+            return status;
+        }
+        if (endOfLog) {
+            return StatusCode::OK;
+        }
+        records.emplace_back(std::move(record));
+    }
+}
+
+static uint32_t computeSamplingInterval(double ratio) {
+    if (ratio <= 0 || ratio >= 1) {
+        return 1;
+    }
+    return static_cast<uint32_t>(std::max(1.0, std::round(1 / ratio)));
+}
+
+TrafficRecorder::TrafficRecorder(const std::string& path, double ratio, size_t maxQueuedRecords, size_t maxServableCounters) :
+    path(path),
+    samplingInterval(computeSamplingInterval(ratio)),
+    maxQueuedRecords(maxQueuedRecords),
+    maxServableCounters(maxServableCounters),
+    captureStart(clock::now()) {}
+
+TrafficRecorder::~TrafficRecorder() {
+    stop();
+}
+
+Status TrafficRecorder::start() {
+    auto status = writer.open(path);
+    if (!status.ok()) {
+        return status;
+    }
+    SPDLOG_INFO("Capturing every {} request of each servable to traffic log: {}", samplingInterval, path);
+    writerThread = std::thread(&TrafficRecorder::writerRoutine, this);
+    return StatusCode::OK;
+}
+
+void TrafficRecorder::stop() {
+    {
+        std::unique_lock<std::mutex> lock(queueMtx);
+        stopRequested = true;
+    }
+    queueCv.notify_one();
+    if (writerThread.joinable()) {
+        writerThread.join();
+        SPDLOG_INFO("Traffic capture finished. Captured requests: {}; dropped: {}", getCapturedCount(), getDroppedCount());
+    }
+}
+
+bool TrafficRecorder::sample(const std::string& servableName) {
+    {
+        std::shared_lock<std::shared_mutex> lock(countersMtx);
+        auto it = servableCounters.find(servableName);
+        if (it != servableCounters.end()) {
+            return it->second->fetch_add(1, std::memory_order_relaxed) % samplingInterval == 0;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(countersMtx);
+    auto it = servableCounters.find(servableName);
+    if (it == servableCounters.end()) {
+        if (servableCounters.size() >= maxServableCounters) {
+            return overflowCounter.fetch_add(1, std::memory_order_relaxed) % samplingInterval == 0;
+        }
+        it = servableCounters.emplace(servableName, std::make_unique<std::atomic<uint64_t>>(0)).first;
+    }
+    return it->second->fetch_add(1, std::memory_order_relaxed) % samplingInterval == 0;
+}
+
+void TrafficRecorder::capture(TrafficApi api, const std::string& servableName, const google::protobuf::Message& request) {
+    const auto arrival = clock::now();
+    if (!sample(servableName)) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(queueMtx);
+        if (stopRequested || queue.size() >= maxQueuedRecords) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    TrafficRecord record;
+    record.api = api;
+    record.arrivalOffsetUs = std::chrono::duration_cast<std::chrono::microseconds>(arrival - captureStart).count();
+    record.servableName = servableName;
+    if (!request.SerializeToString(&record.payload)) {
+        SPDLOG_DEBUG("Could not serialize request of servable: {} for traffic capture", servableName);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(queueMtx);
+        if (stopRequested || queue.size() >= maxQueuedRecords) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        queue.emplace_back(std::move(record));
+    }
+    queueCv.notify_one();
+}
+
+void TrafficRecorder::writerRoutine() {
+    std::deque<TrafficRecord> batch;
+    bool writeFailed = false;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(queueMtx);
+            queueCv.wait(lock, [this] { return stopRequested || !queue.empty(); });
+            if (queue.empty()) {
+                break;
+            }
+            batch.swap(queue);
+        }
+        for (const auto& record : batch) {
+            if (writeFailed || !writer.write(record).ok()) {
+                if (!writeFailed) {
+                    SPDLOG_ERROR("Writing to traffic capture file: {} failed, further requests will be dropped", path);
+                    writeFailed = true;
+                }
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            captured.fetch_add(1, std::memory_order_relaxed);
+        }
+        batch.clear();
+        writer.flush();
+    }
+}
+}  // namespace ovms
@@ -0,0 +1,146 @@
+//*****************************************************************************
+// Copyright 2023 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "status.hpp"
+
+namespace google::protobuf {
+class Message;
+}  // namespace google::protobuf
+
+namespace ovms {
+
+extern const char TRAFFIC_LOG_MAGIC[8];
+const uint32_t TRAFFIC_LOG_VERSION = 1;
+
+enum class TrafficApi : uint8_t {
+    KFS = 1,
+    TFS = 2
+};
+
+/**
+ * @brief Single captured request.
+ *
+ * Payload holds serialized ModelInferRequest (KFS) or PredictRequest (TFS) proto.
+ */
+struct TrafficRecord {
+    TrafficApi api = TrafficApi::KFS;
+    // time since capture start
+    uint64_t arrivalOffsetUs = 0;
+    std::string servableName;
+    std::string payload;
+};
+
+/**
+ * @brief Writes traffic log: file header followed by length prefixed records.
+ *
+ * Integers are stored in host byte order, logs are meant to be replayed on the same architecture.
+ */
+class TrafficLogWriter {
+    std::ofstream file;
+
+public:
+    Status open(const std::string& path);
+    Status write(const TrafficRecord& record);
+    void flush();
+};
+
+class TrafficLogReader {
+    std::ifstream file;
+
+public:
+    Status open(const std::string& path);
+    /**
+     * @brief Reads next record, endOfLog is set when there are no more records.
+     *
+     * @return TRAFFIC_LOG_CORRUPTED on truncated or malformed record
+     */
+    Status read(TrafficRecord& record, bool& endOfLog);
+
+    static Status readAll(const std::string& path, std::vector<TrafficRecord>& records);
+};
+
+/**
+ * @brief Samples incoming inference requests per servable and writes them to traffic log.
+ *
+ * Every n-th request of each servable is captured, where n is derived from capture ratio,
+ * so the capture is deterministic for given order of requests. Requests are serialized on
+ * the calling thread and written by background thread. When writer does not keep up and
+ * queue is full, captured requests are dropped instead of blocking inference.
+ * Servable names come from requests, so the number of per servable counters is limited;
+ * requests of servables above the limit share one counter.
+ */
+class TrafficRecorder {
+public:
+    using clock = std::chrono::steady_clock;
+    static constexpr size_t DEFAULT_MAX_QUEUED_RECORDS = 1024;
+    static constexpr size_t DEFAULT_MAX_SERVABLE_COUNTERS = 1024;
+
+    TrafficRecorder(const std::string& path, double ratio, size_t maxQueuedRecords = DEFAULT_MAX_QUEUED_RECORDS, size_t maxServableCounters = DEFAULT_MAX_SERVABLE_COUNTERS);
+    ~TrafficRecorder();
+
+    Status start();
+    void stop();
+
+    /**
+     * @brief Decides whether next request of the servable is captured.
+     */
+    bool sample(const std::string& servableName);
+    void capture(TrafficApi api, const std::string& servableName, const google::protobuf::Message& request);
+
+    uint32_t getSamplingInterval() const { return samplingInterval; }
+    uint64_t getCapturedCount() const { return captured.load(std::memory_order_relaxed); }
+    uint64_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    void writerRoutine();
+
+    const std::string path;
+    const uint32_t samplingInterval;
+    const size_t maxQueuedRecords;
+    const size_t maxServableCounters;
+    const clock::time_point captureStart;
+
+    std::shared_mutex countersMtx;
+    std::unordered_map<std::string, std::unique_ptr<std::atomic<uint64_t>>> servableCounters;
+    std::atomic<uint64_t> overflowCounter{0};
+
+    std::mutex queueMtx;
+    std::condition_variable queueCv;
+    std::deque<TrafficRecord> queue;
+    bool stopRequested = false;
+
+    TrafficLogWriter writer;
+    std::thread writerThread;
+
+    std::atomic<uint64_t> captured{0};
+    std::atomic<uint64_t> dropped{0};
+};
+}  // namespace ovms